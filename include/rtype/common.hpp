@@ -5,6 +5,8 @@
 #pragma once
 
 #include <Logger/Logger.hpp>
+#include <LockFreeQueue/MpscQueue.hpp>
+#include <LockFreeQueue/SpscQueue.hpp>
 #include <SafeQueue/SafeQueue.hpp>
 #include <Types.hpp>
 #include <Config/TomlParser.hpp>
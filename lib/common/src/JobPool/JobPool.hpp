@@ -0,0 +1,210 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** JobPool - Persistent worker threads running chunked parallel loops
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rtype {
+
+/**
+ * @brief Fixed set of worker threads for fork-join loops inside a tick
+ *
+ * Spawning threads per call (as ECS::ParallelView does) costs more than a
+ * typical per-tick workload, so the workers here are started once and
+ * parked on a condition variable between jobs. parallelFor() splits a
+ * range into fixed-size chunks; workers and the calling thread claim
+ * chunks from a shared atomic cursor until none are left, and the call
+ * returns once every chunk has run.
+ *
+ * Chunk boundaries only depend on (count, chunkSize), never on the number
+ * of workers or on scheduling, so a caller that writes per-chunk output
+ * and reads it back in chunk order gets the same result on any machine.
+ *
+ * Thread-safety: parallelFor() must not be called concurrently or from
+ * inside a job. Construction and destruction from the owning thread only.
+ */
+class JobPool {
+   public:
+    /**
+     * @brief Starts the workers
+     * @param workerCount Background threads; 0 runs every job inline
+     */
+    explicit JobPool(std::size_t workerCount = defaultWorkerCount()) {
+        _workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i) {
+            _workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~JobPool() {
+        {
+            std::lock_guard lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+    JobPool(JobPool&&) = delete;
+    JobPool& operator=(JobPool&&) = delete;
+
+    /**
+     * @brief One worker per hardware thread, minus the calling thread
+     */
+    [[nodiscard]] static std::size_t defaultWorkerCount() noexcept {
+        const unsigned int hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+    /**
+     * @brief Number of chunks parallelFor() splits a range into
+     */
+    [[nodiscard]] static constexpr std::size_t chunkCount(
+        std::size_t count, std::size_t chunkSize) noexcept {
+        return chunkSize == 0 ? 0 : (count + chunkSize - 1) / chunkSize;
+    }
+
+    /**
+     * @brief Background threads (the caller of parallelFor() also works)
+     */
+    [[nodiscard]] std::size_t workerCount() const noexcept {
+        return _workers.size();
+    }
+
+    /**
+     * @brief Runs fn(chunk, begin, end) over [0, count) and waits for it
+     *
+     * @param count Size of the range
+     * @param chunkSize Items per chunk (the last one may be shorter)
+     * @param fn Called once per chunk, possibly from several threads
+     *
+     * The first exception thrown by fn is rethrown here once every chunk
+     * has finished or been skipped.
+     */
+    template <typename Fn>
+    void parallelFor(std::size_t count, std::size_t chunkSize, Fn&& fn) {
+        using Func = std::remove_reference_t<Fn>;
+        const std::size_t chunks = chunkCount(count, chunkSize);
+        if (chunks == 0) {
+            return;
+        }
+        if (chunks == 1 || _workers.empty()) {
+            for (std::size_t c = 0; c < chunks; ++c) {
+                const std::size_t begin = c * chunkSize;
+                fn(c, begin, std::min(count, begin + chunkSize));
+            }
+            return;
+        }
+
+        Job job;
+        job.context = static_cast<void*>(std::addressof(fn));
+        job.run = [](void* context, std::size_t chunk, std::size_t begin,
+                     std::size_t end) {
+            (*static_cast<Func*>(context))(chunk, begin, end);
+        };
+        job.count = count;
+        job.chunkSize = chunkSize;
+        job.chunks = chunks;
+        {
+            std::lock_guard lock(_mutex);
+            _job = job;
+            _error = nullptr;
+            _nextChunk.store(0, std::memory_order_relaxed);
+            ++_generation;
+        }
+        _wake.notify_all();
+
+        drain(job);
+
+        std::unique_lock lock(_mutex);
+        _done.wait(lock, [this] { return _busy == 0; });
+        _job = Job{};
+        if (_error) {
+            std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+    }
+
+   private:
+    struct Job {
+        void* context = nullptr;
+        void (*run)(void*, std::size_t, std::size_t, std::size_t) = nullptr;
+        std::size_t count = 0;
+        std::size_t chunkSize = 0;
+        std::size_t chunks = 0;
+    };
+
+    /// Claims and runs chunks until the cursor passes the last one
+    void drain(const Job& job) {
+        for (;;) {
+            const std::size_t chunk =
+                _nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= job.chunks) {
+                return;
+            }
+            const std::size_t begin = chunk * job.chunkSize;
+            try {
+                job.run(job.context, chunk, begin,
+                        std::min(job.count, begin + job.chunkSize));
+            } catch (...) {
+                std::lock_guard lock(_mutex);
+                if (!_error) {
+                    _error = std::current_exception();
+                }
+                // Skip what is left, the call is failing anyway
+                _nextChunk.store(job.chunks, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void workerLoop() {
+        std::uint64_t seen = 0;
+        std::unique_lock lock(_mutex);
+        for (;;) {
+            _wake.wait(lock, [&] { return _stop || _generation != seen; });
+            if (_stop) {
+                return;
+            }
+            seen = _generation;
+            const Job job = _job;
+            ++_busy;
+            lock.unlock();
+            drain(job);
+            lock.lock();
+            if (--_busy == 0) {
+                _done.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    Job _job;                      ///< Guarded by _mutex
+    std::uint64_t _generation{0};  ///< Bumped per parallelFor(), _mutex
+    std::size_t _busy{0};          ///< Workers inside drain(), _mutex
+    std::exception_ptr _error;     ///< First failure, _mutex
+    std::atomic<std::size_t> _nextChunk{0};
+    bool _stop{false};
+};
+
+}  // namespace rtype
@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** CacheLine - Cache line size used to pad shared atomics
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace rtype {
+
+/**
+ * @brief Cache line size assumed when padding data touched by several threads
+ *
+ * std::hardware_destructive_interference_size is not reliably available (and
+ * GCC warns about using it in headers), 64 bytes matches every x86-64 and
+ * most ARM cores we ship to.
+ */
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * @brief Round a requested queue capacity up to a power of two (minimum 2)
+ */
+[[nodiscard]] constexpr std::size_t roundUpToPowerOfTwo(
+    std::size_t value) noexcept {
+    std::size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace rtype
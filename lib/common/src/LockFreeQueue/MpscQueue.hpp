@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** MpscQueue - Bounded lock-free multi-producer single-consumer ring
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Bounded lock-free queue for many producers and one consumer
+ *
+ * Dmitry Vyukov's bounded queue: every slot carries a sequence number that
+ * tells producers whether it is free and the consumer whether it is filled.
+ * Producers claim a slot with one CAS on the shared tail; the single
+ * consumer needs no read-modify-write at all.
+ *
+ * Elements from a given producer are popped in the order it pushed them;
+ * elements from different producers interleave by claim order.
+ *
+ * Thread-safety: tryPush/tryEmplace from any thread, tryPop/popAll from one
+ * thread. size()/empty() are approximate.
+ *
+ * @tparam T Element type, must be nothrow move constructible
+ */
+template <typename T>
+class MpscQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MpscQueue requires a nothrow move constructible T");
+
+   public:
+    /**
+     * @param capacity Minimum number of elements, rounded to a power of two
+     */
+    explicit MpscQueue(std::size_t capacity)
+        : capacity_(roundUpToPowerOfTwo(capacity)),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<Slot[]>(capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscQueue() {
+        while (tryPop()) {
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    /**
+     * @brief Construct an element in place
+     * @return false if the queue is full (nothing is constructed)
+     */
+    template <typename... Args>
+    [[nodiscard]] bool tryEmplace(Args&&... args) {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            const std::size_t seq =
+                slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) -
+                              static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (slot->storage) T(std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] bool tryPush(const T& item) { return tryEmplace(item); }
+
+    [[nodiscard]] bool tryPush(T&& item) { return tryEmplace(std::move(item)); }
+
+    /**
+     * @brief Pop the oldest fully published element
+     * @return The element, or nullopt if none is ready
+     */
+    [[nodiscard]] std::optional<T> tryPop() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+            return std::nullopt;
+        }
+        T* item = slot.get();
+        std::optional<T> result(std::move(*item));
+        item->~T();
+        slot.sequence.store(head + capacity_, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Move up to out.size() ready elements into out, oldest first
+     *
+     * Stops at the first slot a producer has claimed but not yet published.
+     *
+     * @return Number of elements written to out
+     */
+    std::size_t popAll(std::span<T> out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t count = 0;
+        while (count < out.size()) {
+            Slot& slot = slots_[(head + count) & mask_];
+            if (slot.sequence.load(std::memory_order_acquire) !=
+                head + count + 1) {
+                break;
+            }
+            T* item = slot.get();
+            out[count] = std::move(*item);
+            item->~T();
+            slot.sequence.store(head + count + capacity_,
+                                std::memory_order_release);
+            ++count;
+        }
+        if (count > 0) {
+            head_.store(head + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /// Approximate number of queued elements (claimed slots included)
+    [[nodiscard]] std::size_t size() const noexcept {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+   private:
+    struct alignas(kCacheLineSize) Slot {
+        std::atomic<std::size_t> sequence{0};
+        alignas(T) std::byte storage[sizeof(T)];
+
+        [[nodiscard]] T* get() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    /// Shared by all producers
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+
+    /// Written by the consumer only, read by size()
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+};
+
+}  // namespace rtype
@@ -0,0 +1,164 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** SpscQueue - Bounded lock-free single-producer single-consumer ring
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer and one consumer
+ *
+ * Replacement for SafeQueue on a thread handoff where each side is a single
+ * thread (e.g. network thread -> game thread). Push and pop never block or
+ * allocate; push fails when the ring is full so the producer decides whether
+ * to drop or retry.
+ *
+ * Head and tail live on separate cache lines, and each side keeps a cached
+ * copy of the other side's index so the shared atomic is only re-read when
+ * the ring looks full (producer) or empty (consumer).
+ *
+ * Thread-safety: push/tryEmplace from one thread, tryPop/popAll from one
+ * (other) thread. size()/empty() are approximate from any thread.
+ *
+ * @tparam T Element type, must be nothrow move constructible
+ */
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "SpscQueue requires a nothrow move constructible T");
+
+   public:
+    /**
+     * @param capacity Minimum number of elements, rounded to a power of two
+     */
+    explicit SpscQueue(std::size_t capacity)
+        : capacity_(roundUpToPowerOfTwo(capacity)),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<Slot[]>(capacity_)) {}
+
+    ~SpscQueue() {
+        while (tryPop()) {
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+
+    /**
+     * @brief Construct an element in place
+     * @return false if the queue is full (nothing is constructed)
+     */
+    template <typename... Args>
+    [[nodiscard]] bool tryEmplace(Args&&... args) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == capacity_) {
+                return false;
+            }
+        }
+        ::new (slots_[tail & mask_].storage) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] bool tryPush(const T& item) { return tryEmplace(item); }
+
+    [[nodiscard]] bool tryPush(T&& item) { return tryEmplace(std::move(item)); }
+
+    /**
+     * @brief Pop the oldest element
+     * @return The element, or nullopt if the queue is empty
+     */
+    [[nodiscard]] std::optional<T> tryPop() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return std::nullopt;
+            }
+        }
+        T* item = slots_[head & mask_].get();
+        std::optional<T> result(std::move(*item));
+        item->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Move up to out.size() elements into out, oldest first
+     *
+     * Publishes the consumed slots with a single store, so draining a batch
+     * costs one synchronization instead of one per element.
+     *
+     * @return Number of elements written to out
+     */
+    std::size_t popAll(std::span<T> out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        std::size_t count = cachedTail_ - head;
+        if (count > out.size()) {
+            count = out.size();
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            T* item = slots_[(head + i) & mask_].get();
+            out[i] = std::move(*item);
+            item->~T();
+        }
+        if (count > 0) {
+            head_.store(head + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /// Approximate number of queued elements
+    [[nodiscard]] std::size_t size() const noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+   private:
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+
+        [[nodiscard]] T* get() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    /// Consumer side: next slot to read, and last tail it observed
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+    std::size_t cachedTail_{0};
+
+    /// Producer side: next slot to write, and last head it observed
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+    std::size_t cachedHead_{0};
+};
+
+}  // namespace rtype
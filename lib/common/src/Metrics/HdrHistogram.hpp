@@ -0,0 +1,168 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** HdrHistogram - Lock-free log-linear histogram
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace rtype {
+
+/**
+ * @brief Lock-free histogram with bounded relative error over the full
+ *        uint64 range
+ *
+ * Same layout idea as HdrHistogram: values under 16 get one bucket each,
+ * every power of two above is split into 8 linear sub-buckets, so any
+ * recorded value is known within 12.5% whatever its magnitude. 496
+ * buckets cover 0 to 2^64 - 1 without configuration; the unit (ns, bytes,
+ * packets) is up to the caller.
+ *
+ * Recording is a few relaxed atomic adds, cheap enough for every packet
+ * or tick; readers see a consistent-enough view for monitoring.
+ *
+ * Thread-safety: all methods from any thread.
+ */
+class HdrHistogram {
+   public:
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr std::uint64_t kSubBuckets = 1U << kSubBucketBits;
+    static constexpr std::size_t kBucketCount =
+        (64 - kSubBucketBits) * kSubBuckets + kSubBuckets;
+
+    void record(std::uint64_t value, std::uint64_t count = 1) noexcept {
+        _buckets[bucketIndex(value)].fetch_add(count,
+                                               std::memory_order_relaxed);
+        _count.fetch_add(count, std::memory_order_relaxed);
+        _sum.fetch_add(value * count, std::memory_order_relaxed);
+
+        std::uint64_t max = _max.load(std::memory_order_relaxed);
+        while (value > max && !_max.compare_exchange_weak(
+                                  max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t sum() const noexcept {
+        return _sum.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t max() const noexcept {
+        return _max.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t mean() const noexcept {
+        const std::uint64_t samples = count();
+        return samples == 0 ? 0 : sum() / samples;
+    }
+
+    /**
+     * @brief Highest value equivalent to the given quantile
+     * @param quantile In [0, 1], e.g. 0.99
+     * @return 0 without samples
+     */
+    [[nodiscard]] std::uint64_t percentile(double quantile) const noexcept {
+        const std::uint64_t samples = count();
+        if (samples == 0) {
+            return 0;
+        }
+        const auto rank = static_cast<std::uint64_t>(
+            std::clamp(quantile, 0.0, 1.0) * static_cast<double>(samples));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += _buckets[i].load(std::memory_order_relaxed);
+            if (seen > rank || seen >= samples) {
+                return std::min(bucketUpperBound(i) - 1, max());
+            }
+        }
+        return max();
+    }
+
+    /**
+     * @brief Samples recorded below @p bound
+     *
+     * Exact when @p bound is a bucket boundary: any value up to 16 and
+     * every power of two are.
+     */
+    [[nodiscard]] std::uint64_t countBelow(std::uint64_t bound) const noexcept {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < kBucketCount && bucketLowerBound(i) < bound;
+             ++i) {
+            total += _buckets[i].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Samples recorded at or below @p bound, as Prometheus `le` wants
+     *
+     * Exact for any bound under 16. Above, the bucket starting at @p bound
+     * is counted whole, so samples up to 12.5% over it are included.
+     */
+    [[nodiscard]] std::uint64_t countAtOrBelow(
+        std::uint64_t bound) const noexcept {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0;
+             i < kBucketCount && bucketLowerBound(i) <= bound; ++i) {
+            total += _buckets[i].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() noexcept {
+        for (auto& bucket : _buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        _count.store(0, std::memory_order_relaxed);
+        _sum.store(0, std::memory_order_relaxed);
+        _max.store(0, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static constexpr std::size_t bucketIndex(
+        std::uint64_t value) noexcept {
+        if (value < 2 * kSubBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+        const auto shift =
+            static_cast<unsigned>(std::bit_width(value)) - 1 - kSubBucketBits;
+        return static_cast<std::size_t>(shift * kSubBuckets +
+                                        (value >> shift));
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t bucketLowerBound(
+        std::size_t index) noexcept {
+        if (index < 2 * kSubBuckets) {
+            return index;
+        }
+        const auto shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+        return (index % kSubBuckets + kSubBuckets) << shift;
+    }
+
+    /// Exclusive, saturated at the uint64 maximum for the last bucket
+    [[nodiscard]] static constexpr std::uint64_t bucketUpperBound(
+        std::size_t index) noexcept {
+        return index + 1 < kBucketCount
+                   ? bucketLowerBound(index + 1)
+                   : std::numeric_limits<std::uint64_t>::max();
+    }
+
+   private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> _buckets{};
+    std::atomic<std::uint64_t> _count{0};
+    std::atomic<std::uint64_t> _sum{0};
+    std::atomic<std::uint64_t> _max{0};
+};
+
+}  // namespace rtype
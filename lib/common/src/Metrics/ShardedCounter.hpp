@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** ShardedCounter - Counter split across cache lines to avoid contention
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "LockFreeQueue/CacheLine.hpp"
+
+namespace rtype {
+
+/**
+ * @brief Monotonic counter incremented from many threads
+ *
+ * A plain std::atomic counter bounces its cache line between every thread
+ * that increments it (I/O thread, game thread, frontend...). Here each
+ * thread adds to its own cache-line-sized shard, picked once per thread,
+ * and readers sum the shards. Increments are a single uncontended relaxed
+ * add; reads are rare (metrics export) and cost kShards loads.
+ *
+ * Mirrors the std::atomic calls the server metrics already use (load,
+ * store, fetch_add) so it can replace one in place.
+ *
+ * Thread-safety: all methods from any thread. store() is not atomic with
+ * respect to concurrent increments; it is meant for resets and tests.
+ */
+class ShardedCounter {
+   public:
+    static constexpr std::size_t kShards = 16;
+
+    void fetch_add(
+        std::uint64_t value,
+        std::memory_order order = std::memory_order_relaxed) noexcept {
+        _shards[shardIndex()].value.fetch_add(value, order);
+    }
+
+    [[nodiscard]] std::uint64_t load(
+        std::memory_order order = std::memory_order_relaxed) const noexcept {
+        std::uint64_t total = 0;
+        for (const auto& shard : _shards) {
+            total += shard.value.load(order);
+        }
+        return total;
+    }
+
+    void store(std::uint64_t value,
+               std::memory_order order = std::memory_order_relaxed) noexcept {
+        _shards[0].value.store(value, order);
+        for (std::size_t i = 1; i < kShards; ++i) {
+            _shards[i].value.store(0, order);
+        }
+    }
+
+    operator std::uint64_t() const noexcept { return load(); }  // NOLINT
+
+   private:
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<std::uint64_t> value{0};
+    };
+
+    /// Threads get shards round-robin, so the first kShards never collide
+    [[nodiscard]] static std::size_t shardIndex() noexcept {
+        static std::atomic<std::size_t> nextThread{0};
+        thread_local const std::size_t index =
+            nextThread.fetch_add(1, std::memory_order_relaxed) % kShards;
+        return index;
+    }
+
+    std::array<Shard, kShards> _shards{};
+};
+
+}  // namespace rtype
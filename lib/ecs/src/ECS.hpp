@@ -10,6 +10,7 @@
 
 #include "core/CommandBuffer.hpp"
 #include "core/Entity.hpp"
+#include "core/EntityPool.hpp"
 #include "core/Prefab.hpp"
 #include "core/Registry/Registry.hpp"
 #include "core/Relationship.hpp"
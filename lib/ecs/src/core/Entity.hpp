@@ -61,6 +61,15 @@ struct Entity {
     auto operator<=>(const Entity&) const noexcept = default;
 };
 
+/**
+ * @brief Tag for entities parked by an EntityPool.
+ *
+ * Views, parallel views and groups skip entities carrying this tag unless
+ * Inactive is one of the requested components. The entity stays alive and
+ * keeps its other components, so reactivating it is just removing the tag.
+ */
+struct Inactive {};
+
 }  // namespace ECS
 
 namespace std {
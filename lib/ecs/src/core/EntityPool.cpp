@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2026
+** R-Type
+** File description:
+** EntityPool
+*/
+
+#include "EntityPool.hpp"
+
+#include <utility>
+
+#include "Registry/Registry.hpp"
+
+namespace ECS {
+
+EntityPool::EntityPool(PrefabFunc prefab)
+    : _prefab(std::move(prefab)),
+      _freeList(std::make_shared<std::vector<Entity>>()) {}
+
+void EntityPool::prewarm(Registry& registry, size_t count) {
+    _freeList->reserve(count);
+    while (_freeList->size() < count) {
+        park(registry, create(registry), *_freeList);
+    }
+}
+
+auto EntityPool::acquire(Registry& registry) -> Entity {
+    while (!_freeList->empty()) {
+        Entity entity = _freeList->back();
+        _freeList->pop_back();
+        // Skip entities killed behind the pool's back (registry cleared...)
+        if (registry.isAlive(entity) &&
+            registry.hasComponent<Inactive>(entity)) {
+            registry.removeComponent<Inactive>(entity);
+            return entity;
+        }
+    }
+    return create(registry);
+}
+
+void EntityPool::release(Registry& registry, Entity entity) {
+    park(registry, entity, *_freeList);
+}
+
+void EntityPool::despawn(Registry& registry, Entity entity) {
+    if (!registry.isAlive(entity)) {
+        return;
+    }
+    if (registry.hasComponent<Pooled>(entity)) {
+        auto freeList = registry.getComponent<Pooled>(entity).freeList.lock();
+        if (freeList) {
+            park(registry, entity, *freeList);
+            return;
+        }
+    }
+    registry.killEntity(entity);
+}
+
+void EntityPool::clear(Registry& registry) {
+    for (auto entity : *_freeList) {
+        registry.killEntity(entity);
+    }
+    _freeList->clear();
+}
+
+auto EntityPool::create(Registry& registry) -> Entity {
+    auto entity = registry.spawnEntity();
+    if (_prefab) {
+        _prefab(registry, entity);
+    }
+    registry.emplaceComponent<Pooled>(entity, Pooled{_freeList});
+    ++_created;
+    return entity;
+}
+
+void EntityPool::park(Registry& registry, Entity entity,
+                      std::vector<Entity>& freeList) {
+    if (!registry.isAlive(entity) || registry.hasComponent<Inactive>(entity)) {
+        return;
+    }
+    registry.emplaceComponent<Inactive>(entity);
+    freeList.push_back(entity);
+}
+
+}  // namespace ECS
@@ -0,0 +1,134 @@
+/*
+** EPITECH PROJECT, 2026
+** R-Type
+** File description:
+** EntityPool - Recycled entities for high-churn prefabs
+*/
+
+#ifndef SRC_ENGINE_ECS_CORE_ENTITYPOOL_HPP_
+#define SRC_ENGINE_ECS_CORE_ENTITYPOOL_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Entity.hpp"
+
+namespace ECS {
+
+class Registry;
+
+/**
+ * @brief Links a pooled entity back to the free list of its pool.
+ *
+ * Expires with the pool, after which EntityPool::despawn() falls back to
+ * killing the entity.
+ */
+struct Pooled {
+    std::weak_ptr<std::vector<Entity>> freeList;
+};
+
+/**
+ * @brief Keeps deactivated entities of one prefab around for reuse.
+ *
+ * Bullets, explosions and pickups are spawned and destroyed by the hundred
+ * per second. Creating a fresh entity and emplacing every component each
+ * time costs allocations in every pool it touches; recycling keeps the
+ * entity, its slot in each component pool and its component storage, and
+ * only toggles the Inactive tag that views skip.
+ *
+ * acquire() returns an active entity. It still holds the components of its
+ * previous life, so callers overwrite what they use (emplaceComponent on
+ * an existing component is an in-place assignment) and remove optional
+ * components they do not want. release() (or despawn() when the owning
+ * pool is not at hand) parks it again.
+ *
+ * A released entity keeps its handle: code holding on to it after release
+ * sees it alive and may later see it reused. Release only from the place
+ * that would otherwise have killed it.
+ *
+ * Example:
+ *   EntityPool bullets([](Registry& r, Entity e) {
+ *       r.emplaceComponent<Position>(e, 0.0f, 0.0f);
+ *       r.emplaceComponent<Velocity>(e, 0.0f, 0.0f);
+ *   });
+ *   bullets.prewarm(registry, 256);
+ *   auto bullet = bullets.acquire(registry);
+ *   registry.emplaceComponent<Position>(bullet, x, y);
+ *   // ...
+ *   EntityPool::despawn(registry, bullet);
+ *
+ * Not thread-safe: use it from the thread that mutates the registry.
+ */
+class EntityPool {
+   public:
+    using PrefabFunc = std::function<void(Registry&, Entity)>;
+
+    /**
+     * @brief Creates an empty pool.
+     * @param prefab Components every entity of the pool starts with
+     */
+    explicit EntityPool(PrefabFunc prefab);
+
+    /**
+     * @brief Creates parked entities until at least count are available.
+     * @param registry Registry owning the entities
+     * @param count Entities to keep ready
+     */
+    void prewarm(Registry& registry, size_t count);
+
+    /**
+     * @brief Takes a parked entity, or creates one if none is left.
+     * @param registry Registry owning the entities
+     * @return Active entity carrying the prefab's components
+     */
+    auto acquire(Registry& registry) -> Entity;
+
+    /**
+     * @brief Parks an entity of this pool.
+     * @param registry Registry owning the entities
+     * @param entity Entity previously returned by acquire()
+     */
+    void release(Registry& registry, Entity entity);
+
+    /**
+     * @brief Parks a pooled entity, or kills any other entity.
+     * @param registry Registry owning the entity
+     * @param entity Entity to get rid of
+     */
+    static void despawn(Registry& registry, Entity entity);
+
+    /**
+     * @brief Kills every parked entity.
+     * Parked entities are not freed with the pool; call this first when the
+     * registry outlives it.
+     * @param registry Registry owning the entities
+     */
+    void clear(Registry& registry);
+
+    /**
+     * @brief Entities parked and ready to be acquired.
+     */
+    [[nodiscard]] auto available() const noexcept -> size_t {
+        return _freeList->size();
+    }
+
+    /**
+     * @brief Entities this pool has created so far.
+     */
+    [[nodiscard]] auto created() const noexcept -> size_t { return _created; }
+
+   private:
+    auto create(Registry& registry) -> Entity;
+    static void park(Registry& registry, Entity entity,
+                     std::vector<Entity>& freeList);
+
+    PrefabFunc _prefab;
+    std::shared_ptr<std::vector<Entity>> _freeList;
+    size_t _created = 0;
+};
+
+}  // namespace ECS
+
+#endif  // SRC_ENGINE_ECS_CORE_ENTITYPOOL_HPP_
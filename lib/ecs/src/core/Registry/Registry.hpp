@@ -397,6 +397,12 @@ class Registry {
     template <typename T>
     auto getSparseSetTypedConst() const;
 
+    /**
+     * @brief Pool of Inactive tags, or nullptr while no entity is parked.
+     * Lets views skip the per-entity check in the common case.
+     */
+    auto inactivePool() const noexcept -> const ISparseSet*;
+
     // Friend declarations for view access
     template <typename...>
     friend class View;
@@ -404,6 +410,8 @@ class Registry {
     friend class ParallelView;
     template <typename...>
     friend class Group;
+    template <typename, typename>
+    friend class ExcludeView;
 };
 
 // Include template implementations (must be inside namespace)
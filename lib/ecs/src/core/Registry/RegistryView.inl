@@ -26,6 +26,14 @@
         return View<Components...>(std::ref(const_cast<Registry&>(*this)));
     }
 
+    inline auto Registry::inactivePool() const noexcept -> const ISparseSet* {
+        auto pool = getSparseSetConst<Inactive>();
+        if (!pool.has_value() || pool->get().size() == 0) {
+            return nullptr;
+        }
+        return &pool->get();
+    }
+
     template<typename... Components>
     auto Registry::parallelView() -> ParallelView<Components...> {
         return ParallelView<Components...>(std::ref(*this));
@@ -77,9 +85,12 @@
         };
 
         const auto& entities = allPools[_smallestPoolIndex].get();
+        const ISparseSet* inactive = (std::is_same_v<Components, Inactive> || ...)
+            ? nullptr : registry.get().inactivePool();
 
         for (auto entity : entities) {
-            if ((std::get<Is>(pools).get().contains(entity) && ...)) {
+            if ((std::get<Is>(pools).get().contains(entity) && ...) &&
+                (inactive == nullptr || !inactive->contains(entity))) {
                 std::forward<Func>(func)(entity, getComponentData<Components>(entity, std::get<Is>(pools).get())...);
             }
         }
@@ -133,9 +144,12 @@
         };
 
         const auto& entities = allPools[_smallestPoolIndex].get();
+        const ISparseSet* inactive = (std::is_same_v<Includes, Inactive> || ...)
+            ? nullptr : registry.get().inactivePool();
 
         for (auto entity : entities) {
-            if ((std::get<IncIs>(_includePools).get().contains(entity) && ...)) {
+            if ((std::get<IncIs>(_includePools).get().contains(entity) && ...) &&
+                (inactive == nullptr || !inactive->contains(entity))) {
                 if (!is_excluded(entity)) {
                     std::forward<Func>(func)(entity, getComponentData<Includes>(entity, std::get<IncIs>(_includePools).get())...);
                 }
@@ -182,6 +196,8 @@
         }
 
         const auto& entities = smallest_entities->get();
+        const ISparseSet* inactive = (std::is_same_v<Components, Inactive> || ...)
+            ? nullptr : _registry.get().inactivePool();
 
         const size_t num_threads = std::thread::hardware_concurrency();
         const size_t chunk_size = std::max(size_t(1), entities.size() / num_threads);
@@ -200,7 +216,8 @@
             threads.emplace_back([&, start, end, pools]() {
                 for (size_t i = start; i < end; ++i) {
                     Entity entity = entities[i];
-                    if ((std::get<std::reference_wrapper<SparseSet<Components>>>(pools).get().contains(entity) && ...)) {
+                    if ((std::get<std::reference_wrapper<SparseSet<Components>>>(pools).get().contains(entity) && ...) &&
+                        (inactive == nullptr || !inactive->contains(entity))) {
                         std::forward<Func>(func)(entity, std::get<std::reference_wrapper<SparseSet<Components>>>(pools).get().get(entity)...);
                     }
                 }
@@ -245,8 +262,11 @@
             return;
         }
 
+        const ISparseSet* inactive = (std::is_same_v<Components, Inactive> || ...)
+            ? nullptr : _registry.get().inactivePool();
         for (auto entity : smallest_entities->get()) {
-            if ((_registry.get().template hasComponent<Components>(entity) && ...)) {
+            if ((_registry.get().template hasComponent<Components>(entity) && ...) &&
+                (inactive == nullptr || !inactive->contains(entity))) {
                 _entities.push_back(entity);
             }
         }
@@ -37,6 +37,8 @@ void SystemScheduler::removeSystem(const std::string& name) {
 
 void SystemScheduler::run() {
     std::vector<SystemFunc> toRun;
+    std::vector<std::string> names;
+    SystemTimer timer;
     {
         std::lock_guard<std::mutex> lock(_mutex);
         if (_needsReorder) {
@@ -44,19 +46,36 @@ void SystemScheduler::run() {
             _needsReorder = false;
         }
 
+        timer = _systemTimer;
         for (const auto& system_name : _executionOrder) {
             auto iter = _systems.find(system_name);
             if (iter != _systems.end() && iter->second.enabled) {
                 toRun.push_back(iter->second.func);
+                if (timer) {
+                    names.push_back(system_name);
+                }
             }
         }
     }
 
-    for (auto& func : toRun) {
-        func(registry.get());
+    if (!timer) {
+        for (auto& func : toRun) {
+            func(registry.get());
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < toRun.size(); ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        toRun[i](registry.get());
+        timer(names[i], std::chrono::steady_clock::now() - start);
     }
 }
 
+void SystemScheduler::setSystemTimer(SystemTimer timer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _systemTimer = std::move(timer);
+}
+
 void SystemScheduler::runSystem(const std::string& name) {
     auto iter = _systems.find(name);
     if (iter == _systems.end()) {
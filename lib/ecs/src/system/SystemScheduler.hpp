@@ -9,6 +9,7 @@
 #define SRC_ENGINE_ECS_SYSTEM_SYSTEMSCHEDULER_HPP_
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <stdexcept>
 #include <string>
@@ -42,6 +43,8 @@ class Registry;
 class SystemScheduler {
    public:
     using SystemFunc = std::function<void(Registry&)>;
+    using SystemTimer = std::function<void(const std::string& name,
+                                           std::chrono::nanoseconds elapsed)>;
 
     explicit SystemScheduler(std::reference_wrapper<Registry> reg)
         : registry(reg) {}
@@ -66,6 +69,12 @@ class SystemScheduler {
      */
     void run();
 
+    /**
+     * @brief Reports the wall time of every system run by run().
+     * Pass an empty function to stop timing.
+     */
+    void setSystemTimer(SystemTimer timer);
+
     /**
      * @brief Executes a specific system by name.
      */
@@ -103,6 +112,7 @@ class SystemScheduler {
     std::unordered_map<std::string, SystemNode> _systems;
     std::vector<std::string> _executionOrder;
     bool _needsReorder = true;
+    SystemTimer _systemTimer;
 
     mutable std::mutex _mutex;
 
@@ -27,6 +27,8 @@ class ExcludeView;
  *
  * Automatically selects the smallest component set for iteration to minimize
  * work. Views are lightweight and designed for single-threaded traversal.
+ * Entities tagged Inactive (parked in an EntityPool) are skipped unless
+ * Inactive is one of the requested components.
  *
  * Example:
  *   auto view = registry.view<Position, Velocity>();
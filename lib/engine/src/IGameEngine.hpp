@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -109,6 +110,8 @@ struct ProcessedEvent {
 class IGameEngine {
    public:
     using EventCallback = std::function<void(const GameEvent&)>;
+    using SystemTimer = std::function<void(const std::string& system,
+                                           std::chrono::nanoseconds elapsed)>;
 
     virtual ~IGameEngine() = default;
 
@@ -194,6 +197,15 @@ class IGameEngine {
      */
     virtual void syncEntityPositions(
         std::function<void(uint32_t, float, float, float, float)> callback) = 0;
+
+    /**
+     * @brief Report the time each ECS system takes per update
+     *
+     * Optional: engines without named systems ignore it.
+     *
+     * @param timer Called after every system with its name and wall time
+     */
+    virtual void setSystemTimer(SystemTimer timer) { (void)timer; }
 };
 
 }  // namespace rtype::engine
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace rtype::network {
@@ -30,6 +31,7 @@ class Packet {
 
     void setType(PacketType type) { type_ = type; }
     void setData(const std::vector<uint8_t>& data) { data_ = data; }
+    void setData(std::vector<uint8_t>&& data) { data_ = std::move(data); }
 
    private:
     PacketType type_;
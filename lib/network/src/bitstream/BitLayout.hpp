@@ -0,0 +1,239 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** BitLayout - Compile-time bit layouts for payload structs
+*/
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+#include "BitStream.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Field encodings usable in a BitLayout
+ *
+ * Each encoding exposes:
+ * - kMaxBits: worst-case encoded size
+ * - bits(v): exact encoded size of a value
+ * - write(writer, v) / read<V>(reader)
+ */
+namespace BitEncoding {
+
+/// Raw unsigned value on N bits
+template <unsigned N>
+struct Bits {
+    static_assert(N > 0 && N <= 32, "Bits<N> supports 1-32 bits");
+    static constexpr unsigned kMaxBits = N;
+
+    template <typename V>
+    static constexpr unsigned bits(V /*value*/) noexcept {
+        return N;
+    }
+    template <typename V>
+    static void write(BitWriter& out, V value) {
+        out.writeBits(static_cast<std::uint32_t>(value), N);
+    }
+    template <typename V>
+    static V read(BitReader& in) noexcept {
+        return static_cast<V>(in.readBits(N));
+    }
+};
+
+/// Single-bit boolean
+using Bool = Bits<1>;
+
+/// Integer bounded to [Min, Max], clamped on write
+template <std::int64_t Min, std::int64_t Max>
+struct Ranged {
+    static_assert(Min < Max, "Ranged<Min, Max> requires Min < Max");
+    static constexpr unsigned kMaxBits = rangedBits(Min, Max);
+
+    template <typename V>
+    static constexpr unsigned bits(V /*value*/) noexcept {
+        return kMaxBits;
+    }
+    template <typename V>
+    static void write(BitWriter& out, V value) {
+        out.writeRanged<std::int64_t>(static_cast<std::int64_t>(value), Min,
+                                      Max);
+    }
+    template <typename V>
+    static V read(BitReader& in) noexcept {
+        return static_cast<V>(in.readRanged<std::int64_t>(Min, Max));
+    }
+};
+
+/// Float in [Min, Max] quantized to Precision, clamped on write
+template <float Min, float Max, float Precision>
+struct Quantized {
+    static_assert(Min < Max && Precision > 0.0f,
+                  "Quantized requires Min < Max and a positive precision");
+    static constexpr unsigned kMaxBits = quantizedBits(Min, Max, Precision);
+    static_assert(kMaxBits <= 32, "Quantized range too fine for 32 bits");
+
+    template <typename V>
+    static constexpr unsigned bits(V /*value*/) noexcept {
+        return kMaxBits;
+    }
+    template <typename V>
+    static void write(BitWriter& out, V value) {
+        out.writeQuantized(static_cast<float>(value), Min, Max, Precision);
+    }
+    template <typename V>
+    static V read(BitReader& in) noexcept {
+        return static_cast<V>(in.readQuantized(Min, Max, Precision));
+    }
+};
+
+/// Unsigned 32-bit value with the VarUint width-class encoding
+struct Varint {
+    static constexpr unsigned kMaxBits = VarUint::kMaxBits;
+
+    template <typename V>
+    static constexpr unsigned bits(V value) noexcept {
+        return VarUint::encodedBits(static_cast<std::uint32_t>(value));
+    }
+    template <typename V>
+    static void write(BitWriter& out, V value) {
+        out.writeVarUint(static_cast<std::uint32_t>(value));
+    }
+    template <typename V>
+    static V read(BitReader& in) noexcept {
+        return static_cast<V>(in.readVarUint());
+    }
+};
+
+/// Signed 32-bit value as zigzag + VarUint
+struct SignedVarint {
+    static constexpr unsigned kMaxBits = VarUint::kMaxBits;
+
+    template <typename V>
+    static constexpr unsigned bits(V value) noexcept {
+        return VarUint::encodedBits(
+            zigzagEncode(static_cast<std::int32_t>(value)));
+    }
+    template <typename V>
+    static void write(BitWriter& out, V value) {
+        out.writeVarInt(static_cast<std::int32_t>(value));
+    }
+    template <typename V>
+    static V read(BitReader& in) noexcept {
+        return static_cast<V>(in.readVarInt());
+    }
+};
+
+}  // namespace BitEncoding
+
+namespace detail {
+
+template <typename>
+struct MemberPointerTraits;
+
+template <typename C, typename V>
+struct MemberPointerTraits<V C::*> {
+    using Class = C;
+    using Value = V;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Binds one struct member to a BitEncoding
+ *
+ * @tparam Member Pointer to data member (e.g. &EntityHealthPayload::current)
+ * @tparam Encoding One of the BitEncoding types
+ */
+template <auto Member, typename Encoding>
+struct BitField {
+    using Class = typename detail::MemberPointerTraits<
+        decltype(Member)>::Class;
+    using Value = typename detail::MemberPointerTraits<
+        decltype(Member)>::Value;
+
+    static constexpr unsigned kMaxBits = Encoding::kMaxBits;
+
+    [[nodiscard]] static constexpr unsigned bits(const Class& obj) noexcept {
+        return Encoding::bits(static_cast<Value>(obj.*Member));
+    }
+    static void write(BitWriter& out, const Class& obj) {
+        Encoding::write(out, static_cast<Value>(obj.*Member));
+    }
+    static void read(BitReader& in, Class& obj) noexcept {
+        obj.*Member = Encoding::template read<Value>(in);
+    }
+};
+
+/**
+ * @brief Ordered list of BitFields describing a struct's bit layout
+ *
+ * Fields are written and read in declaration order, without padding.
+ */
+template <typename... Fields>
+struct BitFields {
+    static constexpr unsigned kMaxBits = (0U + ... + Fields::kMaxBits);
+
+    template <typename T>
+    [[nodiscard]] static constexpr unsigned bits(const T& obj) noexcept {
+        return (0U + ... + Fields::bits(obj));
+    }
+    template <typename T>
+    static void write(BitWriter& out, const T& obj) {
+        (Fields::write(out, obj), ...);
+    }
+    template <typename T>
+    static void read(BitReader& in, T& obj) noexcept {
+        (Fields::read(in, obj), ...);
+    }
+};
+
+/**
+ * @brief Bit layout descriptor of a payload struct
+ *
+ * Specialize with a nested `using Fields = BitFields<...>;` to make a struct
+ * usable with writeLayout()/readLayout().
+ */
+template <typename T>
+struct BitLayout;
+
+template <typename T>
+concept HasBitLayout = requires { typename BitLayout<T>::Fields; };
+
+/// Worst-case encoded size of T in bits
+template <HasBitLayout T>
+inline constexpr unsigned kLayoutMaxBits = BitLayout<T>::Fields::kMaxBits;
+
+/**
+ * @brief Exact encoded size of a value in bits
+ */
+template <HasBitLayout T>
+[[nodiscard]] constexpr unsigned layoutBits(const T& value) noexcept {
+    return BitLayout<T>::Fields::bits(value);
+}
+
+/**
+ * @brief Write a struct using its BitLayout
+ */
+template <HasBitLayout T>
+void writeLayout(BitWriter& out, const T& value) {
+    BitLayout<T>::Fields::write(out, value);
+}
+
+/**
+ * @brief Read a struct using its BitLayout
+ *
+ * Check BitReader::overflowed() afterwards; fields past the end are zero.
+ */
+template <HasBitLayout T>
+    requires std::default_initializable<T>
+[[nodiscard]] T readLayout(BitReader& in) noexcept {
+    T value{};
+    BitLayout<T>::Fields::read(in, value);
+    return value;
+}
+
+}  // namespace rtype::network
@@ -0,0 +1,340 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** BitStream - Bit-level writer/reader for dense RTGP payloads
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "core/Types.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Number of bits needed to store any value in [0, range]
+ */
+[[nodiscard]] constexpr unsigned bitsRequired(std::uint64_t range) noexcept {
+    return static_cast<unsigned>(std::bit_width(range));
+}
+
+/**
+ * @brief Number of bits used to encode a ranged integer in [min, max]
+ */
+[[nodiscard]] constexpr unsigned rangedBits(std::int64_t min,
+                                            std::int64_t max) noexcept {
+    return bitsRequired(static_cast<std::uint64_t>(max) -
+                        static_cast<std::uint64_t>(min));
+}
+
+/**
+ * @brief Number of quantization steps for a float in [min, max]
+ */
+[[nodiscard]] constexpr std::uint32_t quantizedSteps(float min, float max,
+                                                     float precision) noexcept {
+    double steps = (static_cast<double>(max) - static_cast<double>(min)) /
+                   static_cast<double>(precision);
+    return static_cast<std::uint32_t>(steps + 0.5);
+}
+
+/**
+ * @brief Number of bits used to encode a quantized float
+ */
+[[nodiscard]] constexpr unsigned quantizedBits(float min, float max,
+                                               float precision) noexcept {
+    return bitsRequired(quantizedSteps(min, max, precision));
+}
+
+/**
+ * @brief ZigZag-map a signed value so small magnitudes stay small
+ */
+[[nodiscard]] constexpr std::uint32_t zigzagEncode(std::int32_t v) noexcept {
+    return (static_cast<std::uint32_t>(v) << 1) ^
+           static_cast<std::uint32_t>(v >> 31);
+}
+
+/**
+ * @brief Inverse of zigzagEncode
+ */
+[[nodiscard]] constexpr std::int32_t zigzagDecode(std::uint32_t v) noexcept {
+    return static_cast<std::int32_t>((v >> 1) ^ (~(v & 1U) + 1U));
+}
+
+/**
+ * @brief Variable-width unsigned integer encoding used by the bit stream
+ *
+ * A 2-bit width class selects 4, 8, 16 or 32 value bits, so values below 16
+ * cost 6 bits and the worst case is 34 bits. The class is derived from the
+ * value's bit width without branching.
+ */
+namespace VarUint {
+inline constexpr unsigned kClassBits = 2;
+inline constexpr unsigned kWidths[4] = {4, 8, 16, 32};
+inline constexpr unsigned kMaxBits = kClassBits + 32;
+
+[[nodiscard]] constexpr unsigned sizeClass(std::uint32_t value) noexcept {
+    unsigned width = bitsRequired(value);
+    return static_cast<unsigned>(width > 4) + static_cast<unsigned>(width > 8) +
+           static_cast<unsigned>(width > 16);
+}
+
+[[nodiscard]] constexpr unsigned encodedBits(std::uint32_t value) noexcept {
+    return kClassBits + kWidths[sizeClass(value)];
+}
+}  // namespace VarUint
+
+/**
+ * @brief MSB-first bit writer appending to a growable byte buffer
+ *
+ * Bits are staged in a 64-bit accumulator and spilled a byte at a time, so a
+ * write is a shift/or plus at most a few byte stores. Values wider than the
+ * requested bit count are masked.
+ *
+ * Thread-safety: Not thread-safe.
+ */
+class BitWriter {
+   public:
+    BitWriter() = default;
+
+    /**
+     * @brief Construct a writer with pre-reserved capacity
+     * @param reserveBytes Expected payload size in bytes
+     */
+    explicit BitWriter(std::size_t reserveBytes) {
+        bytes_.reserve(reserveBytes);
+    }
+
+    /**
+     * @brief Write the low bits of value
+     * @param value Value to write
+     * @param bits Number of bits, 0-32
+     */
+    void writeBits(std::uint32_t value, unsigned bits) {
+        std::uint64_t masked =
+            value & ((std::uint64_t{1} << bits) - std::uint64_t{1});
+        acc_ = (acc_ << bits) | masked;
+        accBits_ += bits;
+        while (accBits_ >= 8) {
+            accBits_ -= 8;
+            bytes_.push_back(static_cast<std::uint8_t>(acc_ >> accBits_));
+        }
+        acc_ &= (std::uint64_t{1} << accBits_) - std::uint64_t{1};
+        bitCount_ += bits;
+    }
+
+    /**
+     * @brief Write a 64-bit value as two 32-bit halves
+     * @param bits Number of bits, 0-64
+     */
+    void writeBits64(std::uint64_t value, unsigned bits) {
+        if (bits > 32) {
+            writeBits(static_cast<std::uint32_t>(value >> 32), bits - 32);
+            bits = 32;
+        }
+        writeBits(static_cast<std::uint32_t>(value), bits);
+    }
+
+    void writeBool(bool value) { writeBits(value ? 1U : 0U, 1); }
+
+    /**
+     * @brief Write an integer known to lie in [min, max]
+     *
+     * Uses rangedBits(min, max) bits. Out-of-range values are clamped.
+     */
+    template <std::integral T>
+    void writeRanged(T value, T min, T max) {
+        T clamped = std::clamp(value, min, max);
+        std::uint64_t offset = static_cast<std::uint64_t>(clamped) -
+                               static_cast<std::uint64_t>(min);
+        writeBits64(offset, rangedBits(min, max));
+    }
+
+    /**
+     * @brief Write a float quantized to precision within [min, max]
+     *
+     * Out-of-range values are clamped, NaN encodes as min.
+     */
+    void writeQuantized(float value, float min, float max, float precision) {
+        std::uint32_t steps = quantizedSteps(min, max, precision);
+        double scaled =
+            (static_cast<double>(value) - static_cast<double>(min)) /
+            static_cast<double>(precision);
+        if (!(scaled > 0.0)) {
+            scaled = 0.0;
+        }
+        auto q = static_cast<std::uint32_t>(
+            std::min(std::llround(scaled), static_cast<long long>(steps)));
+        writeBits(q, bitsRequired(steps));
+    }
+
+    /**
+     * @brief Write an unsigned value with the VarUint width-class encoding
+     */
+    void writeVarUint(std::uint32_t value) {
+        unsigned cls = VarUint::sizeClass(value);
+        writeBits(cls, VarUint::kClassBits);
+        writeBits(value, VarUint::kWidths[cls]);
+    }
+
+    /**
+     * @brief Write a signed value as zigzag + VarUint
+     */
+    void writeVarInt(std::int32_t value) { writeVarUint(zigzagEncode(value)); }
+
+    /**
+     * @brief Pad with zero bits up to the next byte boundary
+     */
+    void alignToByte() {
+        if (accBits_ > 0) {
+            writeBits(0, 8 - accBits_);
+        }
+    }
+
+    /**
+     * @brief Append raw bytes (the stream is aligned first)
+     */
+    void writeBytes(std::span<const std::uint8_t> data) {
+        alignToByte();
+        bytes_.insert(bytes_.end(), data.begin(), data.end());
+        bitCount_ += data.size() * 8;
+    }
+
+    /// Number of bits written so far
+    [[nodiscard]] std::size_t bitCount() const noexcept { return bitCount_; }
+
+    /// Number of bytes the stream occupies once padded
+    [[nodiscard]] std::size_t byteCount() const noexcept {
+        return (bitCount_ + 7) / 8;
+    }
+
+    /**
+     * @brief Pad the last byte and return the encoded bytes
+     */
+    [[nodiscard]] Buffer finish() && {
+        alignToByte();
+        return std::move(bytes_);
+    }
+
+   private:
+    Buffer bytes_;
+    std::uint64_t acc_{0};
+    unsigned accBits_{0};
+    std::size_t bitCount_{0};
+};
+
+/**
+ * @brief Bounds-checked MSB-first bit reader over a byte span
+ *
+ * Reading past the end never throws: it returns zeros and sets a sticky
+ * overflow flag, so decoders can read a whole record and check once.
+ *
+ * Thread-safety: Not thread-safe.
+ */
+class BitReader {
+   public:
+    explicit BitReader(std::span<const std::uint8_t> data) noexcept
+        : data_(data) {}
+
+    /**
+     * @brief Read bits as an unsigned value
+     * @param bits Number of bits, 0-32
+     */
+    [[nodiscard]] std::uint32_t readBits(unsigned bits) noexcept {
+        if (bits > remainingBits()) {
+            overflow_ = true;
+            bitPos_ = data_.size() * 8;
+            return 0;
+        }
+        std::uint64_t window = 0;
+        std::size_t first = bitPos_ >> 3;
+        std::size_t last = (bitPos_ + bits + 7) >> 3;
+        for (std::size_t i = first; i < last; ++i) {
+            window = (window << 8) | data_[i];
+        }
+        unsigned tail = static_cast<unsigned>(last * 8 - (bitPos_ + bits));
+        bitPos_ += bits;
+        return static_cast<std::uint32_t>(
+            (window >> tail) &
+            ((std::uint64_t{1} << bits) - std::uint64_t{1}));
+    }
+
+    /**
+     * @brief Read a 64-bit value written by BitWriter::writeBits64
+     */
+    [[nodiscard]] std::uint64_t readBits64(unsigned bits) noexcept {
+        std::uint64_t high = 0;
+        if (bits > 32) {
+            high = std::uint64_t{readBits(bits - 32)} << 32;
+            bits = 32;
+        }
+        return high | readBits(bits);
+    }
+
+    [[nodiscard]] bool readBool() noexcept { return readBits(1) != 0; }
+
+    /**
+     * @brief Read an integer written by BitWriter::writeRanged
+     *
+     * Offsets decoding above max are clamped to max.
+     */
+    template <std::integral T>
+    [[nodiscard]] T readRanged(T min, T max) noexcept {
+        std::uint64_t offset = readBits64(rangedBits(min, max));
+        std::uint64_t span = static_cast<std::uint64_t>(max) -
+                             static_cast<std::uint64_t>(min);
+        return static_cast<T>(static_cast<std::uint64_t>(min) +
+                              std::min(offset, span));
+    }
+
+    /**
+     * @brief Read a float written by BitWriter::writeQuantized
+     */
+    [[nodiscard]] float readQuantized(float min, float max,
+                                      float precision) noexcept {
+        std::uint32_t steps = quantizedSteps(min, max, precision);
+        std::uint32_t q = std::min(readBits(bitsRequired(steps)), steps);
+        return static_cast<float>(static_cast<double>(min) +
+                                  static_cast<double>(q) * precision);
+    }
+
+    [[nodiscard]] std::uint32_t readVarUint() noexcept {
+        unsigned cls = readBits(VarUint::kClassBits);
+        return readBits(VarUint::kWidths[cls]);
+    }
+
+    [[nodiscard]] std::int32_t readVarInt() noexcept {
+        return zigzagDecode(readVarUint());
+    }
+
+    /**
+     * @brief Skip to the next byte boundary
+     */
+    void alignToByte() noexcept {
+        bitPos_ = std::min((bitPos_ + 7) & ~std::size_t{7}, data_.size() * 8);
+    }
+
+    [[nodiscard]] std::size_t remainingBits() const noexcept {
+        return data_.size() * 8 - bitPos_;
+    }
+
+    [[nodiscard]] std::size_t bitPosition() const noexcept { return bitPos_; }
+
+    /// True once any read ran past the end of the data
+    [[nodiscard]] bool overflowed() const noexcept { return overflow_; }
+
+   private:
+    std::span<const std::uint8_t> data_;
+    std::size_t bitPos_{0};
+    bool overflow_{false};
+};
+
+}  // namespace rtype::network
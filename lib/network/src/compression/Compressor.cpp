@@ -7,13 +7,92 @@
 
 #include "Compressor.hpp"
 
+#include <lz4.h>
 #include <lz4frame.h>
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 namespace rtype::network {
 
+namespace {
+
+/// Size prefix of a dictionary block: original payload size, big-endian
+constexpr std::size_t kDictSizePrefix = 2;
+
+}  // namespace
+
+/**
+ * @brief LZ4 streams with each dictionary of the set preloaded
+ *
+ * LZ4_loadDict hashes the whole dictionary, so it is done once here. Each
+ * compression copies the prepared stream into a thread-local working stream
+ * instead, which is the reuse pattern documented by lz4.h.
+ */
+struct Compressor::DictionaryContexts {
+    struct StreamDeleter {
+        void operator()(LZ4_stream_t* stream) const noexcept {
+            LZ4_freeStream(stream);
+        }
+    };
+    using StreamPtr = std::unique_ptr<LZ4_stream_t, StreamDeleter>;
+
+    /// Keeps the dictionary bytes referenced by the streams alive
+    std::shared_ptr<const DictionarySet> set;
+    std::vector<StreamPtr> streams;
+    /// Prepared stream per raw opcode, nullptr if no dictionary applies
+    std::array<const LZ4_stream_t*, 256> byOpcode{};
+
+    explicit DictionaryContexts(std::shared_ptr<const DictionarySet> dicts)
+        : set(std::move(dicts)) {
+        std::vector<std::pair<const Buffer*, const LZ4_stream_t*>> prepared;
+        for (std::size_t raw = 0; raw < byOpcode.size(); ++raw) {
+            const Buffer* dict =
+                set->find(static_cast<OpCode>(static_cast<std::uint8_t>(raw)));
+            if (dict == nullptr) {
+                continue;
+            }
+            auto it = std::find_if(
+                prepared.begin(), prepared.end(),
+                [dict](const auto& entry) { return entry.first == dict; });
+            if (it != prepared.end()) {
+                byOpcode[raw] = it->second;
+                continue;
+            }
+            StreamPtr stream(LZ4_createStream());
+            if (!stream) {
+                continue;
+            }
+            LZ4_loadDict(stream.get(),
+                         reinterpret_cast<const char*>(dict->data()),
+                         static_cast<int>(dict->size()));
+            byOpcode[raw] = stream.get();
+            prepared.emplace_back(dict, stream.get());
+            streams.push_back(std::move(stream));
+        }
+    }
+};
+
 Compressor::Compressor() noexcept : config_() {}
 
-Compressor::Compressor(const Config& config) noexcept : config_(config) {}
+Compressor::Compressor(const Config& config) : config_(config) {
+    if (config_.dictionaries && !config_.dictionaries->empty()) {
+        dictionaryContexts_ =
+            std::make_unique<const DictionaryContexts>(config_.dictionaries);
+    }
+}
+
+Compressor::~Compressor() = default;
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+std::uint32_t Compressor::dictionaryId() const noexcept {
+    return dictionaryContexts_ ? dictionaryContexts_->set->id() : 0;
+}
 
 bool Compressor::shouldCompress(std::size_t payloadSize) const noexcept {
     return payloadSize >= config_.minSizeThreshold;
@@ -63,6 +142,80 @@ CompressionResult Compressor::compress(const Buffer& payload) const {
     return result;
 }
 
+CompressionResult Compressor::compress(const Buffer& payload, OpCode opcode,
+                                       bool allowDictionary) const {
+    if (!allowDictionary || !dictionaryContexts_ ||
+        payload.size() < config_.dictionaryMinSizeThreshold ||
+        payload.size() > kMaxPacketSize) {
+        return compress(payload);
+    }
+    const LZ4_stream_t* prepared =
+        dictionaryContexts_->byOpcode[static_cast<std::uint8_t>(opcode)];
+    if (prepared == nullptr) {
+        return compress(payload);
+    }
+
+    CompressionResult result;
+    result.originalSize = payload.size();
+    result.wasCompressed = false;
+
+    thread_local LZ4_stream_t working;
+    std::memcpy(&working, prepared, sizeof(working));
+
+    int bound = LZ4_compressBound(static_cast<int>(payload.size()));
+    Buffer compressed(kDictSizePrefix + static_cast<std::size_t>(bound));
+    compressed[0] = static_cast<std::uint8_t>(payload.size() >> 8);
+    compressed[1] = static_cast<std::uint8_t>(payload.size() & 0xFF);
+
+    int compressedSize = LZ4_compress_fast_continue(
+        &working, reinterpret_cast<const char*>(payload.data()),
+        reinterpret_cast<char*>(compressed.data() + kDictSizePrefix),
+        static_cast<int>(payload.size()), bound, 1);
+
+    std::size_t total =
+        kDictSizePrefix + static_cast<std::size_t>(compressedSize);
+    if (compressedSize <= 0 || total >= payload.size()) {
+        result.data = payload;
+        return result;
+    }
+
+    compressed.resize(total);
+    result.data = std::move(compressed);
+    result.wasCompressed = true;
+    result.usedDictionary = true;
+    return result;
+}
+
+Result<Buffer> Compressor::decompressWithDictionary(
+    const Buffer& compressedData, OpCode opcode) const {
+    if (!dictionaryContexts_ || compressedData.size() <= kDictSizePrefix) {
+        return Err<Buffer>(NetworkError::DecompressionFailed);
+    }
+    const Buffer* dict = dictionaryContexts_->set->find(opcode);
+    if (dict == nullptr) {
+        return Err<Buffer>(NetworkError::DecompressionFailed);
+    }
+
+    std::size_t originalSize = static_cast<std::size_t>(
+        (compressedData[0] << 8) | compressedData[1]);
+    if (originalSize == 0 || originalSize > kMaxPacketSize) {
+        return Err<Buffer>(NetworkError::DecompressionFailed);
+    }
+
+    Buffer decompressed(originalSize);
+    int written = LZ4_decompress_safe_usingDict(
+        reinterpret_cast<const char*>(compressedData.data() + kDictSizePrefix),
+        reinterpret_cast<char*>(decompressed.data()),
+        static_cast<int>(compressedData.size() - kDictSizePrefix),
+        static_cast<int>(originalSize),
+        reinterpret_cast<const char*>(dict->data()),
+        static_cast<int>(dict->size()));
+    if (written < 0 || static_cast<std::size_t>(written) != originalSize) {
+        return Err<Buffer>(NetworkError::DecompressionFailed);
+    }
+    return Ok(std::move(decompressed));
+}
+
 Result<Buffer> Compressor::decompress(const Buffer& compressedData) const {
     if (compressedData.empty()) {
         return Err<Buffer>(NetworkError::DecompressionFailed);
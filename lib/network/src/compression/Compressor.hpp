@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <memory>
 
+#include "DictionarySet.hpp"
 #include "core/Error.hpp"
 #include "core/Types.hpp"
+#include "protocol/OpCode.hpp"
 
 namespace rtype::network {
 
@@ -21,6 +25,7 @@ struct CompressionResult {
     Buffer data;               ///< Compressed data (or original if not compressed)
     std::size_t originalSize;  ///< Original uncompressed size
     bool wasCompressed;        ///< True if compression was applied
+    bool usedDictionary{false};  ///< True if data is a dictionary LZ4 block
 };
 
 /**
@@ -29,7 +34,15 @@ struct CompressionResult {
  * Provides transparent compression/decompression using LZ4 frame format.
  * Compression is only applied when beneficial (compressed < original).
  *
- * Thread-safety: All methods are thread-safe (stateless).
+ * When configured with a DictionarySet, compress(payload, opcode, true)
+ * emits a headerless LZ4 block primed with the opcode's dictionary instead
+ * of a frame: a 2-byte big-endian original size followed by the block. The
+ * dictionary hash tables are built once per dictionary at construction and
+ * copied into a thread-local working stream on each call, so no allocation
+ * or dictionary hashing happens per packet.
+ *
+ * Thread-safety: All methods are thread-safe (immutable state plus
+ * thread-local scratch).
  *
  * @see RFC RTGP v1.4.0 Section 4.4
  */
@@ -42,16 +55,22 @@ class Compressor {
         std::size_t minSizeThreshold = 64;
 
         float maxExpansionRatio = 1.0f;
+
+        /// Dictionaries are worth it on much smaller payloads than frames
+        std::size_t dictionaryMinSizeThreshold = 16;
+
+        /// Per-opcode dictionaries, nullptr disables dictionary mode
+        std::shared_ptr<const DictionarySet> dictionaries;
     };
 
     Compressor() noexcept;
-    explicit Compressor(const Config& config) noexcept;
-    ~Compressor() = default;
+    explicit Compressor(const Config& config);
+    ~Compressor();
 
     Compressor(const Compressor&) = delete;
     Compressor& operator=(const Compressor&) = delete;
-    Compressor(Compressor&&) = default;
-    Compressor& operator=(Compressor&&) = default;
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
 
     /**
      * @brief Attempt to compress payload
@@ -64,6 +83,21 @@ class Compressor {
      */
     [[nodiscard]] CompressionResult compress(const Buffer& payload) const;
 
+    /**
+     * @brief Compress payload, with the opcode's dictionary when allowed
+     *
+     * Falls back to compress(payload) when dictionaries are disabled, the
+     * peer has not agreed on them, or the opcode has no dictionary.
+     *
+     * @param payload Raw payload data to compress
+     * @param opcode Opcode selecting the dictionary
+     * @param allowDictionary True once the peer selected our dictionary set
+     * @return CompressionResult, usedDictionary tells which format was used
+     */
+    [[nodiscard]] CompressionResult compress(const Buffer& payload,
+                                             OpCode opcode,
+                                             bool allowDictionary) const;
+
     /**
      * @brief Decompress LZ4 frame data
      *
@@ -75,6 +109,22 @@ class Compressor {
      */
     [[nodiscard]] Result<Buffer> decompress(const Buffer& compressedData) const;
 
+    /**
+     * @brief Decompress a dictionary LZ4 block (Flags::kDictCompressed)
+     *
+     * @param compressedData Size prefix + LZ4 block
+     * @param opcode Opcode the block was compressed for
+     * @return Ok with decompressed data, Err if no dictionary is loaded for
+     * the opcode or the block is corrupt
+     */
+    [[nodiscard]] Result<Buffer> decompressWithDictionary(
+        const Buffer& compressedData, OpCode opcode) const;
+
+    /**
+     * @brief Id of the loaded dictionary set, 0 if none
+     */
+    [[nodiscard]] std::uint32_t dictionaryId() const noexcept;
+
     /**
      * @brief Check if payload should be compressed
      *
@@ -95,7 +145,10 @@ class Compressor {
     maxCompressedSize(std::size_t originalSize) noexcept;
 
    private:
+    struct DictionaryContexts;
+
     Config config_;
+    std::unique_ptr<const DictionaryContexts> dictionaryContexts_;
 };
 
 }  // namespace rtype::network
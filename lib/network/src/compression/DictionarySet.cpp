@@ -0,0 +1,186 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** DictionarySet - Implementation
+*/
+
+#include "DictionarySet.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+namespace rtype::network {
+
+namespace {
+
+constexpr std::array<std::uint8_t, 4> kMagic = {'R', 'T', 'D', 'C'};
+constexpr std::uint8_t kVersion = 1;
+constexpr std::size_t kFileHeaderSize = kMagic.size() + 1 + 2;
+constexpr std::size_t kEntryHeaderSize = 1 + 2;
+
+void appendU16(Buffer& out, std::uint16_t v) {
+    out.push_back(static_cast<std::uint8_t>(v >> 8));
+    out.push_back(static_cast<std::uint8_t>(v & 0xFF));
+}
+
+[[nodiscard]] std::uint16_t readU16(std::span<const std::uint8_t> in,
+                                    std::size_t offset) noexcept {
+    return static_cast<std::uint16_t>((in[offset] << 8) | in[offset + 1]);
+}
+
+/// FNV-1a, good enough to detect mismatching dictionary files
+[[nodiscard]] std::uint32_t fnv1a(std::span<const std::uint8_t> data) noexcept {
+    std::uint32_t hash = 2166136261u;
+    for (std::uint8_t byte : data) {
+        hash ^= byte;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+}  // namespace
+
+DictionarySet::DictionarySet() noexcept { index_.fill(kNoEntry); }
+
+void DictionarySet::add(std::uint8_t opcode, Buffer dictionary) {
+    if (dictionary.size() > kMaxDictionarySize) {
+        dictionary.erase(dictionary.begin(),
+                         dictionary.end() -
+                             static_cast<std::ptrdiff_t>(kMaxDictionarySize));
+    }
+
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [opcode](const Entry& e) {
+                               return e.opcode == opcode;
+                           });
+    if (dictionary.empty()) {
+        if (it != entries_.end()) {
+            entries_.erase(it);
+        }
+    } else if (it != entries_.end()) {
+        it->data = std::move(dictionary);
+    } else {
+        entries_.push_back({opcode, std::move(dictionary)});
+    }
+
+    std::sort(entries_.begin(), entries_.end(),
+              [](const Entry& a, const Entry& b) {
+                  return a.opcode < b.opcode;
+              });
+    rebuildIndex();
+}
+
+const Buffer* DictionarySet::find(OpCode opcode) const noexcept {
+    std::int16_t slot = index_[static_cast<std::uint8_t>(opcode)];
+    if (slot == kNoEntry) {
+        slot = index_[kFallbackOpcode];
+    }
+    if (slot == kNoEntry) {
+        return nullptr;
+    }
+    return &entries_[static_cast<std::size_t>(slot)].data;
+}
+
+void DictionarySet::rebuildIndex() noexcept {
+    index_.fill(kNoEntry);
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        index_[entries_[i].opcode] = static_cast<std::int16_t>(i);
+    }
+    if (entries_.empty()) {
+        id_ = 0;
+        return;
+    }
+    id_ = fnv1a(serialize());
+    if (id_ == 0) {
+        id_ = 1;
+    }
+}
+
+Buffer DictionarySet::serialize() const {
+    Buffer out(kMagic.begin(), kMagic.end());
+    out.push_back(kVersion);
+    appendU16(out, static_cast<std::uint16_t>(entries_.size()));
+    for (const auto& entry : entries_) {
+        out.push_back(entry.opcode);
+        appendU16(out, static_cast<std::uint16_t>(entry.data.size()));
+        out.insert(out.end(), entry.data.begin(), entry.data.end());
+    }
+    return out;
+}
+
+Result<DictionarySet> DictionarySet::deserialize(
+    std::span<const std::uint8_t> data) {
+    if (data.size() < kFileHeaderSize ||
+        !std::equal(kMagic.begin(), kMagic.end(), data.begin()) ||
+        data[kMagic.size()] != kVersion) {
+        return Err<DictionarySet>(NetworkError::MalformedPacket);
+    }
+
+    std::uint16_t count = readU16(data, kMagic.size() + 1);
+    std::size_t offset = kFileHeaderSize;
+
+    DictionarySet set;
+    for (std::uint16_t i = 0; i < count; ++i) {
+        if (offset + kEntryHeaderSize > data.size()) {
+            return Err<DictionarySet>(NetworkError::MalformedPacket);
+        }
+        std::uint8_t opcode = data[offset];
+        std::uint16_t size = readU16(data, offset + 1);
+        offset += kEntryHeaderSize;
+        if (offset + size > data.size()) {
+            return Err<DictionarySet>(NetworkError::MalformedPacket);
+        }
+        set.entries_.push_back(
+            {opcode, Buffer(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                            data.begin() + static_cast<std::ptrdiff_t>(
+                                               offset + size))});
+        offset += size;
+    }
+    if (offset != data.size()) {
+        return Err<DictionarySet>(NetworkError::MalformedPacket);
+    }
+
+    std::sort(set.entries_.begin(), set.entries_.end(),
+              [](const Entry& a, const Entry& b) {
+                  return a.opcode < b.opcode;
+              });
+    auto duplicate = std::adjacent_find(set.entries_.begin(),
+                                        set.entries_.end(),
+                                        [](const Entry& a, const Entry& b) {
+                                            return a.opcode == b.opcode;
+                                        });
+    if (duplicate != set.entries_.end()) {
+        return Err<DictionarySet>(NetworkError::MalformedPacket);
+    }
+    set.rebuildIndex();
+    return Ok(std::move(set));
+}
+
+Result<DictionarySet> DictionarySet::loadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return Err<DictionarySet>(NetworkError::InternalError);
+    }
+    Buffer data((std::istreambuf_iterator<char>(file)),
+                std::istreambuf_iterator<char>());
+    return deserialize(data);
+}
+
+Result<void> DictionarySet::saveToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return Err<void>(NetworkError::InternalError);
+    }
+    Buffer data = serialize();
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        return Err<void>(NetworkError::InternalError);
+    }
+    return Ok();
+}
+
+}  // namespace rtype::network
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** DictionarySet - Per-opcode compression dictionaries
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "core/Error.hpp"
+#include "core/Types.hpp"
+#include "protocol/OpCode.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Set of LZ4 dictionaries selected by opcode
+ *
+ * Dictionaries are trained offline from captured traffic (see
+ * tools/network/rtgp_dict_trainer) and shipped to both peers. The set is
+ * identified by a 32-bit id derived from its content, which peers exchange
+ * at connect time (C_COMPRESSION_OFFER / S_COMPRESSION_SELECT) to make sure
+ * they hold the same dictionaries.
+ *
+ * File layout (all integers big-endian):
+ * - "RTDC" magic, uint8 version (1), uint16 entry count
+ * - per entry: uint8 opcode, uint16 size, size bytes of dictionary
+ *
+ * Opcode kFallbackOpcode (0x00, never a valid opcode) holds the dictionary
+ * used for opcodes without a dedicated one.
+ *
+ * Thread-safety: Immutable once built, safe to share between threads.
+ */
+class DictionarySet {
+   public:
+    /// Opcode slot of the dictionary used when no dedicated one exists
+    static constexpr std::uint8_t kFallbackOpcode = 0x00;
+
+    /// Largest dictionary accepted (LZ4 only uses the last 64 KB anyway)
+    static constexpr std::size_t kMaxDictionarySize = 0xFFFF;
+
+    DictionarySet() noexcept;
+
+    /**
+     * @brief Add or replace the dictionary of an opcode
+     * @param opcode Raw opcode, or kFallbackOpcode
+     * @param dictionary Dictionary content, truncated to its last
+     * kMaxDictionarySize bytes
+     */
+    void add(std::uint8_t opcode, Buffer dictionary);
+
+    /**
+     * @brief Dictionary to use for an opcode
+     * @return The dedicated or fallback dictionary, nullptr if none
+     */
+    [[nodiscard]] const Buffer* find(OpCode opcode) const noexcept;
+
+    /// Content-derived id, 0 for an empty set
+    [[nodiscard]] std::uint32_t id() const noexcept { return id_; }
+
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return entries_.size();
+    }
+
+    /**
+     * @brief Serialize the set to the on-disk layout
+     */
+    [[nodiscard]] Buffer serialize() const;
+
+    /**
+     * @brief Parse a serialized set
+     * @return The set, or MalformedPacket on a corrupt buffer
+     */
+    [[nodiscard]] static Result<DictionarySet> deserialize(
+        std::span<const std::uint8_t> data);
+
+    /**
+     * @brief Load a set from a file
+     * @return The set, InternalError if the file cannot be read,
+     * MalformedPacket if it is corrupt
+     */
+    [[nodiscard]] static Result<DictionarySet> loadFromFile(
+        const std::string& path);
+
+    /**
+     * @brief Write the set to a file
+     */
+    [[nodiscard]] Result<void> saveToFile(const std::string& path) const;
+
+   private:
+    struct Entry {
+        std::uint8_t opcode;
+        Buffer data;
+    };
+
+    static constexpr std::int16_t kNoEntry = -1;
+
+    void rebuildIndex() noexcept;
+
+    std::vector<Entry> entries_;
+    std::array<std::int16_t, 256> index_;
+    std::uint32_t id_{0};
+};
+
+}  // namespace rtype::network
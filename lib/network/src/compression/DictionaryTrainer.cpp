@@ -0,0 +1,190 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** DictionaryTrainer - Implementation
+*/
+
+#include "DictionaryTrainer.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace rtype::network {
+
+namespace {
+
+[[nodiscard]] std::uint64_t hashKmer(const std::uint8_t* data,
+                                     std::size_t size) noexcept {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+struct Segment {
+    std::size_t sample;
+    std::size_t offset;
+    std::size_t length;
+    std::uint64_t score;
+};
+
+}  // namespace
+
+DictionaryTrainer::DictionaryTrainer(const Config& config) noexcept
+    : config_(config) {}
+
+void DictionaryTrainer::addSample(std::uint8_t opcode,
+                                  std::span<const std::uint8_t> payload) {
+    if (payload.empty()) {
+        return;
+    }
+    samplesByOpcode_[opcode].emplace_back(payload.begin(), payload.end());
+}
+
+std::size_t DictionaryTrainer::sampleCount() const noexcept {
+    std::size_t total = 0;
+    for (const auto& samples : samplesByOpcode_) {
+        total += samples.size();
+    }
+    return total;
+}
+
+std::size_t DictionaryTrainer::sampleCount(std::uint8_t opcode) const noexcept {
+    return samplesByOpcode_[opcode].size();
+}
+
+DictionarySet DictionaryTrainer::train() const {
+    DictionarySet set;
+    std::vector<Buffer> all;
+    for (std::size_t opcode = 0; opcode < samplesByOpcode_.size(); ++opcode) {
+        const auto& samples = samplesByOpcode_[opcode];
+        all.insert(all.end(), samples.begin(), samples.end());
+        if (opcode == DictionarySet::kFallbackOpcode ||
+            samples.size() < config_.minSamples) {
+            continue;
+        }
+        set.add(static_cast<std::uint8_t>(opcode),
+                trainDictionary(samples, config_));
+    }
+    if (!all.empty()) {
+        set.add(DictionarySet::kFallbackOpcode, trainDictionary(all, config_));
+    }
+    return set;
+}
+
+Buffer DictionaryTrainer::trainDictionary(const std::vector<Buffer>& samples,
+                                          const Config& config) {
+    const std::size_t k = std::max<std::size_t>(config.kmerSize, 1);
+    const std::size_t segmentSize = std::max(config.segmentSize, k);
+    if (samples.empty() || config.dictionarySize == 0) {
+        return {};
+    }
+
+    // Document frequency: number of samples containing each k-mer
+    std::unordered_map<std::uint64_t, std::uint32_t> frequency;
+    std::unordered_set<std::uint64_t> seen;
+    for (const auto& sample : samples) {
+        if (sample.size() < k) {
+            continue;
+        }
+        seen.clear();
+        for (std::size_t i = 0; i + k <= sample.size(); ++i) {
+            std::uint64_t hash = hashKmer(sample.data() + i, k);
+            if (seen.insert(hash).second) {
+                ++frequency[hash];
+            }
+        }
+    }
+    if (frequency.empty()) {
+        return {};
+    }
+
+    const std::size_t epochs =
+        std::max<std::size_t>(config.dictionarySize / segmentSize, 1);
+    const std::size_t epochSize =
+        std::max<std::size_t>(samples.size() / epochs, 1);
+
+    std::vector<Segment> picked;
+    std::size_t dictionaryBytes = 0;
+    std::vector<std::uint64_t> kmerHashes;
+    bool progress = false;
+    for (std::size_t first = 0; dictionaryBytes < config.dictionarySize;
+         first += epochSize) {
+        // Small sample sets: keep cycling while segments still score
+        if (first >= samples.size()) {
+            if (!progress) {
+                break;
+            }
+            first = 0;
+            progress = false;
+        }
+        Segment best{0, 0, 0, 0};
+        std::size_t last = std::min(first + epochSize, samples.size());
+        for (std::size_t s = first; s < last; ++s) {
+            const auto& sample = samples[s];
+            if (sample.size() < k) {
+                continue;
+            }
+            std::size_t length = std::min(segmentSize, sample.size());
+            std::size_t kmersPerSegment = length - k + 1;
+
+            kmerHashes.clear();
+            for (std::size_t i = 0; i + k <= sample.size(); ++i) {
+                kmerHashes.push_back(hashKmer(sample.data() + i, k));
+            }
+
+            // Sliding window sum of the k-mer frequencies
+            std::uint64_t score = 0;
+            for (std::size_t i = 0; i < kmersPerSegment; ++i) {
+                score += frequency[kmerHashes[i]];
+            }
+            for (std::size_t offset = 0;; ++offset) {
+                if (score > best.score) {
+                    best = {s, offset, length, score};
+                }
+                if (offset + kmersPerSegment >= kmerHashes.size()) {
+                    break;
+                }
+                score -= frequency[kmerHashes[offset]];
+                score += frequency[kmerHashes[offset + kmersPerSegment]];
+            }
+        }
+        if (best.score == 0) {
+            continue;
+        }
+
+        // Already covered k-mers no longer improve the dictionary
+        const auto& sample = samples[best.sample];
+        for (std::size_t i = best.offset; i + k <= best.offset + best.length;
+             ++i) {
+            frequency[hashKmer(sample.data() + i, k)] = 0;
+        }
+        best.length =
+            std::min(best.length, config.dictionarySize - dictionaryBytes);
+        dictionaryBytes += best.length;
+        picked.push_back(best);
+        progress = true;
+    }
+
+    std::stable_sort(picked.begin(), picked.end(),
+                     [](const Segment& a, const Segment& b) {
+                         return a.score < b.score;
+                     });
+    Buffer dictionary;
+    dictionary.reserve(dictionaryBytes);
+    for (const auto& segment : picked) {
+        const auto& sample = samples[segment.sample];
+        auto begin =
+            sample.begin() + static_cast<std::ptrdiff_t>(segment.offset);
+        dictionary.insert(dictionary.end(), begin,
+                          begin + static_cast<std::ptrdiff_t>(segment.length));
+    }
+    return dictionary;
+}
+
+}  // namespace rtype::network
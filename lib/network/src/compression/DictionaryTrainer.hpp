@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** DictionaryTrainer - Builds compression dictionaries from sample payloads
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "DictionarySet.hpp"
+#include "core/Types.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Trains per-opcode LZ4 dictionaries from captured payloads
+ *
+ * Simplified COVER algorithm (as used by zstd --train): samples are split
+ * into epochs, and each epoch contributes its segment whose k-mers appear in
+ * the most distinct samples. K-mers picked once stop scoring, so segments do
+ * not repeat each other. Most valuable segments are placed at the end of the
+ * dictionary, closest to the data being compressed.
+ *
+ * Opcodes with at least minSamples samples get a dedicated dictionary; every
+ * sample also feeds the fallback dictionary (DictionarySet::kFallbackOpcode).
+ */
+class DictionaryTrainer {
+   public:
+    struct Config {
+        /// Target size of each dictionary in bytes
+        std::size_t dictionarySize = 4096;
+
+        /// Length of the segments copied into the dictionary
+        std::size_t segmentSize = 32;
+
+        /// Length of the byte sequences scored across samples
+        std::size_t kmerSize = 6;
+
+        /// Samples required before an opcode gets its own dictionary
+        std::size_t minSamples = 32;
+    };
+
+    DictionaryTrainer() noexcept = default;
+    explicit DictionaryTrainer(const Config& config) noexcept;
+
+    /**
+     * @brief Record one uncompressed payload
+     * @param opcode Raw opcode of the packet
+     * @param payload Payload bytes (header excluded)
+     */
+    void addSample(std::uint8_t opcode, std::span<const std::uint8_t> payload);
+
+    [[nodiscard]] std::size_t sampleCount() const noexcept;
+
+    [[nodiscard]] std::size_t sampleCount(std::uint8_t opcode) const noexcept;
+
+    /**
+     * @brief Train the dictionaries of every opcode with enough samples
+     */
+    [[nodiscard]] DictionarySet train() const;
+
+    /**
+     * @brief Train a single dictionary from a list of samples
+     * @return Dictionary of at most config.dictionarySize bytes, empty if
+     * the samples are too small to contain a k-mer
+     */
+    [[nodiscard]] static Buffer trainDictionary(
+        const std::vector<Buffer>& samples, const Config& config);
+
+   private:
+    Config config_;
+    std::vector<std::vector<Buffer>> samplesByOpcode_{256};
+};
+
+}  // namespace rtype::network
@@ -7,6 +7,7 @@
 
 #include "Connection.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include <utility>
@@ -39,6 +40,17 @@ Result<void> Connection::connect() {
     return Ok();
 }
 
+void Connection::setConnectToken(const std::string& lobbyCode) {
+    if (lobbyCode.empty()) {
+        connectToken_.reset();
+        return;
+    }
+    ConnectTokenPayload token{};
+    std::memcpy(token.lobbyCode.data(), lobbyCode.data(),
+                std::min(lobbyCode.size(), token.lobbyCode.size()));
+    connectToken_ = token;
+}
+
 Result<void> Connection::disconnect() {
     auto result = stateMachine_.initiateDisconnect();
     if (!result) {
@@ -104,7 +116,14 @@ Result<void> Connection::processPacket(const Buffer& data,
     if (header.payloadSize > 0) {
         Buffer rawPayload(data.begin() + kHeaderSize, data.end());
 
-        if (header.flags & Flags::kCompressed) {
+        if (header.flags & Flags::kDictCompressed) {
+            auto decompressResult = compressor_.decompressWithDictionary(
+                rawPayload, static_cast<OpCode>(header.opcode));
+            if (!decompressResult) {
+                return Err<void>(NetworkError::DecompressionFailed);
+            }
+            payload = std::move(decompressResult.value());
+        } else if (header.flags & Flags::kCompressed) {
             auto decompressResult = compressor_.decompress(rawPayload);
             if (!decompressResult) {
                 return Err<void>(NetworkError::DecompressionFailed);
@@ -124,6 +143,9 @@ Result<void> Connection::processPacket(const Buffer& data,
         case OpCode::DISCONNECT:
             return handleDisconnect(header, payload);
 
+        case OpCode::S_COMPRESSION_SELECT:
+            return handleCompressionSelect(payload);
+
         case OpCode::PONG:
             processPong(header);
             break;
@@ -161,6 +183,7 @@ void Connection::update() {
         OutgoingPacket outgoing;
         outgoing.data = std::move(pkt.data);
         outgoing.isReliable = true;
+        outgoing.seqId = pkt.seqId;
         outgoingQueue_.push(std::move(outgoing));
     }
 
@@ -201,14 +224,16 @@ Result<Connection::OutgoingPacket> Connection::buildPacket(
     }
 
     Buffer finalPayload = payload;
-    bool isCompressed = false;
+    std::uint8_t compressionFlag = 0;
 
-    if (config_.enableCompression &&
-        compressor_.shouldCompress(payload.size())) {
-        auto compressionResult = compressor_.compress(payload);
+    if (config_.enableCompression) {
+        auto compressionResult =
+            compressor_.compress(payload, opcode, dictionaryActive_);
         if (compressionResult.wasCompressed) {
             finalPayload = std::move(compressionResult.data);
-            isCompressed = true;
+            compressionFlag = compressionResult.usedDictionary
+                                  ? Flags::kDictCompressed
+                                  : Flags::kCompressed;
         }
     }
 
@@ -229,9 +254,7 @@ Result<Connection::OutgoingPacket> Connection::buildPacket(
         header.flags |= Flags::kReliable;
     }
 
-    if (isCompressed) {
-        header.flags |= Flags::kCompressed;
-    }
+    header.flags |= compressionFlag;
 
     Buffer packet(kHeaderSize + finalPayload.size());
     std::memcpy(packet.data(), &header, kHeaderSize);
@@ -250,11 +273,12 @@ Result<Connection::OutgoingPacket> Connection::buildPacket(
     OutgoingPacket outgoing;
     outgoing.data = std::move(packet);
     outgoing.isReliable = reliable;
+    outgoing.seqId = ByteOrderSpec::fromNetwork(header.seqId);
     return Ok(std::move(outgoing));
 }
 
 void Connection::recordAck(std::uint16_t ackId) noexcept {
-    reliableChannel_.recordAck(ackId);
+    (void)reliableChannel_.recordAck(ackId);
 }
 
 
@@ -294,13 +318,15 @@ void Connection::reset() noexcept {
     lastPingSent_.reset();
     currentLatencyMs_ = 0;
     missedPingCount_ = 0;
+    dictionaryActive_ = false;
 }
 
 Buffer Connection::buildConnectPacket() {
     Header header;
     header.magic = kMagicByte;
     header.opcode = static_cast<std::uint8_t>(OpCode::C_CONNECT);
-    header.payloadSize = 0;
+    header.payloadSize = ByteOrderSpec::toNetwork(static_cast<std::uint16_t>(
+        connectToken_ ? sizeof(ConnectTokenPayload) : 0));
     header.userId = ByteOrderSpec::toNetwork(kUnassignedUserId);
     header.seqId = ByteOrderSpec::toNetwork(nextSequenceId());
     header.ackId =
@@ -310,6 +336,10 @@ Buffer Connection::buildConnectPacket() {
 
     Buffer packet(kHeaderSize);
     std::memcpy(packet.data(), &header, kHeaderSize);
+    if (connectToken_) {
+        auto token = Serializer::serializeForNetwork(*connectToken_);
+        packet.insert(packet.end(), token.begin(), token.end());
+    }
 
     std::uint16_t seqId = ByteOrderSpec::fromNetwork(header.seqId);
     (void)reliableChannel_.trackOutgoing(seqId, packet);
@@ -410,11 +440,40 @@ Result<void> Connection::handleConnectAccept(const Header& header,
     if (result) {
         Buffer ackPacket = buildAckPacketInternal(newUserId);
         queuePacket(std::move(ackPacket), false);
+        queueCompressionOffer();
     }
 
     return result;
 }
 
+void Connection::queueCompressionOffer() {
+    dictionaryActive_ = false;
+    if (!config_.enableCompression || compressor_.dictionaryId() == 0) {
+        return;
+    }
+
+    CompressionDictionaryPayload offer{};
+    offer.dictionaryId = compressor_.dictionaryId();
+    auto serialized = Serializer::serializeForNetwork(offer);
+    auto packet = buildPacket(OpCode::C_COMPRESSION_OFFER, serialized);
+    if (packet) {
+        outgoingQueue_.push(std::move(packet.value()));
+    }
+}
+
+Result<void> Connection::handleCompressionSelect(const Buffer& payload) {
+    if (payload.size() < sizeof(CompressionDictionaryPayload)) {
+        return Err<void>(NetworkError::MalformedPacket);
+    }
+
+    auto select =
+        Serializer::deserializeFromNetwork<CompressionDictionaryPayload>(
+            payload);
+    dictionaryActive_ = select.dictionaryId != 0 &&
+                        select.dictionaryId == compressor_.dictionaryId();
+    return Ok();
+}
+
 Result<void> Connection::handleDisconnect(const Header& header, const Buffer& payload) {
     (void)header;
 
@@ -434,7 +493,7 @@ Result<void> Connection::handleDisconnect(const Header& header, const Buffer& pa
 
 void Connection::processReliabilityAck(const Header& header) {
     if (header.flags & Flags::kIsAck) {
-        reliableChannel_.recordAck(header.ackId);
+        (void)reliableChannel_.recordAck(header.ackId);
     }
 }
 
@@ -12,6 +12,7 @@
 #include <memory>
 #include <optional>
 #include <queue>
+#include <string>
 #include <vector>
 
 #include "compression/Compressor.hpp"
@@ -62,6 +63,7 @@ class Connection {
     struct OutgoingPacket {
         Buffer data;
         bool isReliable;
+        std::uint16_t seqId{0};  ///< Sequence ID written in the header
     };
 
     Connection();
@@ -81,6 +83,17 @@ class Connection {
      */
     [[nodiscard]] Result<void> connect();
 
+    /**
+     * @brief Lobby code carried by C_CONNECT (ConnectTokenPayload)
+     *
+     * Lets a server running several lobbies behind one port route the
+     * handshake. An empty code sends the plain header-only C_CONNECT. Kept
+     * across reset().
+     *
+     * @param lobbyCode 6-char lobby code, longer codes are truncated
+     */
+    void setConnectToken(const std::string& lobbyCode);
+
     /**
      * @brief Initiate graceful disconnection
      * @return Ok if disconnect started, Err if not connected
@@ -150,6 +163,16 @@ class Connection {
         return compressor_;
     }
 
+    /**
+     * @brief Whether the server selected our compression dictionaries
+     *
+     * Set by S_COMPRESSION_SELECT, answering the C_COMPRESSION_OFFER sent
+     * after S_ACCEPT when dictionaries are configured.
+     */
+    [[nodiscard]] bool isDictionaryCompressionActive() const noexcept {
+        return dictionaryActive_;
+    }
+
     /**
      * @brief Build an ACK packet for a specific sequence ID
      * @param ackSeqId The specific sequence ID to acknowledge
@@ -208,6 +231,8 @@ class Connection {
                                                    const Buffer& payload,
                                                    const Endpoint& sender);
     [[nodiscard]] Result<void> handleDisconnect(const Header& header, const Buffer& payload);
+    [[nodiscard]] Result<void> handleCompressionSelect(const Buffer& payload);
+    void queueCompressionOffer();
     void processPong(const Header& header) noexcept;
     void processReliabilityAck(const Header& header);
     void queuePacket(Buffer data, bool reliable);
@@ -229,6 +254,8 @@ class Connection {
     std::optional<PingTracker> lastPingSent_;
     std::uint32_t currentLatencyMs_{0};
     int missedPingCount_{0};
+    bool dictionaryActive_{false};
+    std::optional<ConnectTokenPayload> connectToken_;
 };
 
 }  // namespace rtype::network
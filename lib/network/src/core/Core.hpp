@@ -9,9 +9,11 @@
 
 /**
  * @file Core.hpp
- * @brief Include all network core types: Buffer, Endpoint, ByteOrder, Result<T>
+ * @brief Include all network core types: Buffer, Endpoint, EndpointKey,
+ *        ByteOrder, Result<T>
  */
 
 #include "core/ByteOrder.hpp"
+#include "core/EndpointKey.hpp"
 #include "core/Error.hpp"
 #include "core/Types.hpp"
@@ -0,0 +1,174 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** EndpointKey - Implementation
+*/
+
+#include "EndpointKey.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <ios>
+#include <ostream>
+
+#include <asio.hpp>
+
+namespace rtype::network {
+
+namespace {
+
+/// Longest address text accepted (IPv6 with scope id fits easily)
+constexpr std::size_t kMaxAddressText = 64;
+
+constexpr std::uint64_t kFnvOffset = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t kFnvPrime = 0x100000001b3ULL;
+
+std::uint64_t fnv1a(const void* data, std::size_t size,
+                    std::uint64_t seed = kFnvOffset) noexcept {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint64_t h = seed;
+    for (std::size_t i = 0; i < size; ++i) {
+        h ^= bytes[i];
+        h *= kFnvPrime;
+    }
+    return h;
+}
+
+/**
+ * @brief Parse an IP address into key.address / key.family
+ * @return false if the text is not an IPv4 or IPv6 address
+ */
+bool parseAddress(std::string_view text, EndpointKey& key) noexcept {
+    if (text.empty() || text.size() >= kMaxAddressText) {
+        return false;
+    }
+    // make_address needs a terminated string; copy to the stack, not a
+    // std::string, to stay allocation-free
+    std::array<char, kMaxAddressText> buffer{};
+    std::memcpy(buffer.data(), text.data(), text.size());
+
+    asio::error_code ec;
+    const auto address = asio::ip::make_address(buffer.data(), ec);
+    if (ec) {
+        return false;
+    }
+
+    if (address.is_v4()) {
+        const auto v4 = address.to_v4().to_bytes();
+        key = EndpointKey::fromV4({v4[0], v4[1], v4[2], v4[3]}, 0);
+        return true;
+    }
+    const auto v6 = address.to_v6();
+    if (v6.is_v4_mapped()) {
+        const auto v4 =
+            asio::ip::make_address_v4(asio::ip::v4_mapped, v6).to_bytes();
+        key = EndpointKey::fromV4({v4[0], v4[1], v4[2], v4[3]}, 0);
+        return true;
+    }
+    const auto bytes = v6.to_bytes();
+    std::array<std::uint8_t, 16> raw{};
+    std::copy(bytes.begin(), bytes.end(), raw.begin());
+    key = EndpointKey::fromV6(raw, 0);
+    return true;
+}
+
+/// Key for text that is not an IP address: two independent 64-bit hashes
+EndpointKey textKey(std::string_view text, std::uint16_t port) noexcept {
+    EndpointKey key;
+    const std::uint64_t low = fnv1a(text.data(), text.size());
+    const std::uint64_t high =
+        fnv1a(text.data(), text.size(), low ^ 0x9e3779b97f4a7c15ULL);
+    std::memcpy(key.address.data(), &low, sizeof(low));
+    std::memcpy(key.address.data() + sizeof(low), &high, sizeof(high));
+    key.family = EndpointKey::Family::Text;
+    key.port = port;
+    return key;
+}
+
+}  // namespace
+
+EndpointKey::EndpointKey(std::string_view text) noexcept {
+    const auto colon = text.rfind(':');
+    if (colon != std::string_view::npos && colon + 1 < text.size()) {
+        const std::string_view portText = text.substr(colon + 1);
+        std::uint16_t parsedPort = 0;
+        const auto [end, ec] = std::from_chars(
+            portText.data(), portText.data() + portText.size(), parsedPort);
+        if (ec == std::errc{} && end == portText.data() + portText.size() &&
+            parseAddress(text.substr(0, colon), *this)) {
+            port = parsedPort;
+            computeHash();
+            return;
+        }
+    }
+    if (parseAddress(text, *this)) {
+        return;
+    }
+    *this = textKey(text, 0);
+    computeHash();
+}
+
+EndpointKey EndpointKey::from(const Endpoint& endpoint) noexcept {
+    EndpointKey key;
+    if (!parseAddress(endpoint.address, key)) {
+        key = textKey(endpoint.address, endpoint.port);
+    }
+    key.port = endpoint.port;
+    key.computeHash();
+    return key;
+}
+
+EndpointKey EndpointKey::fromV4(const std::array<std::uint8_t, 4>& bytes,
+                                std::uint16_t port) noexcept {
+    EndpointKey key;
+    // ::ffff:a.b.c.d, so both address families share one layout
+    key.address[10] = 0xFF;
+    key.address[11] = 0xFF;
+    std::copy(bytes.begin(), bytes.end(), key.address.begin() + 12);
+    key.port = port;
+    key.family = Family::IPv4;
+    key.computeHash();
+    return key;
+}
+
+EndpointKey EndpointKey::fromV6(const std::array<std::uint8_t, 16>& bytes,
+                                std::uint16_t port) noexcept {
+    EndpointKey key;
+    key.address = bytes;
+    key.port = port;
+    key.family = Family::IPv6;
+    key.computeHash();
+    return key;
+}
+
+void EndpointKey::computeHash() noexcept {
+    std::uint64_t h = fnv1a(address.data(), address.size());
+    h = fnv1a(&port, sizeof(port), h);
+    h = fnv1a(&family, sizeof(family), h);
+    hash = static_cast<std::size_t>(h);
+}
+
+std::ostream& operator<<(std::ostream& os, const EndpointKey& key) {
+    switch (key.family) {
+        case EndpointKey::Family::IPv4:
+            return os << static_cast<int>(key.address[12]) << '.'
+                      << static_cast<int>(key.address[13]) << '.'
+                      << static_cast<int>(key.address[14]) << '.'
+                      << static_cast<int>(key.address[15]) << ':' << key.port;
+        case EndpointKey::Family::IPv6: {
+            asio::ip::address_v6::bytes_type bytes{};
+            std::copy(key.address.begin(), key.address.end(), bytes.begin());
+            return os << asio::ip::address_v6(bytes).to_string() << ':'
+                      << key.port;
+        }
+        case EndpointKey::Family::Text:
+            return os << "text#" << std::hex << key.hash << std::dec;
+        case EndpointKey::Family::None:
+            break;
+    }
+    return os << "<none>";
+}
+
+}  // namespace rtype::network
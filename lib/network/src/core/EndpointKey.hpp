@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** EndpointKey - Compact, pre-hashed identity of a UDP peer
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "Types.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Fixed-size key identifying a peer (address + port)
+ *
+ * Replaces "address:port" strings as the key of per-connection tables on
+ * the receive path: building one parses the address into 16 bytes (IPv4 is
+ * stored v4-mapped) and hashes it once, without formatting or allocating.
+ *
+ * Text that is not an IP address (host names, test identifiers) still gets
+ * a stable key from a hash of the text, so distinct strings stay distinct.
+ */
+struct EndpointKey {
+    enum class Family : std::uint8_t { None = 0, IPv4, IPv6, Text };
+
+    std::array<std::uint8_t, 16> address{};
+    std::uint16_t port{0};
+    Family family{Family::None};
+    std::size_t hash{0};
+
+    EndpointKey() = default;
+
+    /**
+     * @brief Key of a connection identified by text
+     *
+     * "address:port" (the Endpoint::toString() form) yields the same key as
+     * from(Endpoint); any other text is hashed. Implicit so callers that
+     * still name connections by string keep working.
+     */
+    EndpointKey(std::string_view text) noexcept;  // NOLINT: implicit
+    EndpointKey(const std::string& text) noexcept  // NOLINT: implicit
+        : EndpointKey(std::string_view(text)) {}
+    EndpointKey(const char* text) noexcept  // NOLINT: implicit
+        : EndpointKey(std::string_view(text != nullptr ? text : "")) {}
+
+    /// Key of an endpoint, parsing its address without allocating
+    [[nodiscard]] static EndpointKey from(const Endpoint& endpoint) noexcept;
+
+    /// Key of an IPv4 address in network byte order
+    [[nodiscard]] static EndpointKey fromV4(
+        const std::array<std::uint8_t, 4>& bytes, std::uint16_t port) noexcept;
+
+    /// Key of an IPv6 address in network byte order
+    [[nodiscard]] static EndpointKey fromV6(
+        const std::array<std::uint8_t, 16>& bytes,
+        std::uint16_t port) noexcept;
+
+    [[nodiscard]] bool operator==(const EndpointKey& other) const noexcept {
+        return hash == other.hash && port == other.port &&
+               family == other.family && address == other.address;
+    }
+
+   private:
+    void computeHash() noexcept;
+};
+
+/**
+ * @brief Print "address:port" (text keys print as "text#<hash>")
+ *
+ * Formats on demand, for logs only.
+ */
+std::ostream& operator<<(std::ostream& os, const EndpointKey& key);
+
+}  // namespace rtype::network
+
+template <>
+struct std::hash<rtype::network::EndpointKey> {
+    [[nodiscard]] std::size_t operator()(
+        const rtype::network::EndpointKey& key) const noexcept {
+        return key.hash;
+    }
+};
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistoryCodec - Implementation
+*/
+
+#include "InputHistoryCodec.hpp"
+
+#include "Serializer.hpp"
+#include "bitstream/BitStream.hpp"
+
+namespace rtype::network {
+
+namespace {
+
+constexpr std::uint16_t kMaskValues = (1U << InputHistoryCodec::kMaskBits) - 1;
+
+/// Worst case: full mask first, then a 32-bit gap and a new mask per frame
+constexpr std::size_t kWorstCaseBits =
+    InputHistoryCodec::kMaskBits +
+    (kMaxInputHistoryFrames - 1) *
+        (VarUint::encodedBits(0xFFFFFFFFU) + 1 + InputHistoryCodec::kMaskBits);
+static_assert(sizeof(InputHistoryHeader) + (kWorstCaseBits + 7) / 8 <=
+                  kMaxInputHistoryPayloadSize,
+              "kMaxInputHistoryPayloadSize must fit a full input history");
+
+}  // namespace
+
+Buffer InputHistoryCodec::encode(std::span<const InputFrame> frames) {
+    if (frames.empty()) {
+        return {};
+    }
+
+    BitWriter writer(16);
+    writer.writeBits(frames[0].inputMask, kMaskBits);
+
+    std::size_t count = 1;
+    for (; count < frames.size() && count < kMaxInputHistoryFrames; ++count) {
+        const auto& newer = frames[count - 1];
+        const auto& frame = frames[count];
+        if (frame.tick >= newer.tick) {
+            break;
+        }
+        writer.writeVarUint(newer.tick - frame.tick - 1);
+        const bool same =
+            (frame.inputMask & kMaskValues) == (newer.inputMask & kMaskValues);
+        writer.writeBool(same);
+        if (!same) {
+            writer.writeBits(frame.inputMask, kMaskBits);
+        }
+    }
+
+    InputHistoryHeader header{};
+    header.newestTick = frames[0].tick;
+    header.frameCount = static_cast<std::uint8_t>(count);
+
+    Buffer bits = std::move(writer).finish();
+    Buffer payload = Serializer::serializeForNetwork(header);
+    payload.insert(payload.end(), bits.begin(), bits.end());
+    return payload;
+}
+
+Result<std::vector<InputFrame>> InputHistoryCodec::decode(
+    std::span<const std::uint8_t> payload) {
+    if (payload.size() < sizeof(InputHistoryHeader)) {
+        return Err<std::vector<InputFrame>>(NetworkError::PacketTooSmall);
+    }
+    const auto header = Serializer::deserializeFromNetwork<InputHistoryHeader>(
+        payload.first(sizeof(InputHistoryHeader)));
+    if (header.frameCount == 0 ||
+        header.frameCount > kMaxInputHistoryFrames) {
+        return Err<std::vector<InputFrame>>(NetworkError::MalformedPacket);
+    }
+
+    BitReader in(payload.subspan(sizeof(InputHistoryHeader)));
+    std::vector<InputFrame> frames;
+    frames.reserve(header.frameCount);
+
+    InputFrame frame;
+    frame.tick = header.newestTick;
+    frame.inputMask = static_cast<std::uint16_t>(in.readBits(kMaskBits));
+    frames.push_back(frame);
+
+    for (std::uint8_t i = 1; i < header.frameCount; ++i) {
+        const std::uint64_t step = std::uint64_t{in.readVarUint()} + 1;
+        if (step > frame.tick) {
+            return Err<std::vector<InputFrame>>(NetworkError::MalformedPacket);
+        }
+        frame.tick -= static_cast<std::uint32_t>(step);
+        if (!in.readBool()) {
+            frame.inputMask = static_cast<std::uint16_t>(in.readBits(kMaskBits));
+        }
+        frames.push_back(frame);
+    }
+
+    if (in.overflowed()) {
+        return Err<std::vector<InputFrame>>(NetworkError::MalformedPacket);
+    }
+    return Ok(std::move(frames));
+}
+
+}  // namespace rtype::network
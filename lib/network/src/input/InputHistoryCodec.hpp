@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistoryCodec - Redundant bit-packed C_INPUT payloads
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/Error.hpp"
+#include "core/Types.hpp"
+#include "protocol/Payloads.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Input mask held by a client during one of its simulation ticks
+ */
+struct InputFrame {
+    std::uint32_t tick{0};       ///< Client tick, from 1, one per tick
+    std::uint16_t inputMask{0};  ///< InputMask flags
+};
+
+/**
+ * @brief Encoder/decoder for the input history form of C_INPUT
+ *
+ * Payload layout:
+ * - InputHistoryHeader (5 bytes, network byte order)
+ * - BitWriter stream of frameCount frames, newest first:
+ *   - first frame: 9-bit input mask (its tick is the header's newestTick)
+ *   - next frames: tick gap to the previous (newer) frame minus one
+ *     (VarUint), then a "same mask" bit, then the 9-bit mask if it changed
+ *
+ * A client sends one frame per tick, so consecutive frames are one tick apart
+ * and mostly hold the same keys: each repeated frame costs 7 bits, so eight
+ * frames of unchanged keys take a 13-byte payload.
+ *
+ * Thread-safety: Stateless, all methods are thread-safe.
+ */
+class InputHistoryCodec {
+   public:
+    /// Bits of InputMask carried per frame (kWeaponSwitch is bit 8)
+    static constexpr unsigned kMaskBits = 9;
+
+    /**
+     * @brief Encode frames into a C_INPUT payload
+     *
+     * @param frames Frames newest first, with strictly decreasing ticks.
+     *        Encoding stops at the first frame out of order and after
+     *        kMaxInputHistoryFrames frames.
+     * @return Encoded payload, empty if frames is empty
+     */
+    [[nodiscard]] static Buffer encode(std::span<const InputFrame> frames);
+
+    /**
+     * @brief Decode a C_INPUT history payload
+     *
+     * @param payload Raw payload bytes
+     * @return Frames newest first, or PacketTooSmall / MalformedPacket
+     */
+    [[nodiscard]] static Result<std::vector<InputFrame>> decode(
+        std::span<const std::uint8_t> payload);
+
+    /**
+     * @brief True if a C_INPUT payload of this size is a history payload
+     *
+     * The single-mask InputPayload form is smaller than the history header.
+     */
+    [[nodiscard]] static constexpr bool isHistoryPayload(
+        std::size_t payloadSize) noexcept {
+        return payloadSize >= sizeof(InputHistoryHeader);
+    }
+};
+
+}  // namespace rtype::network
@@ -94,8 +94,12 @@ struct is_rfc_type<GameOverPayload> : std::true_type {};
 template <>
 struct is_rfc_type<InputPayload> : std::true_type {};
 template <>
+struct is_rfc_type<InputHistoryHeader> : std::true_type {};
+template <>
 struct is_rfc_type<ConnectPayload> : std::true_type {};
 template <>
+struct is_rfc_type<ConnectTokenPayload> : std::true_type {};
+template <>
 struct is_rfc_type<DisconnectPayload> : std::true_type {};
 template <>
 struct is_rfc_type<ChatPayload> : std::true_type {};
@@ -109,6 +113,12 @@ struct is_rfc_type<EntityMoveBatchHeader> : std::true_type {};
 template <>
 struct is_rfc_type<EntityMoveBatchEntry> : std::true_type {};
 template <>
+struct is_rfc_type<SnapshotHeader> : std::true_type {};
+template <>
+struct is_rfc_type<SnapshotAckPayload> : std::true_type {};
+template <>
+struct is_rfc_type<CompressionDictionaryPayload> : std::true_type {};
+template <>
 struct is_rfc_type<LobbyReadyPayload> : std::true_type {};
 template <>
 struct is_rfc_type<GameStartPayload> : std::true_type {};
@@ -307,6 +317,8 @@ fromNetwork(const T& data) noexcept {
     UpdatePosPayload result;
     result.posX = ByteOrder::toNetwork(p.posX);
     result.posY = ByteOrder::toNetwork(p.posY);
+    result.ackInputSeq = ByteOrder::toNetwork(p.ackInputSeq);
+    result.moveSpeed = ByteOrder::toNetwork(p.moveSpeed);
     return result;
 }
 
@@ -315,6 +327,8 @@ fromNetwork(const T& data) noexcept {
     UpdatePosPayload result;
     result.posX = ByteOrder::fromNetwork(p.posX);
     result.posY = ByteOrder::fromNetwork(p.posY);
+    result.ackInputSeq = ByteOrder::fromNetwork(p.ackInputSeq);
+    result.moveSpeed = ByteOrder::fromNetwork(p.moveSpeed);
     return result;
 }
 
@@ -352,6 +366,21 @@ fromNetwork(const T& data) noexcept {
     return p;
 }
 
+[[nodiscard]] inline InputHistoryHeader toNetwork(
+    const InputHistoryHeader& p) noexcept {
+    InputHistoryHeader result;
+    result.newestTick = ByteOrder::toNetwork(p.newestTick);
+    result.frameCount = p.frameCount;
+    return result;
+}
+[[nodiscard]] inline InputHistoryHeader fromNetwork(
+    const InputHistoryHeader& p) noexcept {
+    InputHistoryHeader result;
+    result.newestTick = ByteOrder::fromNetwork(p.newestTick);
+    result.frameCount = p.frameCount;
+    return result;
+}
+
 [[nodiscard]] inline ConnectPayload toNetwork(
     const ConnectPayload& p) noexcept {
     return p;
@@ -361,6 +390,15 @@ fromNetwork(const T& data) noexcept {
     return p;
 }
 
+[[nodiscard]] inline ConnectTokenPayload toNetwork(
+    const ConnectTokenPayload& p) noexcept {
+    return p;
+}
+[[nodiscard]] inline ConnectTokenPayload fromNetwork(
+    const ConnectTokenPayload& p) noexcept {
+    return p;
+}
+
 [[nodiscard]] inline DisconnectPayload toNetwork(
     const DisconnectPayload& p) noexcept {
     return p;
@@ -420,6 +458,49 @@ fromNetwork(const T& data) noexcept {
     return result;
 }
 
+[[nodiscard]] inline SnapshotHeader toNetwork(
+    const SnapshotHeader& p) noexcept {
+    SnapshotHeader result;
+    result.serverTick = ByteOrder::toNetwork(p.serverTick);
+    result.baselineTick = ByteOrder::toNetwork(p.baselineTick);
+    result.recordCount = ByteOrder::toNetwork(p.recordCount);
+    return result;
+}
+[[nodiscard]] inline SnapshotHeader fromNetwork(
+    const SnapshotHeader& p) noexcept {
+    SnapshotHeader result;
+    result.serverTick = ByteOrder::fromNetwork(p.serverTick);
+    result.baselineTick = ByteOrder::fromNetwork(p.baselineTick);
+    result.recordCount = ByteOrder::fromNetwork(p.recordCount);
+    return result;
+}
+
+[[nodiscard]] inline SnapshotAckPayload toNetwork(
+    const SnapshotAckPayload& p) noexcept {
+    SnapshotAckPayload result;
+    result.serverTick = ByteOrder::toNetwork(p.serverTick);
+    return result;
+}
+[[nodiscard]] inline SnapshotAckPayload fromNetwork(
+    const SnapshotAckPayload& p) noexcept {
+    SnapshotAckPayload result;
+    result.serverTick = ByteOrder::fromNetwork(p.serverTick);
+    return result;
+}
+
+[[nodiscard]] inline CompressionDictionaryPayload toNetwork(
+    const CompressionDictionaryPayload& p) noexcept {
+    CompressionDictionaryPayload result;
+    result.dictionaryId = ByteOrder::toNetwork(p.dictionaryId);
+    return result;
+}
+[[nodiscard]] inline CompressionDictionaryPayload fromNetwork(
+    const CompressionDictionaryPayload& p) noexcept {
+    CompressionDictionaryPayload result;
+    result.dictionaryId = ByteOrder::fromNetwork(p.dictionaryId);
+    return result;
+}
+
 [[nodiscard]] inline LobbyReadyPayload toNetwork(const LobbyReadyPayload& p) noexcept {
     return p;
 }
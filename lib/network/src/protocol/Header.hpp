@@ -53,6 +53,9 @@ inline constexpr std::uint8_t kIsAck = 0x02;
 
 /// Payload is LZ4-compressed (RFC RTGP v1.4.0)
 inline constexpr std::uint8_t kCompressed = 0x04;
+
+/// Payload is an LZ4 block compressed with the per-opcode dictionary
+inline constexpr std::uint8_t kDictCompressed = 0x08;
 }  // namespace Flags
 
 #pragma pack(push, 1)
@@ -92,12 +92,18 @@ enum class OpCode : std::uint8_t {
     /// Server announces a level change with visual notification (RELIABLE)
     S_LEVEL_ANNOUNCE = 0x18,
 
+    /// Server sends a delta-compressed world snapshot (UNRELIABLE)
+    S_SNAPSHOT = 0x19,
+
     /// Client sends input state (UNRELIABLE)
     C_INPUT = 0x20,
 
     /// Server sends authoritative position (UNRELIABLE)
     S_UPDATE_POS = 0x21,
 
+    /// Client acknowledges the last decoded world snapshot (UNRELIABLE)
+    C_SNAPSHOT_ACK = 0x22,
+
     /// Latency measurement request (UNRELIABLE)
     PING = 0xF0,
 
@@ -107,6 +113,12 @@ enum class OpCode : std::uint8_t {
     /// Acknowledgment packet (UNRELIABLE)
     ACK = 0xF2,
 
+    /// Client offers its compression dictionary set id (RELIABLE)
+    C_COMPRESSION_OFFER = 0xF3,
+
+    /// Server answers with the dictionary set id it will use (RELIABLE)
+    S_COMPRESSION_SELECT = 0xF4,
+
     /// Client sends chat message (RELIABLE)
     C_CHAT = 0x30,
 
@@ -168,12 +180,16 @@ constexpr std::uint8_t kSystemMax = 0xFF;
         case OpCode::S_CHAT:
         case OpCode::C_ADMIN_COMMAND:
         case OpCode::S_ADMIN_RESPONSE:
+        case OpCode::C_COMPRESSION_OFFER:
+        case OpCode::S_COMPRESSION_SELECT:
             return true;
 
         case OpCode::S_ENTITY_MOVE:
         case OpCode::S_ENTITY_MOVE_BATCH:
+        case OpCode::S_SNAPSHOT:
         case OpCode::C_INPUT:
         case OpCode::S_UPDATE_POS:
+        case OpCode::C_SNAPSHOT_ACK:
         case OpCode::PING:
         case OpCode::PONG:
         case OpCode::ACK:
@@ -196,8 +212,10 @@ constexpr std::uint8_t kSystemMax = 0xFF;
         case OpCode::C_JOIN_LOBBY:
         case OpCode::C_SET_BANDWIDTH_MODE:
         case OpCode::C_INPUT:
+        case OpCode::C_SNAPSHOT_ACK:
         case OpCode::C_CHAT:
         case OpCode::C_ADMIN_COMMAND:
+        case OpCode::C_COMPRESSION_OFFER:
         case OpCode::PING:
             return true;
 
@@ -228,6 +246,7 @@ constexpr std::uint8_t kSystemMax = 0xFF;
         case OpCode::S_ENTITY_SPAWN:
         case OpCode::S_ENTITY_MOVE:
         case OpCode::S_ENTITY_MOVE_BATCH:
+        case OpCode::S_SNAPSHOT:
         case OpCode::S_ENTITY_DESTROY:
         case OpCode::S_ENTITY_HEALTH:
         case OpCode::S_POWERUP_EVENT:
@@ -235,6 +254,7 @@ constexpr std::uint8_t kSystemMax = 0xFF;
         case OpCode::S_BANDWIDTH_MODE_CHANGED:
         case OpCode::S_CHAT:
         case OpCode::S_ADMIN_RESPONSE:
+        case OpCode::S_COMPRESSION_SELECT:
         case OpCode::PONG:
             return true;
 
@@ -274,13 +294,17 @@ constexpr std::uint8_t kSystemMax = 0xFF;
         case OpCode::S_ENTITY_DESTROY:
         case OpCode::S_ENTITY_HEALTH:
         case OpCode::S_POWERUP_EVENT:
+        case OpCode::S_SNAPSHOT:
         case OpCode::C_INPUT:
         case OpCode::S_UPDATE_POS:
+        case OpCode::C_SNAPSHOT_ACK:
         case OpCode::C_SET_BANDWIDTH_MODE:
         case OpCode::S_BANDWIDTH_MODE_CHANGED:
         case OpCode::PING:
         case OpCode::PONG:
         case OpCode::ACK:
+        case OpCode::C_COMPRESSION_OFFER:
+        case OpCode::S_COMPRESSION_SELECT:
         case OpCode::C_CHAT:
         case OpCode::S_CHAT:
         case OpCode::C_ADMIN_COMMAND:
@@ -356,6 +380,8 @@ constexpr std::uint8_t kSystemMax = 0xFF;
             return "S_ENTITY_MOVE";
         case OpCode::S_ENTITY_MOVE_BATCH:
             return "S_ENTITY_MOVE_BATCH";
+        case OpCode::S_SNAPSHOT:
+            return "S_SNAPSHOT";
         case OpCode::C_SET_BANDWIDTH_MODE:
             return "C_SET_BANDWIDTH_MODE";
         case OpCode::S_BANDWIDTH_MODE_CHANGED:
@@ -374,12 +400,18 @@ constexpr std::uint8_t kSystemMax = 0xFF;
             return "S_CHAT";
         case OpCode::S_UPDATE_POS:
             return "S_UPDATE_POS";
+        case OpCode::C_SNAPSHOT_ACK:
+            return "C_SNAPSHOT_ACK";
         case OpCode::PING:
             return "PING";
         case OpCode::PONG:
             return "PONG";
         case OpCode::ACK:
             return "ACK";
+        case OpCode::C_COMPRESSION_OFFER:
+            return "C_COMPRESSION_OFFER";
+        case OpCode::S_COMPRESSION_SELECT:
+            return "S_COMPRESSION_SELECT";
         case OpCode::C_ADMIN_COMMAND:
             return "C_ADMIN_COMMAND";
         case OpCode::S_ADMIN_RESPONSE:
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** PayloadLayouts - Bit layouts of RTGP payload structs
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "Payloads.hpp"
+#include "bitstream/BitLayout.hpp"
+
+namespace rtype::network {
+
+/**
+ * Bit layouts for payloads that are packed into bit streams (see
+ * bitstream/BitLayout.hpp). Entity ids use Varint since live ids are small,
+ * quantized int16 values keep their full range.
+ */
+
+template <>
+struct BitLayout<InputPayload> {
+    /// Highest defined InputMask bit is kWeaponSwitch (0x100)
+    using Fields =
+        BitFields<BitField<&InputPayload::inputMask, BitEncoding::Bits<9>>>;
+};
+
+template <>
+struct BitLayout<EntityDestroyPayload> {
+    using Fields = BitFields<
+        BitField<&EntityDestroyPayload::entityId, BitEncoding::Varint>>;
+};
+
+template <>
+struct BitLayout<EntityHealthPayload> {
+    using Fields = BitFields<
+        BitField<&EntityHealthPayload::entityId, BitEncoding::Varint>,
+        BitField<&EntityHealthPayload::current, BitEncoding::SignedVarint>,
+        BitField<&EntityHealthPayload::max, BitEncoding::SignedVarint>>;
+};
+
+template <>
+struct BitLayout<EntityMoveBatchEntry> {
+    using Int16 = BitEncoding::Ranged<std::numeric_limits<std::int16_t>::min(),
+                                      std::numeric_limits<std::int16_t>::max()>;
+    using Fields = BitFields<
+        BitField<&EntityMoveBatchEntry::entityId, BitEncoding::Varint>,
+        BitField<&EntityMoveBatchEntry::posX, Int16>,
+        BitField<&EntityMoveBatchEntry::posY, Int16>,
+        BitField<&EntityMoveBatchEntry::velX, Int16>,
+        BitField<&EntityMoveBatchEntry::velY, Int16>>;
+};
+
+template <>
+struct BitLayout<SnapshotAckPayload> {
+    using Fields = BitFields<
+        BitField<&SnapshotAckPayload::serverTick, BitEncoding::Varint>>;
+};
+
+}  // namespace rtype::network
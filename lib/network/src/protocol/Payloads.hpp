@@ -70,6 +70,17 @@ inline constexpr std::uint16_t kWeaponSwitch = 0x100;
  */
 struct ConnectPayload {};
 
+/**
+ * @brief Optional C_CONNECT (0x01) payload carrying a lobby code
+ *
+ * Lets a server that serves several lobbies behind one UDP port route the
+ * handshake before a user ID exists. Servers with one lobby per port ignore
+ * it, so the plain empty C_CONNECT stays valid.
+ */
+struct ConnectTokenPayload {
+    std::array<char, 6> lobbyCode;
+};
+
 /**
  * @brief Payload for S_ACCEPT (0x02)
  *
@@ -303,6 +314,30 @@ struct LevelAnnouncePayload {
     std::array<char, 32> levelMusic;
 };
 
+/**
+ * @brief Header for S_SNAPSHOT (0x19)
+ *
+ * Variable-length payload: header (10 bytes) followed by a bit-packed stream
+ * of `recordCount` entity delta records (see snapshot/SnapshotCodec.hpp).
+ * A baselineTick of 0 means the records are relative to an empty world
+ * (full snapshot).
+ */
+struct SnapshotHeader {
+    std::uint32_t serverTick;    ///< Tick this snapshot describes
+    std::uint32_t baselineTick;  ///< Acked snapshot the delta is built on
+    std::uint16_t recordCount;   ///< Number of encoded entity records
+};
+
+/**
+ * @brief Payload for C_SNAPSHOT_ACK (0x22)
+ *
+ * Client acknowledges the latest snapshot it decoded so the server can use it
+ * as the next delta baseline.
+ */
+struct SnapshotAckPayload {
+    std::uint32_t serverTick;
+};
+
 /**
  * @brief Payload for C_INPUT (0x20)
  *
@@ -341,6 +376,25 @@ struct InputPayload {
     }
 };
 
+/// Most input frames one C_INPUT history payload may carry
+inline constexpr std::size_t kMaxInputHistoryFrames = 16;
+/// Upper bound of a C_INPUT history payload (header + worst-case frames)
+inline constexpr std::size_t kMaxInputHistoryPayloadSize = 96;
+
+/**
+ * @brief Header of the redundant form of C_INPUT (0x20)
+ *
+ * Variable-length payload: header (5 bytes) followed by a bit-packed stream
+ * of `frameCount` input frames, newest first (see
+ * input/InputHistoryCodec.hpp). Every packet repeats the last few frames, so
+ * a lost datagram is covered by the next one. The 2-byte InputPayload form
+ * stays valid; the payload size tells them apart.
+ */
+struct InputHistoryHeader {
+    std::uint32_t newestTick;  ///< Client tick of the first frame
+    std::uint8_t frameCount;   ///< Number of encoded frames (1-16)
+};
+
 /**
  * @brief Payload for S_UPDATE_POS (0x21)
  *
@@ -349,6 +403,20 @@ struct InputPayload {
 struct UpdatePosPayload {
     float posX;
     float posY;
+    /// Header seqId of the last C_INPUT applied (prediction replays from it)
+    std::uint16_t ackInputSeq;
+    /// Speed (px/s per axis) the server moves the ship at for the held input
+    float moveSpeed;
+};
+
+/**
+ * @brief Payload for C_COMPRESSION_OFFER and S_COMPRESSION_SELECT (0xF3/0xF4)
+ *
+ * The client offers the id of the dictionary set it loaded, the server
+ * echoes it if it holds the same set, 0 otherwise.
+ */
+struct CompressionDictionaryPayload {
+    std::uint32_t dictionaryId;  ///< DictionarySet id, 0 = no dictionary
 };
 
 /**
@@ -456,6 +524,8 @@ struct AdminResponsePayload {
 static_assert(sizeof(ConnectPayload) == 1,
               "ConnectPayload is an empty struct (size 1 in C++), "
               "serialization returns 0 bytes");
+static_assert(sizeof(ConnectTokenPayload) == 6,
+              "ConnectTokenPayload must be 6 bytes (char[6])");
 static_assert(sizeof(DisconnectPayload) == 1,
               "DisconnectPayload must be exactly 1 byte (reason)");
 static_assert(sizeof(GetUsersRequestPayload) == 1,
@@ -490,6 +560,12 @@ static_assert(sizeof(EntityMoveBatchHeader) == 5,
               "EntityMoveBatchHeader must be 5 bytes (1+4)");
 static_assert(sizeof(EntityMoveBatchEntry) == 12,
               "EntityMoveBatchEntry must be 12 bytes (4+2+2+2+2)");
+static_assert(sizeof(SnapshotHeader) == 10,
+              "SnapshotHeader must be 10 bytes (4+4+2)");
+static_assert(sizeof(SnapshotAckPayload) == 4,
+              "SnapshotAckPayload must be 4 bytes (uint32_t)");
+static_assert(sizeof(CompressionDictionaryPayload) == 4,
+              "CompressionDictionaryPayload must be 4 bytes (uint32_t)");
 static_assert(sizeof(EntityDestroyPayload) == 4,
               "EntityDestroyPayload must be 4 bytes");
 static_assert(sizeof(EntityHealthPayload) == 12,
@@ -497,8 +573,10 @@ static_assert(sizeof(EntityHealthPayload) == 12,
 static_assert(sizeof(PowerUpEventPayload) == 9,
               "PowerUpEventPayload must be 9 bytes (4+1+4)");
 static_assert(sizeof(InputPayload) == 2, "InputPayload must be 2 bytes");
-static_assert(sizeof(UpdatePosPayload) == 8,
-              "UpdatePosPayload must be 8 bytes (4+4)");
+static_assert(sizeof(InputHistoryHeader) == 5,
+              "InputHistoryHeader must be 5 bytes (4+1)");
+static_assert(sizeof(UpdatePosPayload) == 14,
+              "UpdatePosPayload must be 14 bytes (4+4+2+4)");
 static_assert(sizeof(GameStartPayload) == 4,
               "GameStartPayload must be 4 bytes (float)");
 static_assert(sizeof(PlayerReadyStatePayload) == 5,
@@ -524,6 +602,10 @@ static_assert(std::is_trivially_copyable_v<GameOverPayload>);
 static_assert(std::is_trivially_copyable_v<EntitySpawnPayload>);
 static_assert(std::is_trivially_copyable_v<EntityMovePayload>);
 static_assert(std::is_trivially_copyable_v<EntityMoveBatchHeader>);
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(std::is_trivially_copyable_v<InputHistoryHeader>);
+static_assert(std::is_trivially_copyable_v<SnapshotAckPayload>);
+static_assert(std::is_trivially_copyable_v<CompressionDictionaryPayload>);
 static_assert(std::is_trivially_copyable_v<EntityDestroyPayload>);
 static_assert(std::is_trivially_copyable_v<EntityHealthPayload>);
 static_assert(std::is_trivially_copyable_v<PowerUpEventPayload>);
@@ -542,6 +624,9 @@ static_assert(std::is_standard_layout_v<GameOverPayload>);
 static_assert(std::is_standard_layout_v<EntitySpawnPayload>);
 static_assert(std::is_standard_layout_v<EntityMovePayload>);
 static_assert(std::is_standard_layout_v<EntityMoveBatchHeader>);
+static_assert(std::is_standard_layout_v<SnapshotHeader>);
+static_assert(std::is_standard_layout_v<SnapshotAckPayload>);
+static_assert(std::is_standard_layout_v<CompressionDictionaryPayload>);
 static_assert(std::is_standard_layout_v<EntityDestroyPayload>);
 static_assert(std::is_standard_layout_v<EntityHealthPayload>);
 static_assert(std::is_standard_layout_v<PowerUpEventPayload>);
@@ -610,6 +695,8 @@ static_assert(std::is_standard_layout_v<AdminResponsePayload>);
             return sizeof(EntityHealthPayload);
         case OpCode::S_POWERUP_EVENT:
             return sizeof(PowerUpEventPayload);
+        case OpCode::S_SNAPSHOT:
+            return 0;  // Variable-length payload
 
         case OpCode::C_CHAT:
         case OpCode::S_CHAT:
@@ -619,6 +706,8 @@ static_assert(std::is_standard_layout_v<AdminResponsePayload>);
             return sizeof(InputPayload);
         case OpCode::S_UPDATE_POS:
             return sizeof(UpdatePosPayload);
+        case OpCode::C_SNAPSHOT_ACK:
+            return sizeof(SnapshotAckPayload);
         case OpCode::DISCONNECT:
             return sizeof(DisconnectPayload);
 
@@ -626,6 +715,10 @@ static_assert(std::is_standard_layout_v<AdminResponsePayload>);
             return sizeof(AdminCommandPayload);
         case OpCode::S_ADMIN_RESPONSE:
             return sizeof(AdminResponsePayload);
+
+        case OpCode::C_COMPRESSION_OFFER:
+        case OpCode::S_COMPRESSION_SELECT:
+            return sizeof(CompressionDictionaryPayload);
     }
     return 0;
 }
@@ -636,6 +729,7 @@ static_assert(std::is_standard_layout_v<AdminResponsePayload>);
 [[nodiscard]] constexpr bool hasVariablePayload(OpCode opcode) noexcept {
     return opcode == OpCode::R_GET_USERS ||
            opcode == OpCode::S_ENTITY_MOVE_BATCH ||
+           opcode == OpCode::S_SNAPSHOT ||
            opcode == OpCode::S_LOBBY_LIST;
 }
 
@@ -7,12 +7,13 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
 #include <chrono>
 #include <cstdint>
-#include <map>
-#include <set>
-#include <string>
+#include <unordered_map>
 
+#include "../core/EndpointKey.hpp"
 #include "../core/Error.hpp"
 #include "Header.hpp"
 
@@ -20,11 +21,76 @@ namespace rtype::network {
 
 inline constexpr size_t kAntiReplayWindowSize = 1000;
 
+/**
+ * @brief Fixed bitmap of the sequence IDs received behind the newest one
+ *
+ * Bit i is set when (newest - i) was received. Advancing the newest ID
+ * shifts the bitmap, so tracking costs a few word operations and no heap,
+ * unlike a set of IDs.
+ */
+class ReplayWindow {
+   public:
+    /// Tracked distance; covers kAntiReplayWindowSize with whole words
+    static constexpr std::size_t kBits = 1024;
+
+    static_assert(kBits > kAntiReplayWindowSize,
+                  "Replay window must cover the anti-replay distance");
+
+    [[nodiscard]] bool test(std::size_t back) const noexcept {
+        return back < kBits &&
+               ((words_[back / 64] >> (back % 64)) & 1ULL) != 0;
+    }
+
+    void set(std::size_t back) noexcept {
+        if (back < kBits) {
+            words_[back / 64] |= 1ULL << (back % 64);
+        }
+    }
+
+    /// Move the newest ID forward by @p shift (older bits fall off)
+    void advance(std::size_t shift) noexcept {
+        if (shift >= kBits) {
+            clear();
+            return;
+        }
+        const std::size_t wordShift = shift / 64;
+        const std::size_t bitShift = shift % 64;
+        for (std::size_t i = kWords; i-- > 0;) {
+            std::uint64_t word = 0;
+            if (i >= wordShift) {
+                word = words_[i - wordShift] << bitShift;
+                if (bitShift != 0 && i > wordShift) {
+                    word |= words_[i - wordShift - 1] >> (64 - bitShift);
+                }
+            }
+            words_[i] = word;
+        }
+    }
+
+    void clear() noexcept { words_.fill(0); }
+
+    /// Number of IDs currently marked as received
+    [[nodiscard]] std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (auto word : words_) {
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+   private:
+    static constexpr std::size_t kWords = kBits / 64;
+    std::array<std::uint64_t, kWords> words_{};
+};
+
 /**
  * @brief Security context for tracking packet validation state
  *
  * Maintains per-connection state for anti-replay protection and sequence
- * tracking. Each endpoint/UserID combination has its own context.
+ * tracking. Each endpoint/UserID combination has its own context, keyed by
+ * EndpointKey so lookups on the packet path neither format nor allocate.
  */
 class SecurityContext {
    public:
@@ -34,7 +100,7 @@ class SecurityContext {
     struct ConnectionInfo {
         uint32_t userId;
         uint16_t lastValidSeqId;
-        std::set<uint16_t> receivedSeqs;
+        ReplayWindow receivedSeqs;
         std::chrono::steady_clock::time_point lastActivity;
         bool initialized;
 
@@ -49,28 +115,25 @@ class SecurityContext {
      * @brief Validate sequence ID for anti-replay protection
      *
      * As per RFC Section 6, packets with stale sequence IDs are discarded.
-     * Uses a sliding window to track received packets.
+     * Uses a fixed bitmap window (ReplayWindow) to track received packets.
      *
      * @param connectionKey Unique identifier for the connection
      * @param seqId Sequence ID to validate
      * @return Success if valid, InvalidSequence or DuplicatePacket error
      */
     [[nodiscard]] Result<void> validateSequenceId(
-        const std::string& connectionKey, uint16_t seqId) noexcept {
+        const EndpointKey& connectionKey, uint16_t seqId) noexcept {
         auto& info = connections_[connectionKey];
 
         if (!info.initialized) {
             info.lastValidSeqId = seqId;
-            info.receivedSeqs.insert(seqId);
+            info.receivedSeqs.clear();
+            info.receivedSeqs.set(0);
             info.initialized = true;
             info.lastActivity = std::chrono::steady_clock::now();
             return Result<void>::ok();
         }
 
-        if (info.receivedSeqs.count(seqId) > 0) {
-            return Result<void>::err(NetworkError::DuplicatePacket);
-        }
-
         int32_t distance = static_cast<int32_t>(seqId) -
                            static_cast<int32_t>(info.lastValidSeqId);
 
@@ -80,17 +143,19 @@ class SecurityContext {
             distance -= 65536;
         }
 
-        if (distance < -static_cast<int32_t>(kAntiReplayWindowSize)) {
-            return Result<void>::err(NetworkError::InvalidSequence);
-        }
-
-        info.receivedSeqs.insert(seqId);
         if (distance > 0) {
+            info.receivedSeqs.advance(static_cast<std::size_t>(distance));
+            info.receivedSeqs.set(0);
             info.lastValidSeqId = seqId;
-        }
-
-        while (info.receivedSeqs.size() > kAntiReplayWindowSize) {
-            info.receivedSeqs.erase(info.receivedSeqs.begin());
+        } else {
+            const auto back = static_cast<std::size_t>(-distance);
+            if (info.receivedSeqs.test(back)) {
+                return Result<void>::err(NetworkError::DuplicatePacket);
+            }
+            if (back > kAntiReplayWindowSize) {
+                return Result<void>::err(NetworkError::InvalidSequence);
+            }
+            info.receivedSeqs.set(back);
         }
 
         info.lastActivity = std::chrono::steady_clock::now();
@@ -104,10 +169,10 @@ class SecurityContext {
      * Prevents UserID spoofing.
      *
      * @param connectionKey Unique identifier for the connection (e.g.,
-     * "IP:Port")
+     * EndpointKey::from(endpoint))
      * @param userId The user ID to associate
      */
-    void registerConnection(const std::string& connectionKey,
+    void registerConnection(const EndpointKey& connectionKey,
                             uint32_t userId) noexcept {
         auto& info = connections_[connectionKey];
         info.userId = userId;
@@ -125,7 +190,7 @@ class SecurityContext {
      * @return Success if valid, InvalidUserId if mismatch
      */
     [[nodiscard]] Result<void> validateUserIdMapping(
-        const std::string& connectionKey, uint32_t claimedUserId) noexcept {
+        const EndpointKey& connectionKey, uint32_t claimedUserId) noexcept {
         auto it = connections_.find(connectionKey);
         if (it == connections_.end()) {
             if (claimedUserId == kUnassignedUserId) {
@@ -151,7 +216,7 @@ class SecurityContext {
     /**
      * @brief Remove a connection from tracking
      */
-    void removeConnection(const std::string& connectionKey) noexcept {
+    void removeConnection(const EndpointKey& connectionKey) noexcept {
         connections_.erase(connectionKey);
     }
 
@@ -163,7 +228,7 @@ class SecurityContext {
      * @throws std::out_of_range if connection not found
      */
     [[nodiscard]] const ConnectionInfo& getConnectionInfo(
-        const std::string& connectionKey) const {
+        const EndpointKey& connectionKey) const {
         return connections_.at(connectionKey);
     }
 
@@ -205,7 +270,7 @@ class SecurityContext {
     void clear() noexcept { connections_.clear(); }
 
    private:
-    std::map<std::string, ConnectionInfo> connections_;
+    std::unordered_map<EndpointKey, ConnectionInfo> connections_;
 };
 
 }  // namespace rtype::network
@@ -120,6 +120,19 @@ namespace Validator {
         return Result<void>::ok();
     }
 
+    // C_CONNECT may carry a lobby code token (shared-socket servers)
+    if (opcode == OpCode::C_CONNECT &&
+        payloadSize == sizeof(ConnectTokenPayload)) {
+        return Result<void>::ok();
+    }
+
+    // C_INPUT may carry a redundant input history instead of one mask
+    if (opcode == OpCode::C_INPUT &&
+        payloadSize >= sizeof(InputHistoryHeader) &&
+        payloadSize <= kMaxInputHistoryPayloadSize) {
+        return Result<void>::ok();
+    }
+
     std::size_t expected = getPayloadSize(opcode);
     if (payloadSize != expected) {
         return Result<void>::err(NetworkError::MalformedPacket);
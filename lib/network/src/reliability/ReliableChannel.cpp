@@ -33,11 +33,17 @@ Result<void> ReliableChannel::trackOutgoing(
     return Ok();
 }
 
-void ReliableChannel::recordAck(std::uint16_t ackId) noexcept {
+std::optional<ReliableChannel::Clock::duration> ReliableChannel::recordAck(
+    std::uint16_t ackId) noexcept {
     auto it = pendingPackets_.find(ackId);
-    if (it != pendingPackets_.end()) {
-        it->second.isAcked = true;
+    if (it == pendingPackets_.end() || it->second.isAcked) {
+        return std::nullopt;
     }
+    it->second.isAcked = true;
+    if (it->second.retryCount != 0) {
+        return std::nullopt;
+    }
+    return Clock::now() - it->second.sentTime;
 }
 
 std::vector<ReliableChannel::RetransmitPacket>
@@ -10,6 +10,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -104,8 +105,11 @@ class ReliableChannel {
      * Marks the corresponding packet as acknowledged.
      *
      * @param ackId Sequence ID being acknowledged
+     * @return Round-trip time of the packet, only for the first ACK of a
+     *         packet that was never retransmitted (Karn's algorithm: the
+     *         ACK of a resent packet cannot be matched to one send)
      */
-    void recordAck(std::uint16_t ackId) noexcept;
+    std::optional<Clock::duration> recordAck(std::uint16_t ackId) noexcept;
 
     /**
      * @brief Structure for packets that need retransmission
@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** Snapshot - Quantized world snapshot types for delta replication
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace rtype::network {
+
+/// Fixed-point scale applied to positions stored in a snapshot
+inline constexpr float kSnapshotPosScale = 16.0f;
+
+/// Fixed-point scale applied to velocities stored in a snapshot
+inline constexpr float kSnapshotVelScale = 16.0f;
+
+/**
+ * @brief Bit flags identifying which fields of an entity changed
+ *
+ * Used as the per-entity changed-field mask in S_SNAPSHOT delta records.
+ */
+namespace SnapshotField {
+inline constexpr std::uint8_t kPosX = 0x01;
+inline constexpr std::uint8_t kPosY = 0x02;
+inline constexpr std::uint8_t kVelX = 0x04;
+inline constexpr std::uint8_t kVelY = 0x08;
+inline constexpr std::uint8_t kHealth = 0x10;
+inline constexpr std::uint8_t kMaxHealth = 0x20;
+inline constexpr std::uint8_t kType = 0x40;
+inline constexpr std::uint8_t kAll = 0x7F;
+inline constexpr unsigned kMaskBits = 7;
+}  // namespace SnapshotField
+
+/**
+ * @brief Quantize a float to the fixed-point representation used in snapshots
+ * @param value Value in world units
+ * @param scale Fixed-point scale (units per world unit)
+ * @return Rounded value, saturated to the int32 range
+ */
+[[nodiscard]] inline std::int32_t quantizeSnapshotValue(float value,
+                                                        float scale) noexcept {
+    constexpr auto kMin = std::numeric_limits<std::int32_t>::min();
+    constexpr auto kMax = std::numeric_limits<std::int32_t>::max();
+    double scaled = static_cast<double>(value) * static_cast<double>(scale);
+    if (std::isnan(scaled)) {
+        return 0;
+    }
+    if (scaled >= static_cast<double>(kMax)) {
+        return kMax;
+    }
+    if (scaled <= static_cast<double>(kMin)) {
+        return kMin;
+    }
+    return static_cast<std::int32_t>(std::llround(scaled));
+}
+
+/**
+ * @brief Convert a quantized snapshot value back to world units
+ */
+[[nodiscard]] inline float dequantizeSnapshotValue(std::int32_t value,
+                                                   float scale) noexcept {
+    return static_cast<float>(value) / scale;
+}
+
+/**
+ * @brief Quantized replicated state of a single entity
+ */
+struct EntitySnapshotState {
+    std::uint32_t networkId{0};
+    std::uint8_t type{0};
+    std::int32_t posX{0};  ///< Quantized with kSnapshotPosScale
+    std::int32_t posY{0};  ///< Quantized with kSnapshotPosScale
+    std::int32_t velX{0};  ///< Quantized with kSnapshotVelScale
+    std::int32_t velY{0};  ///< Quantized with kSnapshotVelScale
+    std::int32_t health{0};
+    std::int32_t maxHealth{0};
+
+    /**
+     * @brief Compute the SnapshotField mask of fields differing from other
+     */
+    [[nodiscard]] std::uint8_t diffMask(
+        const EntitySnapshotState& other) const noexcept {
+        std::uint8_t mask = 0;
+        if (posX != other.posX) mask |= SnapshotField::kPosX;
+        if (posY != other.posY) mask |= SnapshotField::kPosY;
+        if (velX != other.velX) mask |= SnapshotField::kVelX;
+        if (velY != other.velY) mask |= SnapshotField::kVelY;
+        if (health != other.health) mask |= SnapshotField::kHealth;
+        if (maxHealth != other.maxHealth) mask |= SnapshotField::kMaxHealth;
+        if (type != other.type) mask |= SnapshotField::kType;
+        return mask;
+    }
+
+    bool operator==(const EntitySnapshotState& other) const = default;
+};
+
+/**
+ * @brief Full replicated world state for one server tick
+ *
+ * Entities are kept sorted by networkId so two snapshots can be diffed with a
+ * single linear merge.
+ */
+struct WorldSnapshot {
+    std::uint32_t tick{0};
+    std::vector<EntitySnapshotState> entities;
+
+    /**
+     * @brief Sort entities by networkId (required before encoding)
+     */
+    void sortEntities() {
+        std::sort(entities.begin(), entities.end(),
+                  [](const EntitySnapshotState& a,
+                     const EntitySnapshotState& b) {
+                      return a.networkId < b.networkId;
+                  });
+    }
+
+    /**
+     * @brief Find an entity by networkId (entities must be sorted)
+     * @return Pointer to the entity state, nullptr if absent
+     */
+    [[nodiscard]] const EntitySnapshotState* find(
+        std::uint32_t networkId) const noexcept {
+        auto it = std::lower_bound(
+            entities.begin(), entities.end(), networkId,
+            [](const EntitySnapshotState& e, std::uint32_t id) {
+                return e.networkId < id;
+            });
+        if (it == entities.end() || it->networkId != networkId) {
+            return nullptr;
+        }
+        return &*it;
+    }
+};
+
+}  // namespace rtype::network
@@ -0,0 +1,299 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** SnapshotCodec - Implementation
+*/
+
+#include "SnapshotCodec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "Serializer.hpp"
+#include "bitstream/BitLayout.hpp"
+
+namespace rtype::network {
+
+namespace {
+
+constexpr unsigned kKindBits = 2;
+constexpr unsigned kTypeBits = 8;
+
+/// Wrapping difference so every int32 pair round-trips exactly
+[[nodiscard]] std::int32_t wrappingDelta(std::int32_t to,
+                                         std::int32_t from) noexcept {
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(to) -
+                                     static_cast<std::uint32_t>(from));
+}
+
+[[nodiscard]] std::int32_t wrappingApply(std::int32_t base,
+                                         std::int32_t delta) noexcept {
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(base) +
+                                     static_cast<std::uint32_t>(delta));
+}
+
+/// Body of a Create record: raw type then every value field, absolute
+using CreateRecordLayout = BitFields<
+    BitField<&EntitySnapshotState::type, BitEncoding::Bits<kTypeBits>>,
+    BitField<&EntitySnapshotState::posX, BitEncoding::SignedVarint>,
+    BitField<&EntitySnapshotState::posY, BitEncoding::SignedVarint>,
+    BitField<&EntitySnapshotState::velX, BitEncoding::SignedVarint>,
+    BitField<&EntitySnapshotState::velY, BitEncoding::SignedVarint>,
+    BitField<&EntitySnapshotState::health, BitEncoding::SignedVarint>,
+    BitField<&EntitySnapshotState::maxHealth, BitEncoding::SignedVarint>>;
+
+/// Field accessors in SnapshotField bit order (type handled separately)
+constexpr std::array<std::int32_t EntitySnapshotState::*, 6> kValueFields = {
+    &EntitySnapshotState::posX,   &EntitySnapshotState::posY,
+    &EntitySnapshotState::velX,   &EntitySnapshotState::velY,
+    &EntitySnapshotState::health, &EntitySnapshotState::maxHealth,
+};
+
+/**
+ * @brief One pending record produced by diffing current against baseline
+ */
+struct PendingRecord {
+    SnapshotCodec::RecordKind kind;
+    const EntitySnapshotState* state;  ///< Current state (nullptr on Remove)
+    const EntitySnapshotState* base;   ///< Baseline state (nullptr on Create)
+    std::uint32_t networkId;
+    std::uint8_t mask;
+};
+
+[[nodiscard]] std::size_t recordBodyBits(const PendingRecord& rec) noexcept {
+    std::size_t bits = kKindBits;
+    switch (rec.kind) {
+        case SnapshotCodec::RecordKind::Update:
+            bits += SnapshotField::kMaskBits;
+            for (std::size_t i = 0; i < kValueFields.size(); ++i) {
+                if (rec.mask & (1U << i)) {
+                    std::int32_t delta =
+                        wrappingDelta(rec.state->*kValueFields[i],
+                                      rec.base->*kValueFields[i]);
+                    bits += VarUint::encodedBits(zigzagEncode(delta));
+                }
+            }
+            if (rec.mask & SnapshotField::kType) {
+                bits += kTypeBits;
+            }
+            break;
+        case SnapshotCodec::RecordKind::Create:
+            bits += CreateRecordLayout::bits(*rec.state);
+            break;
+        case SnapshotCodec::RecordKind::Remove:
+            break;
+    }
+    return bits;
+}
+
+void writeRecordBody(BitWriter& out, const PendingRecord& rec) {
+    out.writeBits(static_cast<std::uint32_t>(rec.kind), kKindBits);
+    switch (rec.kind) {
+        case SnapshotCodec::RecordKind::Update:
+            out.writeBits(rec.mask, SnapshotField::kMaskBits);
+            for (std::size_t i = 0; i < kValueFields.size(); ++i) {
+                if (rec.mask & (1U << i)) {
+                    out.writeVarInt(wrappingDelta(rec.state->*kValueFields[i],
+                                                  rec.base->*kValueFields[i]));
+                }
+            }
+            if (rec.mask & SnapshotField::kType) {
+                out.writeBits(rec.state->type, kTypeBits);
+            }
+            break;
+        case SnapshotCodec::RecordKind::Create:
+            CreateRecordLayout::write(out, *rec.state);
+            break;
+        case SnapshotCodec::RecordKind::Remove:
+            break;
+    }
+}
+
+void appendUntil(std::vector<EntitySnapshotState>& out,
+                 const std::vector<EntitySnapshotState>& base,
+                 std::size_t& index, std::uint32_t networkId) {
+    while (index < base.size() && base[index].networkId < networkId) {
+        out.push_back(base[index]);
+        ++index;
+    }
+}
+
+}  // namespace
+
+SnapshotCodec::EncodeResult SnapshotCodec::encode(
+    const WorldSnapshot& current, const WorldSnapshot* baseline,
+    std::size_t maxBytes) {
+    static const std::vector<EntitySnapshotState> kEmpty;
+    const auto& cur = current.entities;
+    const auto& base = baseline ? baseline->entities : kEmpty;
+
+    std::vector<PendingRecord> records;
+    records.reserve(cur.size());
+
+    std::size_t ci = 0;
+    std::size_t bi = 0;
+    while (ci < cur.size() || bi < base.size()) {
+        if (bi >= base.size() ||
+            (ci < cur.size() && cur[ci].networkId < base[bi].networkId)) {
+            records.push_back({RecordKind::Create, &cur[ci], nullptr,
+                               cur[ci].networkId, SnapshotField::kAll});
+            ++ci;
+        } else if (ci >= cur.size() ||
+                   base[bi].networkId < cur[ci].networkId) {
+            records.push_back({RecordKind::Remove, nullptr, &base[bi],
+                               base[bi].networkId, 0});
+            ++bi;
+        } else {
+            std::uint8_t mask = cur[ci].diffMask(base[bi]);
+            if (mask != 0) {
+                records.push_back({RecordKind::Update, &cur[ci], &base[bi],
+                                   cur[ci].networkId, mask});
+            }
+            ++ci;
+            ++bi;
+        }
+    }
+
+    EncodeResult result;
+    BitWriter writer(std::min(maxBytes, records.size() * 8));
+
+    const std::size_t headerBits = sizeof(SnapshotHeader) * 8;
+    const std::size_t budgetBits = maxBytes * 8;
+    std::size_t usedBits = headerBits;
+    std::uint32_t prevId = 0;
+    constexpr std::size_t kMaxRecords = 0xFFFF;
+
+    for (const auto& rec : records) {
+        std::uint32_t gap = rec.networkId - prevId;
+        std::size_t recBits = VarUint::encodedBits(gap) + recordBodyBits(rec);
+        if (usedBits + recBits > budgetBits ||
+            result.recordCount >= kMaxRecords) {
+            result.truncated = true;
+            break;
+        }
+        writer.writeVarUint(gap);
+        writeRecordBody(writer, rec);
+        usedBits += recBits;
+        prevId = rec.networkId;
+        ++result.recordCount;
+    }
+
+    SnapshotHeader header{};
+    header.serverTick = current.tick;
+    header.baselineTick = baseline ? baseline->tick : 0;
+    header.recordCount = static_cast<std::uint16_t>(result.recordCount);
+
+    Buffer bits = std::move(writer).finish();
+    result.payload = Serializer::serializeForNetwork(header);
+    result.payload.insert(result.payload.end(), bits.begin(), bits.end());
+    return result;
+}
+
+Result<SnapshotHeader> SnapshotCodec::peekHeader(
+    std::span<const std::uint8_t> payload) {
+    if (payload.size() < sizeof(SnapshotHeader)) {
+        return Err<SnapshotHeader>(NetworkError::PacketTooSmall);
+    }
+    return Ok(Serializer::deserializeFromNetwork<SnapshotHeader>(
+        payload.first(sizeof(SnapshotHeader))));
+}
+
+Result<WorldSnapshot> SnapshotCodec::decode(
+    std::span<const std::uint8_t> payload, const WorldSnapshot* baseline) {
+    auto headerResult = peekHeader(payload);
+    if (!headerResult) {
+        return Err<WorldSnapshot>(headerResult.error());
+    }
+    const auto header = headerResult.value();
+
+    static const std::vector<EntitySnapshotState> kEmpty;
+    if (header.baselineTick != 0 &&
+        (!baseline || baseline->tick != header.baselineTick)) {
+        return Err<WorldSnapshot>(NetworkError::InvalidSequence);
+    }
+    const auto& base =
+        (header.baselineTick != 0) ? baseline->entities : kEmpty;
+
+    WorldSnapshot snapshot;
+    snapshot.tick = header.serverTick;
+    snapshot.entities.reserve(base.size() + header.recordCount);
+
+    BitReader in(payload.subspan(sizeof(SnapshotHeader)));
+    std::size_t bi = 0;
+    std::uint32_t prevId = 0;
+
+    for (std::uint16_t r = 0; r < header.recordCount; ++r) {
+        std::uint32_t gap = in.readVarUint();
+        if (r > 0 && gap == 0) {
+            return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+        }
+        std::uint64_t id64 = std::uint64_t{prevId} + gap;
+        if (id64 > 0xFFFFFFFFULL) {
+            return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+        }
+        auto networkId = static_cast<std::uint32_t>(id64);
+        prevId = networkId;
+
+        appendUntil(snapshot.entities, base, bi, networkId);
+        const EntitySnapshotState* baseState =
+            (bi < base.size() && base[bi].networkId == networkId) ? &base[bi]
+                                                                  : nullptr;
+
+        auto kind = static_cast<RecordKind>(in.readBits(kKindBits));
+        switch (kind) {
+            case RecordKind::Update: {
+                if (!baseState) {
+                    return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+                }
+                EntitySnapshotState state = *baseState;
+                auto mask = static_cast<std::uint8_t>(
+                    in.readBits(SnapshotField::kMaskBits));
+                for (std::size_t i = 0; i < kValueFields.size(); ++i) {
+                    if (mask & (1U << i)) {
+                        state.*kValueFields[i] = wrappingApply(
+                            state.*kValueFields[i], in.readVarInt());
+                    }
+                }
+                if (mask & SnapshotField::kType) {
+                    state.type =
+                        static_cast<std::uint8_t>(in.readBits(kTypeBits));
+                }
+                snapshot.entities.push_back(state);
+                ++bi;
+                break;
+            }
+            case RecordKind::Create: {
+                EntitySnapshotState state{};
+                state.networkId = networkId;
+                CreateRecordLayout::read(in, state);
+                snapshot.entities.push_back(state);
+                if (baseState) {
+                    ++bi;
+                }
+                break;
+            }
+            case RecordKind::Remove:
+                if (!baseState) {
+                    return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+                }
+                ++bi;
+                break;
+            default:
+                return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+        }
+
+        if (in.overflowed()) {
+            return Err<WorldSnapshot>(NetworkError::MalformedPacket);
+        }
+    }
+
+    snapshot.entities.insert(snapshot.entities.end(),
+                             base.begin() + static_cast<std::ptrdiff_t>(bi),
+                             base.end());
+    return Ok(std::move(snapshot));
+}
+
+}  // namespace rtype::network
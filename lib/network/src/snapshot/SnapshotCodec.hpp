@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** SnapshotCodec - Bit-packed delta encoding of world snapshots
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Snapshot.hpp"
+#include "core/Error.hpp"
+#include "core/Types.hpp"
+#include "protocol/Header.hpp"
+#include "protocol/Payloads.hpp"
+
+namespace rtype::network {
+
+/**
+ * @brief Encoder/decoder for S_SNAPSHOT payloads
+ *
+ * Payload layout:
+ * - SnapshotHeader (10 bytes, network byte order)
+ * - BitWriter stream of recordCount records, sorted by networkId:
+ *   - id gap from the previous record (VarUint)
+ *   - 2-bit record kind (Update / Create / Remove)
+ *   - Update: 7-bit SnapshotField mask, then one zigzag VarUint delta per set
+ *     field (type is sent raw on 8 bits)
+ *   - Create: 8-bit type, then absolute pos/vel/health/maxHealth values
+ *   - Remove: no body
+ *
+ * VarUint costs a 2-bit width class plus 4, 8, 16 or 32 bits, so a typical
+ * per-tick movement delta costs 10 bits per axis.
+ *
+ * Entities identical to the baseline are omitted. When the encoded stream
+ * would exceed the byte budget, the remaining records are dropped: the payload
+ * stays valid and the receiver converges on a later tick. Callers that keep
+ * a history must then store decode(payload, baseline) rather than the input
+ * snapshot, since that is what the peer will actually hold.
+ *
+ * Thread-safety: Stateless, all methods are thread-safe.
+ */
+class SnapshotCodec {
+   public:
+    /**
+     * @brief Kind of an encoded entity record
+     */
+    enum class RecordKind : std::uint8_t {
+        Update = 0,  ///< Entity exists in baseline, changed fields follow
+        Create = 1,  ///< Entity absent from baseline, full state follows
+        Remove = 2,  ///< Entity present in baseline, gone from this snapshot
+    };
+
+    /**
+     * @brief Result of an encode operation
+     */
+    struct EncodeResult {
+        Buffer payload;               ///< Serialized S_SNAPSHOT payload
+        std::size_t recordCount{0};   ///< Records written to the payload
+        bool truncated{false};        ///< True if records were dropped
+    };
+
+    /**
+     * @brief Encode a snapshot as a delta against a baseline
+     *
+     * @param current Snapshot to send (entities must be sorted)
+     * @param baseline Last snapshot acked by the peer, nullptr for a full
+     * snapshot
+     * @param maxBytes Payload byte budget
+     * @return Encoded payload and bookkeeping
+     */
+    [[nodiscard]] static EncodeResult encode(
+        const WorldSnapshot& current, const WorldSnapshot* baseline,
+        std::size_t maxBytes = kMaxPayloadSize);
+
+    /**
+     * @brief Decode an S_SNAPSHOT payload
+     *
+     * @param payload Raw payload bytes
+     * @param baseline Snapshot matching the payload's baselineTick (ignored
+     * for full snapshots)
+     * @return Reconstructed snapshot, or MalformedPacket / InvalidSequence if
+     * the payload is corrupt or the baseline does not match
+     */
+    [[nodiscard]] static Result<WorldSnapshot> decode(
+        std::span<const std::uint8_t> payload, const WorldSnapshot* baseline);
+
+    /**
+     * @brief Read only the fixed header of an S_SNAPSHOT payload
+     *
+     * Lets the receiver pick the right baseline before decoding.
+     */
+    [[nodiscard]] static Result<SnapshotHeader> peekHeader(
+        std::span<const std::uint8_t> payload);
+};
+
+}  // namespace rtype::network
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** SnapshotRing - Fixed-size history of world snapshots indexed by tick
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Snapshot.hpp"
+
+namespace rtype::network {
+
+/// Number of snapshots kept per peer (~0.5s of history at 60 Hz)
+inline constexpr std::size_t kSnapshotHistorySize = 32;
+
+/**
+ * @brief Fixed-capacity ring of snapshots addressed by server tick
+ *
+ * Slot = tick % Capacity. A lookup only succeeds if the slot still holds the
+ * requested tick, so baselines older than Capacity ticks are implicitly
+ * evicted and the encoder falls back to a full snapshot.
+ *
+ * Snapshots are held through shared_ptr<const> so a single encoded world
+ * state can be shared by every client history that references it.
+ *
+ * Thread-safety: Not thread-safe, owned by a single network thread.
+ *
+ * @tparam Capacity Number of retained snapshots
+ */
+template <std::size_t Capacity = kSnapshotHistorySize>
+class SnapshotRing {
+    static_assert(Capacity > 0, "SnapshotRing capacity must be non-zero");
+
+   public:
+    using SnapshotPtr = std::shared_ptr<const WorldSnapshot>;
+
+    /**
+     * @brief Store a snapshot, replacing whatever occupied its slot
+     */
+    void push(SnapshotPtr snapshot) {
+        if (!snapshot) {
+            return;
+        }
+        slots_[snapshot->tick % Capacity] = std::move(snapshot);
+    }
+
+    /**
+     * @brief Find the snapshot recorded for a given tick
+     * @return The snapshot, or nullptr if it was never stored or was evicted
+     */
+    [[nodiscard]] SnapshotPtr find(std::uint32_t tick) const noexcept {
+        const auto& slot = slots_[tick % Capacity];
+        if (slot && slot->tick == tick) {
+            return slot;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Drop every stored snapshot
+     */
+    void clear() noexcept {
+        for (auto& slot : slots_) {
+            slot.reset();
+        }
+    }
+
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+   private:
+    std::array<SnapshotPtr, Capacity> slots_{};
+};
+
+using SnapshotHistory = SnapshotRing<>;
+
+}  // namespace rtype::network
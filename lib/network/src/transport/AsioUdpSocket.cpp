@@ -7,6 +7,7 @@
 
 #include "AsioUdpSocket.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -131,9 +132,10 @@ void AsioUdpSocket::asyncReceiveFrom(std::shared_ptr<Buffer> buffer,
                 }
             } else {
                 buffer->resize(bytesReceived);
-                auto endpoint = fromAsioEndpoint(remoteEndpoint_);
-                sender->address = std::move(endpoint.address);
-                sender->port = endpoint.port;
+                // Copy-assign reuses the sender's buffer: no formatting or
+                // allocation for a peer already in the cache
+                sender->address = cachedAddress(remoteEndpoint_.address());
+                sender->port = remoteEndpoint_.port();
                 if (handler) {
                     handler(Ok(bytesReceived));
                 }
@@ -197,8 +199,25 @@ NetworkError AsioUdpSocket::fromAsioError(const asio::error_code& ec) noexcept {
     return NetworkError::InternalError;
 }
 
-Endpoint AsioUdpSocket::fromAsioEndpoint(const asio::ip::udp::endpoint& ep) {
-    return Endpoint{ep.address().to_string(), ep.port()};
+const std::string& AsioUdpSocket::cachedAddress(
+    const asio::ip::address& address) {
+    EndpointKey key;
+    if (address.is_v4()) {
+        const auto bytes = address.to_v4().to_bytes();
+        key = EndpointKey::fromV4({bytes[0], bytes[1], bytes[2], bytes[3]}, 0);
+    } else {
+        const auto bytes = address.to_v6().to_bytes();
+        std::array<std::uint8_t, 16> raw{};
+        std::copy(bytes.begin(), bytes.end(), raw.begin());
+        key = EndpointKey::fromV6(raw, 0);
+    }
+
+    auto& entry = addressCache_[key.hash % kAddressCacheSize];
+    if (entry.key != key) {
+        entry.key = key;
+        entry.text = address.to_string();
+    }
+    return entry.text;
 }
 
 asio::ip::udp::endpoint AsioUdpSocket::toAsioEndpoint(const Endpoint& ep) {
@@ -7,13 +7,16 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include <asio.hpp>
 
 #include "IAsyncSocket.hpp"
+#include "core/EndpointKey.hpp"
 #include "core/Error.hpp"
 #include "core/Types.hpp"
 #include "protocol/Header.hpp"  // For kMaxPacketSize
@@ -63,12 +66,28 @@ class AsioUdpSocket : public IAsyncSocket {
     static NetworkError fromAsioError(const asio::error_code& ec) noexcept;
 
     private:
-    static Endpoint fromAsioEndpoint(const asio::ip::udp::endpoint& ep);
     static asio::ip::udp::endpoint toAsioEndpoint(const Endpoint& ep);
 
+    /**
+     * @brief Text form of a peer address, formatted once per peer
+     *
+     * Small direct-mapped cache so the receive path copies a known string
+     * instead of calling address().to_string() for every datagram.
+     */
+    [[nodiscard]] const std::string& cachedAddress(
+        const asio::ip::address& address);
+
+    struct CachedAddress {
+        EndpointKey key;
+        std::string text;
+    };
+    static constexpr std::size_t kAddressCacheSize = 64;
+
     asio::ip::udp::socket socket_;
     mutable std::mutex mutex_;
     asio::ip::udp::endpoint remoteEndpoint_;
+    /// Only touched by the receive handler
+    std::array<CachedAddress, kAddressCacheSize> addressCache_{};
 };
 
 [[nodiscard]] inline std::unique_ptr<IAsyncSocket> createAsyncSocket(
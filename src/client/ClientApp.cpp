@@ -7,15 +7,32 @@
 
 #include "ClientApp.hpp"
 
+#include <filesystem>
 #include <memory>
 #include <utility>
 
+#include "compression/DictionarySet.hpp"
+
 namespace {
+/// Optional dictionary set, offered to the server after S_ACCEPT
+constexpr const char* kCompressionDictPath = "config/client/rtgp.dict";
+
 rtype::client::NetworkClient::Config createNetworkConfig() {
     rtype::client::NetworkClient::Config cfg;
     cfg.connectionConfig.reliabilityConfig.retransmitTimeout =
         std::chrono::milliseconds(1000);
     cfg.connectionConfig.reliabilityConfig.maxRetries = 15;
+
+    std::error_code ec;
+    if (std::filesystem::exists(kCompressionDictPath, ec)) {
+        auto dictionaries =
+            rtype::network::DictionarySet::loadFromFile(kCompressionDictPath);
+        if (dictionaries) {
+            cfg.connectionConfig.compressionConfig.dictionaries =
+                std::make_shared<const rtype::network::DictionarySet>(
+                    std::move(dictionaries.value()));
+        }
+    }
     return cfg;
 }
 }  // namespace
@@ -177,6 +177,12 @@ void Graphic::_setupNetworkEntityFactory() {
     _networkSystem->setEntityFactory(
         rc::RtypeEntityFactory::createNetworkEntityFactory(registry,
                                                            assetsManager));
+    // Fallback until the first S_UPDATE_POS reports the server's speed
+    auto& entityConfigs =
+        rtype::games::rtype::shared::EntityConfigRegistry::getInstance();
+    if (auto ship = entityConfigs.getPlayer("default_ship")) {
+        _networkSystem->setPredictionSpeed(ship->get().speed);
+    }
     _networkSystem->onLocalPlayerAssigned(
         [registry](std::uint32_t /*userId*/, ECS::Entity entity) {
             if (registry->isAlive(entity)) {
@@ -421,7 +421,7 @@ void MainMenuScene::_onConnectClicked(
             }
 
             this->_pendingLobbyCode = lobby.code;
-            client->connect(discoveryIp, lobby.port);
+            client->connect(discoveryIp, lobby.port, lobby.code);
         });
 
     auto onConnectedId = _networkClient->addConnectedCallback(
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <cmath>
 #include <memory>
+#include <tuple>
 #include <utility>
 
 #include "Components/HealthComponent.hpp"
@@ -78,6 +79,7 @@ ClientNetworkSystem::ClientNetworkSystem(
     std::shared_ptr<ECS::Registry> registry,
     std::shared_ptr<NetworkClient> client)
     : registry_(std::move(registry)), client_(std::move(client)) {
+    prediction_.setTickSeconds(InputHistory::tickSeconds());
     registerCallbacks();
 }
 
@@ -126,7 +128,9 @@ void ClientNetworkSystem::registerCallbacks() {
         [this](PowerUpEvent event) { handlePowerUpEvent(event); });
 
     client_->onPositionCorrection(
-        [this](float x, float y) { handlePositionCorrection(x, y); });
+        [this](float x, float y, std::uint16_t ackInputSeq, float moveSpeed) {
+            handlePositionCorrection(x, y, ackInputSeq, moveSpeed);
+        });
 }
 
 void ClientNetworkSystem::setEntityFactory(EntityFactory factory) {
@@ -169,10 +173,99 @@ void ClientNetworkSystem::onHealthUpdate(
     }
 }
 
-void ClientNetworkSystem::update() { client_->poll(); }
+void ClientNetworkSystem::update() {
+    client_->poll();
+    if (inputStarted_ && client_->isConnected() &&
+        inputHistory_.advance(nowSeconds())) {
+        client_->sendInputHistory(inputHistory_.frames());
+    }
+    if (interpolationEnabled_) {
+        applyInterpolation(nowSeconds());
+    }
+}
+
+void ClientNetworkSystem::setInterpolationEnabled(bool enabled) {
+    interpolationEnabled_ = enabled;
+    if (!enabled) {
+        interpolation_.clear();
+        interpolationClock_.reset();
+    }
+}
+
+void ClientNetworkSystem::setInterpolationConfig(
+    const InterpolationClock::Config& config) {
+    interpolationClock_.setConfig(config);
+}
+
+void ClientNetworkSystem::applyInterpolation(double now) {
+    const auto renderTick = interpolationClock_.renderTick(now);
+    if (!renderTick) {
+        return;
+    }
+    const double secondsPerTick = interpolationClock_.secondsPerTick();
+    const double maxExtrapolation =
+        interpolationClock_.config().maxExtrapolationTicks;
+
+    for (auto it = interpolation_.begin(); it != interpolation_.end();) {
+        auto entityIt = networkIdToEntity_.find(it->first);
+        if (entityIt == networkIdToEntity_.end() ||
+            !ownsNetworkId(entityIt->second, it->first) ||
+            (localPlayerEntity_.has_value() &&
+             *localPlayerEntity_ == entityIt->second)) {
+            it = interpolation_.erase(it);
+            continue;
+        }
+
+        const ECS::Entity entity = entityIt->second;
+        const auto state =
+            it->second.sample(*renderTick, secondsPerTick, maxExtrapolation);
+        if (state && registry_->hasComponent<Transform>(entity)) {
+            auto& pos = registry_->getComponent<Transform>(entity);
+            pos.x = state->x;
+            pos.y = state->y;
+        }
+        if (state && registry_->hasComponent<Velocity>(entity)) {
+            auto& vel = registry_->getComponent<Velocity>(entity);
+            vel.vx = state->vx;
+            vel.vy = state->vy;
+        }
+        ++it;
+    }
+}
 
 void ClientNetworkSystem::sendInput(std::uint16_t inputMask) {
-    client_->sendInput(inputMask);
+    if (!client_->isConnected()) {
+        return;
+    }
+    inputHistory_.setInput(inputMask);
+    inputStarted_ = true;
+    if (!predictionEnabled_ || !localPlayerEntity_.has_value() ||
+        !registry_->isAlive(*localPlayerEntity_)) {
+        return;
+    }
+
+    // The server acks the low 16 bits of the tick it played
+    prediction_.record(static_cast<std::uint16_t>(inputHistory_.nextTick()),
+                       inputMask, nowSeconds());
+    if (registry_->hasComponent<Velocity>(*localPlayerEntity_)) {
+        auto& vel = registry_->getComponent<Velocity>(*localPlayerEntity_);
+        std::tie(vel.vx, vel.vy) = prediction_.velocityFor(inputMask);
+    }
+}
+
+void ClientNetworkSystem::setPredictionEnabled(bool enabled) {
+    predictionEnabled_ = enabled;
+    if (!enabled) {
+        prediction_.clear();
+    }
+}
+
+void ClientNetworkSystem::setPredictionSpeed(float speed) {
+    prediction_.setSpeed(speed);
+}
+
+void ClientNetworkSystem::setInputRedundancy(std::size_t frames) {
+    inputHistory_.setRedundancy(frames);
 }
 
 std::optional<ECS::Entity> ClientNetworkSystem::getLocalPlayerEntity() const {
@@ -186,7 +279,8 @@ std::optional<std::uint32_t> ClientNetworkSystem::getLocalUserId() const {
 std::optional<ECS::Entity> ClientNetworkSystem::findEntityByNetworkId(
     std::uint32_t networkId) const {
     auto it = networkIdToEntity_.find(networkId);
-    if (it != networkIdToEntity_.end()) {
+    if (it != networkIdToEntity_.end() &&
+        ownsNetworkId(it->second, networkId)) {
         return it->second;
     }
     return std::nullopt;
@@ -198,12 +292,12 @@ void ClientNetworkSystem::reset() {
     LOG_DEBUG_CAT(rtype::LogCategory::Network,
                   "[ClientNetworkSystem] Resetting network system state");
     for (const auto& [networkId, entity] : networkIdToEntity_) {
-        if (registry_->isAlive(entity)) {
+        if (ownsNetworkId(entity, networkId)) {
             LOG_DEBUG_CAT(
                 rtype::LogCategory::Network,
                 "[ClientNetworkSystem] Destroying network entity: networkId="
                     << networkId);
-            registry_->killEntity(entity);
+            ECS::EntityPool::despawn(*registry_, entity);
         }
     }
     networkIdToEntity_.clear();
@@ -211,6 +305,11 @@ void ClientNetworkSystem::reset() {
     localPlayerEntity_.reset();
     pendingPlayerSpawns_.clear();
     lastKnownHealth_.clear();
+    interpolation_.clear();
+    interpolationClock_.reset();
+    prediction_.clear();
+    inputHistory_.reset();
+    inputStarted_ = false;
     disconnectedHandled_ = false;
     debugNotFoundLogCount_ = 0;
     debugBossPartLogCount_ = 0;
@@ -248,12 +347,13 @@ void ClientNetworkSystem::handleEntitySpawn(const EntitySpawnEvent& event) {
 
     auto existingIt = networkIdToEntity_.find(event.entityId);
     if (existingIt != networkIdToEntity_.end()) {
-        if (registry_->isAlive(existingIt->second)) {
+        if (ownsNetworkId(existingIt->second, event.entityId)) {
             LOG_DEBUG("[ClientNetworkSystem] Entity already exists (id="
                       << event.entityId
                       << "), updating position and ensuring visible");
 
             ECS::Entity existingEntity = existingIt->second;
+            interpolation_.erase(event.entityId);
 
             if (registry_->hasComponent<Transform>(existingEntity)) {
                 auto& pos = registry_->getComponent<Transform>(existingEntity);
@@ -355,7 +455,7 @@ void ClientNetworkSystem::handleEntityMove(const EntityMoveEvent& event) {
 
     ECS::Entity entity = it->second;
 
-    if (!registry_->isAlive(entity)) {
+    if (!ownsNetworkId(entity, event.entityId)) {
         networkIdToEntity_.erase(it);
         return;
     }
@@ -369,12 +469,14 @@ void ClientNetworkSystem::handleEntityMove(const EntityMoveEvent& event) {
         localPlayerEntity_.has_value() && *localPlayerEntity_ == entity;
 
     if (isLocalPlayer) {
-        if (registry_->hasComponent<Transform>(entity)) {
+        // A predicting client is reconciled by S_UPDATE_POS instead
+        const bool predicted = predictionEnabled_ && prediction_.synced();
+        if (!predicted && registry_->hasComponent<Transform>(entity)) {
             auto& pos = registry_->getComponent<Transform>(entity);
             pos.x = event.x;
             pos.y = event.y;
         }
-        if (registry_->hasComponent<Velocity>(entity)) {
+        if (!predicted && registry_->hasComponent<Velocity>(entity)) {
             auto& vel = registry_->getComponent<Velocity>(entity);
             vel.vx = event.vx;
             vel.vy = event.vy;
@@ -394,6 +496,19 @@ void ClientNetworkSystem::handleEntityMove(const EntityMoveEvent& event) {
         return;
     }
 
+    // Ticks of 0 carry no timing (older servers): apply them directly
+    const bool interpolated = interpolationEnabled_ && event.serverTick != 0;
+    if (interpolated) {
+        auto& buffer = interpolation_[event.entityId];
+        const std::uint32_t gap =
+            buffer.empty() ? 0 : event.serverTick - buffer.newest().tick;
+        if (!buffer.push({event.serverTick, event.x, event.y, event.vx,
+                          event.vy})) {
+            return;  // Late or duplicate: a newer state is already buffered
+        }
+        interpolationClock_.onSample(event.serverTick, nowSeconds(), gap);
+    }
+
     if (registry_->hasComponent<Transform>(entity)) {
         auto& pos = registry_->getComponent<Transform>(entity);
 
@@ -408,8 +523,10 @@ void ClientNetworkSystem::handleEntityMove(const EntityMoveEvent& event) {
             debugBossPartLogCount_++;
         }
 
-        pos.x = event.x;
-        pos.y = event.y;
+        if (!interpolated) {
+            pos.x = event.x;
+            pos.y = event.y;
+        }
 
         if (registry_->hasComponent<games::rtype::shared::PlayerIdComponent>(
                 entity) &&
@@ -436,6 +553,20 @@ void ClientNetworkSystem::handleEntityMove(const EntityMoveEvent& event) {
     updateProjectileVisuals(*registry_, entity);
 }
 
+bool ClientNetworkSystem::ownsNetworkId(ECS::Entity entity,
+                                        std::uint32_t networkId) const {
+    using rtype::games::rtype::shared::NetworkIdComponent;
+    if (!registry_->isAlive(entity) ||
+        registry_->hasComponent<ECS::Inactive>(entity)) {
+        return false;
+    }
+    if (!registry_->hasComponent<NetworkIdComponent>(entity)) {
+        return true;
+    }
+    return registry_->getComponent<NetworkIdComponent>(entity).networkId ==
+           networkId;
+}
+
 void ClientNetworkSystem::_playDeathSound(ECS::Entity entity) {
     if (registry_->hasComponent<games::rtype::client::EnemySoundComponent>(
             entity)) {
@@ -479,7 +610,9 @@ void ClientNetworkSystem::handleEntityDestroy(std::uint32_t entityId) {
 
     ECS::Entity entity = it->second;
 
-    if (registry_->isAlive(entity)) {
+    // A pooled entity may already be parked (client-side lifetime) or reused
+    // for another network id: then only the stale mapping goes away.
+    if (ownsNetworkId(entity, entityId)) {
         using LaserAnim = games::rtype::client::LaserBeamAnimationComponent;
         if (registry_->hasComponent<LaserAnim>(entity)) {
             auto& anim = registry_->getComponent<LaserAnim>(entity);
@@ -495,22 +628,30 @@ void ClientNetworkSystem::handleEntityDestroy(std::uint32_t entityId) {
         }
 
         _playDeathSound(entity);
-        registry_->killEntity(entity);
+        if (registry_->hasComponent<games::rtype::shared::DestroyTag>(entity)) {
+            registry_->removeComponent<games::rtype::shared::DestroyTag>(
+                entity);
+        }
+        ECS::EntityPool::despawn(*registry_, entity);
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[ClientNetworkSystem] Entity killed");
     }
 
     this->networkIdToEntity_.erase(it);
     lastKnownHealth_.erase(entityId);
+    interpolation_.erase(entityId);
 
     if (localPlayerEntity_.has_value() && *localPlayerEntity_ == entity) {
         localPlayerEntity_.reset();
+        prediction_.clear();
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[ClientNetworkSystem] Local player entity reset!");
     }
 }
 
-void ClientNetworkSystem::handlePositionCorrection(float x, float y) {
+void ClientNetworkSystem::handlePositionCorrection(float x, float y,
+                                                   std::uint16_t ackInputSeq,
+                                                   float moveSpeed) {
     if (!localPlayerEntity_.has_value()) {
         return;
     }
@@ -522,6 +663,25 @@ void ClientNetworkSystem::handlePositionCorrection(float x, float y) {
         return;
     }
 
+    if (predictionEnabled_) {
+        // Predict with the speed the server moves the ship at, modifiers
+        // included, so held inputs do not drift between corrections
+        if (moveSpeed > 0.0F) {
+            prediction_.setSpeed(moveSpeed);
+        }
+        const double rttSeconds = client_->latencyMs() / 1000.0;
+        auto predicted =
+            prediction_.reconcile(ackInputSeq, x, y, nowSeconds(), rttSeconds);
+        if (!predicted) {
+            return;  // Reordered: a newer correction was already applied
+        }
+        std::tie(x, y) = *predicted;
+        if (registry_->hasComponent<Velocity>(entity)) {
+            auto& vel = registry_->getComponent<Velocity>(entity);
+            std::tie(vel.vx, vel.vy) = prediction_.currentVelocity();
+        }
+    }
+
     if (registry_->hasComponent<Transform>(entity)) {
         auto& pos = registry_->getComponent<Transform>(entity);
         pos.x = x;
@@ -554,7 +714,7 @@ void ClientNetworkSystem::handleEntityHealth(const EntityHealthEvent& event) {
 
     ECS::Entity entity = it->second;
 
-    if (!registry_->isAlive(entity)) {
+    if (!ownsNetworkId(entity, event.entityId)) {
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[ClientNetworkSystem] Entity "
                           << event.entityId << " not alive, ignoring health");
@@ -637,7 +797,7 @@ void ClientNetworkSystem::handlePowerUpEvent(const PowerUpEvent& event) {
     }
 
     ECS::Entity entity = it->second;
-    if (!registry_->isAlive(entity)) {
+    if (!ownsNetworkId(entity, event.playerId)) {
         LOG_WARNING("[ClientNetworkSystem] PowerUp event for dead entity");
         return;
     }
@@ -709,6 +869,8 @@ void ClientNetworkSystem::handleConnected(std::uint32_t userId) {
                      std::to_string(userId));
     localUserId_ = userId;
     disconnectedHandled_ = false;
+    inputHistory_.reset();
+    inputStarted_ = false;
 
     auto pendingIt = pendingPlayerSpawns_.find(userId);
     if (pendingIt != pendingPlayerSpawns_.end()) {
@@ -751,8 +913,8 @@ void ClientNetworkSystem::handleDisconnected(network::DisconnectReason reason) {
     disconnectedHandled_ = true;
 
     for (auto& [networkId, entity] : networkIdToEntity_) {
-        if (registry_->isAlive(entity)) {
-            registry_->killEntity(entity);
+        if (ownsNetworkId(entity, networkId)) {
+            ECS::EntityPool::despawn(*registry_, entity);
         }
     }
 
@@ -761,6 +923,11 @@ void ClientNetworkSystem::handleDisconnected(network::DisconnectReason reason) {
     localPlayerEntity_.reset();
     pendingPlayerSpawns_.clear();
     lastKnownHealth_.clear();
+    interpolation_.clear();
+    interpolationClock_.reset();
+    prediction_.clear();
+    inputHistory_.reset();
+    inputStarted_ = false;
 
     if (onDisconnectCallback_) {
         LOG_DEBUG("[ClientNetworkSystem] Calling onDisconnect callback");
@@ -8,6 +8,7 @@
 #ifndef SRC_CLIENT_NETWORK_CLIENTNETWORKSYSTEM_HPP_
 #define SRC_CLIENT_NETWORK_CLIENTNETWORKSYSTEM_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -16,6 +17,9 @@
 
 #include <rtype/ecs.hpp>
 
+#include "ClientPrediction.hpp"
+#include "InputHistory.hpp"
+#include "InterpolationBuffer.hpp"
 #include "NetworkClient.hpp"
 #include "protocol/Payloads.hpp"
 
@@ -27,9 +31,12 @@ namespace rtype::client {
  *
  * This system handles:
  * - Spawning entities when server sends S_ENTITY_SPAWN
- * - Updating entity positions when server sends S_ENTITY_MOVE
+ * - Updating entity positions when server sends S_ENTITY_MOVE; remote
+ *   entities are drawn through a per-entity InterpolationBuffer, a little
+ *   behind the newest server tick
  * - Destroying entities when server sends S_ENTITY_DESTROY
- * - Correcting local player position on S_UPDATE_POS
+ * - Predicting the local ship from its inputs (ClientPrediction) and
+ *   reconciling it on S_UPDATE_POS
  *
  * Usage:
  * @code
@@ -125,11 +132,67 @@ class ClientNetworkSystem {
     /**
      * @brief Update the network system
      *
-     * Polls the network client and processes any pending events.
+     * Polls the network client and processes any pending events, sends
+     * the input frames of the ticks elapsed, then moves interpolated
+     * entities to the current render tick.
      * Should be called once per frame.
      */
     void update();
 
+    /**
+     * @brief Enable or disable interpolation of remote entities
+     *
+     * When disabled, received positions are applied as they arrive.
+     *
+     * @param enabled true to interpolate (default)
+     */
+    void setInterpolationEnabled(bool enabled);
+
+    /**
+     * @brief Tune the render delay and extrapolation of remote entities
+     * @param config Server tick rate, delay bounds and jitter margin
+     */
+    void setInterpolationConfig(const InterpolationClock::Config& config);
+
+    /**
+     * @brief Clock mapping local time to the rendered server tick
+     */
+    [[nodiscard]] const InterpolationClock& getInterpolationClock() const {
+        return interpolationClock_;
+    }
+
+    /**
+     * @brief Enable or disable prediction of the local ship
+     *
+     * When disabled, the ship is moved by the server's updates only.
+     *
+     * @param enabled true to predict (default)
+     */
+    void setPredictionEnabled(bool enabled);
+
+    /**
+     * @brief Speed (px/s) the server moves the local ship at
+     *
+     * Overridden by the speed carried in each S_UPDATE_POS; only used until
+     * the first one arrives.
+     *
+     * @param speed Ship speed
+     */
+    void setPredictionSpeed(float speed);
+
+    /**
+     * @brief Input frames repeated in each C_INPUT
+     * @param frames Redundancy, clamped to [1, kMaxInputHistoryFrames]
+     */
+    void setInputRedundancy(std::size_t frames);
+
+    /**
+     * @brief Local ship prediction state
+     */
+    [[nodiscard]] const ClientPrediction& getPrediction() const {
+        return prediction_;
+    }
+
     /**
      * @brief Re-register network callbacks
      *
@@ -142,6 +205,11 @@ class ClientNetworkSystem {
     /**
      * @brief Send player input to server
      *
+     * The input is held from now on: update() sends one frame per client
+     * tick, each C_INPUT repeating the last few so a lost packet costs
+     * nothing. With prediction on, the local ship also starts moving right
+     * away.
+     *
      * @param inputMask Combined input flags
      */
     void sendInput(std::uint16_t inputMask);
@@ -184,12 +252,28 @@ class ClientNetworkSystem {
     void handleEntitySpawn(const EntitySpawnEvent& event);
     void handleEntityMove(const EntityMoveEvent& event);
 
+    /**
+     * @brief Write each buffered entity's state at the render tick
+     * @param nowSeconds Local steady-clock time
+     */
+    void applyInterpolation(double nowSeconds);
+
     void handlePowerUpEvent(const PowerUpEvent& event);
 
     void _playDeathSound(ECS::Entity entity);
 
+    /**
+     * @brief Whether an entity still is the one spawned for networkId
+     *
+     * False once it died, or once a pooled entity was parked or reused for
+     * another id.
+     */
+    [[nodiscard]] bool ownsNetworkId(ECS::Entity entity,
+                                     std::uint32_t networkId) const;
+
     void handleEntityDestroy(std::uint32_t entityId);
-    void handlePositionCorrection(float x, float y);
+    void handlePositionCorrection(float x, float y, std::uint16_t ackInputSeq,
+                                  float moveSpeed);
     void handleEntityHealth(const EntityHealthEvent& event);
     void handleConnected(std::uint32_t userId);
     void handleDisconnected(network::DisconnectReason reason);
@@ -221,6 +305,16 @@ class ClientNetworkSystem {
 
     std::unordered_map<std::uint32_t, ECS::Entity> pendingPlayerSpawns_;
 
+    bool interpolationEnabled_{true};
+    InterpolationClock interpolationClock_;
+    std::unordered_map<std::uint32_t, InterpolationBuffer> interpolation_;
+
+    bool predictionEnabled_{true};
+    ClientPrediction prediction_;
+
+    InputHistory inputHistory_;
+    bool inputStarted_{false};  ///< No input frames before the first input
+
     bool disconnectedHandled_{false};
 
     /// Debug log counters (reset on system reset)
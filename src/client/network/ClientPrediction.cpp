@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** ClientPrediction - Implementation
+*/
+
+#include "ClientPrediction.hpp"
+
+#include <algorithm>
+
+#include "protocol/Payloads.hpp"
+
+namespace rtype::client {
+
+namespace {
+
+/// Sequence ids wrap at 65536: a is newer if it is less than half ahead
+bool isNewer(std::uint16_t a, std::uint16_t b) noexcept {
+    return static_cast<std::int16_t>(a - b) > 0;
+}
+
+}  // namespace
+
+std::pair<float, float> ClientPrediction::velocityFor(
+    std::uint16_t inputMask) const noexcept {
+    float vx = 0.0F;
+    float vy = 0.0F;
+
+    // Same rules as the server's PlayerInputHandler::processMovement
+    if (inputMask & network::InputMask::kUp) {
+        vy -= speed_;
+    }
+    if (inputMask & network::InputMask::kDown) {
+        vy += speed_;
+    }
+    if (inputMask & network::InputMask::kLeft) {
+        vx -= speed_;
+    }
+    if (inputMask & network::InputMask::kRight) {
+        vx += speed_;
+    }
+    return {vx, vy};
+}
+
+void ClientPrediction::record(std::uint16_t seq, std::uint16_t inputMask,
+                              double nowSeconds) {
+    inputs_.push_back({seq, nowSeconds, inputMask});
+    if (inputs_.size() > kMaxPendingInputs) {
+        inputs_.pop_front();
+    }
+}
+
+std::optional<std::pair<float, float>> ClientPrediction::reconcile(
+    std::uint16_t ackSeq, float x, float y, double nowSeconds,
+    double rttSeconds) {
+    if (lastAck_ && isNewer(*lastAck_, ackSeq)) {
+        return std::nullopt;
+    }
+    lastAck_ = ackSeq;
+
+    // Newest input the server applied; the ones before it are superseded
+    auto applied = std::find_if(inputs_.rbegin(), inputs_.rend(),
+                                [ackSeq](const Input& input) {
+                                    return !isNewer(input.seq, ackSeq);
+                                });
+    double replayFrom = inputs_.empty() ? nowSeconds : inputs_.front().sentAt;
+    if (applied != inputs_.rend()) {
+        inputs_.erase(inputs_.begin(), std::prev(applied.base()));
+        const double segmentEnd =
+            inputs_.size() > 1 ? inputs_[1].sentAt : nowSeconds;
+        double replayPoint = nowSeconds - rttSeconds;
+        if (tickSeconds_ > 0.0) {
+            const auto ticksApplied =
+                static_cast<std::uint16_t>(ackSeq - inputs_.front().seq) + 1;
+            replayPoint = inputs_.front().sentAt + ticksApplied * tickSeconds_;
+        }
+        replayFrom =
+            std::clamp(replayPoint, inputs_.front().sentAt, segmentEnd);
+    }
+
+    for (std::size_t i = 0; i < inputs_.size(); ++i) {
+        const double start = std::max(inputs_[i].sentAt, replayFrom);
+        const double end =
+            std::min(i + 1 < inputs_.size() ? inputs_[i + 1].sentAt
+                                            : nowSeconds,
+                     nowSeconds);
+        if (end > start) {
+            const auto seconds = static_cast<float>(end - start);
+            const auto [vx, vy] = velocityFor(inputs_[i].inputMask);
+            x += vx * seconds;
+            y += vy * seconds;
+        }
+    }
+    return std::make_pair(x, y);
+}
+
+std::pair<float, float> ClientPrediction::currentVelocity() const noexcept {
+    if (inputs_.empty()) {
+        return {0.0F, 0.0F};
+    }
+    return velocityFor(inputs_.back().inputMask);
+}
+
+void ClientPrediction::clear() noexcept {
+    inputs_.clear();
+    lastAck_.reset();
+}
+
+}  // namespace rtype::client
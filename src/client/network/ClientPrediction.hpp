@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** ClientPrediction - Local ship prediction and server reconciliation
+*/
+
+#ifndef SRC_CLIENT_NETWORK_CLIENTPREDICTION_HPP_
+#define SRC_CLIENT_NETWORK_CLIENTPREDICTION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+
+namespace rtype::client {
+
+/**
+ * @brief Predicts the local ship from its own inputs
+ *
+ * Inputs are only sent when they change and the server keeps applying the
+ * last one it received, so each sent input is a segment of constant velocity
+ * lasting until the next one. The client moves its ship along those segments
+ * right away instead of waiting a round trip for the server.
+ *
+ * Every S_UPDATE_POS carries the authoritative position and the sequence id
+ * of the last input the server applied. That position is where the ship was
+ * one round trip ago on the client timeline, inside the acked input's
+ * segment; reconcile() rebases on it and replays the segments from that point
+ * to now. Older inputs are dropped.
+ *
+ * When inputs are numbered by client tick (setTickSeconds()), the ack is the
+ * last tick the server applied: the replay point is the acked input's send
+ * time plus the ticks applied since, with no round trip estimate.
+ *
+ * The speed must be the one the server applies; S_UPDATE_POS carries it and
+ * the caller passes it to setSpeed() before reconcile().
+ */
+class ClientPrediction {
+   public:
+    /// Inputs kept while unacknowledged (a few seconds of key changes)
+    static constexpr std::size_t kMaxPendingInputs = 64;
+    /// Fallback speed (px/s) until setSpeed() is called
+    static constexpr float kDefaultSpeed = 200.0F;
+
+    /**
+     * @brief One sent input: a constant velocity from sentAt on
+     *
+     * The mask is kept rather than the velocity so a speed reported by the
+     * server after the input was sent applies to its replay too.
+     */
+    struct Input {
+        std::uint16_t seq{0};
+        double sentAt{0};
+        std::uint16_t inputMask{0};
+    };
+
+    /**
+     * @brief Ship velocity the server derives from an input mask
+     */
+    [[nodiscard]] std::pair<float, float> velocityFor(
+        std::uint16_t inputMask) const noexcept;
+
+    /**
+     * @brief Record a sent input
+     * @param seq Sequence id of the C_INPUT packet
+     * @param inputMask Sent input flags
+     * @param nowSeconds Local time it was sent at
+     */
+    void record(std::uint16_t seq, std::uint16_t inputMask, double nowSeconds);
+
+    /**
+     * @brief Rebase on an authoritative position and replay pending inputs
+     *
+     * @param ackSeq Last input the server applied
+     * @param x Authoritative X
+     * @param y Authoritative Y
+     * @param nowSeconds Local time
+     * @param rttSeconds Current round trip time (unused with tick seqs)
+     * @return Predicted position now, nullopt if the correction is older than
+     *         one already applied
+     */
+    [[nodiscard]] std::optional<std::pair<float, float>> reconcile(
+        std::uint16_t ackSeq, float x, float y, double nowSeconds,
+        double rttSeconds);
+
+    /// Velocity of the newest input (0 if none)
+    [[nodiscard]] std::pair<float, float> currentVelocity() const noexcept;
+
+    /// True once a correction was applied: the server sends them
+    [[nodiscard]] bool synced() const noexcept { return lastAck_.has_value(); }
+
+    [[nodiscard]] std::size_t pendingCount() const noexcept {
+        return inputs_.size();
+    }
+
+    /**
+     * @brief Duration of a client tick when seqs are tick numbers
+     * @param seconds Tick duration, 0 for packet seqs (default)
+     */
+    void setTickSeconds(double seconds) noexcept { tickSeconds_ = seconds; }
+
+    void setSpeed(float speed) noexcept { speed_ = speed; }
+    [[nodiscard]] float speed() const noexcept { return speed_; }
+
+    void clear() noexcept;
+
+   private:
+    float speed_{kDefaultSpeed};
+    double tickSeconds_{0};
+    std::deque<Input> inputs_;
+    std::optional<std::uint16_t> lastAck_;
+};
+
+}  // namespace rtype::client
+
+#endif  // SRC_CLIENT_NETWORK_CLIENTPREDICTION_HPP_
@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistory - Implementation
+*/
+
+#include "InputHistory.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rtype::client {
+
+void InputHistory::setInput(std::uint16_t inputMask) noexcept {
+    held_ = inputMask;
+    pressed_ |= inputMask;
+}
+
+bool InputHistory::advance(double nowSeconds) {
+    if (!started_) {
+        started_ = true;
+        nextTickAt_ = nowSeconds;
+    }
+    if (nowSeconds < nextTickAt_) {
+        return false;
+    }
+
+    auto due = static_cast<std::uint32_t>(
+                   std::floor((nowSeconds - nextTickAt_) * kTickRate)) +
+               1;
+    nextTickAt_ += static_cast<double>(due) * tickSeconds();
+
+    const auto window = static_cast<std::uint32_t>(redundancy_);
+    if (due > window) {
+        // Stalled: older ticks would not fit in a packet anyway
+        nextTick_ += due - window;
+        due = window;
+    }
+
+    for (std::uint32_t i = 0; i < due; ++i) {
+        const std::uint16_t mask = held_ | pressed_;
+        pressed_ = 0;
+        frames_.insert(frames_.begin(), {nextTick_++, mask});
+        idleFrames_ = (mask == 0) ? idleFrames_ + 1 : 0;
+    }
+    if (frames_.size() > network::kMaxInputHistoryFrames) {
+        frames_.resize(network::kMaxInputHistoryFrames);
+    }
+    return idleFrames_ <= redundancy_;
+}
+
+std::span<const network::InputFrame> InputHistory::frames() const noexcept {
+    return std::span<const network::InputFrame>(frames_).first(
+        std::min(frames_.size(), redundancy_));
+}
+
+void InputHistory::setRedundancy(std::size_t frames) noexcept {
+    redundancy_ = std::clamp<std::size_t>(frames, 1,
+                                          network::kMaxInputHistoryFrames);
+}
+
+void InputHistory::reset() noexcept {
+    frames_.clear();
+    held_ = 0;
+    pressed_ = 0;
+    nextTick_ = 1;
+    nextTickAt_ = 0;
+    started_ = false;
+    idleFrames_ = 0;
+}
+
+}  // namespace rtype::client
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistory - Per-tick input frames sent with redundancy
+*/
+
+#ifndef SRC_CLIENT_NETWORK_INPUTHISTORY_HPP_
+#define SRC_CLIENT_NETWORK_INPUTHISTORY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "input/InputHistoryCodec.hpp"
+
+namespace rtype::client {
+
+/**
+ * @brief Samples the held input once per client tick
+ *
+ * The game reports input changes through setInput(); advance() turns them
+ * into one frame per tick of a fixed 60 Hz client clock, numbered from 1.
+ * Each C_INPUT carries the newest frames (see frames()), so a lost packet is
+ * repeated by the next ones and the server never waits on a retransmit.
+ *
+ * Keys pressed and released between two ticks still show up in the next
+ * frame. Once the input has been idle for a full redundancy window the
+ * packets stop; the ticks keep counting so the server sees the gap.
+ */
+class InputHistory {
+   public:
+    static constexpr double kTickRate = 60.0;
+    /// Frames repeated per packet: covers 5 lost packets in a row
+    static constexpr std::size_t kDefaultRedundancy = 6;
+
+    /**
+     * @brief Report the input held from now on
+     */
+    void setInput(std::uint16_t inputMask) noexcept;
+
+    /**
+     * @brief Emit the frames of the ticks elapsed up to now
+     *
+     * The first call starts the clock. After a stall longer than the
+     * redundancy window, only the last window of ticks is emitted.
+     *
+     * @param nowSeconds Local steady-clock time
+     * @return true if a packet should be sent with frames()
+     */
+    bool advance(double nowSeconds);
+
+    /// Newest frames, newest first, at most redundancy() of them
+    [[nodiscard]] std::span<const network::InputFrame> frames() const noexcept;
+
+    /// Tick the current input is first sent with
+    [[nodiscard]] std::uint32_t nextTick() const noexcept { return nextTick_; }
+
+    [[nodiscard]] std::size_t redundancy() const noexcept {
+        return redundancy_;
+    }
+
+    /**
+     * @brief Frames per packet, clamped to [1, kMaxInputHistoryFrames]
+     */
+    void setRedundancy(std::size_t frames) noexcept;
+
+    [[nodiscard]] static constexpr double tickSeconds() noexcept {
+        return 1.0 / kTickRate;
+    }
+
+    void reset() noexcept;
+
+   private:
+    std::vector<network::InputFrame> frames_;  ///< Newest first
+    std::size_t redundancy_{kDefaultRedundancy};
+    std::uint16_t held_{0};
+    std::uint16_t pressed_{0};  ///< Bits seen since the last frame
+    std::uint32_t nextTick_{1};
+    double nextTickAt_{0};
+    bool started_{false};
+    std::size_t idleFrames_{0};
+};
+
+}  // namespace rtype::client
+
+#endif  // SRC_CLIENT_NETWORK_INPUTHISTORY_HPP_
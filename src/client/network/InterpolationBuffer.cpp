@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterpolationBuffer - Implementation
+*/
+
+#include "InterpolationBuffer.hpp"
+
+#include <algorithm>
+
+namespace rtype::client {
+
+namespace {
+
+/// Weight of a new measurement in the jitter/gap moving averages
+constexpr double kSmoothing = 0.1;
+/// How fast the timeline anchor may slide back (ticks per second), so it
+/// follows a server that runs slightly slower than the local clock
+constexpr double kDriftTicksPerSecond = 1.0;
+
+}  // namespace
+
+bool InterpolationBuffer::push(const InterpolationSample& sample) noexcept {
+    if (count_ > 0 && sample.tick <= newest().tick) {
+        return false;
+    }
+    if (count_ == kCapacity) {
+        head_ = (head_ + 1) % kCapacity;
+        --count_;
+    }
+    samples_[(head_ + count_) % kCapacity] = sample;
+    ++count_;
+    return true;
+}
+
+std::optional<InterpolationBuffer::State> InterpolationBuffer::sample(
+    double renderTick, double secondsPerTick,
+    double maxExtrapolationTicks) const noexcept {
+    if (count_ == 0) {
+        return std::nullopt;
+    }
+
+    const auto& oldest = at(0);
+    if (renderTick <= static_cast<double>(oldest.tick)) {
+        return State{oldest.x, oldest.y, oldest.vx, oldest.vy, false};
+    }
+
+    const auto& last = newest();
+    if (renderTick >= static_cast<double>(last.tick)) {
+        const double ahead = renderTick - static_cast<double>(last.tick);
+        const bool holding = ahead > maxExtrapolationTicks;
+        const auto seconds = static_cast<float>(
+            std::min(ahead, maxExtrapolationTicks) * secondsPerTick);
+        return State{last.x + last.vx * seconds, last.y + last.vy * seconds,
+                     holding ? 0.0F : last.vx, holding ? 0.0F : last.vy,
+                     ahead > 0.0};
+    }
+
+    // Render time sits just behind the newest sample: search from there
+    std::size_t i = count_ - 1;
+    while (i > 0 && static_cast<double>(at(i - 1).tick) > renderTick) {
+        --i;
+    }
+    const auto& a = at(i - 1);
+    const auto& b = at(i);
+
+    const double spanTicks = static_cast<double>(b.tick - a.tick);
+    const auto s =
+        static_cast<float>((renderTick - static_cast<double>(a.tick)) /
+                           spanTicks);
+    const auto span = static_cast<float>(spanTicks * secondsPerTick);
+
+    const float s2 = s * s;
+    const float s3 = s2 * s;
+    const float h00 = 2.0F * s3 - 3.0F * s2 + 1.0F;
+    const float h10 = s3 - 2.0F * s2 + s;
+    const float h01 = -2.0F * s3 + 3.0F * s2;
+    const float h11 = s3 - s2;
+    // Derivatives with respect to s
+    const float d00 = 6.0F * s2 - 6.0F * s;
+    const float d10 = 3.0F * s2 - 4.0F * s + 1.0F;
+    const float d01 = -d00;
+    const float d11 = 3.0F * s2 - 2.0F * s;
+
+    State state;
+    state.x = h00 * a.x + h10 * span * a.vx + h01 * b.x + h11 * span * b.vx;
+    state.y = h00 * a.y + h10 * span * a.vy + h01 * b.y + h11 * span * b.vy;
+    state.vx = (d00 * a.x + d01 * b.x) / span + d10 * a.vx + d11 * b.vx;
+    state.vy = (d00 * a.y + d01 * b.y) / span + d10 * a.vy + d11 * b.vy;
+    return state;
+}
+
+void InterpolationClock::onSample(std::uint32_t tick, double arrivalSeconds,
+                                  std::uint32_t gapTicks) noexcept {
+    const double observed =
+        static_cast<double>(tick) - arrivalSeconds * config_.tickRate;
+
+    if (!synced_) {
+        synced_ = true;
+        offset_ = observed;
+        lastArrival_ = arrivalSeconds;
+        return;
+    }
+
+    if (arrivalSeconds > lastArrival_) {
+        offset_ -= kDriftTicksPerSecond * (arrivalSeconds - lastArrival_);
+        lastArrival_ = arrivalSeconds;
+    }
+    offset_ = std::max(offset_, observed);
+
+    double lateness = offset_ - observed;
+    if (lateness > 2.0 * config_.maxDelayTicks) {
+        // Server restarted or the clock jumped: start over from here
+        offset_ = observed;
+        lateness = 0.0;
+    }
+    jitter_ += (lateness - jitter_) * kSmoothing;
+
+    if (gapTicks > 0) {
+        const double gap =
+            std::min(static_cast<double>(gapTicks), config_.maxDelayTicks);
+        averageGap_ += (gap - averageGap_) * kSmoothing;
+    }
+}
+
+std::optional<double> InterpolationClock::renderTick(
+    double nowSeconds) const noexcept {
+    if (!synced_) {
+        return std::nullopt;
+    }
+    return offset_ + nowSeconds * config_.tickRate - delayTicks();
+}
+
+double InterpolationClock::delayTicks() const noexcept {
+    return std::clamp(averageGap_ + config_.jitterMultiplier * jitter_,
+                      config_.minDelayTicks, config_.maxDelayTicks);
+}
+
+void InterpolationClock::reset() noexcept {
+    synced_ = false;
+    offset_ = 0;
+    lastArrival_ = 0;
+    jitter_ = 0;
+    averageGap_ = 1;
+}
+
+}  // namespace rtype::client
@@ -0,0 +1,156 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterpolationBuffer - Delayed rendering of remote entities
+*/
+
+#ifndef SRC_CLIENT_NETWORK_INTERPOLATIONBUFFER_HPP_
+#define SRC_CLIENT_NETWORK_INTERPOLATIONBUFFER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace rtype::client {
+
+/**
+ * @brief One replicated state of an entity, stamped with its server tick
+ */
+struct InterpolationSample {
+    std::uint32_t tick{0};
+    float x{0};
+    float y{0};
+    float vx{0};  ///< px/s
+    float vy{0};  ///< px/s
+};
+
+/**
+ * @brief Small ring of the latest samples of one remote entity
+ *
+ * Remote entities are drawn slightly in the past (see InterpolationClock),
+ * between two received samples instead of at the newest one, so jitter and
+ * reduced send rates do not show as stutter. Between samples the position
+ * follows a cubic Hermite curve whose tangents are the sampled velocities;
+ * past the newest sample it is extrapolated along the last velocity for a
+ * bounded number of ticks, then held.
+ */
+class InterpolationBuffer {
+   public:
+    static constexpr std::size_t kCapacity = 16;
+
+    /**
+     * @brief Interpolated state at a render tick
+     */
+    struct State {
+        float x{0};
+        float y{0};
+        float vx{0};
+        float vy{0};
+        bool extrapolated{false};  ///< Past the newest sample
+    };
+
+    /**
+     * @brief Add a sample
+     * @return false if it is not newer than the newest one (late or
+     *         duplicate packet), in which case it is dropped
+     */
+    bool push(const InterpolationSample& sample) noexcept;
+
+    /**
+     * @brief State of the entity at a (fractional) server tick
+     *
+     * @param renderTick Server tick to draw
+     * @param secondsPerTick Duration of one server tick
+     * @param maxExtrapolationTicks How far past the newest sample to
+     *        extrapolate before holding still
+     * @return nullopt if no sample was received yet
+     */
+    [[nodiscard]] std::optional<State> sample(
+        double renderTick, double secondsPerTick,
+        double maxExtrapolationTicks) const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+    /// Newest sample (only valid if not empty)
+    [[nodiscard]] const InterpolationSample& newest() const noexcept {
+        return at(count_ - 1);
+    }
+
+    void clear() noexcept { count_ = 0; }
+
+   private:
+    /// i-th sample from the oldest
+    [[nodiscard]] const InterpolationSample& at(std::size_t i) const noexcept {
+        return samples_[(head_ + i) % kCapacity];
+    }
+
+    std::array<InterpolationSample, kCapacity> samples_{};
+    std::size_t head_{0};  ///< Index of the oldest sample
+    std::size_t count_{0};
+};
+
+/**
+ * @brief Maps local time to the server tick remote entities are drawn at
+ *
+ * Each sample tells the clock when a tick arrived. The least delayed
+ * arrivals anchor the server timeline; how much later the others arrive is
+ * the jitter. The render delay behind the newest tick adapts to cover the
+ * average gap between two samples of an entity (longer in low bandwidth
+ * mode) plus a multiple of the jitter, within configured bounds.
+ */
+class InterpolationClock {
+   public:
+    struct Config {
+        double tickRate = 60.0;          ///< Server ticks per second
+        double minDelayTicks = 2.0;      ///< Delay floor
+        double maxDelayTicks = 20.0;     ///< Delay ceiling
+        double jitterMultiplier = 2.0;   ///< Jitter margin in the delay
+        double maxExtrapolationTicks = 6.0;
+    };
+
+    InterpolationClock() = default;
+    explicit InterpolationClock(const Config& config) : config_(config) {}
+
+    /**
+     * @brief Record the arrival of a sample
+     *
+     * @param tick Server tick of the sample
+     * @param arrivalSeconds Local time it arrived at
+     * @param gapTicks Ticks since the previous sample of the same entity
+     *        (0 for the first one)
+     */
+    void onSample(std::uint32_t tick, double arrivalSeconds,
+                  std::uint32_t gapTicks) noexcept;
+
+    /**
+     * @brief Server tick to render at the given local time
+     * @return nullopt until the first sample arrived
+     */
+    [[nodiscard]] std::optional<double> renderTick(
+        double nowSeconds) const noexcept;
+
+    [[nodiscard]] double delayTicks() const noexcept;
+    [[nodiscard]] double jitterTicks() const noexcept { return jitter_; }
+    [[nodiscard]] double secondsPerTick() const noexcept {
+        return 1.0 / config_.tickRate;
+    }
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+    void setConfig(const Config& config) noexcept { config_ = config; }
+    void reset() noexcept;
+
+   private:
+    Config config_;
+    bool synced_{false};
+    double offset_{0};  ///< Server tick at local time 0 (least delayed)
+    double lastArrival_{0};
+    double jitter_{0};      ///< Average lateness behind offset_, in ticks
+    double averageGap_{1};  ///< Average ticks between samples of an entity
+};
+
+}  // namespace rtype::client
+
+#endif  // SRC_CLIENT_NETWORK_INTERPOLATIONBUFFER_HPP_
@@ -7,20 +7,24 @@
 
 #include "NetworkClient.hpp"
 
-#include <chrono>
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <exception>
+#include <future>
 #include <memory>
-#include <queue>
 #include <span>
 #include <string>
 #include <thread>
 #include <utility>
+#include <variant>
 
 #include "Logger/Macros.hpp"
 #include "Serializer.hpp"
 #include "protocol/ByteOrderSpec.hpp"
 #include "protocol/Header.hpp"
 #include "protocol/OpCode.hpp"
+#include "snapshot/SnapshotCodec.hpp"
 
 namespace rtype::client {
 
@@ -35,74 +39,15 @@ inline float dequantize(std::int16_t v, float scale) {
 }  // namespace
 
 NetworkClient::NetworkClient(const Config& config)
-    : config_(config),
-      ioContext_(),
-      socket_(network::createAsyncSocket(ioContext_.get())),
-      connection_(config.connectionConfig),
-      receiveBuffer_(
-          std::make_shared<network::Buffer>(network::kMaxPacketSize)),
-      receiveSender_(std::make_shared<network::Endpoint>()) {
-    network::ConnectionCallbacks connCallbacks;
-
-    connCallbacks.onConnected = [this](std::uint32_t userId) {
-        queueCallback([this, userId]() {
-            for (const auto& callback : onConnectedCallbacks_) {
-                if (callback) {
-                    callback(userId);
-                }
-            }
-        });
-    };
-
-    connCallbacks.onDisconnected = [this](network::DisconnectReason reason) {
-        queueCallback([this, reason]() {
-            connection_.reset();
-            serverEndpoint_.reset();
-            if (socket_) {
-                socket_->cancel();
-                ioContext_.poll();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                socket_->close();
-                socket_ = network::createAsyncSocket(ioContext_.get());
-            }
-
-            for (const auto& cb : onDisconnectedCallbacks_) {
-                if (cb) cb(reason);
-            }
-        });
-    };
-
-    connCallbacks.onConnectFailed = [this](network::NetworkError error) {
-        (void)error;
-        queueCallback([this]() {
-            connection_.reset();
-            serverEndpoint_.reset();
-            if (socket_) {
-                socket_->cancel();
-                ioContext_.poll();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                socket_->close();
-                socket_ = network::createAsyncSocket(ioContext_.get());
-            }
-
-            for (const auto& cb : onDisconnectedCallbacks_) {
-                if (cb) cb(DisconnectReason::ProtocolError);
-            }
-        });
-    };
-
-    connection_.setCallbacks(connCallbacks);
-
-    networkThreadRunning_.store(true, std::memory_order_release);
-    networkThread_ = std::thread([this]() { networkThreadLoop(); });
-}
+    : NetworkClient(config, nullptr, true) {}
 
 NetworkClient::NetworkClient(const Config& config,
                              std::unique_ptr<network::IAsyncSocket> socket,
                              bool startNetworkThread)
     : config_(config),
       ioContext_(),
-      socket_(std::move(socket)),
+      socket_(socket ? std::move(socket)
+                     : network::createAsyncSocket(ioContext_.get())),
       connection_(config.connectionConfig),
       receiveBuffer_(
           std::make_shared<network::Buffer>(network::kMaxPacketSize)),
@@ -110,59 +55,23 @@ NetworkClient::NetworkClient(const Config& config,
     network::ConnectionCallbacks connCallbacks;
 
     connCallbacks.onConnected = [this](std::uint32_t userId) {
-        queueCallback([this, userId]() {
-            for (const auto& callback : onConnectedCallbacks_) {
-                if (callback) {
-                    callback(userId);
-                }
-            }
-        });
+        resetSnapshotState();
+        pushEvent(ConnectedEvent{userId});
     };
 
     connCallbacks.onDisconnected = [this](network::DisconnectReason reason) {
-        queueCallback([this, reason]() {
-            connection_.reset();
-            serverEndpoint_.reset();
-            if (socket_) {
-                socket_->cancel();
-                ioContext_.poll();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                socket_->close();
-                socket_ = network::createAsyncSocket(ioContext_.get());
-            }
-
-            for (const auto& cb : onDisconnectedCallbacks_) {
-                if (cb) cb(reason);
-            }
-        });
+        pushEvent(DisconnectedEvent{reason});
     };
 
     connCallbacks.onConnectFailed = [this](network::NetworkError error) {
         (void)error;
-        queueCallback([this]() {
-            connection_.reset();
-            serverEndpoint_.reset();
-            if (socket_) {
-                socket_->cancel();
-                ioContext_.poll();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                socket_->close();
-                socket_ = network::createAsyncSocket(ioContext_.get());
-            }
-
-            for (const auto& cb : onDisconnectedCallbacks_) {
-                if (cb) cb(DisconnectReason::ProtocolError);
-            }
-        });
+        pushEvent(DisconnectedEvent{DisconnectReason::ProtocolError});
     };
 
     connection_.setCallbacks(connCallbacks);
 
     if (startNetworkThread) {
-        networkThreadRunning_.store(true, std::memory_order_release);
         networkThread_ = std::thread([this]() { networkThreadLoop(); });
-    } else {
-        networkThreadRunning_.store(false, std::memory_order_release);
     }
 }
 
@@ -171,12 +80,9 @@ NetworkClient::~NetworkClient() {
         disconnect();
     }
 
-    if (socket_) {
-        socket_->cancel();
-        ioContext_.poll();
-    }
+    // Handlers only run on the network thread: stop it before touching the
+    // socket from here
     ioContext_.stop();
-    networkThreadRunning_.store(false, std::memory_order_release);
     if (networkThread_.joinable()) {
         networkThread_.join();
     }
@@ -186,7 +92,8 @@ NetworkClient::~NetworkClient() {
     }
 }
 
-bool NetworkClient::connect(const std::string& host, std::uint16_t port) {
+bool NetworkClient::connect(const std::string& host, std::uint16_t port,
+                            const std::string& lobbyCode) {
     if (!connection_.isDisconnected()) {
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Cannot connect: not disconnected");
@@ -194,19 +101,17 @@ bool NetworkClient::connect(const std::string& host, std::uint16_t port) {
     }
 
     connection_.reset();
+    connection_.setConnectToken(lobbyCode);
 
     if (socket_) {
-        socket_->cancel();
-        socket_->close();
-        socket_ = network::createAsyncSocket(ioContext_.get());
+        replaceSocket();
     }
 
     auto bindResult = socket_->bind(0);
     if (!bindResult) {
         LOG_ERROR_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Failed to bind socket");
-        socket_->close();
-        socket_ = network::createAsyncSocket(ioContext_.get());
+        replaceSocket();
         return false;
     }
 
@@ -218,9 +123,7 @@ bool NetworkClient::connect(const std::string& host, std::uint16_t port) {
     if (!result) {
         LOG_ERROR_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Failed to initiate connection");
-        socket_->cancel();
-        socket_->close();
-        socket_ = network::createAsyncSocket(ioContext_.get());
+        replaceSocket();
         serverEndpoint_.reset();
         connection_.reset();
         return false;
@@ -241,16 +144,47 @@ void NetworkClient::disconnect() {
         flushOutgoing();
     }
 
+    resetTransport();
+}
+
+void NetworkClient::resetTransport() {
     connection_.reset();
     serverEndpoint_.reset();
 
     if (socket_) {
+        replaceSocket();
+    }
+}
+
+void NetworkClient::replaceSocket() {
+    runOnNetworkThread([this]() {
         socket_->cancel();
-        ioContext_.poll();
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
         socket_->close();
         socket_ = network::createAsyncSocket(ioContext_.get());
+        // The cancelled receive still completes later; its epoch is stale
+        socketEpoch_.fetch_add(1, std::memory_order_acq_rel);
+        receiveInProgress_.store(false, std::memory_order_release);
+    });
+}
+
+void NetworkClient::runOnNetworkThread(const std::function<void()>& task) {
+    if (!networkThread_.joinable() ||
+        networkThread_.get_id() == std::this_thread::get_id()) {
+        task();
+        return;
     }
+
+    std::promise<void> done;
+    auto finished = done.get_future();
+    asio::post(ioContext_.get(), [&task, &done]() {
+        try {
+            task();
+            done.set_value();
+        } catch (...) {
+            done.set_exception(std::current_exception());
+        }
+    });
+    finished.get();
 }
 
 bool NetworkClient::isConnected() const noexcept {
@@ -279,6 +213,28 @@ bool NetworkClient::sendInput(std::uint16_t inputMask) {
     if (!result) {
         return false;
     }
+    lastInputSeqId_ = result.value().seqId;
+
+    socket_->asyncSendTo(
+        result.value().data, *serverEndpoint_,
+        [](network::Result<std::size_t> sendResult) { (void)sendResult; });
+
+    return true;
+}
+
+bool NetworkClient::sendInputHistory(
+    std::span<const network::InputFrame> frames) {
+    if (frames.empty() || !isConnected() || !serverEndpoint_.has_value() ||
+        !socket_->isOpen()) {
+        return false;
+    }
+
+    auto payload = network::InputHistoryCodec::encode(frames);
+
+    auto result = connection_.buildPacket(network::OpCode::C_INPUT, payload);
+    if (!result) {
+        return false;
+    }
 
     socket_->asyncSendTo(
         result.value().data, *serverEndpoint_,
@@ -548,7 +504,9 @@ void NetworkClient::onJoinLobbyResponse(
 }
 
 void NetworkClient::onPositionCorrection(
-    std::function<void(float x, float y)> callback) {
+    std::function<void(float x, float y, std::uint16_t ackInputSeq,
+                       float moveSpeed)>
+        callback) {
     onPositionCorrectionCallback_ = std::move(callback);
 }
 
@@ -653,30 +611,182 @@ void NetworkClient::poll() {
 }
 
 void NetworkClient::networkThreadLoop() {
-    while (networkThreadRunning_.load(std::memory_order_acquire)) {
-        ioContext_.poll();
-
-        std::this_thread::sleep_for(kNetworkThreadSleepDuration);
+    // The IoContext work guard keeps run() blocked while no I/O is pending,
+    // so received datagrams are handled as they arrive; stop() ends it
+    for (;;) {
+        try {
+            ioContext_.run();
+            break;
+        } catch (const std::exception& e) {
+            LOG_ERROR_CAT(rtype::LogCategory::Network,
+                          "[NetworkClient] Exception in network thread: "
+                              << e.what());
+        }
     }
 }
 
 void NetworkClient::dispatchCallbacks() {
-    std::queue<std::function<void()>> toDispatch;
+    std::array<NetworkEvent, kEventDispatchBatch> batch;
 
-    {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        std::swap(toDispatch, callbackQueue_);
+    // Only what is queued now; events queued meanwhile wait for next frame
+    std::size_t remaining = eventQueue_.size();
+    while (remaining > 0) {
+        std::size_t count = eventQueue_.popAll(batch);
+        if (count == 0) {
+            break;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            try {
+                std::visit([this](const auto& event) { deliver(event); },
+                           batch[i]);
+            } catch (const std::exception& e) {
+                LOG_ERROR("[NetworkClient] Exception in callback: "
+                          << e.what());
+            } catch (...) {
+                LOG_ERROR("[NetworkClient] Unknown exception in callback");
+            }
+            batch[i] = DeferredCall{};
+        }
+        remaining -= std::min(remaining, count);
     }
+}
 
-    while (!toDispatch.empty()) {
-        try {
-            toDispatch.front()();
-        } catch (const std::exception& e) {
-            LOG_ERROR("[NetworkClient] Exception in callback: " << e.what());
-        } catch (...) {
-            LOG_ERROR("[NetworkClient] Unknown exception in callback");
+void NetworkClient::deliver(const ConnectedEvent& event) {
+    for (const auto& callback : onConnectedCallbacks_) {
+        if (callback) {
+            callback(event.userId);
         }
-        toDispatch.pop();
+    }
+}
+
+void NetworkClient::deliver(const DisconnectedEvent& event) {
+    resetTransport();
+
+    for (const auto& cb : onDisconnectedCallbacks_) {
+        if (cb) cb(event.reason);
+    }
+}
+
+void NetworkClient::deliver(const EntitySpawnEvent& event) {
+    if (onEntitySpawnCallback_) {
+        onEntitySpawnCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const EntityMoveEvent& event) {
+    if (onEntityMoveCallback_) {
+        onEntityMoveCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const EntityMoveBatchEvent& event) {
+    if (onEntityMoveBatchCallback_) {
+        onEntityMoveBatchCallback_(event);
+    } else if (onEntityMoveCallback_) {
+        for (const auto& e : event.entities) {
+            onEntityMoveCallback_(e);
+        }
+    }
+}
+
+void NetworkClient::deliver(const EntityDestroyEvent& event) {
+    for (const auto& cb : onEntityDestroyCallbacks_) {
+        if (cb) cb(event.entityId);
+    }
+}
+
+void NetworkClient::deliver(const EntityHealthEvent& event) {
+    if (onEntityHealthCallback_) {
+        onEntityHealthCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const PowerUpEvent& event) {
+    if (onPowerUpCallback_) {
+        onPowerUpCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const PositionCorrectionEvent& event) {
+    if (onPositionCorrectionCallback_) {
+        onPositionCorrectionCallback_(event.x, event.y, event.ackInputSeq,
+                                      event.moveSpeed);
+    }
+}
+
+void NetworkClient::deliver(const GameStateEvent& event) {
+    if (onGameStateChangeCallback_) {
+        onGameStateChangeCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const GameOverEvent& event) {
+    if (onGameOverCallback_) {
+        onGameOverCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const GameStartEvent& event) {
+    if (onGameStartCallback_) {
+        onGameStartCallback_(event.countdownDuration);
+    }
+}
+
+void NetworkClient::deliver(const PlayerReadyStateEvent& event) {
+    if (onPlayerReadyStateChangedCallback_) {
+        onPlayerReadyStateChangedCallback_(event.userId, event.isReady);
+    }
+}
+
+void NetworkClient::deliver(const BandwidthModeEvent& event) {
+    if (onBandwidthModeChangedCallback_) {
+        onBandwidthModeChangedCallback_(event.userId, event.lowBandwidth,
+                                        event.activeCount);
+    }
+}
+
+void NetworkClient::deliver(const LobbyListEvent& event) {
+    if (onLobbyListReceivedCallback_) {
+        onLobbyListReceivedCallback_(event);
+    }
+}
+
+void NetworkClient::deliver(const JoinLobbyResponseEvent& event) {
+    if (onJoinLobbyResponseCallback_) {
+        onJoinLobbyResponseCallback_(event.accepted, event.reason,
+                                     event.levelName);
+    }
+}
+
+void NetworkClient::deliver(const ChatEvent& event) {
+    if (onChatReceivedCallback_) {
+        onChatReceivedCallback_(event.userId, event.message);
+    }
+}
+
+void NetworkClient::deliver(const LevelAnnounceEvent& event) {
+    if (onLevelAnnounceCallback_) {
+        LOG_INFO_CAT(rtype::LogCategory::Network,
+                     "[NetworkClient] Delivering level announce to callback");
+        onLevelAnnounceCallback_(event);
+        pendingLevelAnnounce_.reset();
+    } else {
+        LOG_INFO_CAT(rtype::LogCategory::Network,
+                     "[NetworkClient] No callback yet, keeping pending "
+                     "announce");
+    }
+}
+
+void NetworkClient::deliver(const AdminResponseEvent& event) {
+    if (onAdminResponseCallback_) {
+        onAdminResponseCallback_(event.commandType, event.success,
+                                 event.newState, event.message);
+    }
+}
+
+void NetworkClient::deliver(const DeferredCall& event) {
+    if (event.call) {
+        event.call();
     }
 }
 
@@ -688,7 +798,7 @@ void NetworkClient::test_processIncomingPacket(
 }
 
 void NetworkClient::test_queueCallback(std::function<void()> callback) {
-    queueCallback(std::move(callback));
+    pushEvent(DeferredCall{std::move(callback)});
 }
 
 void NetworkClient::test_startReceive() { startReceive(); }
@@ -698,15 +808,15 @@ void NetworkClient::test_handlePong(const network::Header& header,
     handlePong(header, payload);
 }
 
-void NetworkClient::queueCallback(std::function<void()> callback) {
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    callbackQueue_.push(std::move(callback));
+void NetworkClient::pushEvent(NetworkEvent event) {
+    if (!eventQueue_.tryPush(std::move(event))) {
+        LOG_WARNING("[NetworkClient] Event queue full, dropping event");
+    }
 }
 
 void NetworkClient::clearPendingCallbacks() {
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    std::queue<std::function<void()>> empty;
-    std::swap(callbackQueue_, empty);
+    while (eventQueue_.tryPop()) {
+    }
 }
 
 void NetworkClient::startReceive() {
@@ -718,10 +828,15 @@ void NetworkClient::startReceive() {
     receiveInProgress_.store(true, std::memory_order_release);
     receiveBuffer_->resize(network::kMaxPacketSize);
 
-    socket_->asyncReceiveFrom(receiveBuffer_, receiveSender_,
-                              [this](network::Result<std::size_t> result) {
-                                  handleReceive(std::move(result));
-                              });
+    const auto epoch = socketEpoch_.load(std::memory_order_acquire);
+    socket_->asyncReceiveFrom(
+        receiveBuffer_, receiveSender_,
+        [this, epoch](network::Result<std::size_t> result) {
+            if (epoch != socketEpoch_.load(std::memory_order_acquire)) {
+                return;
+            }
+            handleReceive(std::move(result));
+        });
 }
 
 void NetworkClient::handleReceive(network::Result<std::size_t> result) {
@@ -765,8 +880,18 @@ void NetworkClient::processIncomingPacket(const network::Buffer& data,
         network::Buffer rawPayload(data.begin() + network::kHeaderSize,
                                    data.end());
 
-        if (header.flags & network::Flags::kCompressed) {
-            auto decompressResult = compressor_.decompress(rawPayload);
+        const auto& compressor = connection_.compressor();
+        if (header.flags & network::Flags::kDictCompressed) {
+            auto decompressResult = compressor.decompressWithDictionary(
+                rawPayload, static_cast<network::OpCode>(header.opcode));
+            if (!decompressResult) {
+                LOG_WARNING_CAT(rtype::LogCategory::Network,
+                                "[NetworkClient] Failed to decompress payload");
+                return;
+            }
+            payload = std::move(decompressResult.value());
+        } else if (header.flags & network::Flags::kCompressed) {
+            auto decompressResult = compressor.decompress(rawPayload);
             if (!decompressResult) {
                 LOG_WARNING_CAT(rtype::LogCategory::Network,
                                 "[NetworkClient] Failed to decompress payload");
@@ -789,7 +914,8 @@ void NetworkClient::processIncomingPacket(const network::Buffer& data,
                           << std::dec);
         sendAck(header.seqId);
     } else if (opcode != network::OpCode::S_ENTITY_MOVE_BATCH &&
-               opcode != network::OpCode::S_ENTITY_MOVE) {
+               opcode != network::OpCode::S_ENTITY_MOVE &&
+               opcode != network::OpCode::S_SNAPSHOT) {
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Received unreliable packet: opcode=0x"
                           << std::hex << static_cast<int>(opcode) << std::dec);
@@ -808,6 +934,10 @@ void NetworkClient::processIncomingPacket(const network::Buffer& data,
             handleEntityMoveBatch(header, payload);
             break;
 
+        case network::OpCode::S_SNAPSHOT:
+            handleSnapshot(header, payload);
+            break;
+
         case network::OpCode::S_ENTITY_DESTROY:
             handleEntityDestroy(header, payload);
             break;
@@ -884,19 +1014,7 @@ void NetworkClient::processIncomingPacket(const network::Buffer& data,
                 }
             }
 
-            queueCallback([this, reason]() {
-                connection_.reset();
-                serverEndpoint_.reset();
-                if (socket_) {
-                    socket_->cancel();
-                    socket_->close();
-                    socket_ = network::createAsyncSocket(ioContext_.get());
-                }
-
-                for (const auto& cb : onDisconnectedCallbacks_) {
-                    if (cb) cb(reason);
-                }
-            });
+            pushEvent(DisconnectedEvent{reason});
             break;
         }
 
@@ -942,11 +1060,7 @@ void NetworkClient::handleEntitySpawn(const network::Header& header,
             event.userId = deserialized.entityId;
         }
 
-        queueCallback([this, event]() {
-            if (onEntitySpawnCallback_) {
-                onEntitySpawnCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -972,11 +1086,7 @@ void NetworkClient::handleEntityMove(const network::Header& header,
         event.vx = dequantize(deserialized.velX, kVelQuantScale);
         event.vy = dequantize(deserialized.velY, kVelQuantScale);
 
-        queueCallback([this, event]() {
-            if (onEntityMoveCallback_) {
-                onEntityMoveCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1026,22 +1136,128 @@ void NetworkClient::handleEntityMoveBatch(const network::Header& header,
             batchEvent.entities.push_back(event);
         }
 
-        queueCallback([this, batchEvent]() {
-            if (onEntityMoveBatchCallback_) {
-                onEntityMoveBatchCallback_(batchEvent);
-            } else {
-                for (const auto& e : batchEvent.entities) {
-                    if (onEntityMoveCallback_) {
-                        onEntityMoveCallback_(e);
-                    }
-                }
-            }
-        });
+        pushEvent(std::move(batchEvent));
     } catch (...) {
         // Invalid payload, ignore
     }
 }
 
+void NetworkClient::handleSnapshot(const network::Header& header,
+                                   const network::Buffer& payload) {
+    (void)header;
+
+    auto snapHeader = network::SnapshotCodec::peekHeader(payload);
+    if (!snapHeader) {
+        return;
+    }
+    std::uint32_t tick = snapHeader.value().serverTick;
+    std::uint32_t baselineTick = snapHeader.value().baselineTick;
+
+    if (lastAppliedSnapshot_ && tick <= lastAppliedSnapshot_->tick) {
+        // A full snapshot far behind our history means the server restarted
+        bool restarted = baselineTick == 0 &&
+                         lastAppliedSnapshot_->tick - tick >=
+                             network::kSnapshotHistorySize;
+        if (!restarted) {
+            return;
+        }
+        resetSnapshotState();
+    }
+
+    network::SnapshotHistory::SnapshotPtr baseline;
+    if (baselineTick != 0) {
+        baseline = snapshotHistory_.find(baselineTick);
+        if (!baseline) {
+            LOG_DEBUG_CAT(rtype::LogCategory::Network,
+                          "[NetworkClient] Snapshot baseline "
+                              << baselineTick << " not in history, dropped");
+            return;
+        }
+    }
+
+    auto decoded = network::SnapshotCodec::decode(payload, baseline.get());
+    if (!decoded) {
+        LOG_WARNING_CAT(rtype::LogCategory::Network,
+                        "[NetworkClient] Failed to decode snapshot tick="
+                            << tick);
+        return;
+    }
+
+    auto snapshot = std::make_shared<const network::WorldSnapshot>(
+        std::move(decoded.value()));
+    snapshotHistory_.push(snapshot);
+    sendSnapshotAck(tick);
+
+    EntityMoveBatchEvent batchEvent;
+    std::vector<EntityHealthEvent> healthEvents;
+    for (const auto& entity : snapshot->entities) {
+        const network::EntitySnapshotState* previous =
+            lastAppliedSnapshot_ ? lastAppliedSnapshot_->find(entity.networkId)
+                                 : nullptr;
+        std::uint8_t mask = previous ? entity.diffMask(*previous)
+                                     : network::SnapshotField::kAll;
+
+        constexpr std::uint8_t kMotionMask =
+            network::SnapshotField::kPosX | network::SnapshotField::kPosY |
+            network::SnapshotField::kVelX | network::SnapshotField::kVelY;
+        if (mask & kMotionMask) {
+            EntityMoveEvent event;
+            event.entityId = entity.networkId;
+            event.serverTick = tick;
+            event.x = network::dequantizeSnapshotValue(
+                entity.posX, network::kSnapshotPosScale);
+            event.y = network::dequantizeSnapshotValue(
+                entity.posY, network::kSnapshotPosScale);
+            event.vx = network::dequantizeSnapshotValue(
+                entity.velX, network::kSnapshotVelScale);
+            event.vy = network::dequantizeSnapshotValue(
+                entity.velY, network::kSnapshotVelScale);
+            batchEvent.entities.push_back(event);
+        }
+
+        constexpr std::uint8_t kHealthMask =
+            network::SnapshotField::kHealth |
+            network::SnapshotField::kMaxHealth;
+        if ((mask & kHealthMask) && entity.maxHealth > 0) {
+            healthEvents.push_back(
+                {entity.networkId, entity.health, entity.maxHealth});
+        }
+    }
+    lastAppliedSnapshot_ = std::move(snapshot);
+
+    if (!batchEvent.entities.empty()) {
+        pushEvent(std::move(batchEvent));
+    }
+    for (const auto& e : healthEvents) {
+        pushEvent(e);
+    }
+}
+
+void NetworkClient::sendSnapshotAck(std::uint32_t serverTick) {
+    if (!serverEndpoint_.has_value() || !socket_ || !socket_->isOpen()) {
+        return;
+    }
+
+    network::SnapshotAckPayload ack{};
+    ack.serverTick = serverTick;
+
+    auto result = connection_.buildPacket(
+        network::OpCode::C_SNAPSHOT_ACK,
+        network::Serializer::serializeForNetwork(ack));
+    if (!result) {
+        return;
+    }
+
+    socket_->asyncSendTo(
+        result.value().data, *serverEndpoint_,
+        [](network::Result<std::size_t> sendResult) { (void)sendResult; });
+}
+
+void NetworkClient::resetSnapshotState() {
+    snapshotHistory_.clear();
+    lastAppliedSnapshot_.reset();
+}
+
 void NetworkClient::handleEntityDestroy(const network::Header& header,
                                         const network::Buffer& payload) {
     (void)header;
@@ -1054,13 +1270,7 @@ void NetworkClient::handleEntityDestroy(const network::Header& header,
         auto deserialized = network::Serializer::deserializeFromNetwork<
             network::EntityDestroyPayload>(payload);
 
-        std::uint32_t entityId = deserialized.entityId;
-
-        queueCallback([this, entityId]() {
-            for (const auto& cb : onEntityDestroyCallbacks_) {
-                if (cb) cb(entityId);
-            }
-        });
+        pushEvent(EntityDestroyEvent{deserialized.entityId});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1096,11 +1306,7 @@ void NetworkClient::handleEntityHealth(const network::Header& header,
         event.current = deserialized.current;
         event.max = deserialized.max;
 
-        queueCallback([this, event]() {
-            if (onEntityHealthCallback_) {
-                onEntityHealthCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         LOG_DEBUG_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Exception deserializing health payload");
@@ -1124,11 +1330,7 @@ void NetworkClient::handlePowerUpEvent(const network::Header& header,
         event.powerUpType = deserialized.powerUpType;
         event.duration = deserialized.duration;
 
-        queueCallback([this, event]() {
-            if (onPowerUpCallback_) {
-                onPowerUpCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1146,14 +1348,9 @@ void NetworkClient::handleUpdatePos(const network::Header& header,
         auto deserialized = network::Serializer::deserializeFromNetwork<
             network::UpdatePosPayload>(payload);
 
-        float x = deserialized.posX;
-        float y = deserialized.posY;
-
-        queueCallback([this, x, y]() {
-            if (onPositionCorrectionCallback_) {
-                onPositionCorrectionCallback_(x, y);
-            }
-        });
+        pushEvent(PositionCorrectionEvent{deserialized.posX, deserialized.posY,
+                                          deserialized.ackInputSeq,
+                                          deserialized.moveSpeed});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1174,11 +1371,7 @@ void NetworkClient::handleUpdateState(const network::Header& header,
         GameStateEvent event;
         event.state = deserialized.getState();
 
-        queueCallback([this, event]() {
-            if (onGameStateChangeCallback_) {
-                onGameStateChangeCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1199,11 +1392,7 @@ void NetworkClient::handleGameOver(const network::Header& header,
         GameOverEvent event{deserialized.finalScore,
                             deserialized.isVictory != 0};
 
-        queueCallback([this, event]() {
-            if (onGameOverCallback_) {
-                onGameOverCallback_(event);
-            }
-        });
+        pushEvent(event);
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1221,13 +1410,7 @@ void NetworkClient::handleGameStart(const network::Header& header,
         auto deserialized = network::Serializer::deserializeFromNetwork<
             network::GameStartPayload>(payload);
 
-        float countdownDuration = deserialized.countdownDuration;
-
-        queueCallback([this, countdownDuration]() {
-            if (onGameStartCallback_) {
-                onGameStartCallback_(countdownDuration);
-            }
-        });
+        pushEvent(GameStartEvent{deserialized.countdownDuration});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1245,14 +1428,8 @@ void NetworkClient::handlePlayerReadyState(const network::Header& header,
         auto deserialized = network::Serializer::deserializeFromNetwork<
             network::PlayerReadyStatePayload>(payload);
 
-        uint32_t userId = deserialized.userId;
-        bool isReady = (deserialized.isReady != 0);
-
-        queueCallback([this, userId, isReady]() {
-            if (onPlayerReadyStateChangedCallback_) {
-                onPlayerReadyStateChangedCallback_(userId, isReady);
-            }
-        });
+        pushEvent(PlayerReadyStateEvent{deserialized.userId,
+                                        deserialized.isReady != 0});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1277,12 +1454,7 @@ void NetworkClient::handleBandwidthModeChanged(const network::Header& header,
              static_cast<std::uint8_t>(network::BandwidthMode::Low));
         std::uint8_t activeCount = deserialized.activeCount;
 
-        queueCallback([this, userId, lowBandwidth, activeCount]() {
-            if (onBandwidthModeChangedCallback_) {
-                onBandwidthModeChangedCallback_(userId, lowBandwidth,
-                                                activeCount);
-            }
-        });
+        pushEvent(BandwidthModeEvent{userId, lowBandwidth, activeCount});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1304,12 +1476,8 @@ void NetworkClient::handleJoinLobbyResponse(const network::Header& header,
             resp.levelName.data(),
             strnlen(resp.levelName.data(), kLevelNameMaxSize));
 
-        queueCallback([this, resp, levelName]() {
-            if (onJoinLobbyResponseCallback_) {
-                onJoinLobbyResponseCallback_(resp.accepted == 1, resp.reason,
-                                             levelName);
-            }
-        });
+        pushEvent(JoinLobbyResponseEvent{resp.accepted == 1, resp.reason,
+                                         std::move(levelName)});
     } catch (...) {
         // Invalid payload, ignore
     }
@@ -1330,12 +1498,7 @@ void NetworkClient::handleChat(const network::Header& header,
 
         std::string messageText(msg.message, strnlen(msg.message, 256));
 
-        queueCallback(
-            [this, userId = msg.userId, message = std::move(messageText)]() {
-                if (onChatReceivedCallback_) {
-                    onChatReceivedCallback_(userId, message);
-                }
-            });
+        pushEvent(ChatEvent{msg.userId, std::move(messageText)});
     } catch (...) {
         // Invalid payload
     }
@@ -1371,19 +1534,7 @@ void NetworkClient::handleLevelAnnounce(const network::Header& header,
 
         pendingLevelAnnounce_ = event;
 
-        queueCallback([this, event]() {
-            if (onLevelAnnounceCallback_) {
-                LOG_INFO_CAT(
-                    rtype::LogCategory::Network,
-                    "[NetworkClient] Delivering level announce to callback");
-                onLevelAnnounceCallback_(event);
-                pendingLevelAnnounce_.reset();
-            } else {
-                LOG_INFO_CAT(rtype::LogCategory::Network,
-                             "[NetworkClient] No callback yet, keeping pending "
-                             "announce");
-            }
-        });
+        pushEvent(std::move(event));
     } catch (...) {
         LOG_ERROR_CAT(
             rtype::LogCategory::Network,
@@ -1401,11 +1552,7 @@ void NetworkClient::handleLobbyList(const network::Header& header,
 
     if (payload.empty()) {
         LOG_DEBUG("[NetworkClient] Received empty lobby list");
-        queueCallback([this]() {
-            if (onLobbyListReceivedCallback_) {
-                onLobbyListReceivedCallback_(LobbyListEvent{{}});
-            }
-        });
+        pushEvent(LobbyListEvent{});
         return;
     }
 
@@ -1453,11 +1600,7 @@ void NetworkClient::handleLobbyList(const network::Header& header,
         LOG_DEBUG("[NetworkClient] Received lobby list with "
                   << event.lobbies.size() << " lobbies");
 
-        queueCallback([this, event = std::move(event)]() {
-            if (onLobbyListReceivedCallback_) {
-                onLobbyListReceivedCallback_(event);
-            }
-        });
+        pushEvent(std::move(event));
     } catch (...) {
         LOG_ERROR("[NetworkClient] Failed to parse lobby list");
     }
@@ -1494,13 +1637,10 @@ void NetworkClient::handleAdminResponse(const network::Header& header,
                          << " newState=" << static_cast<int>(response.newState)
                          << " msg=" << message);
 
-        queueCallback([this, response, message]() {
-            if (onAdminResponseCallback_) {
-                onAdminResponseCallback_(response.commandType,
-                                         response.success == 1,
-                                         response.newState == 1, message);
-            }
-        });
+        pushEvent(AdminResponseEvent{response.commandType,
+                                     response.success == 1,
+                                     response.newState == 1,
+                                     std::move(message)});
     } catch (...) {
         LOG_ERROR_CAT(rtype::LogCategory::Network,
                       "[NetworkClient] Failed to parse admin response");
@@ -12,20 +12,24 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <optional>
-#include <queue>
+#include <span>
 #include <string>
+#include <thread>
+#include <variant>
 #include <vector>
 
 #include <asio.hpp>
 
+#include "LockFreeQueue/MpscQueue.hpp"
 #include "compression/Compressor.hpp"
 #include "connection/Connection.hpp"
 #include "connection/ConnectionEvents.hpp"
 #include "core/Types.hpp"
+#include "input/InputHistoryCodec.hpp"
 #include "protocol/Header.hpp"
 #include "protocol/Payloads.hpp"
+#include "snapshot/SnapshotRing.hpp"
 #include "transport/AsioUdpSocket.hpp"
 #include "transport/IoContext.hpp"
 
@@ -120,6 +124,89 @@ struct LevelAnnounceEvent {
     std::string levelMusic;
 };
 
+/**
+ * @brief Server confirmed the connection
+ */
+struct ConnectedEvent {
+    std::uint32_t userId;
+};
+
+/**
+ * @brief Connection lost, refused or closed by the server
+ */
+struct DisconnectedEvent {
+    network::DisconnectReason reason;
+};
+
+struct EntityDestroyEvent {
+    std::uint32_t entityId;
+};
+
+/**
+ * @brief Authoritative position of the local ship (S_UPDATE_POS)
+ */
+struct PositionCorrectionEvent {
+    float x;
+    float y;
+    std::uint16_t ackInputSeq;
+    float moveSpeed;  ///< Server-side ship speed, 0 if not reported
+};
+
+struct GameStartEvent {
+    float countdownDuration;
+};
+
+struct PlayerReadyStateEvent {
+    std::uint32_t userId;
+    bool isReady;
+};
+
+struct BandwidthModeEvent {
+    std::uint32_t userId;
+    bool lowBandwidth;
+    std::uint8_t activeCount;
+};
+
+struct JoinLobbyResponseEvent {
+    bool accepted;
+    std::uint8_t reason;
+    std::string levelName;
+};
+
+struct ChatEvent {
+    std::uint32_t userId;
+    std::string message;
+};
+
+struct AdminResponseEvent {
+    std::uint8_t commandType;
+    bool success;
+    bool newState;
+    std::string message;
+};
+
+/**
+ * @brief Arbitrary call run on the dispatching thread (test hook)
+ */
+struct DeferredCall {
+    std::function<void()> call;
+};
+
+/**
+ * @brief Everything the network thread hands to the game thread
+ *
+ * Events are stored by value in a pre-allocated ring, so delivering one
+ * costs no allocation beyond the strings and vectors it carries.
+ */
+using NetworkEvent =
+    std::variant<ConnectedEvent, DisconnectedEvent, EntitySpawnEvent,
+                 EntityMoveEvent, EntityMoveBatchEvent, EntityDestroyEvent,
+                 EntityHealthEvent, PowerUpEvent, PositionCorrectionEvent,
+                 GameStateEvent, GameOverEvent, GameStartEvent,
+                 PlayerReadyStateEvent, BandwidthModeEvent, LobbyListEvent,
+                 JoinLobbyResponseEvent, ChatEvent, LevelAnnounceEvent,
+                 AdminResponseEvent, DeferredCall>;
+
 /**
  * @brief High-level client networking API
  *
@@ -154,15 +241,12 @@ struct LevelAnnounceEvent {
  * client.disconnect();
  * @endcode
  *
- * Thread-safety: Callbacks are queued and dispatched on the thread calling
- * poll(). Network I/O is handled by a dedicated background thread.
+ * Thread-safety: Callbacks are dispatched on the thread calling poll().
+ * Network I/O runs on a dedicated thread blocked in asio's run(): a datagram
+ * is decoded as soon as it arrives and queued as a NetworkEvent, which
+ * poll() delivers with the others in one batch.
  */
 
-/**
- * @brief Sleep duration for network thread polling loop (in milliseconds)
- */
-static constexpr std::chrono::milliseconds kNetworkThreadSleepDuration{3};
-
 class NetworkClient {
    public:
     using DisconnectReason = network::DisconnectReason;
@@ -212,9 +296,12 @@ class NetworkClient {
      *
      * @param host Server hostname or IP address
      * @param port Server port number
+     * @param lobbyCode Lobby code sent with C_CONNECT so a server hosting
+     *        several lobbies on one port routes us to the right one
      * @return true if connection attempt started, false if already connected
      */
-    bool connect(const std::string& host, std::uint16_t port);
+    bool connect(const std::string& host, std::uint16_t port,
+                 const std::string& lobbyCode = "");
 
     /**
      * @brief Gracefully disconnect from server
@@ -255,6 +342,28 @@ class NetworkClient {
      */
     bool sendInput(std::uint16_t inputMask);
 
+    /**
+     * @brief Header sequence ID of the last input sent
+     *
+     * The server acknowledges inputs by this ID in S_UPDATE_POS.
+     */
+    [[nodiscard]] std::uint16_t lastInputSeqId() const noexcept {
+        return lastInputSeqId_;
+    }
+
+    /**
+     * @brief Send the last input frames to the server
+     *
+     * Redundant form of C_INPUT: every packet repeats the previous frames
+     * (see InputHistoryCodec), so inputs survive packet loss without being
+     * sent reliably. The server plays one frame per tick and acknowledges
+     * the low 16 bits of the last tick applied in S_UPDATE_POS.
+     *
+     * @param frames Frames newest first, ticks strictly decreasing
+     * @return true if sent, false if not connected or frames is empty
+     */
+    bool sendInputHistory(std::span<const network::InputFrame> frames);
+
     /**
      * @brief Send a chat message to the lobby
      *
@@ -392,12 +501,18 @@ class NetworkClient {
     /**
      * @brief Register callback for server position correction
      *
-     * Called when server's authoritative position differs from client
-     * prediction. Use to snap or interpolate player position.
+     * Called with the server's authoritative position of the local ship, the
+     * last input it applied and the speed it moves the ship at. Use to snap
+     * or reconcile the prediction.
      *
-     * @param callback Function receiving corrected x,y position
+     * @param callback Function receiving corrected x,y position, the
+     *        sequence ID of the last applied input (see lastInputSeqId())
+     *        and the ship speed in px/s (0 if the server did not report it)
      */
-    void onPositionCorrection(std::function<void(float x, float y)> callback);
+    void onPositionCorrection(
+        std::function<void(float x, float y, std::uint16_t ackInputSeq,
+                           float moveSpeed)>
+            callback);
 
     /**
      * @brief Register callback for game state changes
@@ -485,15 +600,17 @@ class NetworkClient {
      * - Send queued outgoing packets
      * - Dispatch queued callbacks to registered handlers
      *
-     * Note: I/O polling is handled by a dedicated network thread.
-     * This method only handles connection maintenance and callback dispatch.
+     * Note: I/O is handled by a dedicated network thread.
+     * This method only handles connection maintenance and event dispatch:
+     * the events queued so far are delivered, later ones wait for the next
+     * call.
      *
      * Callbacks are executed on the calling thread.
      */
     void poll();
 
     /**
-     * @brief Clear all pending callbacks in the queue
+     * @brief Clear all pending events in the queue
      * @note Call before scene destruction to prevent stale callbacks
      */
     void clearPendingCallbacks();
@@ -509,10 +626,53 @@ class NetworkClient {
 
    private:
     void dispatchCallbacks();
-    void queueCallback(std::function<void()> callback);
-
+    void pushEvent(NetworkEvent event);
+
+    void deliver(const ConnectedEvent& event);
+    void deliver(const DisconnectedEvent& event);
+    void deliver(const EntitySpawnEvent& event);
+    void deliver(const EntityMoveEvent& event);
+    void deliver(const EntityMoveBatchEvent& event);
+    void deliver(const EntityDestroyEvent& event);
+    void deliver(const EntityHealthEvent& event);
+    void deliver(const PowerUpEvent& event);
+    void deliver(const PositionCorrectionEvent& event);
+    void deliver(const GameStateEvent& event);
+    void deliver(const GameOverEvent& event);
+    void deliver(const GameStartEvent& event);
+    void deliver(const PlayerReadyStateEvent& event);
+    void deliver(const BandwidthModeEvent& event);
+    void deliver(const LobbyListEvent& event);
+    void deliver(const JoinLobbyResponseEvent& event);
+    void deliver(const ChatEvent& event);
+    void deliver(const LevelAnnounceEvent& event);
+    void deliver(const AdminResponseEvent& event);
+    void deliver(const DeferredCall& event);
+
+    /**
+     * @brief Body of networkThread_: runs the io_context until destruction
+     */
     void networkThreadLoop();
 
+    /**
+     * @brief Drop the connection and replace the socket with a fresh one
+     */
+    void resetTransport();
+
+    /**
+     * @brief Close the socket and open a fresh, unbound one
+     *
+     * Runs on the network thread, where the socket's handlers run.
+     */
+    void replaceSocket();
+
+    /**
+     * @brief Run a task on the network thread and wait for it to finish
+     *
+     * Runs it inline when there is no network thread or when already on it.
+     */
+    void runOnNetworkThread(const std::function<void()>& task);
+
     void startReceive();
     void handleReceive(network::Result<std::size_t> result);
     void processIncomingPacket(const network::Buffer& data,
@@ -523,6 +683,8 @@ class NetworkClient {
                           const network::Buffer& payload);
     void handleEntityMoveBatch(const network::Header& header,
                                const network::Buffer& payload);
+    void handleSnapshot(const network::Header& header,
+                        const network::Buffer& payload);
     void handleEntityDestroy(const network::Header& header,
                              const network::Buffer& payload);
     void handleEntityHealth(const network::Header& header,
@@ -565,9 +727,18 @@ class NetworkClient {
      */
     void sendAck(std::uint16_t ackSeqId);
 
-    Config config_;
+    /**
+     * @brief Acknowledge a decoded S_SNAPSHOT so the server can use it as
+     * the next delta baseline
+     */
+    void sendSnapshotAck(std::uint32_t serverTick);
 
-    network::Compressor compressor_;
+    /**
+     * @brief Forget every received snapshot (new session / server restart)
+     */
+    void resetSnapshotState();
+
+    Config config_;
 
     network::IoContext ioContext_;
 
@@ -580,9 +751,17 @@ class NetworkClient {
     std::shared_ptr<network::Buffer> receiveBuffer_;
     std::shared_ptr<network::Endpoint> receiveSender_;
     std::atomic<bool> receiveInProgress_{false};
+    /// Bumped by replaceSocket(): receives of an older socket are ignored
+    std::atomic<std::uint64_t> socketEpoch_{0};
 
-    std::mutex callbackMutex_;
-    std::queue<std::function<void()>> callbackQueue_;
+    // Snapshot replication state, only touched from the network thread
+    network::SnapshotHistory snapshotHistory_;
+    network::SnapshotHistory::SnapshotPtr lastAppliedSnapshot_;
+
+    static constexpr std::size_t kEventQueueCapacity = 4096;
+    static constexpr std::size_t kEventDispatchBatch = 64;
+    /// Network thread (and connection timeouts) -> thread calling poll()
+    MpscQueue<NetworkEvent> eventQueue_{kEventQueueCapacity};
 
     std::vector<std::function<void(std::uint32_t)>> onConnectedCallbacks_;
     std::vector<std::function<void(DisconnectReason)>> onDisconnectedCallbacks_;
@@ -591,7 +770,8 @@ class NetworkClient {
     std::function<void(EntityMoveBatchEvent)> onEntityMoveBatchCallback_;
     std::vector<std::function<void(std::uint32_t)>> onEntityDestroyCallbacks_;
     std::function<void(EntityHealthEvent)> onEntityHealthCallback_;
-    std::function<void(float, float)> onPositionCorrectionCallback_;
+    std::function<void(float, float, std::uint16_t, float)>
+        onPositionCorrectionCallback_;
     std::function<void(GameStateEvent)> onGameStateChangeCallback_;
     std::function<void(GameOverEvent)> onGameOverCallback_;
     std::function<void(std::uint32_t, std::string)> onChatReceivedCallback_;
@@ -609,8 +789,9 @@ class NetworkClient {
     std::function<void(std::uint32_t, bool, std::uint8_t)>
         onBandwidthModeChangedCallback_;
 
+    std::uint16_t lastInputSeqId_{0};
+
     std::thread networkThread_;
-    std::atomic<bool> networkThreadRunning_{false};
 };
 
 }  // namespace rtype::client
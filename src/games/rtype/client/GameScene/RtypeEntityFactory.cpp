@@ -106,7 +106,7 @@ RtypeEntityFactory::createNetworkEntityFactory(
                           << static_cast<int>(event.type) << " pos=(" << event.x
                           << ", " << event.y << ")");
 
-        auto entity = reg.spawnEntity();
+        auto entity = acquireNetworkEntity(reg, event.type, event.subType);
 
         reg.emplaceComponent<::rtype::games::rtype::shared::TransformComponent>(
             entity, event.x, event.y);
@@ -400,6 +400,35 @@ void RtypeEntityFactory::setupBydosEntity(
     }
 }
 
+ECS::Entity RtypeEntityFactory::acquireNetworkEntity(
+    ECS::Registry& reg, ::rtype::network::EntityType type, uint8_t subType) {
+    if (type != ::rtype::network::EntityType::Missile) {
+        return reg.spawnEntity();
+    }
+    if (!reg.hasSingleton<NetworkEntityPools>()) {
+        reg.setSingleton<NetworkEntityPools>();
+    }
+    auto& pools = reg.getSingleton<NetworkEntityPools>().pools;
+    const auto key = static_cast<std::uint16_t>(
+        (static_cast<std::uint16_t>(type) << 8) | subType);
+    auto& pool =
+        pools.try_emplace(key, ECS::EntityPool::PrefabFunc{}).first->second;
+
+    // The setup function overwrites everything it adds; drop what other
+    // paths attached during the previous life.
+    auto entity = pool.acquire(reg);
+    if (reg.hasComponent<shared::DestroyTag>(entity)) {
+        reg.removeComponent<shared::DestroyTag>(entity);
+    }
+    if (reg.hasComponent<shared::HealthComponent>(entity)) {
+        reg.removeComponent<shared::HealthComponent>(entity);
+    }
+    if (reg.hasComponent<Rotation>(entity)) {
+        reg.removeComponent<Rotation>(entity);
+    }
+    return entity;
+}
+
 void RtypeEntityFactory::setupMissileEntity(
     ECS::Registry& reg, std::shared_ptr<AssetManager> assetsManager,
     ECS::Entity entity, uint8_t encodedSubType) {
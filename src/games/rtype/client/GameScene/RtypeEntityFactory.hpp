@@ -8,7 +8,9 @@
 #ifndef SRC_GAMES_RTYPE_CLIENT_GAMESCENE_RTYPEENTITYFACTORY_HPP_
 #define SRC_GAMES_RTYPE_CLIENT_GAMESCENE_RTYPEENTITYFACTORY_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
 
 #include "../../../../client/Graphic/AssetManager/AssetManager.hpp"
 #include "../../../../client/network/ClientNetworkSystem.hpp"
@@ -26,6 +28,16 @@ namespace rtype::games::rtype::client {
  */
 class RtypeEntityFactory {
    public:
+    /**
+     * @brief Recycled network entities, one pool per type and subtype
+     *
+     * Kept as a registry singleton so every factory built on the same
+     * registry shares it.
+     */
+    struct NetworkEntityPools {
+        std::unordered_map<std::uint16_t, ECS::EntityPool> pools;
+    };
+
     /**
      * @brief Create entity factory callback for network system
      *
@@ -37,6 +49,23 @@ class RtypeEntityFactory {
     createNetworkEntityFactory(std::shared_ptr<ECS::Registry> registry,
                                std::shared_ptr<AssetManager> assetsManager);
 
+    /**
+     * @brief Get the entity a network spawn is built on
+     *
+     * Missiles come from a pool keyed by type and subtype: entities of one
+     * key get the same components, so a recycled one only sheds what was
+     * attached during its previous life. Other types are spawned fresh.
+     * Release either through ECS::EntityPool::despawn().
+     *
+     * @param reg ECS registry
+     * @param type Network entity type
+     * @param subType Type-specific variant
+     * @return Active entity
+     */
+    static ECS::Entity acquireNetworkEntity(ECS::Registry& reg,
+                                            ::rtype::network::EntityType type,
+                                            uint8_t subType);
+
     /**
      * @brief Create a player entity with all components
      *
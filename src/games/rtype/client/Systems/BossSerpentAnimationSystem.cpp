@@ -14,8 +14,9 @@
 #include "BossSerpentAnimationSystem.hpp"
 
 #include <cmath>
-#include <unordered_map>
+#include <cstddef>
 
+#include "../../shared/Components/PositionTrailComponent.hpp"
 #include "../../shared/Components/TransformComponent.hpp"
 #include "../../shared/Components/VelocityComponent.hpp"
 #include "../Components/BossSerpentComponent.hpp"
@@ -25,16 +26,12 @@
 
 namespace rtype::games::rtype::client {
 
+using shared::PositionTrailComponent;
 using shared::TransformComponent;
 using shared::VelocityComponent;
 
-struct EntityPositionData {
-    float prevX = 0.0f;
-    float prevY = 0.0f;
-    bool initialized = false;
-};
-
-static std::unordered_map<std::uint32_t, EntityPositionData> s_positionTracker;
+/// Only the last two positions are needed to get a heading
+static constexpr std::size_t HEADING_TRAIL_CAPACITY = 2;
 
 BossSerpentAnimationSystem::BossSerpentAnimationSystem()
     : ::rtype::engine::ASystem("BossSerpentAnimationSystem") {}
@@ -47,10 +44,12 @@ void BossSerpentAnimationSystem::update(ECS::Registry& registry, float dt) {
             visual.updateAnimation(dt);
             if (registry.hasComponent<Rotation>(entity)) {
                 auto& rot = registry.getComponent<Rotation>(entity);
-                auto& posData = s_positionTracker[entity.id];
-                if (posData.initialized) {
-                    float vx = transform.x - posData.prevX;
-                    float vy = transform.y - posData.prevY;
+                auto& trail = registry.getOrEmplace<PositionTrailComponent>(
+                    entity, HEADING_TRAIL_CAPACITY);
+                trail.record(transform.x, transform.y);
+                if (trail.size() > 1) {
+                    float vx = transform.x - trail[1].first;
+                    float vy = transform.y - trail[1].second;
                     if (std::abs(vx) > 0.5f || std::abs(vy) > 0.5f) {
                         float targetAngle =
                             std::atan2(vy, vx) * 180.0f / 3.14159265f;
@@ -63,9 +62,6 @@ void BossSerpentAnimationSystem::update(ECS::Registry& registry, float dt) {
                         rot.angle += diff * 0.35f;
                     }
                 }
-                posData.prevX = transform.x;
-                posData.prevY = transform.y;
-                posData.initialized = true;
             }
             const char* expectedTexture = visual.getTextureName();
             if (image.textureName != expectedTexture) {
@@ -88,11 +84,13 @@ void BossSerpentAnimationSystem::update(ECS::Registry& registry, float dt) {
             bodyVisual.updateAnimation(dt);
             if (registry.hasComponent<Rotation>(entity)) {
                 auto& rot = registry.getComponent<Rotation>(entity);
-                auto& posData = s_positionTracker[entity.id];
+                auto& trail = registry.getOrEmplace<PositionTrailComponent>(
+                    entity, HEADING_TRAIL_CAPACITY);
+                trail.record(transform.x, transform.y);
 
-                if (posData.initialized) {
-                    float vx = transform.x - posData.prevX;
-                    float vy = transform.y - posData.prevY;
+                if (trail.size() > 1) {
+                    float vx = transform.x - trail[1].first;
+                    float vy = transform.y - trail[1].second;
 
                     if (std::abs(vx) > 0.5f || std::abs(vy) > 0.5f) {
                         float targetAngle =
@@ -108,10 +106,6 @@ void BossSerpentAnimationSystem::update(ECS::Registry& registry, float dt) {
                         rot.angle += diff * 0.30f;
                     }
                 }
-
-                posData.prevX = transform.x;
-                posData.prevY = transform.y;
-                posData.initialized = true;
             }
             const char* expectedTexture = bodyVisual.getTextureName();
             if (image.textureName != expectedTexture) {
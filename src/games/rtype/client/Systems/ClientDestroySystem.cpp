@@ -24,7 +24,9 @@ void ClientDestroySystem::update(ECS::Registry& registry, float /*deltaTime*/) {
                       "[ClientDestroySystem] Destroying " +
                           std::to_string(toDestroy.size()) + " entities");
         for (auto entity : toDestroy) {
-            registry.killEntity(entity);
+            // Pooled entities (missiles) go back to their pool for reuse
+            registry.removeComponent<shared::DestroyTag>(entity);
+            ECS::EntityPool::despawn(registry, entity);
         }
     }
 }
@@ -40,7 +40,8 @@ bool GameEngine::initialize() {
     if (_running) {
         return false;
     }
-    _registry->reserveEntities(GameConfig::MAX_ENEMIES + 100);
+    _registry->reserveEntities(GameConfig::MAX_ENEMIES + 100 +
+                               GameConfig::PROJECTILE_POOL_SIZE);
 
     LOG_INFO("[GameEngine] Loading entity configurations");
     auto& entityConfigRegistry = shared::EntityConfigRegistry::getInstance();
@@ -116,6 +117,8 @@ bool GameEngine::initialize() {
     ProjectileSpawnConfig projConfig{};
     _projectileSpawnerSystem =
         std::make_unique<ProjectileSpawnerSystem>(eventEmitter, projConfig);
+    _projectileSpawnerSystem->prewarm(*_registry,
+                                      GameConfig::PROJECTILE_POOL_SIZE);
 
     auto enemyShootCb = [this](ECS::Registry& reg, ECS::Entity enemy,
                                uint32_t enemyNetId, float ex, float ey,
@@ -130,12 +133,16 @@ bool GameEngine::initialize() {
         std::make_unique<EnemyShootingSystem>(std::move(enemyShootCb));
 
     shared::registerDefaultBehaviors();
-    _aiSystem = std::make_unique<shared::AISystem>();
+    _aiSystem =
+        std::make_unique<shared::AISystem>(GameConfig::JOB_POOL_WORKERS);
     _movementSystem = std::make_unique<shared::MovementSystem>();
+    _targetIndexSystem = std::make_unique<shared::TargetIndexSystem>();
     _lifetimeSystem = std::make_unique<shared::LifetimeSystem>();
     _powerUpSystem = std::make_unique<shared::PowerUpSystem>();
     _collisionSystem = std::make_unique<CollisionSystem>(
-        eventEmitter, GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT);
+        eventEmitter, GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT,
+        shared::BroadphaseBackend::LooseQuadTree,
+        GameConfig::JOB_POOL_WORKERS);
     CleanupConfig cleanupConfig{};
     cleanupConfig.leftBoundary = GameConfig::CLEANUP_LEFT;
     cleanupConfig.rightBoundary = GameConfig::CLEANUP_RIGHT;
@@ -211,6 +218,12 @@ bool GameEngine::initialize() {
                                                             _lastDeltaTime);
                                 },
                                 {"AI"});
+    _systemScheduler->addSystem("TargetIndex",
+                                [this](ECS::Registry& reg) {
+                                    _targetIndexSystem->update(reg,
+                                                               _lastDeltaTime);
+                                },
+                                {"Movement"});
     _systemScheduler->addSystem("Lifetime", [this](ECS::Registry& reg) {
         _lifetimeSystem->update(reg, _lastDeltaTime);
     });
@@ -222,7 +235,7 @@ bool GameEngine::initialize() {
                                     _forcePodAttachmentSystem->update(
                                         reg, _lastDeltaTime);
                                 },
-                                {"Movement"});
+                                {"TargetIndex"});
     _systemScheduler->addSystem("ForcePodLaunch",
                                 [this](ECS::Registry& reg) {
                                     _forcePodLaunchSystem->update(
@@ -258,7 +271,7 @@ bool GameEngine::initialize() {
                                     _bossAttackSystem->update(reg,
                                                               _lastDeltaTime);
                                 },
-                                {"BossPhase"});
+                                {"BossPhase", "TargetIndex"});
     _systemScheduler->addSystem("WeakPoint",
                                 [this](ECS::Registry& reg) {
                                     _weakPointSystem->update(reg,
@@ -303,10 +316,14 @@ void GameEngine::shutdown() {
     }
     _spawnerSystem.reset();
     _dataDrivenSpawnerSystem.reset();
+    if (_projectileSpawnerSystem) {
+        _projectileSpawnerSystem->clearPool(*_registry);
+    }
     _projectileSpawnerSystem.reset();
     _enemyShootingSystem.reset();
     _aiSystem.reset();
     _movementSystem.reset();
+    _targetIndexSystem.reset();
     _lifetimeSystem.reset();
     _powerUpSystem.reset();
     _cleanupSystem.reset();
@@ -320,6 +337,10 @@ void GameEngine::shutdown() {
                   "[GameEngine] Shutdown: Complete");
 }
 
+void GameEngine::setSystemTimer(SystemTimer timer) {
+    _systemScheduler->setSystemTimer(std::move(timer));
+}
+
 bool GameEngine::loadLevelFromFile(const std::string& filepath) {
     if (_dataDrivenSpawnerSystem) {
         if (_dataDrivenSpawnerSystem->loadLevelFromFile(filepath)) {
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -53,6 +54,13 @@ struct GameConfig {
 
     // Enemy parameters
     static constexpr float BYDOS_SLAVE_SPEED = 100.0F;
+
+    // Worker threads per job pool (collision narrowphase, AI kernels); each
+    // lobby runs its own game
+    static constexpr std::size_t JOB_POOL_WORKERS = 2;
+
+    // Projectile entities created up front and recycled afterwards
+    static constexpr std::size_t PROJECTILE_POOL_SIZE = 256;
 };
 
 /**
@@ -102,6 +110,11 @@ class GameEngine : public engine::AGameEngine {
      */
     bool loadLevelFromFile(const std::string& filepath) override;
 
+    /**
+     * @brief Time each system run by update() (see SystemScheduler)
+     */
+    void setSystemTimer(SystemTimer timer) override;
+
     /**
      * @brief Start the loaded level
      */
@@ -215,6 +228,7 @@ class GameEngine : public engine::AGameEngine {
     std::unique_ptr<EnemyShootingSystem> _enemyShootingSystem;
     std::unique_ptr<shared::AISystem> _aiSystem;
     std::unique_ptr<shared::MovementSystem> _movementSystem;
+    std::unique_ptr<shared::TargetIndexSystem> _targetIndexSystem;
     std::unique_ptr<shared::LifetimeSystem> _lifetimeSystem;
     std::unique_ptr<shared::PowerUpSystem> _powerUpSystem;
     std::unique_ptr<CollisionSystem> _collisionSystem;
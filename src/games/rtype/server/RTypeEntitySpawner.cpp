@@ -10,6 +10,7 @@
 #include <algorithm>
 
 #include "../shared/Components/BoundingBoxComponent.hpp"
+#include "../shared/Components/CollisionLayerComponent.hpp"
 #include "../shared/Components/CooldownComponent.hpp"
 #include "../shared/Components/ForcePodComponent.hpp"
 #include "../shared/Components/HealthComponent.hpp"
@@ -37,6 +38,7 @@ RTypeEntitySpawner::RTypeEntitySpawner(
 ::rtype::server::PlayerSpawnResult RTypeEntitySpawner::spawnPlayer(
     const ::rtype::server::PlayerSpawnConfig& config) {
     using shared::BoundingBoxComponent;
+    using shared::CollisionLayerComponent;
     using shared::HealthComponent;
     using shared::NetworkIdComponent;
     using shared::PlayerIdComponent;
@@ -72,6 +74,9 @@ RTypeEntitySpawner::RTypeEntitySpawner(
 
     _registry->emplaceComponent<BoundingBoxComponent>(
         playerEntity, kPlayerWidth, kPlayerHeight);
+    _registry->emplaceComponent<CollisionLayerComponent>(
+        playerEntity,
+        CollisionLayerComponent::of(shared::CollisionLayer::Player));
     _registry->emplaceComponent<PlayerTag>(playerEntity);
     _registry->emplaceComponent<HealthComponent>(
         playerEntity, kDefaultPlayerHealth, kDefaultPlayerHealth);
@@ -278,6 +283,7 @@ void RTypeEntitySpawner::updateAllPlayersMovement(
 ECS::Entity RTypeEntitySpawner::spawnForcePod(std::uint32_t ownerNetworkId,
                                               float offsetX, float offsetY) {
     using shared::BoundingBoxComponent;
+    using shared::CollisionLayerComponent;
     using shared::ForcePodComponent;
     using shared::ForcePodTag;
     using shared::TransformComponent;
@@ -296,6 +302,9 @@ ECS::Entity RTypeEntitySpawner::spawnForcePod(std::uint32_t ownerNetworkId,
                                                     0.0F);
     _registry->emplaceComponent<BoundingBoxComponent>(forcePodEntity, 32.0F,
                                                       32.0F);
+    _registry->emplaceComponent<CollisionLayerComponent>(
+        forcePodEntity,
+        CollisionLayerComponent::of(shared::CollisionLayer::ForcePod));
 
     return forcePodEntity;
 }
@@ -8,7 +8,6 @@
 #include "BossAttackSystem.hpp"
 
 #include <cmath>
-#include <limits>
 #include <utility>
 
 #include "../../../shared/Components/BossComponent.hpp"
@@ -24,7 +23,6 @@ using shared::BossPatternComponent;
 using shared::BossTag;
 using shared::NetworkIdComponent;
 using shared::PatternExecutionState;
-using shared::PlayerTag;
 using shared::TransformComponent;
 
 namespace {
@@ -333,24 +331,15 @@ void BossAttackSystem::executeTailSweep(ECS::Registry& registry,
 void BossAttackSystem::findNearestPlayer(ECS::Registry& registry, float bossX,
                                          float bossY, float& targetX,
                                          float& targetY) {
-    float bestDist2 = std::numeric_limits<float>::max();
     targetX = bossX - 300.0F;
     targetY = bossY;
 
-    auto playerView = registry.view<PlayerTag, TransformComponent>();
-    playerView.each([bossX, bossY, &targetX, &targetY, &bestDist2](
-                        ECS::Entity /*entity*/, const PlayerTag& /*tag*/,
-                        const TransformComponent& transform) {
-        float dx = transform.x - bossX;
-        float dy = transform.y - bossY;
-        float dist2 = dx * dx + dy * dy;
-
-        if (dist2 < bestDist2) {
-            bestDist2 = dist2;
-            targetX = transform.x;
-            targetY = transform.y;
-        }
-    });
+    const auto& targets =
+        shared::PlayerTargetIndex::current(registry, _targets);
+    if (const auto* player = targets.nearest(bossX, bossY)) {
+        targetX = player->x;
+        targetY = player->y;
+    }
 }
 
 }  // namespace rtype::games::rtype::server
@@ -13,6 +13,7 @@
 #include <rtype/engine.hpp>
 
 #include "../../../shared/Components/BossPatternComponent.hpp"
+#include "../../../shared/Systems/Targeting/PlayerTargetIndex.hpp"
 
 namespace rtype::games::rtype::server {
 
@@ -78,6 +79,7 @@ class BossAttackSystem : public ::rtype::engine::ASystem {
     EventEmitter _emitEvent;
     ProjectileSpawner _spawnProjectile;
     MinionSpawner _spawnMinion;
+    shared::PlayerTargetIndex _targets;  ///< Used when no index was published
 };
 
 }  // namespace rtype::games::rtype::server
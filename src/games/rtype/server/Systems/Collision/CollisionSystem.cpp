@@ -9,7 +9,9 @@
 #include "CollisionSystem.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -44,8 +46,11 @@ static_assert(sizeof(ECS::Entity::id) == sizeof(std::uint32_t),
            static_cast<std::uint64_t>(id2);
 }
 
+namespace CollisionLayer = shared::CollisionLayer;
+
 using shared::ActivePowerUpComponent;
 using shared::BoundingBoxComponent;
+using shared::CollisionLayerComponent;
 using shared::CollisionPair;
 using shared::DamageOnContactComponent;
 using shared::DestroyTag;
@@ -64,6 +69,7 @@ using shared::PickupTag;
 using shared::PlayerProjectileTag;
 using shared::PlayerTag;
 using shared::PowerUpComponent;
+using shared::SweptColliderComponent;
 using shared::ProjectileComponent;
 using shared::ProjectileOwner;
 using shared::ProjectileTag;
@@ -72,131 +78,365 @@ using shared::TransformComponent;
 using shared::WeaponComponent;
 using shared::collision::overlaps;
 using shared::collision::Rect;
+using shared::collision::sweptOverlaps;
+
+namespace {
+
+/**
+ * @brief What an entity is, as far as the narrowphase is concerned
+ */
+enum class CollisionKind : uint8_t {
+    Other,
+    Player,
+    Enemy,
+    Projectile,
+    Pickup,
+    Obstacle,
+    ForcePod,
+    LaserBeam,
+    Count
+};
+
+/**
+ * @brief Handler to run for a pair of kinds
+ */
+enum class PairAction : uint8_t {
+    None,
+    ForcePodPickup,
+    Pickup,
+    Obstacle,
+    LaserEnemy,
+    ProjectileHit,
+    EnemyPlayer
+};
+
+struct PairRule {
+    PairAction action = PairAction::None;
+    bool swap = false;  ///< Handler wants (entityB, entityA)
+};
+
+constexpr size_t kKindCount = static_cast<size_t>(CollisionKind::Count);
+using PairRuleTable = std::array<std::array<PairRule, kKindCount>, kKindCount>;
+
+/**
+ * @brief Rule for (a, b), in the priority order the handlers expect
+ */
+constexpr PairRule ruleFor(CollisionKind a, CollisionKind b) {
+    using K = CollisionKind;
+    const auto either = [a, b](K first, K second, PairAction action) {
+        if (a == first && b == second) {
+            return PairRule{action, false};
+        }
+        if (b == first && a == second) {
+            return PairRule{action, true};
+        }
+        return PairRule{};
+    };
+    const auto isPlayerOrProjectile = [](K k) {
+        return k == K::Player || k == K::Projectile;
+    };
+
+    if (auto r = either(K::ForcePod, K::Player, PairAction::ForcePodPickup);
+        r.action != PairAction::None) {
+        return r;
+    }
+    if (auto r = either(K::Player, K::Pickup, PairAction::Pickup);
+        r.action != PairAction::None) {
+        return r;
+    }
+    if (a == K::Obstacle && isPlayerOrProjectile(b)) {
+        return {PairAction::Obstacle, false};
+    }
+    if (b == K::Obstacle && isPlayerOrProjectile(a)) {
+        return {PairAction::Obstacle, true};
+    }
+    if (auto r = either(K::LaserBeam, K::Enemy, PairAction::LaserEnemy);
+        r.action != PairAction::None) {
+        return r;
+    }
+    if (a == K::Projectile || b == K::Projectile) {
+        return {PairAction::ProjectileHit, false};
+    }
+    return either(K::Enemy, K::Player, PairAction::EnemyPlayer);
+}
+
+constexpr PairRuleTable makePairRules() {
+    PairRuleTable table{};
+    for (size_t a = 0; a < kKindCount; ++a) {
+        for (size_t b = 0; b < kKindCount; ++b) {
+            table[a][b] = ruleFor(static_cast<CollisionKind>(a),
+                                  static_cast<CollisionKind>(b));
+        }
+    }
+    return table;
+}
+
+constexpr PairRuleTable kPairRules = makePairRules();
+
+/**
+ * @brief Kind of an entity without a CollisionLayerComponent
+ */
+CollisionKind classifyByTags(const ECS::Registry& registry,
+                             ECS::Entity entity) {
+    if (registry.hasComponent<ForcePodTag>(entity)) {
+        return CollisionKind::ForcePod;
+    }
+    if (registry.hasComponent<PickupTag>(entity)) {
+        return CollisionKind::Pickup;
+    }
+    if (registry.hasComponent<ObstacleTag>(entity)) {
+        return CollisionKind::Obstacle;
+    }
+    if (registry.hasComponent<LaserBeamTag>(entity)) {
+        return CollisionKind::LaserBeam;
+    }
+    if (registry.hasComponent<ProjectileTag>(entity)) {
+        return CollisionKind::Projectile;
+    }
+    if (registry.hasComponent<EnemyTag>(entity)) {
+        return CollisionKind::Enemy;
+    }
+    if (registry.hasComponent<PlayerTag>(entity)) {
+        return CollisionKind::Player;
+    }
+    return CollisionKind::Other;
+}
+
+CollisionKind kindOf(const ECS::Registry& registry, ECS::Entity entity,
+                     uint16_t category) {
+    switch (category) {
+        case CollisionLayer::Player:
+            return CollisionKind::Player;
+        case CollisionLayer::Enemy:
+            return CollisionKind::Enemy;
+        case CollisionLayer::PlayerProjectile:
+        case CollisionLayer::EnemyProjectile:
+        case CollisionLayer::NeutralProjectile:
+            return CollisionKind::Projectile;
+        case CollisionLayer::Pickup:
+            return CollisionKind::Pickup;
+        case CollisionLayer::Obstacle:
+            return CollisionKind::Obstacle;
+        case CollisionLayer::ForcePod:
+            return CollisionKind::ForcePod;
+        case CollisionLayer::LaserBeam:
+            return CollisionKind::LaserBeam;
+        default:
+            return classifyByTags(registry, entity);
+    }
+}
+
+/**
+ * @brief Where the collision system last saw an entity
+ *
+ * The previous position for swept colliders, the current one otherwise
+ * (slow entities are treated as still over one tick).
+ */
+TransformComponent pathStart(const ECS::Registry& registry, ECS::Entity entity,
+                             const TransformComponent& current) {
+    if (registry.hasComponent<SweptColliderComponent>(entity)) {
+        const auto& swept =
+            registry.getComponent<SweptColliderComponent>(entity);
+        if (swept.hasPrevious) {
+            return TransformComponent{swept.prevX, swept.prevY,
+                                      current.rotation};
+        }
+    }
+    return current;
+}
+
+/**
+ * @brief Narrowphase test, swept when either side is a fast mover
+ */
+bool touches(const ECS::Registry& registry, ECS::Entity entityA,
+             const TransformComponent& transformA,
+             const BoundingBoxComponent& boxA, ECS::Entity entityB,
+             const TransformComponent& transformB,
+             const BoundingBoxComponent& boxB) {
+    if (overlaps(transformA, boxA, transformB, boxB)) {
+        return true;
+    }
+    const TransformComponent fromA = pathStart(registry, entityA, transformA);
+    const TransformComponent fromB = pathStart(registry, entityB, transformB);
+    const bool movedA = fromA.x != transformA.x || fromA.y != transformA.y;
+    const bool movedB = fromB.x != transformB.x || fromB.y != transformB.y;
+    if (!movedA && !movedB) {
+        return false;
+    }
+    return sweptOverlaps(fromA, transformA, boxA, fromB, transformB, boxB);
+}
+
+/**
+ * @brief Projectiles hit enemies, players and anything else with health
+ */
+bool isProjectileTarget(const ECS::Registry& registry, ECS::Entity entity,
+                        CollisionKind kind) {
+    return kind == CollisionKind::Enemy || kind == CollisionKind::Player ||
+           registry.hasComponent<HealthComponent>(entity);
+}
+
+}  // namespace
 
 CollisionSystem::CollisionSystem(EventEmitter emitter, float worldWidth,
-                                 float worldHeight)
-    : ASystem("CollisionSystem"), _emitEvent(std::move(emitter)) {
+                                 float worldHeight,
+                                 shared::BroadphaseBackend backend,
+                                 std::size_t narrowphaseWorkers)
+    : ASystem("CollisionSystem"),
+      _emitEvent(std::move(emitter)),
+      _jobPool(std::make_unique<::rtype::JobPool>(narrowphaseWorkers)) {
     Rect worldBounds(0, 0, worldWidth, worldHeight);
-    _quadTreeSystem = std::make_unique<QuadTreeSystem>(worldBounds, 10, 5);
+    _quadTreeSystem =
+        std::make_unique<QuadTreeSystem>(worldBounds, 10, 5, backend);
 }
 
 void CollisionSystem::update(ECS::Registry& registry, float deltaTime) {
     _quadTreeSystem->update(registry, deltaTime);
-    auto collisionPairs = _quadTreeSystem->queryCollisionPairs(registry);
-    ECS::CommandBuffer cmdBuffer(std::ref(registry));
+    _quadTreeSystem->queryCollisionPairs(_collisionPairs);
+    runNarrowphase(registry);
 
+    ECS::CommandBuffer cmdBuffer(std::ref(registry));
     _laserDamagedThisFrame.clear();
     _obstacleCollidedThisFrame.clear();
 
-    for (const auto& pair : collisionPairs) {
-        ECS::Entity entityA = pair.entityA;
-        ECS::Entity entityB = pair.entityB;
+    for (const auto& hit : _hits) {
+        applyHit(registry, cmdBuffer, hit, deltaTime);
+    }
+    cmdBuffer.flush();
 
-        if (!registry.isAlive(entityA) || !registry.isAlive(entityB)) {
-            continue;
-        }
-        if (registry.hasComponent<DestroyTag>(entityA) ||
-            registry.hasComponent<DestroyTag>(entityB)) {
-            continue;
-        }
+    // Next frame sweeps fast movers from where they are now
+    registry.view<SweptColliderComponent, TransformComponent>().each(
+        [](ECS::Entity /*entity*/, SweptColliderComponent& swept,
+           const TransformComponent& transform) { swept.record(transform); });
+}
 
-        if (!registry.hasComponent<TransformComponent>(entityA) ||
-            !registry.hasComponent<TransformComponent>(entityB) ||
-            !registry.hasComponent<BoundingBoxComponent>(entityA) ||
-            !registry.hasComponent<BoundingBoxComponent>(entityB)) {
-            continue;
-        }
+bool CollisionSystem::testPair(const ECS::Registry& registry,
+                               const CollisionPair& pair, HitRecord& hit) {
+    ECS::Entity entityA = pair.entityA;
+    ECS::Entity entityB = pair.entityB;
 
-        const auto& transformA =
-            registry.getComponent<TransformComponent>(entityA);
-        const auto& transformB =
-            registry.getComponent<TransformComponent>(entityB);
-        const auto& boxA = registry.getComponent<BoundingBoxComponent>(entityA);
-        const auto& boxB = registry.getComponent<BoundingBoxComponent>(entityB);
+    if (!registry.isAlive(entityA) || !registry.isAlive(entityB)) {
+        return false;
+    }
+    if (registry.hasComponent<DestroyTag>(entityA) ||
+        registry.hasComponent<DestroyTag>(entityB)) {
+        return false;
+    }
 
-        if (!overlaps(transformA, boxA, transformB, boxB)) {
-            continue;
-        }
+    if (!registry.hasComponent<TransformComponent>(entityA) ||
+        !registry.hasComponent<TransformComponent>(entityB) ||
+        !registry.hasComponent<BoundingBoxComponent>(entityA) ||
+        !registry.hasComponent<BoundingBoxComponent>(entityB)) {
+        return false;
+    }
 
-        bool aIsProjectile = registry.hasComponent<ProjectileTag>(entityA);
-        bool bIsProjectile = registry.hasComponent<ProjectileTag>(entityB);
-        bool aIsEnemy = registry.hasComponent<EnemyTag>(entityA);
-        bool bIsEnemy = registry.hasComponent<EnemyTag>(entityB);
-        bool aIsForcePod = registry.hasComponent<ForcePodTag>(entityA);
-        bool bIsForcePod = registry.hasComponent<ForcePodTag>(entityB);
-        bool aIsPlayer =
-            registry.hasComponent<PlayerTag>(entityA) && !aIsForcePod;
-        bool bIsPlayer =
-            registry.hasComponent<PlayerTag>(entityB) && !bIsForcePod;
-        bool aIsPickup = registry.hasComponent<PickupTag>(entityA);
-        bool bIsPickup = registry.hasComponent<PickupTag>(entityB);
-        bool aIsObstacle = registry.hasComponent<ObstacleTag>(entityA);
-        bool bIsObstacle = registry.hasComponent<ObstacleTag>(entityB);
-        bool aIsLaser = registry.hasComponent<LaserBeamTag>(entityA);
-        bool bIsLaser = registry.hasComponent<LaserBeamTag>(entityB);
-        bool aHasHealth = registry.hasComponent<HealthComponent>(entityA);
-        bool bHasHealth = registry.hasComponent<HealthComponent>(entityB);
-
-        if (aIsForcePod && bIsPlayer) {
-            handleOrphanForcePodPickup(registry, cmdBuffer, entityA, entityB);
-            continue;
-        }
-        if (bIsForcePod && aIsPlayer) {
-            handleOrphanForcePodPickup(registry, cmdBuffer, entityB, entityA);
-            continue;
-        }
+    const auto& transformA = registry.getComponent<TransformComponent>(entityA);
+    const auto& transformB = registry.getComponent<TransformComponent>(entityB);
+    const auto& boxA = registry.getComponent<BoundingBoxComponent>(entityA);
+    const auto& boxB = registry.getComponent<BoundingBoxComponent>(entityB);
 
-        if (aIsPickup && bIsPlayer) {
-            LOG_INFO(
-                "[CollisionSystem] Pickup-Player collision detected: pickup="
-                << entityA.id << " player=" << entityB.id);
-            handlePickupCollision(registry, cmdBuffer, entityB, entityA);
-            continue;
-        }
-        if (bIsPickup && aIsPlayer) {
-            LOG_INFO(
-                "[CollisionSystem] Player-Pickup collision detected: player="
-                << entityA.id << " pickup=" << entityB.id);
-            handlePickupCollision(registry, cmdBuffer, entityA, entityB);
-            continue;
-        }
+    if (!touches(registry, entityA, transformA, boxA, entityB, transformB,
+                 boxB)) {
+        return false;
+    }
 
-        if (aIsObstacle && (bIsPlayer || bIsProjectile)) {
-            handleObstacleCollision(registry, cmdBuffer, entityA, entityB,
-                                    bIsPlayer);
-            continue;
-        }
-        if (bIsObstacle && (aIsPlayer || aIsProjectile)) {
-            handleObstacleCollision(registry, cmdBuffer, entityB, entityA,
-                                    aIsPlayer);
-            continue;
-        }
+    CollisionKind kindA = kindOf(registry, entityA, pair.categoryA);
+    CollisionKind kindB = kindOf(registry, entityB, pair.categoryB);
+    // Lower id first, so the broadphase's pair orientation does not matter
+    if (entityB.id < entityA.id) {
+        std::swap(entityA, entityB);
+        std::swap(kindA, kindB);
+    }
+    hit.entityA = entityA;
+    hit.entityB = entityB;
+    hit.kindA = static_cast<uint8_t>(kindA);
+    hit.kindB = static_cast<uint8_t>(kindB);
+    return true;
+}
 
-        if (aIsLaser && bIsEnemy) {
-            handleLaserEnemyCollision(registry, cmdBuffer, entityA, entityB,
-                                      deltaTime);
-            continue;
-        }
-        if (bIsLaser && aIsEnemy) {
-            handleLaserEnemyCollision(registry, cmdBuffer, entityB, entityA,
-                                      deltaTime);
-            continue;
-        }
+void CollisionSystem::runNarrowphase(const ECS::Registry& registry) {
+    const std::size_t chunks = ::rtype::JobPool::chunkCount(
+        _collisionPairs.size(), kNarrowphaseChunk);
+    if (_chunkHits.size() < chunks) {
+        _chunkHits.resize(chunks);
+    }
 
-        if (aIsProjectile && (bIsEnemy || bIsPlayer || bHasHealth)) {
-            handleProjectileCollision(registry, cmdBuffer, entityA, entityB,
-                                      bIsPlayer);
-        } else if (bIsProjectile && (aIsEnemy || aIsPlayer || aHasHealth)) {
-            handleProjectileCollision(registry, cmdBuffer, entityB, entityA,
-                                      aIsPlayer);
-        }
-        if (aIsEnemy && bIsPlayer) {
-            handleEnemyPlayerCollision(registry, cmdBuffer, entityA, entityB);
-        } else if (bIsEnemy && aIsPlayer) {
-            handleEnemyPlayerCollision(registry, cmdBuffer, entityB, entityA);
-        }
+    _jobPool->parallelFor(
+        _collisionPairs.size(), kNarrowphaseChunk,
+        [this, &registry](std::size_t chunk, std::size_t begin,
+                          std::size_t end) {
+            auto& out = _chunkHits[chunk];
+            out.clear();
+            HitRecord hit;
+            for (std::size_t i = begin; i < end; ++i) {
+                if (testPair(registry, _collisionPairs[i], hit)) {
+                    out.push_back(hit);
+                }
+            }
+        });
+
+    _hits.clear();
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        _hits.insert(_hits.end(), _chunkHits[chunk].begin(),
+                     _chunkHits[chunk].end());
+    }
+    // Responses run in entity order, whatever order the pairs came in
+    std::sort(_hits.begin(), _hits.end(),
+              [](const HitRecord& lhs, const HitRecord& rhs) {
+                  return makeCollisionPairId(lhs.entityA, lhs.entityB) <
+                         makeCollisionPairId(rhs.entityA, rhs.entityB);
+              });
+}
+
+void CollisionSystem::applyHit(ECS::Registry& registry,
+                               ECS::CommandBuffer& cmdBuffer,
+                               const HitRecord& hit, float deltaTime) {
+    const ECS::Entity entityA = hit.entityA;
+    const ECS::Entity entityB = hit.entityB;
+    const auto kindA = static_cast<CollisionKind>(hit.kindA);
+    const auto kindB = static_cast<CollisionKind>(hit.kindB);
+    const PairRule rule =
+        kPairRules[static_cast<size_t>(kindA)][static_cast<size_t>(kindB)];
+    // Handlers take their entities in a fixed role order
+    const ECS::Entity first = rule.swap ? entityB : entityA;
+    const ECS::Entity second = rule.swap ? entityA : entityB;
+    const CollisionKind secondKind = rule.swap ? kindA : kindB;
+
+    switch (rule.action) {
+        case PairAction::ForcePodPickup:
+            handleOrphanForcePodPickup(registry, cmdBuffer, first, second);
+            break;
+        case PairAction::Pickup:
+            LOG_INFO("[CollisionSystem] Player-Pickup collision detected: "
+                     "player=" << first.id << " pickup=" << second.id);
+            handlePickupCollision(registry, cmdBuffer, first, second);
+            break;
+        case PairAction::Obstacle:
+            handleObstacleCollision(registry, cmdBuffer, first, second,
+                                    secondKind == CollisionKind::Player);
+            break;
+        case PairAction::LaserEnemy:
+            handleLaserEnemyCollision(registry, cmdBuffer, first, second,
+                                      deltaTime);
+            break;
+        case PairAction::ProjectileHit:
+            if (kindA == CollisionKind::Projectile &&
+                isProjectileTarget(registry, entityB, kindB)) {
+                handleProjectileCollision(registry, cmdBuffer, entityA,
+                                          entityB,
+                                          kindB == CollisionKind::Player);
+            } else if (kindB == CollisionKind::Projectile &&
+                       isProjectileTarget(registry, entityA, kindA)) {
+                handleProjectileCollision(registry, cmdBuffer, entityB,
+                                          entityA,
+                                          kindA == CollisionKind::Player);
+            }
+            break;
+        case PairAction::EnemyPlayer:
+            handleEnemyPlayerCollision(registry, cmdBuffer, first, second);
+            break;
+        case PairAction::None:
+            break;
     }
-    cmdBuffer.flush();
 }
 
 void CollisionSystem::handleProjectileCollision(ECS::Registry& registry,
@@ -473,6 +713,9 @@ void CollisionSystem::handlePickupCollision(ECS::Registry& registry,
                                                               0.0F, 0.0F);
                 registry.emplaceComponent<BoundingBoxComponent>(forcePod, 32.0F,
                                                                 32.0F);
+                registry.emplaceComponent<CollisionLayerComponent>(
+                    forcePod, CollisionLayerComponent::of(
+                                  CollisionLayer::ForcePod));
 
                 if (_emitEvent) {
                     uint32_t forcePodNetId =
@@ -7,17 +7,20 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <rtype/engine.hpp>
 
 #include "../../../shared/Components/DamageOnContactComponent.hpp"
 #include "../../../shared/Components/PowerUpComponent.hpp"
 #include "../../../shared/Systems/Collision/QuadTreeSystem.hpp"
+#include "JobPool/JobPool.hpp"
 
 namespace rtype::games::rtype::server {
 
@@ -30,6 +33,16 @@ namespace rtype::games::rtype::server {
  *
  * Uses CommandBuffer pour différer les modifications d'entités durant
  * l'itération.
+ *
+ * Each frame runs in two passes: the narrowphase tests every candidate pair
+ * read-only, in fixed-size chunks spread over a JobPool, and records hits
+ * per chunk; the hits are then sorted by entity id and the responses
+ * (damage, pickups, force pod...) applied serially. The outcome does not
+ * depend on the worker count or on the broadphase pair order.
+ *
+ * Entities with a SweptColliderComponent are tested along the segment from
+ * their position at the previous update to the current one, so fast shots
+ * cannot step over a thin target at low tick rates.
  */
 class CollisionSystem : public ::rtype::engine::ASystem {
    public:
@@ -40,13 +53,52 @@ class CollisionSystem : public ::rtype::engine::ASystem {
      * @param emitter Function to emit game events (e.g., health changes)
      * @param worldWidth Width of the game world (default: 1920)
      * @param worldHeight Height of the game world (default: 1080)
+     * @param backend Broadphase used to find candidate pairs
+     * @param narrowphaseWorkers Worker threads for the narrowphase; 0 keeps
+     *        it on the calling thread
      */
-    explicit CollisionSystem(EventEmitter emitter, float worldWidth = 1920.0F,
-                             float worldHeight = 1080.0F);
+    explicit CollisionSystem(
+        EventEmitter emitter, float worldWidth = 1920.0F,
+        float worldHeight = 1080.0F,
+        shared::BroadphaseBackend backend =
+            shared::BroadphaseBackend::LooseQuadTree,
+        std::size_t narrowphaseWorkers = 0);
 
     void update(ECS::Registry& registry, float deltaTime) override;
 
+    /// Candidate pairs per narrowphase chunk
+    static constexpr std::size_t kNarrowphaseChunk = 128;
+
    private:
+    /**
+     * @brief Overlapping pair found by the narrowphase, applied later
+     */
+    struct HitRecord {
+        ECS::Entity entityA;
+        ECS::Entity entityB;
+        uint8_t kindA = 0;  ///< CollisionKind of entityA
+        uint8_t kindB = 0;  ///< CollisionKind of entityB
+    };
+
+    /**
+     * @brief Tests one candidate pair without modifying the registry
+     * @param hit Filled when the pair overlaps (output parameter)
+     * @return true if the pair overlaps and both entities are live
+     */
+    static bool testPair(const ECS::Registry& registry,
+                         const shared::CollisionPair& pair, HitRecord& hit);
+
+    /**
+     * @brief Fills _hits with every overlapping pair, sorted by entity id
+     */
+    void runNarrowphase(const ECS::Registry& registry);
+
+    /**
+     * @brief Applies the response of one hit
+     */
+    void applyHit(ECS::Registry& registry, ECS::CommandBuffer& cmdBuffer,
+                  const HitRecord& hit, float deltaTime);
+
     /**
      * @brief Handle collision between a projectile and a target entity
      * @param registry ECS registry
@@ -107,6 +159,18 @@ class CollisionSystem : public ::rtype::engine::ASystem {
     EventEmitter _emitEvent;
     std::unique_ptr<shared::QuadTreeSystem> _quadTreeSystem;
 
+    /// Candidate pairs of the current frame, reused to keep its capacity
+    std::vector<shared::CollisionPair> _collisionPairs;
+
+    /// Narrowphase workers, shared by every chunk of a frame
+    std::unique_ptr<::rtype::JobPool> _jobPool;
+
+    /// Hits of each narrowphase chunk, one writer per buffer
+    std::vector<std::vector<HitRecord>> _chunkHits;
+
+    /// Merged hits of the current frame, in response order
+    std::vector<HitRecord> _hits;
+
     /// Tracks laser-enemy pairs damaged this frame to prevent double hits
     std::unordered_set<uint64_t> _laserDamagedThisFrame;
 
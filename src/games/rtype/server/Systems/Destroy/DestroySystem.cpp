@@ -83,7 +83,9 @@ void DestroySystem::update(ECS::Registry& registry, float /*deltaTime*/) {
                 "DestroySystem: Entity destroyed without valid NetworkId - "
                 "clients will not be notified");
         }
-        registry.killEntity(entity);
+        // Pooled entities (projectiles) go back to their pool for reuse
+        registry.removeComponent<DestroyTag>(entity);
+        ECS::EntityPool::despawn(registry, entity);
     }
 }
 
@@ -7,8 +7,6 @@
 
 #include "EnemyShootingSystem.hpp"
 
-#include <limits>
-
 #include "../../shared/Components.hpp"
 
 namespace rtype::games::rtype::server {
@@ -17,7 +15,6 @@ using shared::AIBehavior;
 using shared::AIComponent;
 using shared::EnemyTag;
 using shared::NetworkIdComponent;
-using shared::PlayerTag;
 using shared::ShootCooldownComponent;
 using shared::TransformComponent;
 
@@ -27,24 +24,17 @@ void EnemyShootingSystem::update(ECS::Registry& registry, float /*deltaTime*/) {
         return;
     }
 
-    _playerCache.clear();
-    auto playerView =
-        registry.view<PlayerTag, TransformComponent, NetworkIdComponent>();
-    playerView.each([this](ECS::Entity /*entity*/, const PlayerTag& /*tag*/,
-                           const TransformComponent& transform,
-                           const NetworkIdComponent& net) {
-        _playerCache.push_back(
-            PlayerInfo{net.networkId, transform.x, transform.y});
-    });
+    const auto& targets =
+        shared::PlayerTargetIndex::current(registry, _targets);
 
     auto enemyView =
         registry.view<EnemyTag, TransformComponent, NetworkIdComponent,
                       ShootCooldownComponent>();
-    enemyView.each([this, &registry](ECS::Entity entity,
-                                     const EnemyTag& /*tag*/,
-                                     const TransformComponent& tf,
-                                     const NetworkIdComponent& net,
-                                     ShootCooldownComponent& cd) {
+    enemyView.each([this, &registry, &targets](
+                       ECS::Entity entity, const EnemyTag& /*tag*/,
+                       const TransformComponent& tf,
+                       const NetworkIdComponent& net,
+                       ShootCooldownComponent& cd) {
         if (!cd.canShoot()) {
             return;
         }
@@ -54,16 +44,9 @@ void EnemyShootingSystem::update(ECS::Registry& registry, float /*deltaTime*/) {
         if (registry.hasComponent<AIComponent>(entity)) {
             const auto& ai = registry.getComponent<AIComponent>(entity);
             if (ai.behavior == AIBehavior::Chase) {
-                float bestDist2 = std::numeric_limits<float>::max();
-                for (const auto& p : _playerCache) {
-                    float dx = p.x - tf.x;
-                    float dy = p.y - tf.y;
-                    float d2 = dx * dx + dy * dy;
-                    if (d2 < bestDist2) {
-                        bestDist2 = d2;
-                        targetX = p.x;
-                        targetY = p.y;
-                    }
+                if (const auto* player = targets.nearest(tf.x, tf.y)) {
+                    targetX = player->x;
+                    targetY = player->y;
                 }
             }
         }
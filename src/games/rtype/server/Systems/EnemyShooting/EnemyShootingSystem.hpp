@@ -8,11 +8,12 @@
 #pragma once
 
 #include <functional>
-#include <vector>
 
 #include <rtype/ecs.hpp>
 #include <rtype/engine.hpp>
 
+#include "../../../shared/Systems/Targeting/PlayerTargetIndex.hpp"
+
 namespace rtype::games::rtype::server {
 
 /**
@@ -38,15 +39,9 @@ class EnemyShootingSystem : public ::rtype::engine::ASystem {
     void update(ECS::Registry& registry, float deltaTime) override;
 
    private:
-    struct PlayerInfo {
-        uint32_t networkId;
-        float x;
-        float y;
-    };
-
     ShootCallback _shootCb;
     float _defaultTargetOffset;
-    std::vector<PlayerInfo> _playerCache;
+    shared::PlayerTargetIndex _targets;  ///< Used when no index was published
 };
 
 }  // namespace rtype::games::rtype::server
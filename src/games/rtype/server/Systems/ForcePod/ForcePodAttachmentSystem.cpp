@@ -15,7 +15,6 @@ using shared::ForcePodComponent;
 using shared::ForcePodState;
 using shared::ForcePodTag;
 using shared::NetworkIdComponent;
-using shared::PlayerTag;
 using shared::TransformComponent;
 
 ForcePodAttachmentSystem::ForcePodAttachmentSystem()
@@ -27,13 +26,16 @@ void ForcePodAttachmentSystem::update(ECS::Registry& registry,
 }
 
 void ForcePodAttachmentSystem::updateAttachedPods(ECS::Registry& registry) {
+    const auto& targets =
+        shared::PlayerTargetIndex::current(registry, _targets);
     auto podView = registry.view<ForcePodTag, ForcePodComponent,
                                  TransformComponent, NetworkIdComponent>();
 
-    podView.each([&registry, this](ECS::Entity podEntity, const ForcePodTag&,
-                                   ForcePodComponent& forcePod,
-                                   TransformComponent& podTransform,
-                                   const NetworkIdComponent& podNetId) {
+    podView.each([&registry, &targets, this](
+                     ECS::Entity podEntity, const ForcePodTag&,
+                     ForcePodComponent& forcePod,
+                     TransformComponent& podTransform,
+                     const NetworkIdComponent& /*podNetId*/) {
         if (forcePod.state == ForcePodState::Orphan) {
             return;
         }
@@ -42,24 +44,16 @@ void ForcePodAttachmentSystem::updateAttachedPods(ECS::Registry& registry) {
             _launchSystem->setForcePodForPlayer(forcePod.ownerNetworkId,
                                                 podEntity);
         }
-        bool ownerExists = false;
-        auto playerView =
-            registry.view<PlayerTag, NetworkIdComponent, TransformComponent>();
-
-        playerView.each([&forcePod, &podTransform, &ownerExists](
-                            ECS::Entity /*playerEntity*/, const PlayerTag&,
-                            const NetworkIdComponent& networkId,
-                            const TransformComponent& playerTransform) {
-            if (networkId.networkId == forcePod.ownerNetworkId) {
-                ownerExists = true;
-                if (forcePod.state == ForcePodState::Attached) {
-                    podTransform.x = playerTransform.x + forcePod.offsetX;
-                    podTransform.y = playerTransform.y + forcePod.offsetY;
-                    podTransform.rotation = playerTransform.rotation;
-                }
+        const auto* owner = targets.findByNetworkId(forcePod.ownerNetworkId);
+        if (owner != nullptr) {
+            if (forcePod.state == ForcePodState::Attached) {
+                const auto& playerTransform =
+                    registry.getComponent<TransformComponent>(owner->entity);
+                podTransform.x = playerTransform.x + forcePod.offsetX;
+                podTransform.y = playerTransform.y + forcePod.offsetY;
+                podTransform.rotation = playerTransform.rotation;
             }
-        });
-        if (!ownerExists && forcePod.ownerNetworkId != 0) {
+        } else if (forcePod.ownerNetworkId != 0) {
             forcePod.makeOrphan();
             if (_launchSystem) {
                 _launchSystem->removeForcePodForPlayer(forcePod.ownerNetworkId);
@@ -13,6 +13,7 @@
 #include "../../../shared/Components/NetworkIdComponent.hpp"
 #include "../../../shared/Components/Tags.hpp"
 #include "../../../shared/Components/TransformComponent.hpp"
+#include "../../../shared/Systems/Targeting/PlayerTargetIndex.hpp"
 
 namespace rtype::games::rtype::server {
 
@@ -35,6 +36,7 @@ class ForcePodAttachmentSystem : public ::rtype::engine::ASystem {
    private:
     void updateAttachedPods(ECS::Registry& registry);
     ForcePodLaunchSystem* _launchSystem = nullptr;
+    shared::PlayerTargetIndex _targets;  ///< Used when no index was published
 };
 
 }  // namespace rtype::games::rtype::server
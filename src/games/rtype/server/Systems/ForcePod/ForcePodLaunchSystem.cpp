@@ -14,8 +14,6 @@ namespace rtype::games::rtype::server {
 using shared::ForcePodComponent;
 using shared::ForcePodState;
 using shared::ForcePodTag;
-using shared::NetworkIdComponent;
-using shared::PlayerTag;
 using shared::TransformComponent;
 using shared::VelocityComponent;
 
@@ -43,22 +41,16 @@ void ForcePodLaunchSystem::handleForcePodInput(ECS::Registry& registry,
 
     auto& forcePodComp = registry.getComponent<ForcePodComponent>(forcePod);
 
-    auto playerView =
-        registry.view<NetworkIdComponent, TransformComponent, PlayerTag>();
-    TransformComponent playerTransform{};
-    bool playerFound = false;
-
-    playerView.each([&](ECS::Entity, const NetworkIdComponent& netId,
-                        const TransformComponent& transform, const PlayerTag&) {
-        if (netId.networkId == playerNetworkId) {
-            playerTransform = transform;
-            playerFound = true;
-        }
-    });
-
-    if (!playerFound) {
+    // Input arrives between ticks, so the published index may still list a
+    // player destroyed at the end of the last one
+    const auto* player = shared::PlayerTargetIndex::current(registry, _targets)
+                             .findByNetworkId(playerNetworkId);
+    if (player == nullptr || !registry.isAlive(player->entity) ||
+        !registry.hasComponent<TransformComponent>(player->entity)) {
         return;
     }
+    const TransformComponent playerTransform =
+        registry.getComponent<TransformComponent>(player->entity);
 
     if (forcePodComp.state == ForcePodState::Attached) {
         launchForcePod(registry, forcePod, playerTransform);
@@ -125,41 +117,29 @@ void ForcePodLaunchSystem::updateDetachedPhysics(ECS::Registry& registry,
 }
 
 void ForcePodLaunchSystem::updateReturningPods(ECS::Registry& registry,
-                                               float deltaTime) {
+                                               float /*deltaTime*/) {
+    const auto& targets =
+        shared::PlayerTargetIndex::current(registry, _targets);
     auto podView = registry.view<ForcePodComponent, TransformComponent,
                                  VelocityComponent, ForcePodTag>();
 
-    podView.each([this, &registry, deltaTime](
-                     ECS::Entity, ForcePodComponent& forcePod,
-                     TransformComponent& podTransform, VelocityComponent& vel,
-                     const ForcePodTag&) {
+    podView.each([&targets](ECS::Entity, ForcePodComponent& forcePod,
+                            TransformComponent& podTransform,
+                            VelocityComponent& vel, const ForcePodTag&) {
         if (forcePod.state != ForcePodState::Returning) {
             return;
         }
 
-        auto playerView =
-            registry.view<NetworkIdComponent, TransformComponent, PlayerTag>();
-        bool playerFound = false;
-        TransformComponent playerTransform{};
-
-        playerView.each([&](ECS::Entity, const NetworkIdComponent& netId,
-                            const TransformComponent& transform,
-                            const PlayerTag&) {
-            if (netId.networkId == forcePod.ownerNetworkId) {
-                playerTransform = transform;
-                playerFound = true;
-            }
-        });
-
-        if (!playerFound) {
+        const auto* owner = targets.findByNetworkId(forcePod.ownerNetworkId);
+        if (owner == nullptr) {
             forcePod.makeOrphan();
             vel.vx = 0.0F;
             vel.vy = 0.0F;
             return;
         }
 
-        float dx = playerTransform.x - podTransform.x;
-        float dy = playerTransform.y - podTransform.y;
+        float dx = owner->x - podTransform.x;
+        float dy = owner->y - podTransform.y;
         float distance = std::sqrt(dx * dx + dy * dy);
 
         if (distance > 0.1F) {
@@ -176,53 +156,22 @@ void ForcePodLaunchSystem::updateReturningPods(ECS::Registry& registry,
 }
 
 void ForcePodLaunchSystem::checkReattachment(ECS::Registry& registry) {
+    const auto& targets =
+        shared::PlayerTargetIndex::current(registry, _targets);
     auto podView =
         registry.view<ForcePodComponent, TransformComponent, ForcePodTag>();
 
-    podView.each([this, &registry](ECS::Entity forcePodEntity,
-                                   ForcePodComponent& forcePod,
-                                   const TransformComponent& podTransform,
-                                   const ForcePodTag&) {
+    podView.each([&registry, &targets](ECS::Entity forcePodEntity,
+                                       ForcePodComponent& forcePod,
+                                       const TransformComponent& podTransform,
+                                       const ForcePodTag&) {
         if (forcePod.state == ForcePodState::Attached ||
             forcePod.state == ForcePodState::Orphan) {
             return;
         }
 
-        auto playerView =
-            registry.view<NetworkIdComponent, TransformComponent, PlayerTag>();
-        bool reattached = false;
-        bool autoRecall = false;
-        bool ownerExists = false;
-
-        playerView.each([&](ECS::Entity, const NetworkIdComponent& netId,
-                            const TransformComponent& playerTransform,
-                            const PlayerTag&) {
-            if (netId.networkId != forcePod.ownerNetworkId) {
-                return;
-            }
-
-            ownerExists = true;
-            float dx = playerTransform.x - podTransform.x;
-            float dy = playerTransform.y - podTransform.y;
-            float distance = std::sqrt(dx * dx + dy * dy);
-
-            if (distance <= kReattachDistance &&
-                forcePod.state == ForcePodState::Returning) {
-                forcePod.state = ForcePodState::Attached;
-                if (registry.hasComponent<VelocityComponent>(forcePodEntity)) {
-                    auto& vel = registry.getComponent<VelocityComponent>(
-                        forcePodEntity);
-                    vel.vx = 0.0F;
-                    vel.vy = 0.0F;
-                }
-                reattached = true;
-            } else if (distance >= kMaxDetachDistance &&
-                       forcePod.state == ForcePodState::Detached) {
-                autoRecall = true;
-            }
-        });
-
-        if (!ownerExists) {
+        const auto* owner = targets.findByNetworkId(forcePod.ownerNetworkId);
+        if (owner == nullptr) {
             forcePod.makeOrphan();
             if (registry.hasComponent<VelocityComponent>(forcePodEntity)) {
                 auto& vel =
@@ -233,7 +182,21 @@ void ForcePodLaunchSystem::checkReattachment(ECS::Registry& registry) {
             return;
         }
 
-        if (autoRecall && !reattached) {
+        float dx = owner->x - podTransform.x;
+        float dy = owner->y - podTransform.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+
+        if (distance <= kReattachDistance &&
+            forcePod.state == ForcePodState::Returning) {
+            forcePod.state = ForcePodState::Attached;
+            if (registry.hasComponent<VelocityComponent>(forcePodEntity)) {
+                auto& vel =
+                    registry.getComponent<VelocityComponent>(forcePodEntity);
+                vel.vx = 0.0F;
+                vel.vy = 0.0F;
+            }
+        } else if (distance >= kMaxDetachDistance &&
+                   forcePod.state == ForcePodState::Detached) {
             forcePod.state = ForcePodState::Returning;
         }
     });
@@ -17,6 +17,7 @@
 #include "../../../shared/Components/Tags.hpp"
 #include "../../../shared/Components/TransformComponent.hpp"
 #include "../../../shared/Components/VelocityComponent.hpp"
+#include "../../../shared/Systems/Targeting/PlayerTargetIndex.hpp"
 
 namespace rtype::games::rtype::server {
 
@@ -50,6 +51,7 @@ class ForcePodLaunchSystem : public ::rtype::engine::ASystem {
     void checkReattachment(ECS::Registry& registry);
 
     std::unordered_map<std::uint32_t, ECS::Entity> _playerForcePods;
+    shared::PlayerTargetIndex _targets;  ///< Used when no index was published
 
     static constexpr float kLaunchSpeed = 400.0F;
     static constexpr float kReturnSpeed = 500.0F;
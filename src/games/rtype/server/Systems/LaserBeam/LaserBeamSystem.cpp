@@ -7,12 +7,14 @@
 
 #include "LaserBeamSystem.hpp"
 
+#include "../../../shared/Components/CollisionLayerComponent.hpp"
 #include "../../../shared/Components/EntityType.hpp"
 #include "Logger/Macros.hpp"
 
 namespace rtype::games::rtype::server {
 
 using shared::BoundingBoxComponent;
+using shared::CollisionLayerComponent;
 using shared::DamageOnContactComponent;
 using shared::EntityType;
 using shared::LaserBeamComponent;
@@ -111,6 +113,9 @@ void LaserBeamSystem::startLaser(ECS::Registry& registry,
         beamEntity, playerPos.x + _config.offsetX, playerPos.y, 0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(
         beamEntity, _config.hitboxWidth, _config.hitboxHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        beamEntity,
+        CollisionLayerComponent::of(shared::CollisionLayer::LaserBeam));
     registry.emplaceComponent<LaserBeamTag>(beamEntity);
 
     LaserBeamComponent beamComp;
@@ -21,6 +21,7 @@ namespace rtype::games::rtype::server {
 using ::rtype::network::EntityType;
 using shared::ActivePowerUpComponent;
 using shared::BoundingBoxComponent;
+using shared::CollisionLayerComponent;
 using shared::EnemyProjectileTag;
 using shared::LifetimeComponent;
 using shared::NetworkIdComponent;
@@ -30,6 +31,7 @@ using shared::ProjectileComponent;
 using shared::ProjectileOwner;
 using shared::ProjectileTag;
 using shared::ShootCooldownComponent;
+using shared::SweptColliderComponent;
 using shared::TransformComponent;
 using shared::VelocityComponent;
 using shared::WeaponComponent;
@@ -38,6 +40,21 @@ using shared::WeaponPresets::BasicBullet;
 using shared::WeaponPresets::EnemyBullet;
 
 namespace {
+/**
+ * @brief Whether a shot can cross a thin target between two ticks
+ *
+ * Charged shots and missiles always qualify: they are the ones aimed at
+ * boss weak points. Anything else qualifies by speed.
+ */
+bool needsSweptCollision(shared::ProjectileType type, float vx, float vy,
+                         float speedThreshold) {
+    if (type == shared::ProjectileType::ChargedShot ||
+        type == shared::ProjectileType::Missile) {
+        return true;
+    }
+    return vx * vx + vy * vy >= speedThreshold * speedThreshold;
+}
+
 /**
  * @brief Convert ProjectileConfig from TOML to WeaponConfig
  * @param projConfig The projectile config from TOML
@@ -60,15 +77,33 @@ shared::WeaponConfig createWeaponConfigFromProjectile(
     config.maxHits = projConfig.maxHits;
     config.projectileCount = 1;
     config.spreadAngle = 0.0F;
+    config.collisionMask = projConfig.collisionMask;
     return config;
 }
+
+/**
+ * @brief Components every pooled projectile carries
+ *
+ * Values are placeholders; spawnProjectileWithConfig() overwrites them.
+ */
+void projectilePrefab(ECS::Registry& registry, ECS::Entity entity) {
+    registry.emplaceComponent<TransformComponent>(entity);
+    registry.emplaceComponent<VelocityComponent>(entity);
+    registry.emplaceComponent<BoundingBoxComponent>(entity);
+    registry.emplaceComponent<CollisionLayerComponent>(entity);
+    registry.emplaceComponent<LifetimeComponent>(entity);
+    registry.emplaceComponent<ProjectileComponent>(entity);
+    registry.emplaceComponent<ProjectileTag>(entity);
+    registry.emplaceComponent<NetworkIdComponent>(entity);
+}
 }  // namespace
 
 ProjectileSpawnerSystem::ProjectileSpawnerSystem(EventEmitter emitter,
                                                  ProjectileSpawnConfig config)
     : ASystem("ProjectileSpawnerSystem"),
       _emitEvent(std::move(emitter)),
-      _config(config) {
+      _config(config),
+      _projectilePool(projectilePrefab) {
     std::random_device rd;
     _rng.seed(rd());
 }
@@ -81,6 +116,15 @@ void ProjectileSpawnerSystem::update(ECS::Registry& registry, float deltaTime) {
         });
 }
 
+void ProjectileSpawnerSystem::prewarm(ECS::Registry& registry,
+                                      std::size_t count) {
+    _projectilePool.prewarm(registry, count);
+}
+
+void ProjectileSpawnerSystem::clearPool(ECS::Registry& registry) {
+    _projectilePool.clear(registry);
+}
+
 // LCOV_EXCL_START - lambda-based callback not easily testable
 uint32_t ProjectileSpawnerSystem::spawnPlayerProjectile(
     ECS::Registry& registry, uint32_t playerNetworkId, float playerX,
@@ -270,12 +314,31 @@ uint32_t ProjectileSpawnerSystem::spawnProjectileWithConfig(
     ECS::Registry& registry, float x, float y, float vx, float vy,
     const WeaponConfig& config, ProjectileOwner owner, uint32_t ownerNetworkId,
     uint8_t subTypeOverride) {
-    ECS::Entity projectile = registry.spawnEntity();
+    // Recycled projectiles keep their components: the ones below are
+    // overwritten in place, optional ones from a previous life are dropped.
+    ECS::Entity projectile = _projectilePool.acquire(registry);
     registry.emplaceComponent<TransformComponent>(projectile, x, y, 0.0F);
     registry.emplaceComponent<VelocityComponent>(projectile, vx, vy);
     registry.emplaceComponent<BoundingBoxComponent>(
         projectile, config.hitboxWidth, config.hitboxHeight);
+    uint16_t category = shared::CollisionLayer::NeutralProjectile;
+    if (owner == ProjectileOwner::Player) {
+        category = shared::CollisionLayer::PlayerProjectile;
+    } else if (owner == ProjectileOwner::Enemy) {
+        category = shared::CollisionLayer::EnemyProjectile;
+    }
+    registry.emplaceComponent<CollisionLayerComponent>(
+        projectile,
+        CollisionLayerComponent::of(category, config.collisionMask));
     registry.emplaceComponent<LifetimeComponent>(projectile, config.lifetime);
+    if (needsSweptCollision(config.projectileType, vx, vy,
+                            _config.sweptSpeedThreshold)) {
+        SweptColliderComponent swept;
+        swept.record(TransformComponent{x, y, 0.0F});
+        registry.emplaceComponent<SweptColliderComponent>(projectile, swept);
+    } else if (registry.hasComponent<SweptColliderComponent>(projectile)) {
+        registry.removeComponent<SweptColliderComponent>(projectile);
+    }
     ProjectileComponent projComp;
     projComp.damage = config.damage;
     projComp.ownerNetworkId = ownerNetworkId;
@@ -287,8 +350,14 @@ uint32_t ProjectileSpawnerSystem::spawnProjectileWithConfig(
     registry.emplaceComponent<ProjectileComponent>(projectile, projComp);
     registry.emplaceComponent<ProjectileTag>(projectile);
     if (owner == ProjectileOwner::Player) {
+        if (registry.hasComponent<EnemyProjectileTag>(projectile)) {
+            registry.removeComponent<EnemyProjectileTag>(projectile);
+        }
         registry.emplaceComponent<PlayerProjectileTag>(projectile);
     } else {
+        if (registry.hasComponent<PlayerProjectileTag>(projectile)) {
+            registry.removeComponent<PlayerProjectileTag>(projectile);
+        }
         registry.emplaceComponent<EnemyProjectileTag>(projectile);
     }
     uint32_t networkId = _nextNetworkId++;
@@ -26,6 +26,8 @@ struct ProjectileSpawnConfig {
     float playerProjectileOffsetY = 0.0F;
     float enemyProjectileOffsetX = -32.0F;
     float enemyProjectileOffsetY = 0.0F;
+    /// Shots at least this fast (px/s) get swept collision
+    float sweptSpeedThreshold = 900.0F;
 };
 
 /**
@@ -56,6 +58,25 @@ class ProjectileSpawnerSystem : public ::rtype::engine::ASystem {
 
     void update(ECS::Registry& registry, float deltaTime) override;
 
+    /**
+     * @brief Park projectile entities ahead of the first volley
+     * @param registry ECS registry
+     * @param count Projectiles to keep ready
+     *
+     * Spawned projectiles are taken from a pool and go back to it when the
+     * DestroySystem despawns them, so a steady stream of shots does not
+     * create entities after warm-up.
+     */
+    void prewarm(ECS::Registry& registry, std::size_t count);
+
+    /**
+     * @brief Kill the parked projectiles
+     * @param registry ECS registry
+     *
+     * Call before dropping the system when the registry outlives it.
+     */
+    void clearPool(ECS::Registry& registry);
+
     /**
      * @brief Spawn a projectile from a player
      * @param registry ECS registry
@@ -153,6 +174,7 @@ class ProjectileSpawnerSystem : public ::rtype::engine::ASystem {
     ProjectileSpawnConfig _config;
     std::size_t _projectileCount = 0;
     uint32_t _nextNetworkId = 100000;
+    ECS::EntityPool _projectilePool;
 
     std::mt19937 _rng;
 };
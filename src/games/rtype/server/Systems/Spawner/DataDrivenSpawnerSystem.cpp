@@ -24,6 +24,7 @@ using shared::AIBehavior;
 using shared::AIComponent;
 using shared::BoundingBoxComponent;
 using shared::BydosSlaveTag;
+using shared::CollisionLayerComponent;
 using shared::DamageOnContactComponent;
 using shared::EnemyTag;
 using shared::EnemyTypeComponent;
@@ -152,15 +153,17 @@ void DataDrivenSpawnerSystem::update(ECS::Registry& registry, float deltaTime) {
     }
 
     if (_waveManager.isLevelLoaded() && _levelStarted) {
-        auto spawns = _waveManager.update(deltaTime, aliveEnemies);
-        for (const auto& spawn : spawns) {
+        _spawnBuffer.clear();
+        _waveManager.update(deltaTime, aliveEnemies, _spawnBuffer);
+        for (const auto& spawn : _spawnBuffer) {
             if (_enemyCount < _config.maxEnemies) {
                 spawnEnemy(registry, spawn);
             }
         }
 
-        auto powerupSpawns = _waveManager.getPowerUpSpawns(deltaTime);
-        for (const auto& powerupSpawn : powerupSpawns) {
+        _powerUpBuffer.clear();
+        _waveManager.collectPowerUpSpawns(deltaTime, _powerUpBuffer);
+        for (const auto& powerupSpawn : _powerUpBuffer) {
             spawnPowerUpFromConfig(registry, powerupSpawn);
         }
 
@@ -193,17 +196,21 @@ void DataDrivenSpawnerSystem::update(ECS::Registry& registry, float deltaTime) {
 
 void DataDrivenSpawnerSystem::spawnEnemy(ECS::Registry& registry,
                                          const SpawnRequest& request) {
-    auto& configRegistry = shared::EntityConfigRegistry::getInstance();
-    auto enemyConfigOpt = configRegistry.getEnemy(request.enemyId);
-
-    if (!enemyConfigOpt.has_value()) {
-        LOG_WARNING_CAT(
-            ::rtype::LogCategory::GameEngine,
-            "[DataDrivenSpawner] Unknown enemy type: " << request.enemyId);
-        return;
+    const shared::EnemyConfig* enemyConfigPtr = request.enemy;
+    if (enemyConfigPtr == nullptr) {
+        auto& configRegistry = shared::EntityConfigRegistry::getInstance();
+        auto enemyConfigOpt =
+            configRegistry.getEnemy(std::string(request.enemyId));
+        if (!enemyConfigOpt.has_value()) {
+            LOG_WARNING_CAT(
+                ::rtype::LogCategory::GameEngine,
+                "[DataDrivenSpawner] Unknown enemy type: " << request.enemyId);
+            return;
+        }
+        enemyConfigPtr = &enemyConfigOpt.value().get();
     }
 
-    const auto& enemyConfig = enemyConfigOpt.value().get();
+    const auto& enemyConfig = *enemyConfigPtr;
 
     float spawnX = request.hasFixedX() ? *request.x : _config.screenWidth;
     float spawnY = request.hasFixedY() ? *request.y : _spawnYDist(_rng);
@@ -248,6 +255,9 @@ void DataDrivenSpawnerSystem::spawnEnemy(ECS::Registry& registry,
                                                enemyConfig.health);
     registry.emplaceComponent<BoundingBoxComponent>(
         enemy, enemyConfig.hitboxWidth, enemyConfig.hitboxHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        enemy, CollisionLayerComponent::of(shared::CollisionLayer::Enemy,
+                                           enemyConfig.collisionMask));
     DamageOnContactComponent enemyDmg{};
     enemyDmg.damage = enemyConfig.damage;
     enemyDmg.destroySelf = true;
@@ -265,9 +275,9 @@ void DataDrivenSpawnerSystem::spawnEnemy(ECS::Registry& registry,
     registry.emplaceComponent<EnemyTag>(enemy);
     registry.emplaceComponent<BydosSlaveTag>(enemy);
 
-    auto variant = EnemyTypeComponent::stringToVariant(request.enemyId);
+    auto variant = EnemyTypeComponent::stringToVariant(enemyConfig.id);
     registry.emplaceComponent<EnemyTypeComponent>(enemy, variant,
-                                                  request.enemyId);
+                                                  enemyConfig.id);
 
     _enemyCount++;
 
@@ -312,6 +322,9 @@ void DataDrivenSpawnerSystem::spawnBoss(ECS::Registry& registry,
                                                bossConfig.health);
     registry.emplaceComponent<BoundingBoxComponent>(
         boss, bossConfig.hitboxWidth, bossConfig.hitboxHeight);
+    const auto bossLayer = CollisionLayerComponent::of(
+        shared::CollisionLayer::Enemy, bossConfig.collisionMask);
+    registry.emplaceComponent<CollisionLayerComponent>(boss, bossLayer);
     registry.emplaceComponent<DamageOnContactComponent>(boss, bossConfig.damage,
                                                         true);
 
@@ -396,6 +409,8 @@ void DataDrivenSpawnerSystem::spawnBoss(ECS::Registry& registry,
                                                    wpConfig.health);
         registry.emplaceComponent<BoundingBoxComponent>(
             weakPoint, wpConfig.hitboxWidth, wpConfig.hitboxHeight);
+        registry.emplaceComponent<CollisionLayerComponent>(weakPoint,
+                                                           bossLayer);
 
         shared::WeakPointComponent wpComp;
         wpComp.parentBossEntity = boss;
@@ -534,6 +549,10 @@ void DataDrivenSpawnerSystem::generateNextPowerUpSpawnTime() {
 
 bool DataDrivenSpawnerSystem::isBossEnemy(
     const std::string& enemyId, const shared::EnemyConfig& config) const {
+    const auto levelBossId = _waveManager.getBossId();
+    if (levelBossId.has_value() && *levelBossId == enemyId) {
+        return true;
+    }
     auto& configRegistry = shared::EntityConfigRegistry::getInstance();
     const auto& allLevels = configRegistry.getAllLevels();
     for (const auto& [levelId, levelConfig] : allLevels) {
@@ -557,6 +576,9 @@ void DataDrivenSpawnerSystem::spawnObstacle(ECS::Registry& registry) {
                                                  -_config.obstacleSpeed, 0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(
         obstacle, _config.obstacleWidth, _config.obstacleHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        obstacle,
+        CollisionLayerComponent::of(shared::CollisionLayer::Obstacle));
     DamageOnContactComponent obstacleDmg{};
     obstacleDmg.damage = _config.obstacleDamage;
     obstacleDmg.destroySelf = true;
@@ -584,6 +606,8 @@ void DataDrivenSpawnerSystem::spawnPowerUp(ECS::Registry& registry) {
     registry.emplaceComponent<VelocityComponent>(pickup, -_config.powerUpSpeed,
                                                  0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(pickup, 24.0F, 24.0F);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        pickup, CollisionLayerComponent::of(shared::CollisionLayer::Pickup));
 
     int powerUpTypeInt = _powerUpTypeDist(_rng);
     auto powerUpType = static_cast<shared::PowerUpType>(powerUpTypeInt);
@@ -651,17 +675,21 @@ void DataDrivenSpawnerSystem::spawnPowerUp(ECS::Registry& registry) {
 
 void DataDrivenSpawnerSystem::spawnPowerUpFromConfig(
     ECS::Registry& registry, const PowerUpSpawnRequest& request) {
-    auto& configRegistry = shared::EntityConfigRegistry::getInstance();
-    auto powerupConfigOpt = configRegistry.getPowerUp(request.powerUpId);
-
-    if (!powerupConfigOpt.has_value()) {
-        LOG_WARNING_CAT(
-            ::rtype::LogCategory::GameEngine,
-            "[DataDrivenSpawner] Unknown powerup type: " << request.powerUpId);
-        return;
+    const shared::PowerUpConfig* powerupConfigPtr = request.powerUp;
+    if (powerupConfigPtr == nullptr) {
+        auto& configRegistry = shared::EntityConfigRegistry::getInstance();
+        auto powerupConfigOpt =
+            configRegistry.getPowerUp(std::string(request.powerUpId));
+        if (!powerupConfigOpt.has_value()) {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[DataDrivenSpawner] Unknown powerup type: "
+                                << request.powerUpId);
+            return;
+        }
+        powerupConfigPtr = &powerupConfigOpt.value().get();
     }
 
-    const auto& powerupConfig = powerupConfigOpt.value().get();
+    const auto& powerupConfig = *powerupConfigPtr;
 
     float spawnX =
         request.hasFixedX() ? *request.x : _config.screenWidth + 30.0F;
@@ -679,6 +707,9 @@ void DataDrivenSpawnerSystem::spawnPowerUpFromConfig(
                                                  0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(
         pickup, powerupConfig.hitboxWidth, powerupConfig.hitboxHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        pickup, CollisionLayerComponent::of(shared::CollisionLayer::Pickup,
+                                            powerupConfig.collisionMask));
 
     shared::PowerUpVariant variant =
         PowerUpTypeComponent::stringToVariant(powerupConfig.id);
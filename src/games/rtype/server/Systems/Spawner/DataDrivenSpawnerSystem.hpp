@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <random>
+#include <vector>
 
 #include <rtype/engine.hpp>
 
@@ -162,6 +163,20 @@ class DataDrivenSpawnerSystem : public ::rtype::engine::ASystem {
         if (_enemyCount > 0) --_enemyCount;
     }
 
+    /**
+     * @brief Check if an enemy ID represents a boss enemy
+     *
+     * The loaded level's boss comes from its timeline, so it is recognised
+     * even when the level was loaded from a compiled cache and never
+     * registered with the EntityConfigRegistry.
+     *
+     * @param enemyId Enemy identifier to check
+     * @param config Enemy configuration
+     * @return true if the enemy is identified as a boss
+     */
+    [[nodiscard]] bool isBossEnemy(const std::string& enemyId,
+                                   const shared::EnemyConfig& config) const;
+
    private:
     friend class GameEngine;
 
@@ -176,15 +191,6 @@ class DataDrivenSpawnerSystem : public ::rtype::engine::ASystem {
     void generateNextObstacleSpawnTime();
     void generateNextPowerUpSpawnTime();
 
-    /**
-     * @brief Check if an enemy ID represents a boss enemy
-     * @param enemyId Enemy identifier to check
-     * @param config Enemy configuration
-     * @return true if the enemy is identified as a boss
-     */
-    bool isBossEnemy(const std::string& enemyId,
-                     const shared::EnemyConfig& config) const;
-
     std::random_device::result_type getRandomSeed() {
         std::random_device rd;
         return rd();
@@ -193,6 +199,8 @@ class DataDrivenSpawnerSystem : public ::rtype::engine::ASystem {
     EventEmitter _emitEvent;
     DataDrivenSpawnerConfig _config;
     WaveManager _waveManager;
+    std::vector<SpawnRequest> _spawnBuffer;  ///< Reused every tick
+    std::vector<PowerUpSpawnRequest> _powerUpBuffer;
 
     std::size_t _enemyCount = 0;
     uint32_t _nextNetworkId = 1000;
@@ -24,6 +24,7 @@ using shared::AIBehavior;
 using shared::AIComponent;
 using shared::BoundingBoxComponent;
 using shared::BydosSlaveTag;
+using shared::CollisionLayerComponent;
 using shared::DamageOnContactComponent;
 using shared::EnemyTag;
 using shared::EnemyTypeComponent;
@@ -221,6 +222,9 @@ void SpawnerSystem::spawnBydosSlave(ECS::Registry& registry) {
                                                enemyConfig.health);
     registry.emplaceComponent<BoundingBoxComponent>(
         enemy, enemyConfig.hitboxWidth, enemyConfig.hitboxHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        enemy, CollisionLayerComponent::of(shared::CollisionLayer::Enemy,
+                                           enemyConfig.collisionMask));
     DamageOnContactComponent enemyDmg{};
     enemyDmg.damage = enemyConfig.damage;
     enemyDmg.destroySelf = true;
@@ -276,6 +280,9 @@ void SpawnerSystem::spawnObstacle(ECS::Registry& registry) {
                                                  -_config.obstacleSpeed, 0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(
         obstacle, _config.obstacleWidth, _config.obstacleHeight);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        obstacle,
+        CollisionLayerComponent::of(shared::CollisionLayer::Obstacle));
     DamageOnContactComponent obstacleDmg{};
     obstacleDmg.damage = _config.obstacleDamage;
     obstacleDmg.destroySelf = true;
@@ -302,6 +309,8 @@ void SpawnerSystem::spawnPowerUp(ECS::Registry& registry) {
     registry.emplaceComponent<VelocityComponent>(pickup, -_config.powerUpSpeed,
                                                  0.0F);
     registry.emplaceComponent<BoundingBoxComponent>(pickup, 24.0F, 24.0F);
+    registry.emplaceComponent<CollisionLayerComponent>(
+        pickup, CollisionLayerComponent::of(shared::CollisionLayer::Pickup));
     registry.emplaceComponent<shared::PickupTag>(pickup);
 
     shared::PowerUpComponent power{};
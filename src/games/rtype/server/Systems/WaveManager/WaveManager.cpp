@@ -7,14 +7,71 @@
 
 #include "WaveManager.hpp"
 
-#include <algorithm>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 
 #include "../../../shared/Config/EntityConfig/EntityConfig.hpp"
 #include "Logger/Macros.hpp"
 
 namespace rtype::games::rtype::server {
 
+namespace {
+
+std::optional<std::vector<uint8_t>> readFile(
+    const std::filesystem::path& path) {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) {
+        return std::nullopt;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Write @p data to a per-thread temp file and rename it over @p path
+ *
+ * Readers never see a half-written file, and two lobbies compiling the
+ * same level each rename a complete image into place.
+ */
+bool writeFileAtomically(const std::filesystem::path& path,
+                         const std::vector<uint8_t>& data) {
+    const auto threadTag =
+        std::hash<std::thread::id>{}(std::this_thread::get_id());
+    const std::filesystem::path tempPath =
+        path.string() + ".tmp." + std::to_string(threadTag);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+        file.close();
+        if (!file) {
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
 WaveManager::WaveManager() = default;
 
 bool WaveManager::loadLevel(const std::string& levelId) {
@@ -29,27 +86,7 @@ bool WaveManager::loadLevel(const std::string& levelId) {
         return false;
     }
 
-    _levelConfig = levelOpt.value().get();
-
-    if (!_levelConfig->isValid()) {
-        _lastError = "Invalid level configuration: " + levelId;
-        LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
-                      "[WaveManager] " << _lastError);
-        _levelConfig.reset();
-        _state = WaveState::Failed;
-        return false;
-    }
-
-    _state = WaveState::NotStarted;
-    _currentWaveIndex = 0;
-    _pendingSpawns.clear();
-
-    LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
-                 "[WaveManager] Loaded level '"
-                     << _levelConfig->name << "' with "
-                     << _levelConfig->waves.size() << " waves");
-
-    return true;
+    return bindTimeline(WaveTimeline::compile(levelOpt.value().get()));
 }
 
 bool WaveManager::loadLevelFromFile(const std::string& filepath) {
@@ -76,6 +113,28 @@ bool WaveManager::loadLevelFromFile(const std::string& filepath) {
         return false;
     }
 
+    auto source = readFile(foundPath);
+    if (!source.has_value()) {
+        _lastError = "Failed to read level file: " + foundPath;
+        LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
+                      "[WaveManager] " << _lastError);
+        _state = WaveState::Failed;
+        return false;
+    }
+    const uint64_t sourceHash = WaveTimeline::hashSource(std::string_view(
+        reinterpret_cast<const char*>(source->data()), source->size()));
+    const fs::path cachePath =
+        fs::path(foundPath).replace_extension(".timeline");
+
+    if (auto cached = readFile(cachePath)) {
+        if (auto timeline = WaveTimeline::deserialize(*cached, sourceHash)) {
+            LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
+                          "[WaveManager] Using compiled timeline "
+                              << cachePath.string());
+            return bindTimeline(std::move(*timeline));
+        }
+    }
+
     if (!configRegistry.loadLevel(foundPath)) {
         _lastError = "Failed to parse level file: " + foundPath;
         LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
@@ -87,17 +146,81 @@ bool WaveManager::loadLevelFromFile(const std::string& filepath) {
     fs::path p(foundPath);
     std::string levelId = p.stem().string();
 
-    return loadLevel(levelId);
+    if (!loadLevel(levelId)) {
+        return false;
+    }
+
+    if (!writeFileAtomically(cachePath, _timeline->serialize(sourceHash))) {
+        static std::once_flag warned;
+        std::call_once(warned, [&cachePath]() {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[WaveManager] Could not write timeline cache "
+                                << cachePath.string()
+                                << ", levels will be compiled on every load");
+        });
+    }
+    return true;
+}
+
+bool WaveManager::bindTimeline(WaveTimeline timeline) {
+    if (timeline.id.empty() || timeline.waveCount() == 0) {
+        _lastError = "Invalid level configuration: " + timeline.id;
+        LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
+                      "[WaveManager] " << _lastError);
+        _timeline.reset();
+        _state = WaveState::Failed;
+        return false;
+    }
+
+    _timeline = std::move(timeline);
+    bindConfigs();
+    _state = WaveState::NotStarted;
+    _currentWaveIndex = 0;
+    _nextEnemy = 0;
+    _waveEnd = 0;
+    _powerUpWindows.clear();
+
+    LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
+                 "[WaveManager] Loaded level '"
+                     << _timeline->name << "' with " << _timeline->waveCount()
+                     << " waves");
+
+    return true;
+}
+
+void WaveManager::bindConfigs() {
+    auto& configRegistry = shared::EntityConfigRegistry::getInstance();
+    _configGeneration = configRegistry.generation();
+    _enemyConfigs.clear();
+    for (const auto& enemyId : _timeline->enemyIds) {
+        auto enemy = configRegistry.getEnemy(enemyId);
+        _enemyConfigs.push_back(enemy ? &enemy->get() : nullptr);
+        if (!enemy) {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[WaveManager] Unknown enemy type: "
+                                << enemyId << " - skipping");
+        }
+    }
+    _powerUpConfigs.clear();
+    for (const auto& powerUpId : _timeline->powerUpIds) {
+        auto powerUp = configRegistry.getPowerUp(powerUpId);
+        _powerUpConfigs.push_back(powerUp ? &powerUp->get() : nullptr);
+        if (!powerUp) {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[WaveManager] Unknown powerup type: "
+                                << powerUpId << " - skipping");
+        }
+    }
 }
 
 void WaveManager::start() {
-    if (!_levelConfig) {
+    if (!_timeline) {
         LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
                         "[WaveManager] Cannot start: no level loaded");
         return;
     }
 
-    if (_levelConfig->waves.empty()) {
+    if (_timeline->waveCount() == 0) {
         LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
                         "[WaveManager] Cannot start: level has no waves");
         _state = WaveState::AllComplete;
@@ -107,6 +230,8 @@ void WaveManager::start() {
     _currentWaveIndex = 0;
     _waveTimer = 0.0F;
     _transitionTimer = 0.0F;
+    _powerUpClock = 0.0F;
+    _powerUpWindows.clear();
     _state = WaveState::InProgress;
 
     if (_startDelay > 0.0f) {
@@ -117,18 +242,20 @@ void WaveManager::start() {
 
     LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
                  "[WaveManager] Starting level '"
-                     << _levelConfig->name << "' - Wave 1/"
-                     << _levelConfig->waves.size());
+                     << _timeline->name << "' - Wave 1/"
+                     << _timeline->waveCount());
 }
 
 void WaveManager::reset() {
     _currentWaveIndex = 0;
     _waveTimer = 0.0F;
     _transitionTimer = 0.0F;
-    _pendingSpawns.clear();
-    _pendingPowerUps.clear();
+    _nextEnemy = 0;
+    _waveEnd = 0;
+    _powerUpWindows.clear();
+    _powerUpClock = 0.0F;
 
-    if (_levelConfig) {
+    if (_timeline) {
         _state = WaveState::NotStarted;
     } else {
         _state = WaveState::Failed;
@@ -138,75 +265,66 @@ void WaveManager::reset() {
 std::vector<SpawnRequest> WaveManager::update(float deltaTime,
                                               std::size_t aliveEnemyCount) {
     std::vector<SpawnRequest> spawns;
+    update(deltaTime, aliveEnemyCount, spawns);
+    return spawns;
+}
 
+void WaveManager::update(float deltaTime, std::size_t aliveEnemyCount,
+                         std::vector<SpawnRequest>& out) {
     if (_state == WaveState::NotStarted || _state == WaveState::AllComplete ||
         _state == WaveState::Failed) {
-        return spawns;
+        return;
     }
 
     if (_state == WaveState::WaveComplete) {
         if (_waitForClear && aliveEnemyCount > 0) {
-            return spawns;
+            return;
         }
 
         _transitionTimer += deltaTime;
         if (_transitionTimer >= _waveTransitionDelay) {
             advanceToNextWave();
         }
-        return spawns;
+        return;
     }
 
     _waveTimer += deltaTime;
 
-    bool allSpawnsComplete = true;
-    for (auto& pending : _pendingSpawns) {
-        if (pending.remainingCount <= 0) {
-            continue;
-        }
-
-        allSpawnsComplete = false;
-
-        if (!pending.started) {
-            if (_waveTimer >= pending.entry.delay) {
-                pending.started = true;
-                pending.remainingDelay = 0.0F;
-            }
-        }
-
-        if (pending.started) {
-            pending.remainingDelay -= deltaTime;
-            if (pending.remainingDelay <= 0.0F) {
-                SpawnRequest request;
-                request.enemyId = pending.entry.enemyId;
-                request.x = pending.entry.x;
-                request.y = pending.entry.y;
-                request.count = 1;
-                spawns.push_back(request);
-                pending.remainingCount--;
-                if (pending.remainingCount > 0 && _levelConfig) {
-                    const auto& wave = _levelConfig->waves[_currentWaveIndex];
-                    pending.remainingDelay = wave.spawnDelay;
-                }
-            }
-        }
+    if (_configGeneration !=
+        shared::EntityConfigRegistry::getInstance().generation()) {
+        bindConfigs();
     }
 
-    if (allSpawnsComplete) {
+    if (_nextEnemy >= _waveEnd) {
         LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
                      "[WaveManager] Wave " << (_currentWaveIndex + 1) << "/"
-                                           << _levelConfig->waves.size()
+                                           << _timeline->waveCount()
                                            << " spawn complete");
         _state = WaveState::WaveComplete;
         _transitionTimer = 0.0F;
+        return;
     }
 
-    return spawns;
+    const auto& events = _timeline->enemyEvents;
+    for (; _nextEnemy < _waveEnd && events[_nextEnemy].time <= _waveTimer;
+         ++_nextEnemy) {
+        const TimelineEvent& event = events[_nextEnemy];
+        const shared::EnemyConfig* enemy = _enemyConfigs[event.id];
+        if (enemy == nullptr) {
+            continue;
+        }
+        SpawnRequest& request = out.emplace_back();
+        request.enemyId = _timeline->enemyIds[event.id];
+        request.enemy = enemy;
+        request.x = event.fixedX();
+        request.y = event.fixedY();
+    }
 }
 
 void WaveManager::advanceToNextWave() {
     _currentWaveIndex++;
 
-    if (_currentWaveIndex >= _levelConfig->waves.size()) {
+    if (_currentWaveIndex >= _timeline->waveCount()) {
         LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
                      "[WaveManager] All waves completed!");
         _state = WaveState::AllComplete;
@@ -220,95 +338,77 @@ void WaveManager::advanceToNextWave() {
     LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
                  "[WaveManager] Starting wave " << (_currentWaveIndex + 1)
                                                 << "/"
-                                                << _levelConfig->waves.size());
+                                                << _timeline->waveCount());
 }
 
 void WaveManager::prepareCurrentWave() {
-    _pendingSpawns.clear();
+    _nextEnemy = 0;
+    _waveEnd = 0;
 
-    if (!_levelConfig) {
+    if (!_timeline || _currentWaveIndex >= _timeline->waveCount()) {
         return;
     }
 
-    if (_currentWaveIndex >= _levelConfig->waves.size()) {
-        return;
-    }
-
-    const auto& wave = _levelConfig->waves[_currentWaveIndex];
-
-    for (const auto& spawnEntry : wave.spawns) {
-        auto& configRegistry = shared::EntityConfigRegistry::getInstance();
-        if (!configRegistry.getEnemy(spawnEntry.enemyId).has_value()) {
-            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
-                            "[WaveManager] Unknown enemy type: "
-                                << spawnEntry.enemyId << " - skipping");
-            continue;
-        }
-
-        PendingSpawn pending;
-        pending.entry = spawnEntry;
-        pending.remainingCount = spawnEntry.count;
-        pending.remainingDelay = 0.0F;
-        pending.started = false;
-        _pendingSpawns.push_back(pending);
-    }
-
-    for (const auto& powerupEntry : wave.powerups) {
-        auto& configRegistry = shared::EntityConfigRegistry::getInstance();
-        if (!configRegistry.getPowerUp(powerupEntry.powerUpId).has_value()) {
-            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
-                            "[WaveManager] Unknown powerup type: "
-                                << powerupEntry.powerUpId << " - skipping");
-            continue;
-        }
+    _nextEnemy = _timeline->enemyWaveStart[_currentWaveIndex];
+    _waveEnd = _timeline->enemyWaveStart[_currentWaveIndex + 1];
 
-        PendingPowerUp pending;
-        pending.entry = powerupEntry;
-        pending.remainingDelay = powerupEntry.delay;
-        pending.spawned = false;
-        _pendingPowerUps.push_back(pending);
+    PowerUpWindow window;
+    window.next = _timeline->powerUpWaveStart[_currentWaveIndex];
+    window.end = _timeline->powerUpWaveStart[_currentWaveIndex + 1];
+    window.startedAt = _powerUpClock;
+    if (window.next < window.end) {
+        _powerUpWindows.push_back(window);
     }
 
     LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
                   "[WaveManager] Prepared wave "
                       << (_currentWaveIndex + 1) << " with "
-                      << _pendingSpawns.size() << " spawn entries and "
-                      << _pendingPowerUps.size() << " powerups");
+                      << (_waveEnd - _nextEnemy) << " spawns and "
+                      << (window.end - window.next) << " powerups");
 }
 
 std::vector<PowerUpSpawnRequest> WaveManager::getPowerUpSpawns(
     float deltaTime) {
     std::vector<PowerUpSpawnRequest> spawns;
+    collectPowerUpSpawns(deltaTime, spawns);
+    return spawns;
+}
+
+void WaveManager::collectPowerUpSpawns(float deltaTime,
+                                       std::vector<PowerUpSpawnRequest>& out) {
     if (_state != WaveState::InProgress && _state != WaveState::WaveComplete) {
-        return spawns;
+        return;
     }
 
-    for (auto& pending : _pendingPowerUps) {
-        if (pending.spawned) {
-            continue;
-        }
-
-        pending.remainingDelay -= deltaTime;
-
-        LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
-                      "[WaveManager] PowerUp '"
-                          << pending.entry.powerUpId
-                          << "' delay: " << pending.remainingDelay);
-
-        if (pending.remainingDelay <= 0.0F) {
+    _powerUpClock += deltaTime;
+    if (_configGeneration !=
+        shared::EntityConfigRegistry::getInstance().generation()) {
+        bindConfigs();
+    }
+    const auto& events = _timeline->powerUpEvents;
+    for (auto& window : _powerUpWindows) {
+        const float elapsed = _powerUpClock - window.startedAt;
+        for (; window.next < window.end && events[window.next].time <= elapsed;
+             ++window.next) {
+            const TimelineEvent& event = events[window.next];
+            const shared::PowerUpConfig* powerUp = _powerUpConfigs[event.id];
+            if (powerUp == nullptr) {
+                continue;
+            }
             LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
-                         "[WaveManager] PowerUp '" << pending.entry.powerUpId
-                                                   << "' ready to spawn!");
-            PowerUpSpawnRequest request;
-            request.powerUpId = pending.entry.powerUpId;
-            request.x = pending.entry.x;
-            request.y = pending.entry.y;
-            spawns.push_back(request);
-            pending.spawned = true;
+                         "[WaveManager] PowerUp '"
+                             << _timeline->powerUpIds[event.id]
+                             << "' ready to spawn!");
+            PowerUpSpawnRequest& request = out.emplace_back();
+            request.powerUpId = _timeline->powerUpIds[event.id];
+            request.powerUp = powerUp;
+            request.x = event.fixedX();
+            request.y = event.fixedY();
         }
     }
-
-    return spawns;
+    std::erase_if(_powerUpWindows, [](const PowerUpWindow& window) {
+        return window.next >= window.end;
+    });
 }
 
 }  // namespace rtype::games::rtype::server
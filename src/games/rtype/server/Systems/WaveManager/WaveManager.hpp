@@ -7,16 +7,20 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <rtype/engine.hpp>
 
+#include "../../../shared/Config/EntityConfig/EntitiesStructs/EnemyConfig.hpp"
 #include "../../../shared/Config/EntityConfig/EntitiesStructs/LevelConfig.hpp"
-#include "../../../shared/Config/EntityConfig/EntitiesStructs/WaveConfig.hpp"
+#include "../../../shared/Config/EntityConfig/EntitiesStructs/PowerUpConfig.hpp"
+#include "WaveTimeline.hpp"
 
 namespace rtype::games::rtype::server {
 
@@ -35,9 +39,15 @@ enum class WaveState {
 /**
  * @struct SpawnRequest
  * @brief Request to spawn an enemy
+ *
+ * Lifetime: a request emitted by the WaveManager borrows from it.
+ * enemyId views the loaded timeline and dies with the next load; enemy
+ * points into EntityConfigRegistry and dies with its clear(). Consume
+ * requests in the frame they are emitted and copy the id to keep it.
  */
 struct SpawnRequest {
-    std::string enemyId;
+    std::string_view enemyId;
+    const shared::EnemyConfig* enemy = nullptr;  ///< nullptr: look up
     std::optional<float> x;
     std::optional<float> y;
     int32_t count = 1;
@@ -46,8 +56,15 @@ struct SpawnRequest {
     [[nodiscard]] bool hasFixedY() const noexcept { return y.has_value(); }
 };
 
+/**
+ * @struct PowerUpSpawnRequest
+ * @brief Request to spawn a power-up
+ *
+ * Same lifetime rule as SpawnRequest.
+ */
 struct PowerUpSpawnRequest {
-    std::string powerUpId;
+    std::string_view powerUpId;
+    const shared::PowerUpConfig* powerUp = nullptr;  ///< nullptr: look up
     std::optional<float> x;
     std::optional<float> y;
 
@@ -60,8 +77,10 @@ struct PowerUpSpawnRequest {
  * @brief Data-driven enemy wave manager
  *
  * This class manages the spawning of enemies based on level configuration
- * files. It reads wave definitions from TOML files and controls the timing
- * and sequence of enemy spawns.
+ * files. Levels are compiled into a WaveTimeline when loaded, so each
+ * update only moves a cursor over the current wave's time-sorted events.
+ * loadLevelFromFile() keeps the compiled timeline next to the TOML
+ * (`<level>.timeline`) and reuses it while the TOML is unchanged.
  *
  * Features:
  * - Load wave definitions from configuration files
@@ -105,6 +124,10 @@ class WaveManager {
 
     /**
      * @brief Load a level configuration from file path
+     *
+     * Uses the `.timeline` cache next to the file when it was built from the
+     * same TOML content, otherwise parses the TOML and rewrites the cache.
+     *
      * @param filepath Path to the level TOML file
      * @return true if level was loaded successfully
      */
@@ -129,9 +152,26 @@ class WaveManager {
     [[nodiscard]] std::vector<SpawnRequest> update(float deltaTime,
                                                    std::size_t aliveEnemyCount);
 
+    /**
+     * @brief Update the wave manager, appending spawn requests to a buffer
+     * @param deltaTime Time elapsed since last update
+     * @param aliveEnemyCount Current number of alive enemies
+     * @param out Receives the enemies to spawn this frame
+     */
+    void update(float deltaTime, std::size_t aliveEnemyCount,
+                std::vector<SpawnRequest>& out);
+
     [[nodiscard]] std::vector<PowerUpSpawnRequest> getPowerUpSpawns(
         float deltaTime);
 
+    /**
+     * @brief Advance the power-up clock, appending due power-ups to a buffer
+     * @param deltaTime Time elapsed since last update
+     * @param out Receives the power-ups to spawn this frame
+     */
+    void collectPowerUpSpawns(float deltaTime,
+                              std::vector<PowerUpSpawnRequest>& out);
+
     /**
      * @brief Get current wave state
      * @return Current state of the wave manager
@@ -151,7 +191,7 @@ class WaveManager {
      * @return Total wave count
      */
     [[nodiscard]] std::size_t getTotalWaves() const noexcept {
-        return _levelConfig ? _levelConfig->waves.size() : 0;
+        return _timeline ? _timeline->waveCount() : 0;
     }
 
     /**
@@ -167,7 +207,7 @@ class WaveManager {
      * @return true if level config is available
      */
     [[nodiscard]] bool isLevelLoaded() const noexcept {
-        return _levelConfig.has_value();
+        return _timeline.has_value();
     }
 
     /**
@@ -176,7 +216,7 @@ class WaveManager {
      */
     [[nodiscard]] const std::string& getLevelId() const noexcept {
         static const std::string empty;
-        return _levelConfig ? _levelConfig->id : empty;
+        return _timeline ? _timeline->id : empty;
     }
 
     /**
@@ -185,7 +225,7 @@ class WaveManager {
      */
     [[nodiscard]] const std::string& getLevelName() const noexcept {
         static const std::string empty;
-        return _levelConfig ? _levelConfig->name : empty;
+        return _timeline ? _timeline->name : empty;
     }
 
     /**
@@ -193,7 +233,7 @@ class WaveManager {
      * @return Optional boss ID
      */
     [[nodiscard]] std::optional<std::string> getBossId() const noexcept {
-        return _levelConfig ? _levelConfig->bossId : std::nullopt;
+        return _timeline ? _timeline->bossId : std::nullopt;
     }
 
     /**
@@ -201,7 +241,7 @@ class WaveManager {
      * @return Optional next level ID
      */
     [[nodiscard]] std::optional<std::string> getNextLevel() const noexcept {
-        return _levelConfig ? _levelConfig->nextLevel : std::nullopt;
+        return _timeline ? _timeline->nextLevel : std::nullopt;
     }
 
     /**
@@ -210,7 +250,7 @@ class WaveManager {
      */
     [[nodiscard]] const std::string& getBackground() const noexcept {
         static const std::string empty;
-        return _levelConfig ? _levelConfig->backgroundPath : empty;
+        return _timeline ? _timeline->backgroundPath : empty;
     }
 
     /**
@@ -219,7 +259,7 @@ class WaveManager {
      */
     [[nodiscard]] const std::string& getLevelMusic() const noexcept {
         static const std::string empty;
-        return _levelConfig ? _levelConfig->levelMusic : empty;
+        return _timeline ? _timeline->levelMusic : empty;
     }
 
     /**
@@ -248,28 +288,38 @@ class WaveManager {
 
    private:
     /**
-     * @struct PendingSpawn
-     * @brief Internal tracking for spawn timing
+     * @struct PowerUpWindow
+     * @brief Power-ups of one wave still to be handed out
+     *
+     * Power-up delays count from the moment their wave started and keep
+     * running after the wave moves on, so several windows can be open.
      */
-    struct PendingSpawn {
-        shared::WaveConfig::SpawnEntry entry;
-        float remainingDelay = 0.0F;
-        int32_t remainingCount = 0;
-        bool started = false;
-    };
-
-    struct PendingPowerUp {
-        shared::WaveConfig::PowerUpEntry entry;
-        float remainingDelay = 0.0F;
-        bool spawned = false;
+    struct PowerUpWindow {
+        std::size_t next = 0;  ///< Index into the timeline's power-up events
+        std::size_t end = 0;
+        float startedAt = 0.0F;  ///< Power-up clock when the wave started
     };
 
+    bool bindTimeline(WaveTimeline timeline);
+    /**
+     * @brief Resolve the timeline's ids against EntityConfigRegistry
+     *
+     * Runs on load, and again whenever the registry's generation moved
+     * (config reload), so cached configs never outlive their registry entry.
+     */
+    void bindConfigs();
     void advanceToNextWave();
     void prepareCurrentWave();
 
-    std::optional<shared::LevelConfig> _levelConfig;
-    std::vector<PendingSpawn> _pendingSpawns;
-    std::vector<PendingPowerUp> _pendingPowerUps;
+    std::optional<WaveTimeline> _timeline;
+    /// Configs of the timeline's enemy / power-up ids, nullptr if unknown
+    std::vector<const shared::EnemyConfig*> _enemyConfigs;
+    std::vector<const shared::PowerUpConfig*> _powerUpConfigs;
+    std::uint64_t _configGeneration = 0;  ///< Registry generation bound
+    std::size_t _nextEnemy = 0;  ///< Cursor into the timeline's enemy events
+    std::size_t _waveEnd = 0;
+    std::vector<PowerUpWindow> _powerUpWindows;
+    float _powerUpClock = 0.0F;
 
     WaveState _state = WaveState::NotStarted;
     std::size_t _currentWaveIndex = 0;
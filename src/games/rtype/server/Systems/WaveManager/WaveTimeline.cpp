@@ -0,0 +1,302 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** WaveTimeline - Implementation
+*/
+
+#include "WaveTimeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "../../../shared/Config/SaveManager/Serialization/BinarySerializer.hpp"
+
+namespace rtype::games::rtype::server {
+
+using ::rtype::game::config::BinarySerializer;
+
+namespace {
+
+constexpr uint32_t TIMELINE_MAGIC = 0x54575452;  // "RTWT"
+constexpr uint32_t TIMELINE_VERSION = 1;
+
+using Buffer = std::shared_ptr<std::vector<uint8_t>>;
+using ConstBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+using Offset = std::shared_ptr<size_t>;
+
+/**
+ * @brief Hands out one index per distinct string
+ */
+class Interner {
+   public:
+    explicit Interner(std::vector<std::string>& table) : _table(table) {}
+
+    uint32_t operator()(const std::string& value) {
+        auto [it, inserted] =
+            _index.try_emplace(value, static_cast<uint32_t>(_table.size()));
+        if (inserted) {
+            _table.push_back(value);
+        }
+        return it->second;
+    }
+
+   private:
+    std::vector<std::string>& _table;
+    std::unordered_map<std::string, uint32_t> _index;
+};
+
+TimelineEvent makeEvent(float time, uint32_t id, std::optional<float> x,
+                        std::optional<float> y) {
+    TimelineEvent event;
+    event.time = time;
+    event.id = id;
+    if (x.has_value()) {
+        event.x = *x;
+        event.flags |= TimelineEvent::HAS_X;
+    }
+    if (y.has_value()) {
+        event.y = *y;
+        event.flags |= TimelineEvent::HAS_Y;
+    }
+    return event;
+}
+
+/// Sorts the events appended since `first`, keeping config order on ties
+void sortWave(std::vector<TimelineEvent>& events, std::size_t first) {
+    std::stable_sort(events.begin() + static_cast<std::ptrdiff_t>(first),
+                     events.end(),
+                     [](const TimelineEvent& a, const TimelineEvent& b) {
+                         return a.time < b.time;
+                     });
+}
+
+void writeOptionalString(const Buffer& out,
+                         const std::optional<std::string>& value) {
+    BinarySerializer::writeUint8(out, value.has_value() ? 1 : 0);
+    if (value.has_value()) {
+        BinarySerializer::writeString(out, *value);
+    }
+}
+
+std::optional<std::string> readOptionalString(const ConstBuffer& in,
+                                              const Offset& offset) {
+    if (BinarySerializer::readUint8(in, offset) == 0) {
+        return std::nullopt;
+    }
+    return BinarySerializer::readString(in, offset);
+}
+
+void writeStrings(const Buffer& out, const std::vector<std::string>& values) {
+    BinarySerializer::writeUint32(out, static_cast<uint32_t>(values.size()));
+    for (const auto& value : values) {
+        BinarySerializer::writeString(out, value);
+    }
+}
+
+std::vector<std::string> readStrings(const ConstBuffer& in,
+                                     const Offset& offset) {
+    const uint32_t count = BinarySerializer::readUint32(in, offset);
+    if (count > in->size() - *offset) {
+        throw std::out_of_range("String count exceeds buffer");
+    }
+    std::vector<std::string> values;
+    values.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        values.push_back(BinarySerializer::readString(in, offset));
+    }
+    return values;
+}
+
+void writeStarts(const Buffer& out, const std::vector<uint32_t>& starts) {
+    BinarySerializer::writeUint32(out, static_cast<uint32_t>(starts.size()));
+    for (uint32_t start : starts) {
+        BinarySerializer::writeUint32(out, start);
+    }
+}
+
+std::vector<uint32_t> readStarts(const ConstBuffer& in, const Offset& offset) {
+    const uint32_t count = BinarySerializer::readUint32(in, offset);
+    if (count > (in->size() - *offset) / sizeof(uint32_t)) {
+        throw std::out_of_range("Wave count exceeds buffer");
+    }
+    std::vector<uint32_t> starts(count);
+    for (auto& start : starts) {
+        start = BinarySerializer::readUint32(in, offset);
+    }
+    return starts;
+}
+
+void writeEvents(const Buffer& out, const std::vector<TimelineEvent>& events) {
+    BinarySerializer::writeUint32(out, static_cast<uint32_t>(events.size()));
+    for (const auto& event : events) {
+        BinarySerializer::writeFloat(out, event.time);
+        BinarySerializer::writeUint32(out, event.id);
+        BinarySerializer::writeFloat(out, event.x);
+        BinarySerializer::writeFloat(out, event.y);
+        BinarySerializer::writeUint8(out, event.flags);
+    }
+}
+
+std::vector<TimelineEvent> readEvents(const ConstBuffer& in,
+                                      const Offset& offset) {
+    constexpr std::size_t EVENT_SIZE = 4 * sizeof(uint32_t) + 1;
+    const uint32_t count = BinarySerializer::readUint32(in, offset);
+    if (count > (in->size() - *offset) / EVENT_SIZE) {
+        throw std::out_of_range("Event count exceeds buffer");
+    }
+    std::vector<TimelineEvent> events(count);
+    for (auto& event : events) {
+        event.time = BinarySerializer::readFloat(in, offset);
+        event.id = BinarySerializer::readUint32(in, offset);
+        event.x = BinarySerializer::readFloat(in, offset);
+        event.y = BinarySerializer::readFloat(in, offset);
+        event.flags = BinarySerializer::readUint8(in, offset);
+    }
+    return events;
+}
+
+/// Wave bounds must start at 0, never go back and end on the last event
+bool validStarts(const std::vector<uint32_t>& starts, std::size_t events) {
+    if (starts.empty() || starts.front() != 0 || starts.back() != events) {
+        return false;
+    }
+    return std::is_sorted(starts.begin(), starts.end());
+}
+
+bool validIds(const std::vector<TimelineEvent>& events, std::size_t ids) {
+    return std::all_of(
+        events.begin(), events.end(),
+        [ids](const TimelineEvent& event) { return event.id < ids; });
+}
+
+}  // namespace
+
+WaveTimeline WaveTimeline::compile(const shared::LevelConfig& level) {
+    WaveTimeline timeline;
+    timeline.id = level.id;
+    timeline.name = level.name;
+    timeline.backgroundPath = level.backgroundPath;
+    timeline.levelMusic = level.levelMusic;
+    timeline.scrollSpeed = level.scrollSpeed;
+    timeline.bossId = level.bossId;
+    timeline.nextLevel = level.nextLevel;
+
+    Interner enemyId(timeline.enemyIds);
+    Interner powerUpId(timeline.powerUpIds);
+    timeline.enemyWaveStart.reserve(level.waves.size() + 1);
+    timeline.powerUpWaveStart.reserve(level.waves.size() + 1);
+
+    for (const auto& wave : level.waves) {
+        const std::size_t firstEnemy = timeline.enemyEvents.size();
+        const std::size_t firstPowerUp = timeline.powerUpEvents.size();
+        timeline.enemyWaveStart.push_back(static_cast<uint32_t>(firstEnemy));
+        timeline.powerUpWaveStart.push_back(
+            static_cast<uint32_t>(firstPowerUp));
+
+        for (const auto& spawn : wave.spawns) {
+            const uint32_t id = enemyId(spawn.enemyId);
+            for (int32_t n = 0; n < spawn.count; ++n) {
+                const float time =
+                    spawn.delay + static_cast<float>(n) * wave.spawnDelay;
+                timeline.enemyEvents.push_back(
+                    makeEvent(time, id, spawn.x, spawn.y));
+            }
+        }
+        for (const auto& powerUp : wave.powerups) {
+            timeline.powerUpEvents.push_back(
+                makeEvent(powerUp.delay, powerUpId(powerUp.powerUpId),
+                          powerUp.x, powerUp.y));
+        }
+        sortWave(timeline.enemyEvents, firstEnemy);
+        sortWave(timeline.powerUpEvents, firstPowerUp);
+    }
+    timeline.enemyWaveStart.push_back(
+        static_cast<uint32_t>(timeline.enemyEvents.size()));
+    timeline.powerUpWaveStart.push_back(
+        static_cast<uint32_t>(timeline.powerUpEvents.size()));
+    return timeline;
+}
+
+std::vector<uint8_t> WaveTimeline::serialize(uint64_t sourceHash) const {
+    auto data = std::make_shared<std::vector<uint8_t>>();
+    data->reserve(64 + enemyEvents.size() * 17 + powerUpEvents.size() * 17);
+
+    BinarySerializer::writeUint32(data, TIMELINE_MAGIC);
+    BinarySerializer::writeUint32(data, TIMELINE_VERSION);
+    BinarySerializer::writeUint64(data, sourceHash);
+
+    BinarySerializer::writeString(data, id);
+    BinarySerializer::writeString(data, name);
+    BinarySerializer::writeString(data, backgroundPath);
+    BinarySerializer::writeString(data, levelMusic);
+    BinarySerializer::writeFloat(data, scrollSpeed);
+    writeOptionalString(data, bossId);
+    writeOptionalString(data, nextLevel);
+
+    writeStrings(data, enemyIds);
+    writeStrings(data, powerUpIds);
+    writeStarts(data, enemyWaveStart);
+    writeStarts(data, powerUpWaveStart);
+    writeEvents(data, enemyEvents);
+    writeEvents(data, powerUpEvents);
+
+    return *data;
+}
+
+std::optional<WaveTimeline> WaveTimeline::deserialize(
+    const std::vector<uint8_t>& data, uint64_t sourceHash) {
+    auto offset = std::make_shared<size_t>(0);
+    auto dataPtr = std::make_shared<const std::vector<uint8_t>>(data);
+
+    WaveTimeline timeline;
+    try {
+        if (BinarySerializer::readUint32(dataPtr, offset) != TIMELINE_MAGIC ||
+            BinarySerializer::readUint32(dataPtr, offset) !=
+                TIMELINE_VERSION ||
+            BinarySerializer::readUint64(dataPtr, offset) != sourceHash) {
+            return std::nullopt;
+        }
+
+        timeline.id = BinarySerializer::readString(dataPtr, offset);
+        timeline.name = BinarySerializer::readString(dataPtr, offset);
+        timeline.backgroundPath = BinarySerializer::readString(dataPtr, offset);
+        timeline.levelMusic = BinarySerializer::readString(dataPtr, offset);
+        timeline.scrollSpeed = BinarySerializer::readFloat(dataPtr, offset);
+        timeline.bossId = readOptionalString(dataPtr, offset);
+        timeline.nextLevel = readOptionalString(dataPtr, offset);
+
+        timeline.enemyIds = readStrings(dataPtr, offset);
+        timeline.powerUpIds = readStrings(dataPtr, offset);
+        timeline.enemyWaveStart = readStarts(dataPtr, offset);
+        timeline.powerUpWaveStart = readStarts(dataPtr, offset);
+        timeline.enemyEvents = readEvents(dataPtr, offset);
+        timeline.powerUpEvents = readEvents(dataPtr, offset);
+    } catch (const std::out_of_range&) {
+        return std::nullopt;
+    }
+
+    if (*offset != data.size() ||
+        timeline.enemyWaveStart.size() != timeline.powerUpWaveStart.size() ||
+        !validStarts(timeline.enemyWaveStart, timeline.enemyEvents.size()) ||
+        !validStarts(timeline.powerUpWaveStart,
+                     timeline.powerUpEvents.size()) ||
+        !validIds(timeline.enemyEvents, timeline.enemyIds.size()) ||
+        !validIds(timeline.powerUpEvents, timeline.powerUpIds.size())) {
+        return std::nullopt;
+    }
+    return timeline;
+}
+
+uint64_t WaveTimeline::hashSource(std::string_view content) noexcept {
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : content) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+}  // namespace rtype::games::rtype::server
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** WaveTimeline - Level waves compiled into flat, time-sorted event lists
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../../shared/Config/EntityConfig/EntitiesStructs/LevelConfig.hpp"
+
+namespace rtype::games::rtype::server {
+
+/**
+ * @struct TimelineEvent
+ * @brief One spawn at a fixed time after its wave started
+ */
+struct TimelineEvent {
+    static constexpr uint8_t HAS_X = 1U << 0U;
+    static constexpr uint8_t HAS_Y = 1U << 1U;
+
+    float time = 0.0F;  ///< Seconds after the wave started
+    uint32_t id = 0;    ///< Index into the timeline's interned ids
+    float x = 0.0F;
+    float y = 0.0F;
+    uint8_t flags = 0;
+
+    [[nodiscard]] std::optional<float> fixedX() const noexcept {
+        return (flags & HAS_X) != 0 ? std::optional<float>(x) : std::nullopt;
+    }
+    [[nodiscard]] std::optional<float> fixedY() const noexcept {
+        return (flags & HAS_Y) != 0 ? std::optional<float>(y) : std::nullopt;
+    }
+};
+
+/**
+ * @struct WaveTimeline
+ * @brief A level as the WaveManager plays it
+ *
+ * compile() expands every spawn entry of every wave into one event per
+ * enemy (entry delay + n * wave spawn delay) and sorts each wave's events
+ * by time, so playing a wave is a cursor that only moves forward. Enemy
+ * and power-up ids are interned: events carry an index into enemyIds /
+ * powerUpIds instead of a string.
+ *
+ * The timeline also carries the level metadata and round-trips through
+ * serialize() / deserialize(), so a level can be loaded from a binary
+ * cache without parsing its TOML again.
+ */
+struct WaveTimeline {
+    std::string id;
+    std::string name;
+    std::string backgroundPath;
+    std::string levelMusic;
+    float scrollSpeed = 50.0F;
+    std::optional<std::string> bossId;
+    std::optional<std::string> nextLevel;
+
+    std::vector<std::string> enemyIds;
+    std::vector<std::string> powerUpIds;
+    std::vector<TimelineEvent> enemyEvents;
+    std::vector<TimelineEvent> powerUpEvents;
+    /// Wave w owns enemyEvents[enemyWaveStart[w], enemyWaveStart[w + 1])
+    std::vector<uint32_t> enemyWaveStart;
+    /// Wave w owns powerUpEvents[powerUpWaveStart[w], powerUpWaveStart[w + 1])
+    std::vector<uint32_t> powerUpWaveStart;
+
+    [[nodiscard]] std::size_t waveCount() const noexcept {
+        return enemyWaveStart.empty() ? 0 : enemyWaveStart.size() - 1;
+    }
+
+    [[nodiscard]] std::span<const TimelineEvent> enemies(
+        std::size_t wave) const noexcept {
+        return slice(enemyEvents, enemyWaveStart, wave);
+    }
+
+    [[nodiscard]] std::span<const TimelineEvent> powerUps(
+        std::size_t wave) const noexcept {
+        return slice(powerUpEvents, powerUpWaveStart, wave);
+    }
+
+    /**
+     * @brief Build the timeline of a parsed level
+     * @param level Level configuration
+     * @return Compiled timeline (not filtered against known enemies)
+     */
+    [[nodiscard]] static WaveTimeline compile(const shared::LevelConfig& level);
+
+    /**
+     * @brief Binary image of the timeline
+     * @param sourceHash Hash of the TOML it was compiled from
+     */
+    [[nodiscard]] std::vector<uint8_t> serialize(uint64_t sourceHash) const;
+
+    /**
+     * @brief Read back a serialize() image
+     * @param data Binary image
+     * @param sourceHash Expected hash of the TOML source
+     * @return nullopt if the data is malformed, from another format version
+     * or compiled from a different source
+     */
+    [[nodiscard]] static std::optional<WaveTimeline> deserialize(
+        const std::vector<uint8_t>& data, uint64_t sourceHash);
+
+    /**
+     * @brief FNV-1a hash used to tell whether a cache matches its source
+     */
+    [[nodiscard]] static uint64_t hashSource(std::string_view content) noexcept;
+
+   private:
+    [[nodiscard]] static std::span<const TimelineEvent> slice(
+        const std::vector<TimelineEvent>& events,
+        const std::vector<uint32_t>& starts, std::size_t wave) noexcept {
+        if (wave + 1 >= starts.size()) {
+            return {};
+        }
+        return std::span<const TimelineEvent>(events).subspan(
+            starts[wave], starts[wave + 1] - starts[wave]);
+    }
+};
+
+}  // namespace rtype::games::rtype::server
@@ -15,12 +15,15 @@
 // Gameplay Components
 #include "Components/AIComponent.hpp"
 #include "Components/BoundingBoxComponent.hpp"
+#include "Components/CollisionLayerComponent.hpp"
 #include "Components/DamageOnContactComponent.hpp"
 #include "Components/EnemyTypeComponent.hpp"
 #include "Components/ForcePodComponent.hpp"
 #include "Components/HealthComponent.hpp"
+#include "Components/PositionTrailComponent.hpp"
 #include "Components/PowerUpComponent.hpp"
 #include "Components/PowerUpTypeComponent.hpp"
+#include "Components/SweptColliderComponent.hpp"
 
 // Boss Components
 #include "Components/BossComponent.hpp"
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace rtype::games::rtype::shared {
@@ -25,6 +26,10 @@ enum class AIBehavior : uint8_t {
     DiveBomb       // Dives toward a target Y while drifting left
 };
 
+/// Number of AIBehavior values (keep in sync with the last enumerator)
+inline constexpr std::size_t kAIBehaviorCount =
+    static_cast<std::size_t>(AIBehavior::DiveBomb) + 1;
+
 /**
  * @struct AIComponent
  * @brief Component for enemy AI behavior
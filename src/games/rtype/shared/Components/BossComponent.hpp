@@ -8,12 +8,13 @@
 #pragma once
 
 #include <cstdint>
-#include <deque>
 #include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "PositionTrailComponent.hpp"
+
 namespace rtype::games::rtype::shared {
 
 /**
@@ -111,7 +112,7 @@ struct BossComponent {
     static constexpr std::size_t MAX_POSITION_HISTORY = 500;
     static constexpr float SEGMENT_SPACING = 100.0F;
     static constexpr float MIN_RECORD_DISTANCE = 3.0F;
-    std::deque<std::pair<float, float>> positionHistory;
+    PositionTrailComponent positionHistory{MAX_POSITION_HISTORY};
 
     /**
      * @brief Record current position in history for serpent movement
@@ -120,22 +121,15 @@ struct BossComponent {
      * @param y Current Y position
      */
     void recordPosition(float x, float y) {
-        if (!positionHistory.empty()) {
-            float dx = x - positionHistory.front().first;
-            float dy = y - positionHistory.front().second;
-            float distSq = dx * dx + dy * dy;
-            if (distSq < MIN_RECORD_DISTANCE * MIN_RECORD_DISTANCE) {
-                return;
-            }
-        }
-        positionHistory.push_front({x, y});
-        if (positionHistory.size() > MAX_POSITION_HISTORY) {
-            positionHistory.pop_back();
-        }
+        positionHistory.record(x, y, MIN_RECORD_DISTANCE);
     }
 
     /**
      * @brief Get position for a segment at given index (0 = head)
+     *
+     * Segments sit SEGMENT_SPACING apart along the recorded path, whatever
+     * the speed the boss moved at. Past the end of the history the body
+     * continues in a straight line to the left.
      * @param segmentIndex Index of the segment (0 = closest to head)
      * @return Position pair, or head position if history too short
      */
@@ -147,18 +141,16 @@ struct BossComponent {
             }
             return {baseX, baseY};
         }
-        std::size_t historyIndex = segmentIndex * 15;
-        if (historyIndex < positionHistory.size()) {
-            return positionHistory[historyIndex];
+        const float behind = static_cast<float>(segmentIndex) * SEGMENT_SPACING;
+        if (auto pos = positionHistory.sampleBehind(behind)) {
+            return *pos;
         }
         if (!positionHistory.empty()) {
             auto lastPos = positionHistory.back();
-            float extraOffset =
-                static_cast<float>(segmentIndex) * SEGMENT_SPACING * 0.5F;
-            return {lastPos.first - extraOffset, lastPos.second};
+            return {lastPos.first - (behind - positionHistory.length()),
+                    lastPos.second};
         }
-        return {baseX - static_cast<float>(segmentIndex) * SEGMENT_SPACING,
-                baseY};
+        return {baseX - behind, baseY};
     }
 
     /**
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** CollisionLayerComponent - Collision category and mask bitfields
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace rtype::games::rtype::shared {
+
+/**
+ * @brief Collision categories, one bit each
+ */
+namespace CollisionLayer {
+inline constexpr uint16_t None = 0;
+inline constexpr uint16_t Player = 1U << 0;
+inline constexpr uint16_t Enemy = 1U << 1;
+inline constexpr uint16_t PlayerProjectile = 1U << 2;
+inline constexpr uint16_t EnemyProjectile = 1U << 3;
+inline constexpr uint16_t NeutralProjectile = 1U << 4;
+inline constexpr uint16_t Pickup = 1U << 5;
+inline constexpr uint16_t Obstacle = 1U << 6;
+inline constexpr uint16_t ForcePod = 1U << 7;
+inline constexpr uint16_t LaserBeam = 1U << 8;
+inline constexpr uint16_t Projectiles =
+    PlayerProjectile | EnemyProjectile | NeutralProjectile;
+inline constexpr uint16_t All = 0xFFFF;
+
+/**
+ * @brief Categories a category interacts with in CollisionSystem
+ *
+ * Masks are symmetric: if A lists B then B lists A.
+ */
+[[nodiscard]] constexpr uint16_t defaultMask(uint16_t category) noexcept {
+    switch (category) {
+        case Player:
+            return Enemy | EnemyProjectile | NeutralProjectile | Pickup |
+                   Obstacle | ForcePod;
+        case Enemy:
+            return Player | PlayerProjectile | NeutralProjectile | LaserBeam;
+        case PlayerProjectile:
+            return Enemy | Obstacle;
+        case EnemyProjectile:
+            return Player | Obstacle;
+        case NeutralProjectile:
+            return Player | Enemy | Obstacle;
+        case Pickup:
+        case ForcePod:
+            return Player;
+        case Obstacle:
+            return Player | Projectiles;
+        case LaserBeam:
+            return Enemy;
+        default:
+            return All;
+    }
+}
+}  // namespace CollisionLayer
+
+/**
+ * @struct CollisionLayerComponent
+ * @brief What an entity is (category) and what it may touch (mask)
+ *
+ * The broadphase drops a pair unless each side's category is in the other's
+ * mask. Entities without this component collide with everything.
+ */
+struct CollisionLayerComponent {
+    uint16_t category{CollisionLayer::All};
+    uint16_t mask{CollisionLayer::All};
+
+    /**
+     * @brief Builds the layer of a category, with an optional mask override
+     * @param category One CollisionLayer bit
+     * @param mask Mask from config (collides_with), default mask otherwise
+     */
+    [[nodiscard]] static constexpr CollisionLayerComponent of(
+        uint16_t category, std::optional<uint16_t> mask = std::nullopt) {
+        return {category, mask.value_or(CollisionLayer::defaultMask(category))};
+    }
+
+    /**
+     * @brief Check if two layers may produce a collision pair
+     */
+    [[nodiscard]] constexpr bool canCollideWith(
+        const CollisionLayerComponent& other) const noexcept {
+        return (category & other.mask) != 0 && (other.category & mask) != 0;
+    }
+};
+
+}  // namespace rtype::games::rtype::shared
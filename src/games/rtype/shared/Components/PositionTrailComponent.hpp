@@ -0,0 +1,165 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** PositionTrailComponent - Fixed-capacity ring buffer of past positions
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace rtype::games::rtype::shared {
+
+/**
+ * @struct TrailPoint
+ * @brief One recorded position and how far along the path it was taken
+ */
+struct TrailPoint {
+    float x = 0.0F;
+    float y = 0.0F;
+    double distance = 0.0;  ///< Path length travelled when recorded
+};
+
+/**
+ * @struct PositionTrailComponent
+ * @brief Recent path of an entity, newest point first
+ *
+ * Points live in a contiguous ring allocated once at construction; when it
+ * is full the oldest point is overwritten. Each point stores the path
+ * length travelled up to it, which decreases strictly from newest to
+ * oldest, so "the point N pixels behind the head" is a binary search
+ * followed by one interpolation instead of a walk along the trail.
+ *
+ * Used for serpent bodies (each segment samples the boss path at a fixed
+ * arc length) and for anything that needs a heading from past positions.
+ */
+struct PositionTrailComponent {
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+    explicit PositionTrailComponent(
+        std::size_t capacity = DEFAULT_CAPACITY)
+        : _points(capacity > 0 ? capacity : 1) {}
+
+    /**
+     * @brief Append a position as the new head
+     * @param x Current X position
+     * @param y Current Y position
+     * @param minDistance Ignore the position if it is closer than this to
+     * the current head
+     * @return true if the position was recorded
+     */
+    bool record(float x, float y, float minDistance = 0.0F) {
+        double distance = 0.0;
+        if (_size > 0) {
+            const TrailPoint& head = _points[_head];
+            const float dx = x - head.x;
+            const float dy = y - head.y;
+            const float distSq = dx * dx + dy * dy;
+            if (distSq < minDistance * minDistance) {
+                return false;
+            }
+            distance = head.distance + std::sqrt(distSq);
+            _head = (_head + 1) % _points.size();
+        }
+        _points[_head] = TrailPoint{x, y, distance};
+        if (_size < _points.size()) {
+            ++_size;
+        }
+        return true;
+    }
+
+    void clear() noexcept {
+        _head = 0;
+        _size = 0;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return _points.size();
+    }
+
+    /**
+     * @brief Point by age (0 = newest); index must be below size()
+     */
+    [[nodiscard]] const TrailPoint& point(std::size_t index) const noexcept {
+        return _points[(_head + _points.size() - index) % _points.size()];
+    }
+
+    /**
+     * @brief Position by age (0 = newest); index must be below size()
+     */
+    [[nodiscard]] std::pair<float, float> operator[](
+        std::size_t index) const noexcept {
+        const TrailPoint& p = point(index);
+        return {p.x, p.y};
+    }
+
+    /// Newest position; the trail must not be empty
+    [[nodiscard]] std::pair<float, float> front() const noexcept {
+        return (*this)[0];
+    }
+
+    /// Oldest position; the trail must not be empty
+    [[nodiscard]] std::pair<float, float> back() const noexcept {
+        return (*this)[_size - 1];
+    }
+
+    /**
+     * @brief Path length between the oldest and the newest point
+     */
+    [[nodiscard]] float length() const noexcept {
+        if (_size == 0) {
+            return 0.0F;
+        }
+        return static_cast<float>(point(0).distance -
+                                  point(_size - 1).distance);
+    }
+
+    /**
+     * @brief Position a given path length behind the newest point
+     * @param behind Distance measured along the trail
+     * @return Interpolated position, nullopt if the trail is shorter
+     */
+    [[nodiscard]] std::optional<std::pair<float, float>> sampleBehind(
+        float behind) const noexcept {
+        if (_size == 0 || behind > length()) {
+            return std::nullopt;
+        }
+        if (behind <= 0.0F) {
+            return front();
+        }
+        const double target = point(0).distance - behind;
+        // First point (by age) at or before the target distance
+        std::size_t lo = 1;
+        std::size_t hi = _size - 1;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (point(mid).distance <= target) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        const TrailPoint& older = point(lo);
+        const TrailPoint& newer = point(lo - 1);
+        const double span = newer.distance - older.distance;
+        const float t =
+            span > 0.0 ? static_cast<float>((target - older.distance) / span)
+                       : 0.0F;
+        return std::pair<float, float>{older.x + (newer.x - older.x) * t,
+                                       older.y + (newer.y - older.y) * t};
+    }
+
+   private:
+    std::vector<TrailPoint> _points;
+    std::size_t _head = 0;  ///< Slot of the newest point
+    std::size_t _size = 0;
+};
+
+}  // namespace rtype::games::rtype::shared
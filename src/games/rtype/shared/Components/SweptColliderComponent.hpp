@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** SweptColliderComponent - Continuous collision for fast movers
+*/
+
+#pragma once
+
+#include "TransformComponent.hpp"
+
+namespace rtype::games::rtype::shared {
+
+/**
+ * @struct SweptColliderComponent
+ * @brief Flags an entity as fast: it collides along its whole path
+ *
+ * Holds the position the collision system last saw. The broadphase uses
+ * the box swept from there to the current position, and the narrowphase
+ * tests the segment between both positions, so a shot moving further than
+ * a target's width in one tick still hits it.
+ */
+struct SweptColliderComponent {
+    float prevX = 0.0F;
+    float prevY = 0.0F;
+    bool hasPrevious = false;  ///< false: discrete test until next record
+
+    /**
+     * @brief Starts the next sweep from the given position
+     */
+    void record(const TransformComponent& transform) noexcept {
+        prevX = transform.x;
+        prevY = transform.y;
+        hasPrevious = true;
+    }
+};
+
+}  // namespace rtype::games::rtype::shared
@@ -9,6 +9,7 @@
 
 #include <array>
 #include <cstdint>
+#include <optional>
 
 #include "ProjectileComponent.hpp"
 
@@ -30,6 +31,7 @@ struct WeaponConfig {
     int32_t maxHits = 1;
     uint8_t projectileCount = 1;  ///< Number of projectiles per shot
     float spreadAngle = 0.0F;     ///< Angle spread for multi-shot
+    std::optional<uint16_t> collisionMask{};  ///< From projectile config
 };
 
 /**
@@ -73,6 +73,7 @@ struct EnemyConfig {
 
     float hitboxWidth = 32.0F;
     float hitboxHeight = 32.0F;
+    std::optional<uint16_t> collisionMask;  ///< collides_with, if set
 
     bool canShoot = false;
     float fireRate = 1.0F;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace rtype::games::rtype::shared {
@@ -27,6 +28,7 @@ struct PlayerConfig {
 
     float hitboxWidth = 32.0F;
     float hitboxHeight = 16.0F;
+    std::optional<uint16_t> collisionMask;  ///< collides_with, if set
 
     std::string defaultProjectile = "basic_bullet";
 
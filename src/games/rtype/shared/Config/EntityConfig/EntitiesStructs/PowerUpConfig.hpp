@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace rtype::games::rtype::shared {
@@ -35,6 +36,7 @@ struct PowerUpConfig {
 
     float hitboxWidth = 16.0F;
     float hitboxHeight = 16.0F;
+    std::optional<uint16_t> collisionMask;  ///< collides_with, if set
 
     uint8_t colorR = 255;
     uint8_t colorG = 255;
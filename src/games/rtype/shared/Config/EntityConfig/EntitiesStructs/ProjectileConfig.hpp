@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace rtype::games::rtype::shared {
@@ -25,6 +26,7 @@ struct ProjectileConfig {
     float lifetime = 5.0F;
     float hitboxWidth = 8.0F;
     float hitboxHeight = 4.0F;
+    std::optional<uint16_t> collisionMask;  ///< collides_with, if set
 
     bool piercing = false;
     int32_t maxHits = 1;
@@ -11,6 +11,7 @@
 
 #include <toml++/toml.hpp>
 
+#include "../../Components/CollisionLayerComponent.hpp"
 #include "Logger/Macros.hpp"
 
 namespace rtype::games::rtype::shared {
@@ -50,6 +51,46 @@ PowerUpConfig::EffectType stringToEffect(const std::string& str) {
     return PowerUpConfig::EffectType::Health;
 }
 
+/**
+ * @brief Convert string to a CollisionLayer bit (None if unknown)
+ */
+uint16_t stringToCollisionLayer(const std::string& str) {
+    if (str == "player") return CollisionLayer::Player;
+    if (str == "enemy") return CollisionLayer::Enemy;
+    if (str == "player_projectile") return CollisionLayer::PlayerProjectile;
+    if (str == "enemy_projectile") return CollisionLayer::EnemyProjectile;
+    if (str == "neutral_projectile") return CollisionLayer::NeutralProjectile;
+    if (str == "projectile") return CollisionLayer::Projectiles;
+    if (str == "pickup") return CollisionLayer::Pickup;
+    if (str == "obstacle") return CollisionLayer::Obstacle;
+    if (str == "force_pod") return CollisionLayer::ForcePod;
+    if (str == "laser_beam") return CollisionLayer::LaserBeam;
+    if (str == "all") return CollisionLayer::All;
+    return CollisionLayer::None;
+}
+
+/**
+ * @brief Read the optional collides_with list into a collision mask
+ */
+std::optional<uint16_t> parseCollisionMask(const toml::table& tbl) {
+    const auto* names = tbl["collides_with"].as_array();
+    if (names == nullptr) {
+        return std::nullopt;
+    }
+    uint16_t mask = CollisionLayer::None;
+    for (const auto& name : *names) {
+        const std::string str = name.value_or(std::string{});
+        const uint16_t layer = stringToCollisionLayer(str);
+        if (layer == CollisionLayer::None) {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[EntityConfig] Unknown collision layer '"
+                                << str << "' in collides_with");
+        }
+        mask |= layer;
+    }
+    return mask;
+}
+
 std::string findConfigPath(const std::string& filepath) {
     namespace fs = std::filesystem;
 
@@ -207,6 +248,7 @@ bool EntityConfigRegistry::loadEnemies(const std::string& filepath) {
                         (*enemyTbl)["hitbox_width"].value_or(32.0F);
                     config.hitboxHeight =
                         (*enemyTbl)["hitbox_height"].value_or(32.0F);
+                    config.collisionMask = parseCollisionMask(*enemyTbl);
 
                     // Shooting
                     config.canShoot = (*enemyTbl)["can_shoot"].value_or(false);
@@ -323,6 +365,7 @@ bool EntityConfigRegistry::loadEnemies(const std::string& filepath) {
 
                     if (config.isValid()) {
                         m_enemies[config.id] = std::move(config);
+                        bumpGeneration();
                     } else {
                         LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
                                         "[EntityConfig] Invalid enemy config: "
@@ -364,6 +407,7 @@ bool EntityConfigRegistry::loadProjectiles(const std::string& filepath) {
                         (*projTbl)["hitbox_width"].value_or(8.0F);
                     config.hitboxHeight =
                         (*projTbl)["hitbox_height"].value_or(4.0F);
+                    config.collisionMask = parseCollisionMask(*projTbl);
 
                     config.piercing = (*projTbl)["piercing"].value_or(false);
                     config.maxHits = (*projTbl)["max_hits"].value_or(1);
@@ -409,6 +453,7 @@ bool EntityConfigRegistry::loadPlayers(const std::string& filepath) {
                         (*playerTbl)["hitbox_width"].value_or(32.0F);
                     config.hitboxHeight =
                         (*playerTbl)["hitbox_height"].value_or(16.0F);
+                    config.collisionMask = parseCollisionMask(*playerTbl);
 
                     config.defaultProjectile =
                         (*playerTbl)["default_projectile"].value_or(
@@ -454,6 +499,7 @@ bool EntityConfigRegistry::loadPowerUps(const std::string& filepath) {
                         (*puTbl)["hitbox_width"].value_or(16.0F);
                     config.hitboxHeight =
                         (*puTbl)["hitbox_height"].value_or(16.0F);
+                    config.collisionMask = parseCollisionMask(*puTbl);
 
                     if (auto* colorArray = (*puTbl)["color"].as_array()) {
                         if (colorArray->size() >= 4) {
@@ -474,6 +520,7 @@ bool EntityConfigRegistry::loadPowerUps(const std::string& filepath) {
 
                     if (config.isValid()) {
                         m_powerUps[config.id] = std::move(config);
+                        bumpGeneration();
                     }
                 }
             }
@@ -637,6 +684,7 @@ void EntityConfigRegistry::clear() {
     m_players.clear();
     m_powerUps.clear();
     m_levels.clear();
+    bumpGeneration();
 }
 
 bool EntityConfigRegistry::loadEnemiesWithSearch(const std::string& filepath) {
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string>
@@ -197,14 +199,31 @@ class EntityConfigRegistry {
      */
     void clear();
 
+    /**
+     * @brief Counter bumped whenever an enemy or power-up config is added or
+     *        replaced, and on clear()
+     *
+     * References handed out by the getters die with clear(); code that
+     * caches them compares this value to know when to look them up again.
+     * Loading a level leaves it untouched so other lobbies keep theirs.
+     */
+    [[nodiscard]] std::uint64_t generation() const noexcept {
+        return m_generation.load(std::memory_order_acquire);
+    }
+
    private:
     EntityConfigRegistry() = default;
 
+    void bumpGeneration() noexcept {
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
     std::unordered_map<std::string, EnemyConfig> m_enemies;
     std::unordered_map<std::string, ProjectileConfig> m_projectiles;
     std::unordered_map<std::string, PlayerConfig> m_players;
     std::unordered_map<std::string, PowerUpConfig> m_powerUps;
     std::unordered_map<std::string, LevelConfig> m_levels;
+    std::atomic<std::uint64_t> m_generation{0};
 };
 
 }  // namespace rtype::games::rtype::shared
@@ -34,6 +34,9 @@ void PrefabLoader::registerEnemyPrefabs(ECS::PrefabManager& prefabs) {
                                                    cfg.speed, 0.0f, 0.0f, 0.0f);
             registry.emplaceComponent<BoundingBoxComponent>(
                 entity, cfg.hitboxWidth, cfg.hitboxHeight);
+            registry.emplaceComponent<CollisionLayerComponent>(
+                entity, CollisionLayerComponent::of(CollisionLayer::Enemy,
+                                                    cfg.collisionMask));
             registry.emplaceComponent<EnemyTag>(entity);
         });
     }
@@ -74,6 +77,9 @@ void PrefabLoader::registerPlayerPrefabs(ECS::PrefabManager& prefabs) {
                                                        cfg.health);
             registry.emplaceComponent<BoundingBoxComponent>(
                 entity, cfg.hitboxWidth, cfg.hitboxHeight);
+            registry.emplaceComponent<CollisionLayerComponent>(
+                entity, CollisionLayerComponent::of(CollisionLayer::Player,
+                                                    cfg.collisionMask));
             registry.emplaceComponent<PlayerTag>(entity);
         });
     }
@@ -91,6 +97,9 @@ void PrefabLoader::registerPowerUpPrefabs(ECS::PrefabManager& prefabs) {
             registry.emplaceComponent<VelocityComponent>(entity, -50.0f, 0.0f);
             registry.emplaceComponent<BoundingBoxComponent>(
                 entity, cfg.hitboxWidth, cfg.hitboxHeight);
+            registry.emplaceComponent<CollisionLayerComponent>(
+                entity, CollisionLayerComponent::of(CollisionLayer::Pickup,
+                                                    cfg.collisionMask));
             registry.emplaceComponent<PickupTag>(entity);
         });
     }
@@ -7,7 +7,7 @@
 
 #include "AISystem.hpp"
 
-#include <limits>
+#include <cstddef>
 
 #include "../../Components/Tags.hpp"
 #include "Behaviors/BehaviorRegistry.hpp"
@@ -15,79 +15,82 @@
 
 namespace rtype::games::rtype::shared {
 
-namespace {
-constexpr size_t PARALLEL_THRESHOLD = 50;
-}
+AISystem::AISystem(std::size_t workers)
+    : ASystem("AISystem"),
+      _jobPool(std::make_unique<::rtype::JobPool>(workers)) {}
 
 void AISystem::update(ECS::Registry& registry, float deltaTime) {
     updateChaseTargets(registry);
 
-    const size_t entityCount = registry.countComponents<AIComponent>();
+    for (auto& bucket : _buckets) {
+        bucket.aiRefs.clear();
+        bucket.velocityRefs.clear();
+        bucket.ai.clear();
+        bucket.transforms.clear();
+        bucket.velocities.clear();
+    }
+
+    auto view =
+        registry.view<AIComponent, TransformComponent, VelocityComponent>();
+    view.each([this](ECS::Entity /*entity*/, AIComponent& ai,
+                     const TransformComponent& transform,
+                     VelocityComponent& velocity) {
+        const auto index = static_cast<std::size_t>(ai.behavior);
+        if (index >= _buckets.size()) {
+            return;
+        }
+        Bucket& bucket = _buckets[index];
+        bucket.aiRefs.push_back(&ai);
+        bucket.velocityRefs.push_back(&velocity);
+        bucket.ai.push_back(ai);
+        bucket.transforms.push_back(transform);
+        bucket.velocities.push_back(velocity);
+    });
+
     const auto& behaviorRegistry = BehaviorRegistry::instance();
-    if (entityCount >= PARALLEL_THRESHOLD) {
-        auto view = registry.parallelView<AIComponent, TransformComponent,
-                                          VelocityComponent>();
-        view.each([deltaTime, &behaviorRegistry](
-                      ECS::Entity /*entity*/, AIComponent& ai,
-                      const TransformComponent& transform,
-                      VelocityComponent& velocity) {
-            auto behavior = behaviorRegistry.getBehavior(ai.behavior);
-            if (behavior) {
-                behavior->apply(ai, transform, velocity, deltaTime);
-            }
-        });
-    } else {
-        auto view =
-            registry.view<AIComponent, TransformComponent, VelocityComponent>();
-        view.each([deltaTime, &behaviorRegistry](
-                      ECS::Entity /*entity*/, AIComponent& ai,
-                      const TransformComponent& transform,
-                      VelocityComponent& velocity) {
-            auto behavior = behaviorRegistry.getBehavior(ai.behavior);
-            if (behavior) {
-                behavior->apply(ai, transform, velocity, deltaTime);
-            }
-        });
+    for (std::size_t b = 0; b < _buckets.size(); ++b) {
+        Bucket& bucket = _buckets[b];
+        if (bucket.ai.empty()) {
+            continue;
+        }
+        auto behavior =
+            behaviorRegistry.getBehavior(static_cast<AIBehavior>(b));
+        if (!behavior) {
+            continue;
+        }
+        const AIBatch batch{bucket.ai, bucket.transforms, bucket.velocities};
+        _jobPool->parallelFor(
+            batch.size(), kBatchChunk,
+            [&batch, &behavior, deltaTime](std::size_t /*chunk*/,
+                                           std::size_t begin,
+                                           std::size_t end) {
+                behavior->applyBatch(batch.subspan(begin, end - begin),
+                                     deltaTime);
+            });
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            *bucket.aiRefs[i] = bucket.ai[i];
+            *bucket.velocityRefs[i] = bucket.velocities[i];
+        }
     }
 }
 
 void AISystem::updateChaseTargets(ECS::Registry& registry) {
-    struct PlayerInfo {
-        float x;
-        float y;
-    };
-    std::vector<PlayerInfo> players;
-
-    auto playerView = registry.view<PlayerTag, TransformComponent>();
-    playerView.each([&players](ECS::Entity /*entity*/, const PlayerTag& /*tag*/,
-                               const TransformComponent& transform) {
-        players.push_back({transform.x, transform.y});
-    });
+    const auto& targets = PlayerTargetIndex::current(registry, _targets);
+    if (targets.empty()) {
+        return;
+    }
 
     auto chaseView = registry.view<EnemyTag, AIComponent, TransformComponent>();
-    chaseView.each([&players](ECS::Entity /*entity*/, const EnemyTag& /*tag*/,
+    chaseView.each([&targets](ECS::Entity /*entity*/, const EnemyTag& /*tag*/,
                               AIComponent& ai,
                               const TransformComponent& transform) {
         if (ai.behavior != AIBehavior::Chase) {
             return;
         }
-        float bestDist2 = std::numeric_limits<float>::max();
-        float targetX = ai.targetX;
-        float targetY = ai.targetY;
-
-        for (const auto& player : players) {
-            float dx = player.x - transform.x;
-            float dy = player.y - transform.y;
-            float dist2 = dx * dx + dy * dy;
-
-            if (dist2 < bestDist2) {
-                bestDist2 = dist2;
-                targetX = player.x;
-                targetY = player.y;
-            }
+        if (const auto* player = targets.nearest(transform.x, transform.y)) {
+            ai.targetX = player->x;
+            ai.targetY = player->y;
         }
-        ai.targetX = targetX;
-        ai.targetY = targetY;
     });
 }
 
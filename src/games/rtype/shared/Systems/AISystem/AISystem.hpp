@@ -7,12 +7,19 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include <rtype/engine.hpp>
 
 #include "../../Components/AIComponent.hpp"
 #include "../../Components/TransformComponent.hpp"
 #include "../../Components/VelocityComponent.hpp"
+#include "../Targeting/PlayerTargetIndex.hpp"
 #include "Behaviors/BehaviorRegistry.hpp"
+#include "JobPool/JobPool.hpp"
 
 namespace rtype::games::rtype::shared {
 
@@ -23,11 +30,24 @@ namespace rtype::games::rtype::shared {
  * Shared between client (for prediction) and server (authoritative).
  * Uses the BehaviorRegistry to apply behavior strategies.
  *
+ * Entities are bucketed by AIBehavior and their AI state, transform and
+ * velocity copied into contiguous arrays. Each behavior is looked up once
+ * per tick and runs as a batch kernel over its bucket (in chunks on a
+ * JobPool for large waves); the results are then written back.
+ *
  * Make sure to call registerDefaultBehaviors() before using this system.
  */
 class AISystem : public ::rtype::engine::ASystem {
    public:
-    AISystem() : ASystem("AISystem") {}
+    /**
+     * @brief Construct the system
+     * @param workers Worker threads for the behavior kernels; 0 keeps them
+     *        on the calling thread
+     */
+    explicit AISystem(std::size_t workers = 0);
+
+    /// Entities per kernel call when a bucket is split across workers
+    static constexpr std::size_t kBatchChunk = 256;
 
     /**
      * @brief Update all entities with AI components
@@ -42,6 +62,21 @@ class AISystem : public ::rtype::engine::ASystem {
      * @param registry ECS registry
      */
     void updateChaseTargets(ECS::Registry& registry);
+
+    /**
+     * @brief Contiguous copy of the entities using one behavior
+     */
+    struct Bucket {
+        std::vector<AIComponent*> aiRefs;  ///< Where to write ai back
+        std::vector<VelocityComponent*> velocityRefs;
+        std::vector<AIComponent> ai;
+        std::vector<TransformComponent> transforms;
+        std::vector<VelocityComponent> velocities;
+    };
+
+    std::array<Bucket, kAIBehaviorCount> _buckets;
+    std::unique_ptr<::rtype::JobPool> _jobPool;
+    PlayerTargetIndex _targets;  ///< Used when no index was published
 };
 
 }  // namespace rtype::games::rtype::shared
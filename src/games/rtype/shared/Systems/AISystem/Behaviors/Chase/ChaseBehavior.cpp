@@ -9,32 +9,30 @@
 
 #include <cmath>
 
-#include "Logger/Macros.hpp"
-
 namespace rtype::games::rtype::shared {
 
 void ChaseBehavior::apply(AIComponent& ai, const TransformComponent& transform,
-                          VelocityComponent& velocity, float /*deltaTime*/) {
-    float dx = ai.targetX - transform.x;
-    float dy = ai.targetY - transform.y;
-    float dist = std::sqrt(dx * dx + dy * dy);
-
-    LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
-                  "[ChaseBehavior] pos=("
-                      << transform.x << "," << transform.y << ")"
-                      << " target=(" << ai.targetX << "," << ai.targetY << ")"
-                      << " dist=" << dist << " speed=" << ai.speed);
-
-    if (dist > _stopDistance) {
-        velocity.vx = (dx / dist) * ai.speed;
-        velocity.vy = (dy / dist) * ai.speed;
+                          VelocityComponent& velocity, float deltaTime) {
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
 
-        LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
-                      "[ChaseBehavior] Setting velocity=("
-                          << velocity.vx << "," << velocity.vy << ")");
-    } else {
-        velocity.vx = 0.0F;
-        velocity.vy = 0.0F;
+void ChaseBehavior::applyBatch(const AIBatch& batch, float /*deltaTime*/) {
+    const float stopDistance = _stopDistance;
+    const auto ai = batch.ai;
+    const auto transform = batch.transforms;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        const float dx = ai[i].targetX - transform[i].x;
+        const float dy = ai[i].targetY - transform[i].y;
+        const float dist = std::sqrt(dx * dx + dy * dy);
+
+        if (dist > stopDistance) {
+            velocity[i].vx = (dx / dist) * ai[i].speed;
+            velocity[i].vy = (dy / dist) * ai[i].speed;
+        } else {
+            velocity[i].vx = 0.0F;
+            velocity[i].vy = 0.0F;
+        }
     }
 }
 
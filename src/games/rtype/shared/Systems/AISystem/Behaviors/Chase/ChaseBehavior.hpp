@@ -30,6 +30,8 @@ class ChaseBehavior final : public IAIBehavior {
     void apply(AIComponent& ai, const TransformComponent& transform,
                VelocityComponent& velocity, float deltaTime) override;
 
+    void applyBatch(const AIBatch& batch, float deltaTime) override;
+
     [[nodiscard]] AIBehavior getType() const noexcept override {
         return AIBehavior::Chase;
     }
@@ -13,12 +13,23 @@ namespace rtype::games::rtype::shared {
 
 void DiveBombBehavior::apply(AIComponent& ai,
                              const TransformComponent& transform,
-                             VelocityComponent& velocity, float /*deltaTime*/) {
-    velocity.vx = -ai.speed;
+                             VelocityComponent& velocity, float deltaTime) {
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
+
+void DiveBombBehavior::applyBatch(const AIBatch& batch, float /*deltaTime*/) {
+    const float adjustSpeed = _adjustSpeed;
+    const auto ai = batch.ai;
+    const auto transform = batch.transforms;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        velocity[i].vx = -ai[i].speed;
 
-    float dy = ai.targetY - transform.y;
-    float direction = (std::abs(dy) < 1.0F) ? 0.0F : (dy > 0.0F ? 1.0F : -1.0F);
-    velocity.vy = _adjustSpeed * direction;
+        const float dy = ai[i].targetY - transform[i].y;
+        const float direction =
+            (std::abs(dy) < 1.0F) ? 0.0F : (dy > 0.0F ? 1.0F : -1.0F);
+        velocity[i].vy = adjustSpeed * direction;
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
@@ -23,6 +23,8 @@ class DiveBombBehavior final : public IAIBehavior {
     void apply(AIComponent& ai, const TransformComponent& transform,
                VelocityComponent& velocity, float deltaTime) override;
 
+    void applyBatch(const AIBatch& batch, float deltaTime) override;
+
     [[nodiscard]] AIBehavior getType() const noexcept override {
         return AIBehavior::DiveBomb;
     }
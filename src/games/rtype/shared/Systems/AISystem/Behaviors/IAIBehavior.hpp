@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <span>
 #include <string>
 
 #include "../../../Components/AIComponent.hpp"
@@ -15,6 +17,39 @@
 
 namespace rtype::games::rtype::shared {
 
+/**
+ * @struct AIBatch
+ * @brief AI state of a group of entities laid out contiguously
+ *
+ * Element i of every span belongs to the same entity. AISystem fills one
+ * batch per behavior each tick.
+ */
+struct AIBatch {
+    std::span<AIComponent> ai;
+    std::span<const TransformComponent> transforms;
+    std::span<VelocityComponent> velocities;
+
+    /**
+     * @brief Batch of a single entity
+     */
+    [[nodiscard]] static AIBatch single(AIComponent& ai,
+                                        const TransformComponent& transform,
+                                        VelocityComponent& velocity) noexcept {
+        return {{&ai, 1}, {&transform, 1}, {&velocity, 1}};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return ai.size(); }
+
+    /**
+     * @brief Entities [offset, offset + count) of this batch
+     */
+    [[nodiscard]] AIBatch subspan(std::size_t offset,
+                                  std::size_t count) const noexcept {
+        return {ai.subspan(offset, count), transforms.subspan(offset, count),
+                velocities.subspan(offset, count)};
+    }
+};
+
 /**
  * @class IAIBehavior
  * @brief Abstract interface for AI behavior strategies
@@ -24,7 +59,8 @@ namespace rtype::games::rtype::shared {
  *
  * To add a new behavior:
  * 1. Add a new enum value in AIBehavior (AIComponent.hpp)
- * 2. Create a new class inheriting from IAIBehavior
+ * 2. Create a new class inheriting from IAIBehavior (override applyBatch()
+ *    too if it runs on many entities)
  * 3. Register it in BehaviorRegistry
  */
 class IAIBehavior {
@@ -46,6 +82,23 @@ class IAIBehavior {
     virtual void apply(AIComponent& ai, const TransformComponent& transform,
                        VelocityComponent& velocity, float deltaTime) = 0;
 
+    /**
+     * @brief Apply the behavior to every entity of a batch
+     *
+     * Called by AISystem once per behavior and chunk, possibly from several
+     * threads on disjoint batches. The default calls apply() per entity;
+     * built-in behaviors override it with a plain loop over the spans.
+     *
+     * @param batch Entities using this behavior
+     * @param deltaTime Time elapsed since last update
+     */
+    virtual void applyBatch(const AIBatch& batch, float deltaTime) {
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            apply(batch.ai[i], batch.transforms[i], batch.velocities[i],
+                  deltaTime);
+        }
+    }
+
     /**
      * @brief Get the behavior type this strategy handles
      * @return The AIBehavior enum value
@@ -10,10 +10,18 @@
 namespace rtype::games::rtype::shared {
 
 void MoveLeftBehavior::apply(AIComponent& ai,
-                             const TransformComponent& /*transform*/,
-                             VelocityComponent& velocity, float /*deltaTime*/) {
-    velocity.vx = -ai.speed;
-    velocity.vy = 0.0F;
+                             const TransformComponent& transform,
+                             VelocityComponent& velocity, float deltaTime) {
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
+
+void MoveLeftBehavior::applyBatch(const AIBatch& batch, float /*deltaTime*/) {
+    const auto ai = batch.ai;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        velocity[i].vx = -ai[i].speed;
+        velocity[i].vy = 0.0F;
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
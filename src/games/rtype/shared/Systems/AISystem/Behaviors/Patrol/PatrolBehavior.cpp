@@ -9,12 +9,19 @@
 
 namespace rtype::games::rtype::shared {
 
-void PatrolBehavior::apply(AIComponent& ai,
-                           const TransformComponent& /*transform*/,
-                           VelocityComponent& velocity, float /*deltaTime*/) {
+void PatrolBehavior::apply(AIComponent& ai, const TransformComponent& transform,
+                           VelocityComponent& velocity, float deltaTime) {
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
+
+void PatrolBehavior::applyBatch(const AIBatch& batch, float /*deltaTime*/) {
     // TODO(Sam): Extend to support waypoint-based patrol
-    velocity.vx = -ai.speed;
-    velocity.vy = 0.0F;
+    const auto ai = batch.ai;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        velocity[i].vx = -ai[i].speed;
+        velocity[i].vy = 0.0F;
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
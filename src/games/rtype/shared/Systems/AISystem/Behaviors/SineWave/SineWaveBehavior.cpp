@@ -12,12 +12,22 @@
 namespace rtype::games::rtype::shared {
 
 void SineWaveBehavior::apply(AIComponent& ai,
-                             const TransformComponent& /*transform*/,
+                             const TransformComponent& transform,
                              VelocityComponent& velocity, float deltaTime) {
-    ai.stateTimer += deltaTime;
-    velocity.vx = -ai.speed;
-    velocity.vy =
-        _amplitude * _frequency * std::cos(_frequency * ai.stateTimer);
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
+
+void SineWaveBehavior::applyBatch(const AIBatch& batch, float deltaTime) {
+    const float amplitude = _amplitude;
+    const float frequency = _frequency;
+    const auto ai = batch.ai;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        ai[i].stateTimer += deltaTime;
+        velocity[i].vx = -ai[i].speed;
+        velocity[i].vy =
+            amplitude * frequency * std::cos(frequency * ai[i].stateTimer);
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
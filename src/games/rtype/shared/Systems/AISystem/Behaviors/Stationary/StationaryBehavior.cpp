@@ -9,12 +9,18 @@
 
 namespace rtype::games::rtype::shared {
 
-void StationaryBehavior::apply(AIComponent& /*ai*/,
-                               const TransformComponent& /*transform*/,
-                               VelocityComponent& velocity,
-                               float /*deltaTime*/) {
-    velocity.vx = 0.0F;
-    velocity.vy = 0.0F;
+void StationaryBehavior::apply(AIComponent& ai,
+                               const TransformComponent& transform,
+                               VelocityComponent& velocity, float deltaTime) {
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
+
+void StationaryBehavior::applyBatch(const AIBatch& batch,
+                                    float /*deltaTime*/) {
+    for (auto& velocity : batch.velocities) {
+        velocity.vx = 0.0F;
+        velocity.vy = 0.0F;
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
@@ -9,22 +9,32 @@
 
 namespace rtype::games::rtype::shared {
 
-void ZigZagBehavior::apply(AIComponent& ai,
-                           const TransformComponent& /*transform*/,
+void ZigZagBehavior::apply(AIComponent& ai, const TransformComponent& transform,
                            VelocityComponent& velocity, float deltaTime) {
-    ai.stateTimer += deltaTime;
+    applyBatch(AIBatch::single(ai, transform, velocity), deltaTime);
+}
 
-    if (ai.targetY == 0.0F) {
-        ai.targetY = 1.0F;
-    }
-    if (ai.stateTimer >= _switchInterval) {
-        ai.stateTimer = 0.0F;
-        ai.targetY = (ai.targetY >= 0.0F) ? -1.0F : 1.0F;
-    }
+void ZigZagBehavior::applyBatch(const AIBatch& batch, float deltaTime) {
+    const float switchInterval = _switchInterval;
+    const float stepSpeed = _stepSpeed;
+    const auto ai = batch.ai;
+    const auto velocity = batch.velocities;
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        AIComponent& state = ai[i];
+        state.stateTimer += deltaTime;
 
-    const float direction = (ai.targetY >= 0.0F) ? 1.0F : -1.0F;
-    velocity.vx = -ai.speed;
-    velocity.vy = _stepSpeed * direction;
+        if (state.targetY == 0.0F) {
+            state.targetY = 1.0F;
+        }
+        if (state.stateTimer >= switchInterval) {
+            state.stateTimer = 0.0F;
+            state.targetY = (state.targetY >= 0.0F) ? -1.0F : 1.0F;
+        }
+
+        const float direction = (state.targetY >= 0.0F) ? 1.0F : -1.0F;
+        velocity[i].vx = -state.speed;
+        velocity[i].vy = stepSpeed * direction;
+    }
 }
 
 }  // namespace rtype::games::rtype::shared
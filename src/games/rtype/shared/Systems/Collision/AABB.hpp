@@ -7,8 +7,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 #include "../../Components/BoundingBoxComponent.hpp"
 #include "../../Components/TransformComponent.hpp"
+#include "Rect.hpp"
 
 namespace rtype::games::rtype::shared::collision {
 
@@ -41,4 +46,56 @@ inline bool overlaps(const TransformComponent& aTransform,
     return !separated;
 }
 
+/**
+ * @brief Checks whether the segment (x0, y0) -> (x1, y1) touches a rectangle
+ *
+ * Slab test: the segment is clipped against the X then the Y extent of the
+ * rectangle, and hits if some part of it survives both. Edges count as
+ * inside, like overlaps().
+ */
+inline bool segmentIntersects(const Rect& rect, float x0, float y0, float x1,
+                              float y1) {
+    float tEnter = 0.0F;
+    float tExit = 1.0F;
+    const auto clip = [&tEnter, &tExit](float start, float delta, float low,
+                                        float high) {
+        if (std::abs(delta) < 1e-6F) {
+            return start >= low && start <= high;
+        }
+        float t0 = (low - start) / delta;
+        float t1 = (high - start) / delta;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tEnter = std::max(tEnter, t0);
+        tExit = std::min(tExit, t1);
+        return tEnter <= tExit;
+    };
+    return clip(x0, x1 - x0, rect.left(), rect.right()) &&
+           clip(y0, y1 - y0, rect.top(), rect.bottom());
+}
+
+/**
+ * @brief Checks whether two boxes touch at any time while both move in a
+ * straight line from their "from" to their "to" transform.
+ *
+ * Works in the frame of B: A's center travels along its motion minus B's,
+ * against B's box grown by A's half extents (Minkowski sum).
+ */
+inline bool sweptOverlaps(const TransformComponent& aFrom,
+                          const TransformComponent& aTo,
+                          const BoundingBoxComponent& aBox,
+                          const TransformComponent& bFrom,
+                          const TransformComponent& bTo,
+                          const BoundingBoxComponent& bBox) {
+    const float halfW = (aBox.width + bBox.width) * 0.5F;
+    const float halfH = (aBox.height + bBox.height) * 0.5F;
+    const float startX = aFrom.x - bFrom.x;
+    const float startY = aFrom.y - bFrom.y;
+    const float endX = startX + (aTo.x - aFrom.x) - (bTo.x - bFrom.x);
+    const float endY = startY + (aTo.y - aFrom.y) - (bTo.y - bFrom.y);
+    return segmentIntersects(Rect(-halfW, -halfH, halfW * 2.0F, halfH * 2.0F),
+                             startX, startY, endX, endY);
+}
+
 }  // namespace rtype::games::rtype::shared::collision
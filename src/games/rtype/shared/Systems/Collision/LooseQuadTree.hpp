@@ -0,0 +1,421 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** LooseQuadTree - Persistent broadphase with pooled nodes
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "QuadTree.hpp"
+#include "Rect.hpp"
+
+namespace rtype::games::rtype::shared::collision {
+
+/**
+ * @class LooseQuadTree
+ * @brief QuadTree that lives across frames and only moves what moved.
+ *
+ * Each node's loose bounds are its cell grown by half a cell on every side,
+ * so an object belongs to exactly one node: the deepest one whose cell
+ * holds its center and is at least as large as the object. A moving object
+ * only changes node when its center leaves that cell, which makes most
+ * per-frame updates a bounds write.
+ *
+ * Objects are identified by a small dense key (the ECS entity index) and
+ * kept in a key-indexed array; nodes are allocated four at a time from a
+ * contiguous arena and recycled through a free list, so steady-state
+ * updates never allocate. Nodes split past maxObjects and merge back once
+ * their children hold half of that.
+ *
+ * @tparam T The type of data associated with stored objects
+ */
+template <typename T>
+class LooseQuadTree {
+   public:
+    static constexpr std::uint32_t kNone =
+        std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Constructs an empty tree (root node only).
+     *
+     * @param bounds The world bounds; objects must fit entirely inside
+     * @param maxObjects Objects in a node before it subdivides
+     * @param maxDepth Maximum tree depth
+     */
+    explicit LooseQuadTree(
+        const Rect& bounds,
+        size_t maxObjects = QuadTree<T>::DEFAULT_MAX_OBJECTS,
+        size_t maxDepth = QuadTree<T>::DEFAULT_MAX_DEPTH)
+        : _bounds(bounds),
+          _maxObjects(std::max<size_t>(maxObjects, 1)),
+          _maxDepth(maxDepth) {
+        _nodes.push_back(Node{bounds});
+    }
+
+    /**
+     * @brief Inserts or moves an object.
+     *
+     * @param key Dense identifier of the object
+     * @param bounds Current bounds of the object
+     * @param data Data returned by queries
+     * @return false if the bounds leave the world (the object is removed)
+     */
+    bool update(std::uint32_t key, const Rect& bounds, const T& data) {
+        if (!_bounds.contains(bounds)) {
+            remove(key);
+            return false;
+        }
+        if (key >= _items.size()) {
+            _items.resize(static_cast<size_t>(key) + 1);
+        }
+
+        Item& item = _items[key];
+        item.data = data;
+        if (item.node != kNone) {
+            if (item.bounds == bounds) {
+                return true;
+            }
+            item.bounds = bounds;
+            if (findNode(bounds) == item.node) {
+                return true;
+            }
+            const std::uint32_t previous = item.node;
+            unlink(key);
+            merge(previous);
+        } else {
+            item.bounds = bounds;
+            ++_size;
+        }
+
+        const std::uint32_t target = findNode(bounds);
+        link(key, target);
+        split(target);
+        return true;
+    }
+
+    /**
+     * @brief Removes an object.
+     * @return true if the object was in the tree
+     */
+    bool remove(std::uint32_t key) {
+        if (!contains(key)) {
+            return false;
+        }
+        const std::uint32_t previous = _items[key].node;
+        unlink(key);
+        --_size;
+        merge(previous);
+        return true;
+    }
+
+    /**
+     * @brief Removes every object for which pred(key, data) is true.
+     */
+    template <typename Pred>
+    void removeIf(Pred&& pred) {
+        for (std::uint32_t key = 0; key < _items.size(); ++key) {
+            if (_items[key].node != kNone && pred(key, _items[key].data)) {
+                remove(key);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether an object is in the tree.
+     */
+    [[nodiscard]] bool contains(std::uint32_t key) const noexcept {
+        return key < _items.size() && _items[key].node != kNone;
+    }
+
+    /**
+     * @brief Queries objects whose bounds intersect a range.
+     *
+     * @param range The query range
+     * @param found Vector to store found objects (output parameter)
+     */
+    void query(const Rect& range, std::vector<QuadTreeObject<T>>& found) const {
+        queryNode(0, range, found);
+    }
+
+    /**
+     * @brief Calls visit(dataA, dataB) once for every pair of objects whose
+     *        bounds intersect.
+     */
+    template <typename Visit>
+    void forEachPair(Visit&& visit) const {
+        for (std::uint32_t index = 0; index < _nodes.size(); ++index) {
+            for (std::uint32_t key = _nodes[index].head; key != kNone;
+                 key = _items[key].next) {
+                pairsOf(index, key, visit);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes every object and collapses the tree to its root.
+     */
+    void clear() {
+        _nodes.assign(1, Node{_bounds});
+        _freeBlocks.clear();
+        _items.clear();
+        _size = 0;
+        _nodeCount = 1;
+    }
+
+    /**
+     * @brief Gets the number of objects in the tree.
+     */
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+
+    /**
+     * @brief Gets the number of nodes in use (including the root).
+     */
+    [[nodiscard]] size_t getNodeCount() const noexcept { return _nodeCount; }
+
+    /**
+     * @brief Gets the world bounds of the tree.
+     */
+    [[nodiscard]] const Rect& getBounds() const noexcept { return _bounds; }
+
+   private:
+    struct Node {
+        Rect bounds;
+        std::uint32_t parent{kNone};
+        std::uint32_t firstChild{kNone};  ///< NW, NE, SW, SE are contiguous
+        std::uint32_t head{kNone};        ///< First object of the node
+        std::uint32_t count{0};
+        std::uint32_t depth{0};
+    };
+
+    struct Item {
+        Rect bounds;
+        T data{};
+        std::uint32_t node{kNone};
+        std::uint32_t prev{kNone};
+        std::uint32_t next{kNone};
+    };
+
+    [[nodiscard]] static Rect looseBounds(const Rect& cell) noexcept {
+        return Rect{cell.x - cell.w * 0.5F, cell.y - cell.h * 0.5F,
+                    cell.w * 2.0F, cell.h * 2.0F};
+    }
+
+    /// Child of @p index that should hold @p bounds, or kNone
+    [[nodiscard]] std::uint32_t childFor(std::uint32_t index,
+                                         const Rect& bounds) const noexcept {
+        const Node& node = _nodes[index];
+        const float halfW = node.bounds.w * 0.5F;
+        const float halfH = node.bounds.h * 0.5F;
+        if (node.firstChild == kNone || bounds.w > halfW ||
+            bounds.h > halfH) {
+            return kNone;
+        }
+        const std::uint32_t east =
+            bounds.centerX() >= node.bounds.x + halfW ? 1 : 0;
+        const std::uint32_t south =
+            bounds.centerY() >= node.bounds.y + halfH ? 2 : 0;
+        return node.firstChild + east + south;
+    }
+
+    [[nodiscard]] std::uint32_t findNode(const Rect& bounds) const noexcept {
+        std::uint32_t index = 0;
+        for (std::uint32_t child = childFor(index, bounds); child != kNone;
+             child = childFor(index, bounds)) {
+            index = child;
+        }
+        return index;
+    }
+
+    void link(std::uint32_t key, std::uint32_t index) {
+        Item& item = _items[key];
+        Node& node = _nodes[index];
+        item.node = index;
+        item.prev = kNone;
+        item.next = node.head;
+        if (node.head != kNone) {
+            _items[node.head].prev = key;
+        }
+        node.head = key;
+        ++node.count;
+    }
+
+    void unlink(std::uint32_t key) {
+        Item& item = _items[key];
+        Node& node = _nodes[item.node];
+        if (item.prev != kNone) {
+            _items[item.prev].next = item.next;
+        } else {
+            node.head = item.next;
+        }
+        if (item.next != kNone) {
+            _items[item.next].prev = item.prev;
+        }
+        --node.count;
+        item.node = kNone;
+    }
+
+    /// Subdivides a crowded leaf and pushes down the objects that fit
+    void split(std::uint32_t index) {
+        if (_nodes[index].firstChild != kNone ||
+            _nodes[index].count <= _maxObjects ||
+            _nodes[index].depth >= _maxDepth) {
+            return;
+        }
+
+        std::uint32_t first = 0;
+        if (!_freeBlocks.empty()) {
+            first = _freeBlocks.back();
+            _freeBlocks.pop_back();
+        } else {
+            first = static_cast<std::uint32_t>(_nodes.size());
+            _nodes.resize(_nodes.size() + 4);
+        }
+        const Rect& b = _nodes[index].bounds;
+        const float halfW = b.w * 0.5F;
+        const float halfH = b.h * 0.5F;
+        const Rect cells[4] = {Rect{b.x, b.y, halfW, halfH},
+                               Rect{b.x + halfW, b.y, halfW, halfH},
+                               Rect{b.x, b.y + halfH, halfW, halfH},
+                               Rect{b.x + halfW, b.y + halfH, halfW, halfH}};
+        for (std::uint32_t i = 0; i < 4; ++i) {
+            _nodes[first + i] = Node{cells[i], index, kNone, kNone, 0,
+                                     _nodes[index].depth + 1};
+        }
+        _nodes[index].firstChild = first;
+        _nodeCount += 4;
+
+        for (std::uint32_t key = _nodes[index].head; key != kNone;) {
+            const std::uint32_t next = _items[key].next;
+            const std::uint32_t child = childFor(index, _items[key].bounds);
+            if (child != kNone) {
+                unlink(key);
+                link(key, child);
+            }
+            key = next;
+        }
+    }
+
+    /// Folds sparse leaves back into their parent, walking up from @p index
+    void merge(std::uint32_t index) {
+        std::uint32_t current = _nodes[index].firstChild == kNone
+                                    ? _nodes[index].parent
+                                    : index;
+        for (; current != kNone; current = _nodes[current].parent) {
+            const std::uint32_t first = _nodes[current].firstChild;
+            size_t total = _nodes[current].count;
+            for (std::uint32_t i = 0; i < 4; ++i) {
+                if (_nodes[first + i].firstChild != kNone) {
+                    return;
+                }
+                total += _nodes[first + i].count;
+            }
+            if (total > _maxObjects / 2) {
+                return;
+            }
+
+            for (std::uint32_t i = 0; i < 4; ++i) {
+                for (std::uint32_t key = _nodes[first + i].head;
+                     key != kNone;) {
+                    const std::uint32_t next = _items[key].next;
+                    unlink(key);
+                    link(key, current);
+                    key = next;
+                }
+            }
+            _nodes[current].firstChild = kNone;
+            _freeBlocks.push_back(first);
+            _nodeCount -= 4;
+        }
+    }
+
+    void queryNode(std::uint32_t index, const Rect& range,
+                   std::vector<QuadTreeObject<T>>& found) const {
+        const Node& node = _nodes[index];
+        if (!looseBounds(node.bounds).intersects(range)) {
+            return;
+        }
+        for (std::uint32_t key = node.head; key != kNone;
+             key = _items[key].next) {
+            if (_items[key].bounds.intersects(range)) {
+                found.emplace_back(_items[key].bounds, _items[key].data);
+            }
+        }
+        if (node.firstChild != kNone) {
+            for (std::uint32_t i = 0; i < 4; ++i) {
+                queryNode(node.firstChild + i, range, found);
+            }
+        }
+    }
+
+    /**
+     * @brief Reports each pair of @p key (stored in node @p home) once
+     *
+     * - Objects after it in @p home
+     * - Objects below @p home (those above report it themselves)
+     * - Objects in other branches, through the later siblings of @p home
+     *   and of each of its ancestors; loose cells overlap, so a pair can
+     *   sit in cells that are not nested. The earlier sibling's objects
+     *   report it.
+     */
+    template <typename Visit>
+    void pairsOf(std::uint32_t home, std::uint32_t key, Visit& visit) const {
+        const Item& item = _items[key];
+        for (std::uint32_t other = item.next; other != kNone;
+             other = _items[other].next) {
+            if (_items[other].bounds.intersects(item.bounds)) {
+                visit(item.data, _items[other].data);
+            }
+        }
+        if (_nodes[home].firstChild != kNone) {
+            for (std::uint32_t i = 0; i < 4; ++i) {
+                pairsInSubtree(_nodes[home].firstChild + i, item, visit);
+            }
+        }
+        for (std::uint32_t node = home; _nodes[node].parent != kNone;
+             node = _nodes[node].parent) {
+            const std::uint32_t first = _nodes[_nodes[node].parent].firstChild;
+            for (std::uint32_t sibling = node + 1; sibling < first + 4;
+                 ++sibling) {
+                pairsInSubtree(sibling, item, visit);
+            }
+        }
+    }
+
+    template <typename Visit>
+    void pairsInSubtree(std::uint32_t index, const Item& item,
+                        Visit& visit) const {
+        const Node& node = _nodes[index];
+        if (!looseBounds(node.bounds).intersects(item.bounds)) {
+            return;
+        }
+        for (std::uint32_t other = node.head; other != kNone;
+             other = _items[other].next) {
+            if (_items[other].bounds.intersects(item.bounds)) {
+                visit(item.data, _items[other].data);
+            }
+        }
+        if (node.firstChild != kNone) {
+            for (std::uint32_t i = 0; i < 4; ++i) {
+                pairsInSubtree(node.firstChild + i, item, visit);
+            }
+        }
+    }
+
+    Rect _bounds;
+    size_t _maxObjects;
+    size_t _maxDepth;
+    std::vector<Node> _nodes;  ///< Arena; children come in blocks of four
+    std::vector<std::uint32_t> _freeBlocks;
+    std::vector<Item> _items;  ///< Indexed by key
+    size_t _size{0};
+    size_t _nodeCount{1};
+};
+
+}  // namespace rtype::games::rtype::shared::collision
@@ -7,83 +7,122 @@
 
 #include "QuadTreeSystem.hpp"
 
-#include <unordered_set>
-
 namespace rtype::games::rtype::shared {
 
 QuadTreeSystem::QuadTreeSystem(const collision::Rect& worldBounds,
-                               size_t maxObjects, size_t maxDepth)
+                               size_t maxObjects, size_t maxDepth,
+                               BroadphaseBackend backend)
     : ASystem("QuadTreeSystem"),
       _worldBounds(worldBounds),
       _maxObjects(maxObjects),
       _maxDepth(maxDepth),
-      _quadTree(nullptr) {}
+      _backend(backend),
+      _quadTree(nullptr),
+      _sweepAndPrune(nullptr) {}
 
 void QuadTreeSystem::update(ECS::Registry& registry, float /*deltaTime*/) {
-    _quadTree = std::make_unique<collision::QuadTree<uint32_t>>(
-        _worldBounds, _maxObjects, _maxDepth);
-    auto view = registry.view<TransformComponent, BoundingBoxComponent>();
-
-    view.each([this](ECS::Entity entity, const TransformComponent& transform,
-                     const BoundingBoxComponent& bbox) {
-        collision::Rect bounds = createRectFromComponents(transform, bbox);
-        collision::QuadTreeObject<uint32_t> obj(bounds, entity.id);
-        _quadTree->insert(obj);
-    });
-}
-
-std::vector<CollisionPair> QuadTreeSystem::queryCollisionPairs(
-    ECS::Registry& registry) const {
-    std::vector<CollisionPair> pairs;
-
-    if (!_quadTree) {
-        return pairs;
+    if (_backend == BroadphaseBackend::SweepAndPrune) {
+        if (!_sweepAndPrune) {
+            _sweepAndPrune =
+                std::make_unique<collision::SweepAndPrune<BroadphaseProxy>>();
+        }
+        sync(registry, *_sweepAndPrune);
+        _sweepAndPrune->sort();
+        return;
+    }
+    if (!_quadTree || _quadTree->getBounds() != _worldBounds) {
+        _quadTree = std::make_unique<collision::LooseQuadTree<BroadphaseProxy>>(
+            _worldBounds, _maxObjects, _maxDepth);
     }
-    std::unordered_set<uint64_t> checkedPairs;
+    sync(registry, *_quadTree);
+}
 
+template <typename Broadphase>
+void QuadTreeSystem::sync(ECS::Registry& registry, Broadphase& broadphase) {
+    const uint32_t frame = ++_frame;
     auto view = registry.view<TransformComponent, BoundingBoxComponent>();
 
-    view.each([this, &pairs, &checkedPairs](ECS::Entity entity,
-                                            const TransformComponent& transform,
-                                            const BoundingBoxComponent& bbox) {
+    view.each([this, frame, &broadphase, &registry](
+                  ECS::Entity entity, const TransformComponent& transform,
+                  const BoundingBoxComponent& bbox) {
         collision::Rect bounds = createRectFromComponents(transform, bbox);
-
-        std::vector<collision::QuadTreeObject<uint32_t>> nearby;
-        _quadTree->query(bounds, nearby);
-
-        for (const auto& other : nearby) {
-            if (other.data == entity.id) {
-                continue;
+        // Fast movers cover their whole path since the last frame, unless
+        // that path leaves the world (then only where they are now)
+        if (registry.hasComponent<SweptColliderComponent>(entity)) {
+            const auto& swept =
+                registry.getComponent<SweptColliderComponent>(entity);
+            if (swept.hasPrevious) {
+                const collision::Rect path =
+                    bounds.merged(createRectFromComponents(
+                        TransformComponent{swept.prevX, swept.prevY}, bbox));
+                if (_worldBounds.contains(path)) {
+                    bounds = path;
+                }
             }
-            uint32_t minId = std::min(entity.id, other.data);
-            uint32_t maxId = std::max(entity.id, other.data);
-            uint64_t pairKey = (static_cast<uint64_t>(minId) << 32) | maxId;
-
-            if (checkedPairs.find(pairKey) != checkedPairs.end()) {
-                continue;
-            }
-            checkedPairs.insert(pairKey);
-            pairs.emplace_back(entity, ECS::Entity{other.data});
         }
+        const uint32_t index = entity.index();
+        // Same world rule for both backends; the tree enforces it itself
+        if (!_worldBounds.contains(bounds)) {
+            return;
+        }
+        BroadphaseProxy proxy{entity.id, {}};
+        if (registry.hasComponent<CollisionLayerComponent>(entity)) {
+            proxy.layer =
+                registry.getComponent<CollisionLayerComponent>(entity);
+        }
+        broadphase.update(index, bounds, proxy);
+        if (index >= _seenFrame.size()) {
+            _seenFrame.resize(static_cast<size_t>(index) + 1, 0);
+        }
+        _seenFrame[index] = frame;
+    });
+
+    // Destroyed since last frame, lost a component or left the world
+    broadphase.removeIf([this, frame](uint32_t index,
+                                      const BroadphaseProxy& /*proxy*/) {
+        return _seenFrame[index] != frame;
     });
+}
 
+std::vector<CollisionPair> QuadTreeSystem::queryCollisionPairs(
+    ECS::Registry& /*registry*/) const {
+    std::vector<CollisionPair> pairs;
+    queryCollisionPairs(pairs);
     return pairs;
 }
 
+void QuadTreeSystem::queryCollisionPairs(
+    std::vector<CollisionPair>& pairs) const {
+    pairs.clear();
+    auto emit = [&pairs](const BroadphaseProxy& a, const BroadphaseProxy& b) {
+        if (!a.layer.canCollideWith(b.layer)) {
+            return;
+        }
+        pairs.emplace_back(ECS::Entity{a.id}, ECS::Entity{b.id},
+                           a.layer.category, b.layer.category);
+    };
+
+    if (_sweepAndPrune) {
+        _sweepAndPrune->forEachPair(emit);
+    } else if (_quadTree) {
+        _quadTree->forEachPair(emit);
+    }
+}
+
 std::vector<ECS::Entity> QuadTreeSystem::queryNearby(
     const collision::Rect& area) const {
     std::vector<ECS::Entity> result;
+    std::vector<collision::QuadTreeObject<BroadphaseProxy>> found;
 
-    if (!_quadTree) {
-        return result;
+    if (_sweepAndPrune) {
+        _sweepAndPrune->query(area, found);
+    } else if (_quadTree) {
+        _quadTree->query(area, found);
     }
 
-    std::vector<collision::QuadTreeObject<uint32_t>> found;
-    _quadTree->query(area, found);
-
     result.reserve(found.size());
     for (const auto& obj : found) {
-        result.push_back(ECS::Entity{obj.data});
+        result.push_back(ECS::Entity{obj.data.id});
     }
 
     return result;
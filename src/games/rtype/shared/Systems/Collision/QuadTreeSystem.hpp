@@ -8,26 +8,57 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <rtype/engine.hpp>
 
 #include "../../Components/BoundingBoxComponent.hpp"
+#include "../../Components/CollisionLayerComponent.hpp"
+#include "../../Components/SweptColliderComponent.hpp"
 #include "../../Components/TransformComponent.hpp"
-#include "QuadTree.hpp"
+#include "LooseQuadTree.hpp"
 #include "Rect.hpp"
+#include "SweepAndPrune.hpp"
 
 namespace rtype::games::rtype::shared {
 
+/**
+ * @enum BroadphaseBackend
+ * @brief Spatial structure used by QuadTreeSystem to find candidate pairs
+ */
+enum class BroadphaseBackend : uint8_t {
+    LooseQuadTree,  ///< Persistent loose quadtree (default)
+    SweepAndPrune   ///< Insertion-sorted sweep along X
+};
+
 /**
  * @struct CollisionPair
  * @brief Represents a pair of entities that are potentially colliding
+ *
+ * Carries both collision categories so the narrowphase can dispatch on
+ * them without looking tags up again (CollisionLayer::All if unlabelled).
  */
 struct CollisionPair {
     ECS::Entity entityA;
     ECS::Entity entityB;
+    uint16_t categoryA;
+    uint16_t categoryB;
+
+    CollisionPair(ECS::Entity a, ECS::Entity b,
+                  uint16_t catA = CollisionLayer::All,
+                  uint16_t catB = CollisionLayer::All)
+        : entityA(a), entityB(b), categoryA(catA), categoryB(catB) {}
+};
 
-    CollisionPair(ECS::Entity a, ECS::Entity b) : entityA(a), entityB(b) {}
+/**
+ * @struct BroadphaseProxy
+ * @brief What the broadphase stores beside each AABB
+ */
+struct BroadphaseProxy {
+    uint32_t id;
+    CollisionLayerComponent layer;
 };
 
 /**
@@ -35,16 +66,27 @@ struct CollisionPair {
  * @brief System that uses QuadTree spatial partitioning for optimized collision
  * detection
  *
- * This system builds a QuadTree each frame with all collidable entities and
- * provides efficient collision queries. Instead of O(n²) brute-force collision
- * checks, it reduces complexity to O(n log n) average case.
+ * This system keeps a LooseQuadTree of all collidable entities across
+ * frames and provides efficient collision queries. Instead of O(n²)
+ * brute-force collision checks, it reduces complexity to O(n log n) average
+ * case.
+ *
+ * Each update moves entities whose bounds changed, inserts new ones and
+ * drops the ones that were destroyed or left the world; entities that did
+ * not move cost a comparison. Entities are keyed by ECS index.
+ *
+ * The SweepAndPrune backend keeps the same entities sorted along X
+ * instead; it wins when colliders are spread horizontally, as in a
+ * side-scroller, and both backends report each pair exactly once.
+ *
+ * Pairs whose CollisionLayerComponent masks exclude each other are
+ * dropped before they are reported.
  *
- * The system rebuilds the QuadTree each frame to handle moving entities.
- * For static entities, consider using a separate static QuadTree that doesn't
- * rebuild.
+ * Entities with a SweptColliderComponent are stored with the box swept
+ * from their previous position, so pairs along their path are reported.
  *
  * Usage:
- * 1. Call update() each frame to rebuild the QuadTree
+ * 1. Call update() each frame to sync the QuadTree with the registry
  * 2. Use queryCollisionPairs() to get potential collision pairs
  * 3. Use queryNearby() to get entities near a specific point/area
  */
@@ -56,14 +98,15 @@ class QuadTreeSystem : public ::rtype::engine::ASystem {
      * @param worldBounds The bounds of the game world (default: 1920x1080)
      * @param maxObjects Maximum objects per QuadTree node before subdivision
      * @param maxDepth Maximum depth of the QuadTree
+     * @param backend Broadphase structure to maintain
      */
     explicit QuadTreeSystem(
         const collision::Rect& worldBounds = collision::Rect(0, 0, 1920, 1080),
-        size_t maxObjects = 10, size_t maxDepth = 5);
+        size_t maxObjects = 10, size_t maxDepth = 5,
+        BroadphaseBackend backend = BroadphaseBackend::LooseQuadTree);
 
     /**
-     * @brief Updates the QuadTree by rebuilding it with current entity
-     * positions
+     * @brief Updates the QuadTree with current entity positions
      *
      * @param registry ECS registry containing entities
      * @param deltaTime Time elapsed since last update (unused but required by
@@ -74,16 +117,27 @@ class QuadTreeSystem : public ::rtype::engine::ASystem {
     /**
      * @brief Queries all potential collision pairs in the current frame
      *
-     * This method returns pairs of entities whose bounding boxes may overlap.
+     * This method returns pairs of entities whose bounding boxes may overlap
+     * and whose collision layers accept each other.
      * Fine-grained collision detection (AABB overlap) should still be performed
      * on these pairs.
      *
-     * @param registry ECS registry for component access
+     * @param registry Unused; pairs use the bounds from the last update()
      * @return Vector of collision pairs to check
      */
     [[nodiscard]] std::vector<CollisionPair> queryCollisionPairs(
         ECS::Registry& registry) const;
 
+    /**
+     * @brief Fills a caller-owned buffer with the potential collision pairs
+     *
+     * The buffer is cleared first; reusing it across frames avoids a
+     * per-frame allocation.
+     *
+     * @param pairs Vector receiving the pairs (output parameter)
+     */
+    void queryCollisionPairs(std::vector<CollisionPair>& pairs) const;
+
     /**
      * @brief Queries entities near a specific area
      *
@@ -113,27 +167,37 @@ class QuadTreeSystem : public ::rtype::engine::ASystem {
     }
 
     /**
-     * @brief Sets new world bounds (will take effect on next update)
+     * @brief Sets new world bounds (the tree is rebuilt on next update)
      * @param bounds New world bounds
      */
     void setWorldBounds(const collision::Rect& bounds) noexcept {
         _worldBounds = bounds;
     }
 
+    /**
+     * @brief Gets the broadphase backend in use
+     */
+    [[nodiscard]] BroadphaseBackend getBackend() const noexcept {
+        return _backend;
+    }
+
     /**
      * @brief Gets statistics about the current QuadTree
-     * @return Number of nodes in the tree
+     * @return Number of nodes in the tree (0 with SweepAndPrune)
      */
     [[nodiscard]] size_t getNodeCount() const noexcept {
         return _quadTree ? _quadTree->getNodeCount() : 0;
     }
 
     /**
-     * @brief Gets the total number of entities in the QuadTree
+     * @brief Gets the total number of entities in the broadphase
      * @return Number of entities
      */
     [[nodiscard]] size_t getEntityCount() const noexcept {
-        return _quadTree ? _quadTree->totalSize() : 0;
+        if (_sweepAndPrune) {
+            return _sweepAndPrune->size();
+        }
+        return _quadTree ? _quadTree->size() : 0;
     }
 
    private:
@@ -147,10 +211,21 @@ class QuadTreeSystem : public ::rtype::engine::ASystem {
     [[nodiscard]] static collision::Rect createRectFromComponents(
         const TransformComponent& transform, const BoundingBoxComponent& bbox);
 
+    /**
+     * @brief Upserts every collidable entity into a backend and drops the
+     *        ones that were not seen this frame
+     */
+    template <typename Broadphase>
+    void sync(ECS::Registry& registry, Broadphase& broadphase);
+
     collision::Rect _worldBounds;
     size_t _maxObjects;
     size_t _maxDepth;
-    std::unique_ptr<collision::QuadTree<uint32_t>> _quadTree;
+    BroadphaseBackend _backend;
+    std::unique_ptr<collision::LooseQuadTree<BroadphaseProxy>> _quadTree;
+    std::unique_ptr<collision::SweepAndPrune<BroadphaseProxy>> _sweepAndPrune;
+    std::vector<uint32_t> _seenFrame;  ///< Last update() that saw an index
+    uint32_t _frame{0};
 };
 
 }  // namespace rtype::games::rtype::shared
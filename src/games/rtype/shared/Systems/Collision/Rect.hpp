@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <compare>
 
 namespace rtype::games::rtype::shared::collision {
@@ -129,6 +130,18 @@ struct Rect {
         return px >= left() && px <= right() && py >= top() && py <= bottom();
     }
 
+    /**
+     * @brief Smallest rectangle covering this one and another.
+     * @param other The other rectangle
+     * @return The bounding rectangle of both
+     */
+    [[nodiscard]] constexpr Rect merged(const Rect& other) const noexcept {
+        const float l = std::min(left(), other.left());
+        const float t = std::min(top(), other.top());
+        return Rect(l, t, std::max(right(), other.right()) - l,
+                    std::max(bottom(), other.bottom()) - t);
+    }
+
     /**
      * @brief Equality comparison operator.
      */
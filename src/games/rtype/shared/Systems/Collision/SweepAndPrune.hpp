@@ -0,0 +1,207 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** SweepAndPrune - Sort-and-sweep broadphase along the X axis
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "QuadTree.hpp"
+#include "Rect.hpp"
+
+namespace rtype::games::rtype::shared::collision {
+
+/**
+ * @class SweepAndPrune
+ * @brief Broadphase that keeps objects sorted by their left edge.
+ *
+ * The array survives across frames and is re-sorted with an insertion
+ * sort: in a side-scroller objects barely change order from one frame to
+ * the next, so a sort is close to one pass. Pairs are found by sweeping
+ * the array and only looking ahead while the next left edge is within the
+ * current right edge, so each pair is seen exactly once without any
+ * deduplication.
+ *
+ * Usage: update()/remove() the objects, sort() once, then forEachPair()
+ * and query(). Both stay correct before sort(), only slower.
+ *
+ * @tparam T The type of data associated with stored objects
+ */
+template <typename T>
+class SweepAndPrune {
+   public:
+    static constexpr std::uint32_t kNone =
+        std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Inserts or moves an object.
+     *
+     * @param key Dense identifier of the object
+     * @param bounds Current bounds of the object
+     * @param data Data returned by queries
+     */
+    void update(std::uint32_t key, const Rect& bounds, const T& data) {
+        if (key >= _position.size()) {
+            _position.resize(static_cast<size_t>(key) + 1, kNone);
+        }
+        if (_position[key] == kNone) {
+            _position[key] = static_cast<std::uint32_t>(_entries.size());
+            _entries.push_back(Entry{bounds, data, key});
+            ++_size;
+            _sorted = false;
+            return;
+        }
+        Entry& entry = _entries[_position[key]];
+        entry.data = data;
+        if (entry.bounds.x != bounds.x) {
+            _sorted = false;
+        }
+        entry.bounds = bounds;
+    }
+
+    /**
+     * @brief Removes an object (its slot is reclaimed by the next sort()).
+     * @return true if the object was present
+     */
+    bool remove(std::uint32_t key) {
+        if (!contains(key)) {
+            return false;
+        }
+        _entries[_position[key]].key = kNone;
+        _position[key] = kNone;
+        --_size;
+        _sorted = false;
+        return true;
+    }
+
+    /**
+     * @brief Removes every object for which pred(key, data) is true.
+     */
+    template <typename Pred>
+    void removeIf(Pred&& pred) {
+        for (const Entry& entry : _entries) {
+            if (entry.key != kNone && pred(entry.key, entry.data)) {
+                remove(entry.key);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether an object is present.
+     */
+    [[nodiscard]] bool contains(std::uint32_t key) const noexcept {
+        return key < _position.size() && _position[key] != kNone;
+    }
+
+    /**
+     * @brief Drops removed slots and restores the left-edge order.
+     *
+     * Insertion sort: O(n) when the order barely changed since last frame.
+     */
+    void sort() {
+        if (_sorted) {
+            return;
+        }
+        size_t live = 0;
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (_entries[i].key == kNone) {
+                continue;
+            }
+            Entry entry = std::move(_entries[i]);
+            size_t j = live;
+            while (j > 0 && _entries[j - 1].bounds.x > entry.bounds.x) {
+                _entries[j] = std::move(_entries[j - 1]);
+                _position[_entries[j].key] = static_cast<std::uint32_t>(j);
+                --j;
+            }
+            _position[entry.key] = static_cast<std::uint32_t>(j);
+            _entries[j] = std::move(entry);
+            ++live;
+        }
+        _entries.resize(live);
+        _sorted = true;
+    }
+
+    /**
+     * @brief Queries objects whose bounds intersect a range.
+     *
+     * @param range The query range
+     * @param found Vector to store found objects (output parameter)
+     */
+    void query(const Rect& range,
+               std::vector<QuadTreeObject<T>>& found) const {
+        for (const Entry& entry : _entries) {
+            if (_sorted && entry.bounds.x > range.right()) {
+                break;
+            }
+            if (entry.key != kNone && entry.bounds.intersects(range)) {
+                found.emplace_back(entry.bounds, entry.data);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls visit(dataA, dataB) once for every pair of objects whose
+     *        bounds intersect, in left-edge order.
+     */
+    template <typename Visit>
+    void forEachPair(Visit&& visit) const {
+        const size_t count = _entries.size();
+        for (size_t i = 0; i < count; ++i) {
+            const Entry& entry = _entries[i];
+            if (entry.key == kNone) {
+                continue;
+            }
+            const float right = entry.bounds.right();
+            for (size_t j = _sorted ? i + 1 : 0; j < count; ++j) {
+                const Entry& other = _entries[j];
+                if (_sorted && other.bounds.x > right) {
+                    break;
+                }
+                if (other.key == kNone ||
+                    (!_sorted && other.key <= entry.key)) {
+                    continue;
+                }
+                if (entry.bounds.intersects(other.bounds)) {
+                    visit(entry.data, other.data);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Removes every object.
+     */
+    void clear() {
+        _entries.clear();
+        _position.clear();
+        _size = 0;
+        _sorted = true;
+    }
+
+    /**
+     * @brief Gets the number of objects.
+     */
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+
+   private:
+    struct Entry {
+        Rect bounds;
+        T data;
+        std::uint32_t key;  ///< kNone once removed
+    };
+
+    std::vector<Entry> _entries;           ///< By left edge after sort()
+    std::vector<std::uint32_t> _position;  ///< Key -> index in _entries
+    size_t _size{0};
+    bool _sorted{true};
+};
+
+}  // namespace rtype::games::rtype::shared::collision
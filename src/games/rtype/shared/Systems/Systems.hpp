@@ -15,3 +15,4 @@
 #include "Movements/MovementSystem.hpp"
 #include "PowerUp/PowerUpSystem.hpp"
 #include "Projectile/ProjectileSystem.hpp"
+#include "Targeting/TargetIndexSystem.hpp"
@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** PlayerTargetIndex - Per-tick snapshot of players implementation
+*/
+
+#include "PlayerTargetIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../Components/NetworkIdComponent.hpp"
+#include "../../Components/Tags.hpp"
+#include "../../Components/TransformComponent.hpp"
+
+namespace rtype::games::rtype::shared {
+
+void PlayerTargetIndex::rebuild(ECS::Registry& registry) {
+    _players.clear();
+    auto view = registry.view<PlayerTag, TransformComponent>();
+    view.each([this, &registry](ECS::Entity entity, const PlayerTag& /*tag*/,
+                                const TransformComponent& transform) {
+        uint32_t networkId = INVALID_NETWORK_ID;
+        if (registry.hasComponent<NetworkIdComponent>(entity)) {
+            networkId =
+                registry.getComponent<NetworkIdComponent>(entity).networkId;
+        }
+        _players.push_back({entity, networkId, transform.x, transform.y});
+    });
+    std::sort(_players.begin(), _players.end(),
+              [](const PlayerTarget& a, const PlayerTarget& b) {
+                  if (a.networkId != b.networkId) {
+                      return a.networkId < b.networkId;
+                  }
+                  return a.entity.id < b.entity.id;
+              });
+}
+
+const PlayerTarget* PlayerTargetIndex::nearest(float x,
+                                               float y) const noexcept {
+    const PlayerTarget* best = nullptr;
+    float bestDist2 = std::numeric_limits<float>::max();
+    for (const auto& player : _players) {
+        const float dx = player.x - x;
+        const float dy = player.y - y;
+        const float dist2 = dx * dx + dy * dy;
+        if (dist2 < bestDist2) {
+            bestDist2 = dist2;
+            best = &player;
+        }
+    }
+    return best;
+}
+
+const PlayerTarget* PlayerTargetIndex::findByNetworkId(
+    uint32_t networkId) const noexcept {
+    if (networkId == INVALID_NETWORK_ID) {
+        return nullptr;
+    }
+    auto it = std::lower_bound(
+        _players.begin(), _players.end(), networkId,
+        [](const PlayerTarget& player, uint32_t id) {
+            return player.networkId < id;
+        });
+    if (it == _players.end() || it->networkId != networkId) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+void PlayerTargetIndex::inRadius(float x, float y, float radius,
+                                 std::vector<const PlayerTarget*>& out) const {
+    const float radius2 = radius * radius;
+    for (const auto& player : _players) {
+        const float dx = player.x - x;
+        const float dy = player.y - y;
+        if (dx * dx + dy * dy <= radius2) {
+            out.push_back(&player);
+        }
+    }
+}
+
+const PlayerTarget* PlayerTargetIndex::firstInLine(
+    float x, float y, float dirX, float dirY, float halfWidth,
+    float range) const noexcept {
+    const float length = std::sqrt(dirX * dirX + dirY * dirY);
+    if (length <= 0.0F) {
+        return nullptr;
+    }
+    const float ux = dirX / length;
+    const float uy = dirY / length;
+
+    const PlayerTarget* best = nullptr;
+    float bestAlong = std::numeric_limits<float>::max();
+    for (const auto& player : _players) {
+        const float dx = player.x - x;
+        const float dy = player.y - y;
+        const float along = dx * ux + dy * uy;
+        if (along < 0.0F || along > range || along >= bestAlong) {
+            continue;
+        }
+        const float across = std::abs(dx * uy - dy * ux);
+        if (across <= halfWidth) {
+            bestAlong = along;
+            best = &player;
+        }
+    }
+    return best;
+}
+
+const PlayerTargetIndex& PlayerTargetIndex::current(
+    ECS::Registry& registry, PlayerTargetIndex& scratch) {
+    if (registry.hasSingleton<PlayerTargetIndex>()) {
+        return registry.getSingleton<PlayerTargetIndex>();
+    }
+    scratch.rebuild(registry);
+    return scratch;
+}
+
+}  // namespace rtype::games::rtype::shared
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** PlayerTargetIndex - Per-tick snapshot of players for targeting queries
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <rtype/ecs.hpp>
+
+namespace rtype::games::rtype::shared {
+
+/**
+ * @brief One player as seen by the targeting queries
+ */
+struct PlayerTarget {
+    ECS::Entity entity;
+    uint32_t networkId;  ///< INVALID_NETWORK_ID if the player has none
+    float x;
+    float y;
+};
+
+/**
+ * @class PlayerTargetIndex
+ * @brief Player positions and ids gathered once per tick
+ *
+ * Chase AI, enemy aiming, boss targeting and force pods all need "where
+ * are the players". Instead of each of them walking a player view, the
+ * TargetIndexSystem fills this index once after movement and publishes it
+ * as a registry singleton; consumers go through current().
+ *
+ * Players are kept sorted by network id, so lookups by id are a binary
+ * search and ties in nearest() always resolve to the same player.
+ */
+class PlayerTargetIndex {
+   public:
+    /**
+     * @brief Refills the index from every PlayerTag + TransformComponent
+     * @param registry ECS registry
+     */
+    void rebuild(ECS::Registry& registry);
+
+    void clear() noexcept { _players.clear(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _players.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return _players.size(); }
+    [[nodiscard]] std::span<const PlayerTarget> players() const noexcept {
+        return _players;
+    }
+
+    /**
+     * @brief Closest player to a point
+     * @return nullptr if there are no players
+     */
+    [[nodiscard]] const PlayerTarget* nearest(float x, float y) const noexcept;
+
+    /**
+     * @brief Player owning a network id
+     * @return nullptr if no indexed player has that id
+     */
+    [[nodiscard]] const PlayerTarget* findByNetworkId(
+        uint32_t networkId) const noexcept;
+
+    /**
+     * @brief Appends every player within radius of a point
+     * @param out Receives the players, in index order
+     */
+    void inRadius(float x, float y, float radius,
+                  std::vector<const PlayerTarget*>& out) const;
+
+    /**
+     * @brief First player a shot fired from (x, y) along (dirX, dirY) meets
+     *
+     * @param halfWidth Half the width of the line of fire
+     * @param range How far the shot travels
+     * @return Player closest to the muzzle inside the corridor, or nullptr
+     */
+    [[nodiscard]] const PlayerTarget* firstInLine(float x, float y, float dirX,
+                                                  float dirY, float halfWidth,
+                                                  float range) const noexcept;
+
+    /**
+     * @brief The index published for this tick, or a fresh one
+     *
+     * Returns the registry singleton when TargetIndexSystem runs; otherwise
+     * rebuilds scratch from the registry so systems also work on their own
+     * (tests, tools).
+     */
+    [[nodiscard]] static const PlayerTargetIndex& current(
+        ECS::Registry& registry, PlayerTargetIndex& scratch);
+
+   private:
+    std::vector<PlayerTarget> _players;
+};
+
+}  // namespace rtype::games::rtype::shared
@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** TargetIndexSystem - Publishes the per-tick PlayerTargetIndex implementation
+*/
+
+#include "TargetIndexSystem.hpp"
+
+namespace rtype::games::rtype::shared {
+
+void TargetIndexSystem::update(ECS::Registry& registry, float /*deltaTime*/) {
+    if (!registry.hasSingleton<PlayerTargetIndex>()) {
+        registry.setSingleton<PlayerTargetIndex>();
+    }
+    registry.getSingleton<PlayerTargetIndex>().rebuild(registry);
+}
+
+}  // namespace rtype::games::rtype::shared
@@ -0,0 +1,37 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** TargetIndexSystem - Publishes the per-tick PlayerTargetIndex
+*/
+
+#pragma once
+
+#include <rtype/engine.hpp>
+
+#include "PlayerTargetIndex.hpp"
+
+namespace rtype::games::rtype::shared {
+
+/**
+ * @class TargetIndexSystem
+ * @brief Rebuilds the PlayerTargetIndex registry singleton
+ *
+ * Runs once per tick right after movement. Systems scheduled later in the
+ * tick see this tick's player positions; systems scheduled before movement
+ * (AI, enemy shooting) see the previous tick's, which is where the players
+ * start this tick.
+ */
+class TargetIndexSystem : public ::rtype::engine::ASystem {
+   public:
+    TargetIndexSystem() : ASystem("TargetIndexSystem") {}
+
+    /**
+     * @brief Refill the index from the current player positions
+     * @param registry ECS registry containing entities
+     * @param deltaTime Unused
+     */
+    void update(ECS::Registry& registry, float deltaTime) override;
+};
+
+}  // namespace rtype::games::rtype::shared
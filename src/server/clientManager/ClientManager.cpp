@@ -143,7 +143,7 @@ void ClientManager::registerClient(ClientId clientId,
                      .state = ClientState::Connected};
 
     _clients.emplace(clientId, newClient);
-    _endpointToClient.emplace(endpoint, clientId);
+    _endpointToClient.emplace(network::EndpointKey::from(endpoint), clientId);
     if (auto metrics = _metrics.lock()) {
         metrics->totalConnections.fetch_add(1, std::memory_order_relaxed);
     }
@@ -179,7 +179,7 @@ void ClientManager::handleClientDisconnectInternal(
 void ClientManager::removeClientFromMaps(ClientId clientId,
                                          const Endpoint& endpoint) noexcept {
     _clients.erase(clientId);
-    _endpointToClient.erase(endpoint);
+    _endpointToClient.erase(network::EndpointKey::from(endpoint));
 }
 
 void ClientManager::updateClientActivity(ClientId clientId) noexcept {
@@ -198,7 +198,8 @@ ClientId ClientManager::findClientByEndpoint(
 
 ClientId ClientManager::findClientByEndpointInternal(
     const Endpoint& endpoint) const noexcept {
-    if (const auto it = _endpointToClient.find(endpoint);
+    if (const auto it =
+            _endpointToClient.find(network::EndpointKey::from(endpoint));
         it != _endpointToClient.end()) {
         return it->second;
     }
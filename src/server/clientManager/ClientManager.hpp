@@ -18,6 +18,7 @@
 #include <rtype/common.hpp>
 
 #include "Client.hpp"
+#include "core/EndpointKey.hpp"
 #include "server/shared/BanManager.hpp"
 #include "server/shared/ServerMetrics.hpp"
 
@@ -240,7 +241,9 @@ class ClientManager {
     bool _verbose;                          ///< Enable verbose debug output
 
     std::unordered_map<ClientId, Client> _clients;
-    std::unordered_map<Endpoint, ClientId> _endpointToClient;
+    /// Keyed by EndpointKey: lookups hash a fixed-size key, not the address
+    /// string
+    std::unordered_map<network::EndpointKey, ClientId> _endpointToClient;
     mutable std::shared_mutex _clientsMutex;
 
     /// @brief Next client ID to assign (starts at FIRST_VALID_CLIENT_ID)
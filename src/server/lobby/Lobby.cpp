@@ -45,12 +45,23 @@ bool Lobby::start() {
             shutdownFlagPtr_, 10, false, banManager_);
 
         serverApp_->setLobbyCode(code_);
+        serverApp_->setSnapshotReplication(config_.snapshotReplication);
+        serverApp_->setJitterMeasurement(config_.measureJitter);
+        serverApp_->setCompressionDictionaries(config_.compressionDictionaries);
         if (!config_.levelId.empty()) {
             serverApp_->setLevel(config_.levelId);
         }
         if (lobbyManager_) {
             serverApp_->setLobbyManager(lobbyManager_);
         }
+        if (config_.frontend) {
+            serverApp_->setSharedFrontend(config_.frontend,
+                                          config_.frontendSlot);
+        }
+
+        if (config_.scheduler) {
+            return startScheduled();
+        }
 
         rtype::Logger::instance().info(std::format(
             "ServerApp created, starting thread for lobby {}...", code_));
@@ -81,6 +92,35 @@ bool Lobby::start() {
     }
 }
 
+bool Lobby::startScheduled() {
+    // The id only exists once the task is added, after startStepped()
+    auto taskId = std::make_shared<std::atomic<LobbyScheduler::TaskId>>(0);
+    serverApp_->setLoopWakeHandler(
+        [scheduler = config_.scheduler, taskId]() {
+            if (const auto id = taskId->load()) {
+                scheduler->wake(id);
+            }
+        });
+
+    if (!serverApp_->startStepped()) {
+        rtype::Logger::instance().error(
+            std::format("Lobby {} failed to initialize", code_));
+        serverApp_.reset();
+        return false;
+    }
+
+    schedulerTask_ = config_.scheduler->add(
+        [app = serverApp_.get()]() { return app->step(); });
+    taskId->store(*schedulerTask_);
+
+    actualPort_ = config_.port;
+    running_ = true;
+    rtype::Logger::instance().info(
+        std::format("Lobby {} scheduled on the worker pool (port {})", code_,
+                    actualPort_));
+    return true;
+}
+
 void Lobby::stop() {
     if (!running_) {
         return;
@@ -93,6 +133,13 @@ void Lobby::stop() {
     if (thread_ && thread_->joinable()) {
         thread_->join();
     }
+    if (schedulerTask_) {
+        // The next step sees the flag, shuts the server down and finishes;
+        // wake it in case the lobby is hibernating
+        config_.scheduler->wake(*schedulerTask_);
+        config_.scheduler->wait(*schedulerTask_);
+        schedulerTask_.reset();
+    }
 
     serverApp_.reset();
     thread_.reset();
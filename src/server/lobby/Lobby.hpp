@@ -10,20 +10,27 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 
+#include "server/lobby/LobbyScheduler.hpp"
 #include "server/serverApp/ServerApp.hpp"
 
 namespace rtype::server {
 
 class LobbyManager;
+class SharedUdpFrontend;
 
 /**
  * @brief Represents a single game lobby instance
  *
  * Each Lobby wraps a ServerApp instance and runs it in a dedicated thread.
  * Lobbies are identified by a unique code and listen on a specific port.
+ *
+ * When the manager runs in shared-socket mode, the lobby instead receives
+ * its traffic through a SharedUdpFrontend slot and its loop is stepped by
+ * a LobbyScheduler worker pool, so it owns neither a port nor a thread.
  */
 class Lobby {
    public:
@@ -36,8 +43,17 @@ class Lobby {
         std::uint32_t tickRate{60};
         std::string configPath{"config/server"};
         std::chrono::seconds emptyTimeout{
-            300};                        ///< Time to keep empty lobby alive
-        std::string levelId{"level_1"};  ///< Level to load
+            300};                         ///< Time to keep empty lobby alive
+        std::string levelId{"level_1"};   ///< Level to load
+        bool snapshotReplication{false};  ///< Delta snapshot replication
+        bool measureJitter{false};        ///< Tick jitter metrics
+        /// LZ4 dictionaries offered to clients, nullptr disables them
+        std::shared_ptr<const network::DictionarySet> compressionDictionaries;
+        /// Shared front-door socket, nullptr to bind `port` directly
+        SharedUdpFrontend* frontend{nullptr};
+        std::size_t frontendSlot{0};  ///< Route slot on `frontend`
+        /// Worker pool stepping the loop, nullptr for a dedicated thread
+        LobbyScheduler* scheduler{nullptr};
     };
 
     /**
@@ -166,6 +182,11 @@ class Lobby {
      */
     void run();
 
+    /**
+     * @brief Initialize the server and hand its loop to config_.scheduler
+     */
+    bool startScheduled();
+
     std::string code_;
     Config config_;
     std::uint16_t actualPort_{0};  ///< Actual port after binding
@@ -173,6 +194,7 @@ class Lobby {
     std::shared_ptr<std::atomic<bool>> shutdownFlagPtr_;
     std::unique_ptr<ServerApp> serverApp_;
     std::unique_ptr<std::thread> thread_;
+    std::optional<LobbyScheduler::TaskId> schedulerTask_;
 
     std::atomic<bool> running_{false};
     std::chrono::steady_clock::time_point lastActivity_;
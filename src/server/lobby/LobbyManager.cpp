@@ -68,19 +68,30 @@ bool LobbyManager::start() {
 
     std::lock_guard<std::mutex> lock(lobbiesMutex_);
 
+    if (config_.sharedSocket) {
+        const std::uint16_t sharedPort = config_.basePort + 1;
+        frontend_ = std::make_unique<SharedUdpFrontend>();
+        if (!frontend_->start(sharedPort)) {
+            rtype::Logger::instance().error(std::format(
+                "Failed to open shared lobby socket on port {}", sharedPort));
+            frontend_.reset();
+            return false;
+        }
+        scheduler_ = std::make_unique<LobbyScheduler>(config_.workerThreads);
+    }
+
     for (std::uint32_t i = 0; i < config_.instanceCount; ++i) {
         std::string code = generateLobbyCode();
         std::uint16_t port = config_.basePort + 1 + i;
 
-        Lobby::Config lobbyConfig;
-        lobbyConfig.port = port;
-        lobbyConfig.maxPlayers = config_.maxPlayers;
-        lobbyConfig.tickRate = config_.tickRate;
-        lobbyConfig.configPath = config_.configPath;
-        lobbyConfig.emptyTimeout = config_.emptyTimeout;
+        auto lobbyConfig = makeLobbyConfig(port);
+        if (!lobbyConfig) {
+            return false;
+        }
+        port = lobbyConfig->port;
 
         auto lobby =
-            std::make_unique<Lobby>(code, lobbyConfig, this, banManager_);
+            std::make_unique<Lobby>(code, *lobbyConfig, this, banManager_);
 
         if (!lobby->start()) {
             rtype::Logger::instance().error(
@@ -90,6 +101,8 @@ bool LobbyManager::start() {
             }
             lobbies_.clear();
             lobbyByCode_.clear();
+            scheduler_.reset();
+            frontend_.reset();
             return false;
         }
 
@@ -137,6 +150,16 @@ void LobbyManager::stop() {
     lobbies_.clear();
     lobbyByCode_.clear();
 
+    // Lobbies are gone, so no route or task refers to them any more
+    if (scheduler_) {
+        scheduler_->stop();
+        scheduler_.reset();
+    }
+    if (frontend_) {
+        frontend_->stop();
+        frontend_.reset();
+    }
+
     rtype::Logger::instance().info(std::format("Lobby manager stopped"));
 }
 
@@ -262,15 +285,15 @@ std::string LobbyManager::createLobby(bool isPrivate,
     std::uint16_t port =
         config_.basePort + 1 + static_cast<std::uint16_t>(lobbies_.size());
 
-    Lobby::Config lobbyConfig;
-    lobbyConfig.port = port;
-    lobbyConfig.maxPlayers = config_.maxPlayers;
-    lobbyConfig.tickRate = config_.tickRate;
-    lobbyConfig.configPath = config_.configPath;
-    lobbyConfig.emptyTimeout = config_.emptyTimeout;
-    lobbyConfig.levelId = levelId;
+    auto lobbyConfig = makeLobbyConfig(port);
+    if (!lobbyConfig) {
+        return "";
+    }
+    lobbyConfig->levelId = levelId;
+    port = lobbyConfig->port;
 
-    auto lobby = std::make_unique<Lobby>(code, lobbyConfig, this, banManager_);
+    auto lobby =
+        std::make_unique<Lobby>(code, *lobbyConfig, this, banManager_);
 
     if (!lobby->start()) {
         rtype::Logger::instance().error(
@@ -319,6 +342,44 @@ bool LobbyManager::deleteLobby(const std::string& code) {
     return true;
 }
 
+std::optional<Lobby::Config> LobbyManager::makeLobbyConfig(
+    std::uint16_t port) const {
+    Lobby::Config lobbyConfig;
+    lobbyConfig.port = port;
+    lobbyConfig.maxPlayers = config_.maxPlayers;
+    lobbyConfig.tickRate = config_.tickRate;
+    lobbyConfig.configPath = config_.configPath;
+    lobbyConfig.emptyTimeout = config_.emptyTimeout;
+    lobbyConfig.snapshotReplication = config_.snapshotReplication;
+    lobbyConfig.measureJitter = config_.measureJitter;
+    lobbyConfig.compressionDictionaries = config_.compressionDictionaries;
+
+    if (!frontend_) {
+        return lobbyConfig;
+    }
+
+    // Lowest slot no running lobby holds
+    std::size_t slot = 0;
+    while (slot < SharedUdpFrontend::kMaxRoutes &&
+           std::any_of(lobbies_.begin(), lobbies_.end(),
+                       [slot](const std::unique_ptr<Lobby>& l) {
+                           return l->getConfig().frontendSlot == slot;
+                       })) {
+        ++slot;
+    }
+    if (slot == SharedUdpFrontend::kMaxRoutes) {
+        rtype::Logger::instance().error(
+            std::format("No free shared socket slot for a new lobby"));
+        return std::nullopt;
+    }
+
+    lobbyConfig.port = frontend_->port();
+    lobbyConfig.frontend = frontend_.get();
+    lobbyConfig.frontendSlot = slot;
+    lobbyConfig.scheduler = scheduler_.get();
+    return lobbyConfig;
+}
+
 void LobbyManager::cleanupLoop() {
     rtype::Logger::instance().info(std::format("Cleanup thread started"));
 
@@ -12,12 +12,15 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "Lobby.hpp"
+#include "LobbyScheduler.hpp"
+#include "server/network/SharedUdpFrontend.hpp"
 
 namespace rtype::server {
 
@@ -27,6 +30,10 @@ namespace rtype::server {
  * The LobbyManager creates and manages N lobby instances, each running
  * on a separate port. It also runs a discovery service on the base port
  * that allows clients to query available lobbies.
+ *
+ * With Config::sharedSocket, every lobby is served from one socket on
+ * basePort + 1 (SharedUdpFrontend) and lobby loops run on a fixed
+ * LobbyScheduler pool instead of one thread each.
  */
 class LobbyManager {
    public:
@@ -41,6 +48,14 @@ class LobbyManager {
         std::string configPath{"config/server"};
         std::chrono::seconds emptyTimeout{300};  ///< Timeout for empty lobbies
         std::uint32_t maxInstances{16};          ///< Maximum allowed instances
+        bool snapshotReplication{false};         ///< Delta snapshot replication
+        bool measureJitter{false};               ///< Tick jitter metrics
+        /// LZ4 dictionaries offered to clients, nullptr disables them
+        std::shared_ptr<const network::DictionarySet> compressionDictionaries;
+        /// One front-door socket and a worker pool for all lobbies
+        bool sharedSocket{false};
+        /// Worker pool size in shared-socket mode, 0 for the core count
+        std::uint32_t workerThreads{0};
     };
 
     /**
@@ -183,6 +198,15 @@ class LobbyManager {
      */
     void discoveryLoop();
 
+    /**
+     * @brief Build the configuration of a new lobby
+     *
+     * In shared-socket mode this also reserves a frontend slot.
+     *
+     * @return nullopt if no slot is free
+     */
+    std::optional<Lobby::Config> makeLobbyConfig(std::uint16_t port) const;
+
     Config config_;  ///< Manager configuration
     std::vector<std::unique_ptr<Lobby>> lobbies_;
     std::map<std::string, Lobby*> lobbyByCode_;
@@ -195,6 +219,9 @@ class LobbyManager {
 
     class LobbyDiscoveryServer* discoveryServer_{nullptr};
 
+    std::unique_ptr<SharedUdpFrontend> frontend_;  ///< sharedSocket only
+    std::unique_ptr<LobbyScheduler> scheduler_;    ///< sharedSocket only
+
     std::mt19937 rng_;
     std::uniform_int_distribution<> charDist_;  ///< For code generation
 
@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** LobbyScheduler - Implementation
+*/
+
+#include "LobbyScheduler.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <utility>
+
+#include "Logger/Logger.hpp"
+
+namespace rtype::server {
+
+LobbyScheduler::LobbyScheduler(std::size_t workerCount)
+    : workerCount_(workerCount != 0
+                       ? workerCount
+                       : std::max<std::size_t>(
+                             1, std::thread::hardware_concurrency())) {
+    workers_.reserve(workerCount_);
+    for (std::size_t i = 0; i < workerCount_; ++i) {
+        workers_.emplace_back(&LobbyScheduler::workerLoop, this);
+    }
+    rtype::Logger::instance().info(
+        std::format("Lobby scheduler started with {} workers", workerCount_));
+}
+
+LobbyScheduler::~LobbyScheduler() { stop(); }
+
+LobbyScheduler::TaskId LobbyScheduler::add(StepFunction step) {
+    std::lock_guard lock(mutex_);
+    const TaskId id = nextId_++;
+    const auto now = Clock::now();
+    tasks_.emplace(id,
+                   Task{std::make_shared<StepFunction>(std::move(step)), now});
+    queue_.push({now, id});
+    wakeWorkers_.notify_one();
+    return id;
+}
+
+void LobbyScheduler::wake(TaskId id) {
+    std::lock_guard lock(mutex_);
+    auto it = tasks_.find(id);
+    if (it == tasks_.end() || stopping_) {
+        return;
+    }
+    Task& task = it->second;
+    if (task.running) {
+        task.wakePending = true;
+        return;
+    }
+    const auto now = Clock::now();
+    if (task.due <= now) {
+        return;
+    }
+    task.due = now;
+    queue_.push({now, id});
+    wakeWorkers_.notify_one();
+}
+
+void LobbyScheduler::wait(TaskId id) {
+    std::unique_lock lock(mutex_);
+    taskFinished_.wait(
+        lock, [this, id]() { return stopping_ || !tasks_.contains(id); });
+}
+
+void LobbyScheduler::stop() {
+    {
+        std::lock_guard lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    wakeWorkers_.notify_all();
+    taskFinished_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+
+    std::lock_guard lock(mutex_);
+    tasks_.clear();
+    queue_ = {};
+}
+
+std::size_t LobbyScheduler::taskCount() const {
+    std::lock_guard lock(mutex_);
+    return tasks_.size();
+}
+
+void LobbyScheduler::workerLoop() {
+    std::unique_lock lock(mutex_);
+
+    while (!stopping_) {
+        if (queue_.empty()) {
+            wakeWorkers_.wait(lock);
+            continue;
+        }
+
+        const Entry next = queue_.top();
+        if (next.due > Clock::now()) {
+            wakeWorkers_.wait_until(lock, next.due);
+            continue;
+        }
+        queue_.pop();
+
+        auto it = tasks_.find(next.id);
+        if (it == tasks_.end() || it->second.running ||
+            it->second.due != next.due) {
+            continue;
+        }
+        it->second.running = true;
+        auto step = it->second.step;
+
+        // Only this worker holds the task now: it is marked running
+        lock.unlock();
+        std::optional<Clock::time_point> due;
+        try {
+            due = (*step)();
+        } catch (const std::exception& e) {
+            rtype::Logger::instance().error(
+                std::format("Lobby task {} crashed: {}", next.id, e.what()));
+        }
+        lock.lock();
+
+        it = tasks_.find(next.id);
+        if (it == tasks_.end()) {
+            continue;
+        }
+        if (due && !stopping_) {
+            Task& task = it->second;
+            task.running = false;
+            task.due = task.wakePending ? std::min(*due, Clock::now()) : *due;
+            task.wakePending = false;
+            // This worker re-reads the heap top right away, no wake needed
+            queue_.push({task.due, next.id});
+        } else {
+            tasks_.erase(it);
+            taskFinished_.notify_all();
+        }
+    }
+}
+
+}  // namespace rtype::server
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** LobbyScheduler - Fixed worker pool stepping lobby simulations
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace rtype::server {
+
+/**
+ * @brief Runs many lobby loops on a fixed pool of worker threads
+ *
+ * Instead of one OS thread sleeping in ServerLoop::run() per lobby, each
+ * lobby registers a step function (ServerApp::step()) that runs one frame
+ * and returns when the next one is due. Workers pop the earliest due lobby
+ * from a min-heap, step it and push it back, so a lobby is never stepped by
+ * two workers at once and idle lobbies cost no thread. A hibernating lobby
+ * returns a far due time and is pulled forward by wake() when a packet
+ * arrives.
+ *
+ * Thread-safety: all public methods are thread-safe.
+ */
+class LobbyScheduler {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using TaskId = std::uint64_t;
+
+    /**
+     * @brief Run one frame
+     * @return When to run next, or nullopt once the task is finished
+     */
+    using StepFunction = std::function<std::optional<Clock::time_point>()>;
+
+    /**
+     * @param workerCount Number of workers, 0 for one per hardware thread
+     */
+    explicit LobbyScheduler(std::size_t workerCount = 0);
+
+    /**
+     * @brief Stops the workers (see stop())
+     */
+    ~LobbyScheduler();
+
+    LobbyScheduler(const LobbyScheduler&) = delete;
+    LobbyScheduler& operator=(const LobbyScheduler&) = delete;
+    LobbyScheduler(LobbyScheduler&&) = delete;
+    LobbyScheduler& operator=(LobbyScheduler&&) = delete;
+
+    /**
+     * @brief Schedule a task, first step as soon as a worker is free
+     * @return Id to pass to wait()
+     */
+    TaskId add(StepFunction step);
+
+    /**
+     * @brief Run a task's next step now instead of at its due time
+     *
+     * If the task is being stepped, its next step is scheduled right after.
+     * Unknown or finished ids are ignored.
+     */
+    void wake(TaskId id);
+
+    /**
+     * @brief Block until a task has finished (its step returned nullopt or
+     *        threw) or the scheduler is stopped
+     */
+    void wait(TaskId id);
+
+    /**
+     * @brief Join all workers; unfinished tasks are dropped without
+     *        another step
+     */
+    void stop();
+
+    [[nodiscard]] std::size_t workerCount() const noexcept {
+        return workerCount_;
+    }
+
+    /// Number of tasks not finished yet
+    [[nodiscard]] std::size_t taskCount() const;
+
+   private:
+    struct Task {
+        std::shared_ptr<StepFunction> step;
+        Clock::time_point due;
+        bool running{false};
+        bool wakePending{false};
+    };
+
+    /// Heap entries are never removed early: one whose due no longer
+    /// matches its task's was superseded by wake() and is skipped
+    struct Entry {
+        Clock::time_point due;
+        TaskId id;
+
+        bool operator>(const Entry& other) const noexcept {
+            return due > other.due;
+        }
+    };
+
+    void workerLoop();
+
+    std::size_t workerCount_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeWorkers_;
+    std::condition_variable taskFinished_;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue_;
+    std::unordered_map<TaskId, Task> tasks_;
+    TaskId nextId_{1};
+    bool stopping_{false};
+};
+
+}  // namespace rtype::server
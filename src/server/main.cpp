@@ -19,6 +19,7 @@
 
 #include "Logger/Macros.hpp"
 #include "ServerApp.hpp"
+#include "compression/DictionarySet.hpp"
 #include "games/rtype/server/GameEngine.hpp"
 #include "games/rtype/server/RTypeEntitySpawner.hpp"
 #include "games/rtype/server/RTypeGameConfig.hpp"
@@ -155,6 +156,39 @@ static std::shared_ptr<rtype::ArgParser> configureParser(
                     if (!v.has_value()) return rtype::ParseResult::Error;
                     config->lobbyTimeout = v.value();
                     return rtype::ParseResult::Success;
+                })
+        .flag("", "--snapshot-replication",
+              "Replicate entity state as delta-compressed snapshots",
+              [config]() {
+                  config->snapshotReplication = true;
+                  return rtype::ParseResult::Success;
+              })
+        .flag("", "--measure-jitter",
+              "Record tick start jitter percentiles in the server metrics",
+              [config]() {
+                  config->measureJitter = true;
+                  return rtype::ParseResult::Success;
+              })
+        .option("", "--compression-dict", "path",
+                "LZ4 dictionary set offered to clients (rtgp_dict_trainer)",
+                [config](std::string_view val) {
+                    config->compressionDictPath = std::string(val);
+                    return rtype::ParseResult::Success;
+                })
+        .flag("", "--shared-socket",
+              "Serve all lobbies from one UDP port on a worker pool",
+              [config]() {
+                  config->sharedSocket = true;
+                  return rtype::ParseResult::Success;
+              })
+        .option("", "--workers", "n",
+                "Worker threads for --shared-socket (0-256, 0: core count)",
+                [config](std::string_view val) {
+                    auto v = rtype::parseNumber<uint32_t>(val, "workers", 0,
+                                                          256);
+                    if (!v.has_value()) return rtype::ParseResult::Error;
+                    config->workerThreads = v.value();
+                    return rtype::ParseResult::Success;
                 });
     return parser;
 }
@@ -262,6 +296,30 @@ static int runServer(const ServerConfig& config,
         managerConfig.configPath = config.configPath;
         managerConfig.emptyTimeout = std::chrono::seconds(config.lobbyTimeout);
         managerConfig.maxInstances = 16;
+        managerConfig.snapshotReplication = config.snapshotReplication;
+        managerConfig.measureJitter = config.measureJitter;
+        managerConfig.sharedSocket = config.sharedSocket;
+        managerConfig.workerThreads = config.workerThreads;
+
+        if (!config.compressionDictPath.empty()) {
+            auto dictionaries = rtype::network::DictionarySet::loadFromFile(
+                config.compressionDictPath);
+            if (!dictionaries) {
+                LOG_ERROR_CAT(rtype::LogCategory::Main,
+                              "[Main] Failed to load compression dictionaries "
+                                  << config.compressionDictPath);
+                return 1;
+            }
+            managerConfig.compressionDictionaries =
+                std::make_shared<const rtype::network::DictionarySet>(
+                    std::move(dictionaries.value()));
+            LOG_INFO_CAT(rtype::LogCategory::Main,
+                         "[Main] Loaded "
+                             << managerConfig.compressionDictionaries->size()
+                             << " compression dictionaries (id 0x" << std::hex
+                             << managerConfig.compressionDictionaries->id()
+                             << std::dec << ")");
+        }
 
         try {
             rtype::server::LobbyManager manager(managerConfig);
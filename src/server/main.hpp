@@ -59,6 +59,11 @@ struct ServerConfig {
 
     uint32_t instanceCount = 1;
     uint32_t lobbyTimeout = 300;
+    bool snapshotReplication = false;
+    bool measureJitter = false;
+    std::string compressionDictPath;
+    bool sharedSocket = false;
+    uint32_t workerThreads = 0;
 };
 
 #endif  // SRC_SERVER_MAIN_HPP_
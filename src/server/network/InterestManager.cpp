@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterestManager - Implementation
+*/
+
+#include "InterestManager.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "protocol/Header.hpp"
+
+namespace rtype::server {
+
+namespace {
+
+constexpr std::size_t kBatchOverhead =
+    network::kHeaderSize + sizeof(network::EntityMoveBatchHeader);
+constexpr std::size_t kBatchEntrySize = sizeof(network::EntityMoveBatchEntry);
+
+}  // namespace
+
+float InterestManager::typeWeight(EntityType type) noexcept {
+    switch (type) {
+        case EntityType::Player:
+            return 1.0F;
+        case EntityType::Boss:
+        case EntityType::BossPart:
+        case EntityType::ForcePod:
+            return 0.5F;
+        case EntityType::Bydos:
+        case EntityType::Obstacle:
+        case EntityType::Pickup:
+            return 0.25F;
+        case EntityType::Missile:
+        case EntityType::LaserBeam:
+            return 0.2F;
+    }
+    return 0.25F;
+}
+
+float InterestManager::distanceWeight(float distance) noexcept {
+    return 0.5F + 0.5F * kDistanceFalloff / (kDistanceFalloff + distance);
+}
+
+std::size_t InterestManager::entriesForBudget(std::size_t bytes) noexcept {
+    std::size_t entries = 0;
+    while (bytes > kBatchOverhead) {
+        const std::size_t fit =
+            std::min((bytes - kBatchOverhead) / kBatchEntrySize,
+                     network::kMaxEntitiesPerBatch);
+        if (fit == 0) {
+            break;
+        }
+        entries += fit;
+        bytes -= kBatchOverhead + fit * kBatchEntrySize;
+    }
+    return entries;
+}
+
+void InterestManager::select(std::uint32_t userId,
+                             std::optional<std::pair<float, float>> ship,
+                             std::size_t byteBudget,
+                             const std::vector<Candidate>& candidates,
+                             std::vector<std::size_t>& out) {
+    out.clear();
+    auto& client = clients_[userId];
+    client.eligible.clear();
+
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        const auto& candidate = candidates[i];
+        auto& state = client.entities[candidate.networkId];
+        if (candidate.changed) {
+            state.pending = true;
+        }
+        if (!state.pending) {
+            continue;
+        }
+
+        float weight = typeWeight(candidate.type);
+        if (ship) {
+            weight *= distanceWeight(std::hypot(candidate.x - ship->first,
+                                                candidate.y - ship->second));
+        }
+        const float velocityChange = std::abs(candidate.vx - state.sentVx) +
+                                     std::abs(candidate.vy - state.sentVy);
+        state.accumulator += weight + velocityChange / kVelocityChangeScale;
+
+        if (state.accumulator >= 1.0F) {
+            client.eligible.emplace_back(state.accumulator, i);
+        }
+    }
+
+    const std::size_t capacity =
+        std::min(entriesForBudget(byteBudget), client.eligible.size());
+    if (capacity < client.eligible.size()) {
+        std::nth_element(
+            client.eligible.begin(),
+            client.eligible.begin() + static_cast<std::ptrdiff_t>(capacity),
+            client.eligible.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+    }
+
+    out.reserve(capacity);
+    for (std::size_t n = 0; n < capacity; ++n) {
+        const std::size_t index = client.eligible[n].second;
+        const auto& candidate = candidates[index];
+        auto& state = client.entities[candidate.networkId];
+        state.accumulator = 0;
+        state.sentVx = candidate.vx;
+        state.sentVy = candidate.vy;
+        state.pending = false;
+        out.push_back(index);
+    }
+}
+
+float InterestManager::priority(std::uint32_t userId,
+                                std::uint32_t networkId) const {
+    auto clientIt = clients_.find(userId);
+    if (clientIt == clients_.end()) {
+        return 0;
+    }
+    auto it = clientIt->second.entities.find(networkId);
+    return it != clientIt->second.entities.end() ? it->second.accumulator : 0;
+}
+
+void InterestManager::removeEntity(std::uint32_t networkId) {
+    for (auto& [userId, client] : clients_) {
+        client.entities.erase(networkId);
+    }
+}
+
+void InterestManager::removeClient(std::uint32_t userId) {
+    clients_.erase(userId);
+}
+
+}  // namespace rtype::server
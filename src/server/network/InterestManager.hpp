@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterestManager - Per-client replication priority and byte budgets
+*/
+
+#ifndef SRC_SERVER_NETWORK_INTERESTMANAGER_HPP_
+#define SRC_SERVER_NETWORK_INTERESTMANAGER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "protocol/Payloads.hpp"
+
+namespace rtype::server {
+
+/**
+ * @brief Decides, per client and per tick, which entity moves to send
+ *
+ * Every client keeps a priority accumulator per entity. While an entity has
+ * state the client has not received yet, its accumulator grows each tick by
+ *
+ *     typeWeight * distanceWeight + velocityChange / kVelocityChangeScale
+ *
+ * where the type weight ranks players > bosses > enemies > projectiles, the
+ * distance weight favours entities near that client's ship and the velocity
+ * term makes unpredictable motion (what dead reckoning gets wrong) urgent.
+ * An entity becomes eligible once its accumulator reaches 1; the client's
+ * byte budget is then filled with the highest accumulators and those are
+ * reset. Entities that do not fit keep accumulating and win a later tick,
+ * so overflow is delayed, never dropped.
+ *
+ * Cost is O(clients * entities) per tick: one pass to accumulate and one
+ * nth_element to pick the winners.
+ *
+ * Thread-safety: none, call from the game loop thread.
+ */
+class InterestManager {
+   public:
+    using EntityType = network::EntityType;
+
+    /// One datagram per tick: a full S_ENTITY_MOVE_BATCH
+    static constexpr std::size_t kDefaultByteBudget = 1400;
+    /// ~5 KB/s at 60 Hz for clients that asked for low bandwidth mode
+    static constexpr std::size_t kLowBandwidthByteBudget = 96;
+    /// Distance (px) at which the distance weight is halfway down
+    static constexpr float kDistanceFalloff = 600.0F;
+    /// Velocity change (px/s, L1) that makes an entity due right away
+    static constexpr float kVelocityChangeScale = 60.0F;
+
+    /**
+     * @brief Entity state offered for replication this tick
+     */
+    struct Candidate {
+        std::uint32_t networkId{0};
+        EntityType type{EntityType::Player};
+        float x{0};
+        float y{0};
+        float vx{0};
+        float vy{0};
+        bool changed{false};  ///< Position/velocity updated since last tick
+    };
+
+    /**
+     * @brief Per-tick send rate of a type at point blank, in sends per tick
+     */
+    [[nodiscard]] static float typeWeight(EntityType type) noexcept;
+
+    /**
+     * @brief Weight in (0.5, 1] of an entity at the given distance
+     */
+    [[nodiscard]] static float distanceWeight(float distance) noexcept;
+
+    /**
+     * @brief Number of batch entries that fit in a byte budget
+     *
+     * Accounts for the RTGP and batch headers of every datagram needed.
+     */
+    [[nodiscard]] static std::size_t entriesForBudget(
+        std::size_t bytes) noexcept;
+
+    /**
+     * @brief Accumulate priorities for one client and pick what to send
+     *
+     * @param userId Client being served
+     * @param ship Position of the client's ship, nullopt for spectators
+     * @param byteBudget Bytes this client may receive this tick
+     * @param candidates Entities relevant this tick (same list per client)
+     * @param out Cleared, then filled with indices into candidates
+     */
+    void select(std::uint32_t userId,
+                std::optional<std::pair<float, float>> ship,
+                std::size_t byteBudget,
+                const std::vector<Candidate>& candidates,
+                std::vector<std::size_t>& out);
+
+    /**
+     * @brief Accumulated priority of an entity for a client (0 if unknown)
+     */
+    [[nodiscard]] float priority(std::uint32_t userId,
+                                 std::uint32_t networkId) const;
+
+    /// Forget an entity for every client
+    void removeEntity(std::uint32_t networkId);
+
+    /// Forget everything about a client
+    void removeClient(std::uint32_t userId);
+
+    void clear() noexcept { clients_.clear(); }
+
+    [[nodiscard]] std::size_t clientCount() const noexcept {
+        return clients_.size();
+    }
+
+   private:
+    struct EntityState {
+        float accumulator{0};
+        float sentVx{0};
+        float sentVy{0};
+        bool pending{false};  ///< Client is missing the latest state
+    };
+
+    struct ClientState {
+        std::unordered_map<std::uint32_t, EntityState> entities;
+        /// Scratch (accumulator, candidate index), reused across ticks
+        std::vector<std::pair<float, std::size_t>> eligible;
+    };
+
+    std::unordered_map<std::uint32_t, ClientState> clients_;
+};
+
+}  // namespace rtype::server
+
+#endif  // SRC_SERVER_NETWORK_INTERESTMANAGER_HPP_
@@ -8,11 +8,11 @@
 #include "NetworkServer.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <memory>
-#include <queue>
-#include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,7 +20,9 @@
 #include "Serializer.hpp"
 #include "protocol/ByteOrderSpec.hpp"
 #include "protocol/Validator.hpp"
+#include "SharedUdpFrontend.hpp"
 #include "server/shared/ServerMetrics.hpp"
+#include "snapshot/SnapshotCodec.hpp"
 
 namespace rtype::server {
 
@@ -51,11 +53,37 @@ bool NetworkServer::start(std::uint16_t portNum) {
     return true;
 }
 
+bool NetworkServer::startShared(SharedUdpFrontend& frontend,
+                                std::size_t slot) {
+    if (running_) {
+        return false;
+    }
+
+    config_.userIdBase = SharedUdpFrontend::userIdBase(slot);
+    frontend_ = &frontend;
+    frontendSlot_ = slot;
+    running_ = true;
+
+    if (!frontend.registerRoute(slot, this, config_.expectedLobbyCode)) {
+        running_ = false;
+        frontend_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
 void NetworkServer::stop() {
     if (!running_) {
         return;
     }
 
+    if (isIoLoopRunning()) {
+        stopIoLoop();
+        while (isIoLoopRunning()) {
+            std::this_thread::yield();
+        }
+    }
+
     running_ = false;
 
     network::DisconnectPayload payload;
@@ -63,17 +91,25 @@ void NetworkServer::stop() {
         static_cast<std::uint8_t>(network::DisconnectReason::RemoteRequest);
     auto serialized = network::Serializer::serialize(payload);
 
-    for (const auto& [key, client] : clients_) {
-        sendToClient(client, network::OpCode::DISCONNECT, serialized);
+    for (const auto& client : slots_) {
+        if (client) {
+            sendToClient(client, network::OpCode::DISCONNECT, serialized);
+        }
     }
 
     {
         std::lock_guard<std::mutex> lock(clientsMutex_);
-        clients_.clear();
-        userIdToKey_.clear();
+        slots_.clear();
+        freeSlots_.clear();
+        slotByKey_.clear();
+        slotByUserId_.clear();
     }
 
-    if (socket_) {
+    if (frontend_) {
+        frontend_->unregisterRoute(frontendSlot_);
+        frontend_ = nullptr;
+    } else if (socket_) {
+        flushOutgoing();
         socket_->cancel();
         ioContext_.poll();
         socket_->close();
@@ -89,7 +125,13 @@ void NetworkServer::stop() {
 bool NetworkServer::isRunning() const noexcept { return running_; }
 
 std::uint16_t NetworkServer::port() const noexcept {
-    if (!running_ || !socket_) {
+    if (!running_) {
+        return 0;
+    }
+    if (frontend_) {
+        return frontend_->port();
+    }
+    if (!socket_) {
         return 0;
     }
     return socket_->localPort();
@@ -120,7 +162,7 @@ void NetworkServer::moveEntity(std::uint32_t id, float x, float y, float vx,
                                float vy) {
     network::EntityMovePayload payload;
     payload.entityId = id;
-    payload.serverTick = nextServerTick();
+    payload.serverTick = serverTick();
     payload.posX = quantize(x, kPosQuantScale);
     payload.posY = quantize(y, kPosQuantScale);
     payload.velX = quantize(vx, kVelQuantScale);
@@ -138,10 +180,34 @@ void NetworkServer::moveEntitiesBatch(
         return;
     }
 
+    broadcastToAll(network::OpCode::S_ENTITY_MOVE_BATCH,
+                   encodeMoveBatch(entities));
+}
+
+void NetworkServer::moveEntitiesBatchToClient(
+    std::uint32_t userId,
+    const std::vector<std::tuple<std::uint32_t, float, float, float, float>>&
+        entities) {
+    if (entities.empty()) {
+        return;
+    }
+
+    auto client = findClientByUserId(userId);
+    if (!client) {
+        return;
+    }
+
+    sendToClient(client, network::OpCode::S_ENTITY_MOVE_BATCH,
+                 encodeMoveBatch(entities));
+}
+
+network::Buffer NetworkServer::encodeMoveBatch(
+    const std::vector<std::tuple<std::uint32_t, float, float, float, float>>&
+        entities) {
     auto count = static_cast<std::uint8_t>(
         std::min(entities.size(), network::kMaxEntitiesPerBatch));
 
-    auto tick = nextServerTick();
+    auto tick = serverTick();
 
     network::Buffer payload;
     payload.reserve(sizeof(network::EntityMoveBatchHeader) +
@@ -165,7 +231,51 @@ void NetworkServer::moveEntitiesBatch(
         payload.insert(payload.end(), serialized.begin(), serialized.end());
     }
 
-    broadcastToAll(network::OpCode::S_ENTITY_MOVE_BATCH, payload);
+    return payload;
+}
+
+void NetworkServer::broadcastSnapshot(
+    std::vector<network::EntitySnapshotState> entities) {
+    auto snapshot = std::make_shared<network::WorldSnapshot>();
+    // Acks and baselines are keyed by tick, so each snapshot needs its own
+    auto tick = serverTick();
+    if (tick == lastSnapshotTick_) {
+        tick = advanceServerTick();
+    }
+    lastSnapshotTick_ = tick;
+    snapshot->tick = tick;
+    snapshot->entities = std::move(entities);
+    snapshot->sortEntities();
+    std::shared_ptr<const network::WorldSnapshot> shared = std::move(snapshot);
+
+    for (const auto& client : slots_) {
+        if (!client) {
+            continue;
+        }
+        std::shared_ptr<const network::WorldSnapshot> baseline;
+        if (client->lastAckedSnapshotTick != 0) {
+            baseline =
+                client->snapshotHistory.find(client->lastAckedSnapshotTick);
+        }
+
+        auto encoded = network::SnapshotCodec::encode(*shared, baseline.get());
+
+        if (encoded.truncated) {
+            // Only part of the delta fits: remember what the client will
+            // actually reconstruct so the next delta is built on it.
+            auto effective = network::SnapshotCodec::decode(encoded.payload,
+                                                            baseline.get());
+            if (effective) {
+                client->snapshotHistory.push(
+                    std::make_shared<const network::WorldSnapshot>(
+                        std::move(effective.value())));
+            }
+        } else {
+            client->snapshotHistory.push(shared);
+        }
+
+        sendToClient(client, network::OpCode::S_SNAPSHOT, encoded.payload);
+    }
 }
 
 void NetworkServer::destroyEntity(std::uint32_t id) {
@@ -284,7 +394,7 @@ void NetworkServer::moveEntityToClient(std::uint32_t userId, std::uint32_t id,
 
     network::EntityMovePayload payload;
     payload.entityId = id;
-    payload.serverTick = nextServerTick();
+    payload.serverTick = serverTick();
     payload.posX = quantize(x, kPosQuantScale);
     payload.posY = quantize(y, kPosQuantScale);
     payload.velX = quantize(vx, kVelQuantScale);
@@ -363,7 +473,8 @@ void NetworkServer::updateGameStateToClient(std::uint32_t userId,
     sendToClient(client, network::OpCode::S_UPDATE_STATE, serialized);
 }
 
-void NetworkServer::correctPosition(std::uint32_t userId, float x, float y) {
+void NetworkServer::correctPosition(std::uint32_t userId, float x, float y,
+                                    float moveSpeed) {
     auto client = findClientByUserId(userId);
     if (!client) {
         return;
@@ -372,6 +483,8 @@ void NetworkServer::correctPosition(std::uint32_t userId, float x, float y) {
     network::UpdatePosPayload payload;
     payload.posX = x;
     payload.posY = y;
+    payload.ackInputSeq = client->lastInputSeq.value_or(0);
+    payload.moveSpeed = moveSpeed;
 
     auto serialized = network::Serializer::serializeForNetwork(payload);
 
@@ -415,6 +528,13 @@ void NetworkServer::onClientInput(
     onClientInputCallback_ = std::move(callback);
 }
 
+void NetworkServer::onClientInputFrames(
+    std::function<void(std::uint32_t userId,
+                       const std::vector<network::InputFrame>& frames)>
+        callback) {
+    onClientInputFramesCallback_ = std::move(callback);
+}
+
 void NetworkServer::onGetUsersRequest(
     std::function<void(std::uint32_t userId)> callback) {
     onGetUsersRequestCallback_ = std::move(callback);
@@ -428,7 +548,11 @@ void NetworkServer::poll() {
         return;
     }
 
-    ioContext_.poll();
+    if (!isIoLoopRunning() && !frontend_) {
+        ioContext_.poll();
+        flushOutgoing();
+    }
+    dispatchDecodedPackets();
 
     checkTimeouts();
 
@@ -436,12 +560,13 @@ void NetworkServer::poll() {
 
     {
         std::lock_guard<std::mutex> lock(clientsMutex_);
-        for (auto& [key, client] : clients_) {
+        for (const auto& client : slots_) {
+            if (!client) {
+                continue;
+            }
             auto retransmits = client->reliableChannel.getPacketsToRetransmit();
             for (auto& pkt : retransmits) {
-                socket_->asyncSendTo(
-                    pkt.data, client->endpoint,
-                    [](network::Result<std::size_t> result) { (void)result; });
+                sendRaw(std::move(pkt.data), client->endpoint);
             }
 
             auto cleanupResult = client->reliableChannel.cleanup();
@@ -472,8 +597,8 @@ void NetworkServer::poll() {
 std::vector<std::uint32_t> NetworkServer::getConnectedClients() const {
     std::lock_guard<std::mutex> lock(clientsMutex_);
     std::vector<std::uint32_t> result;
-    result.reserve(userIdToKey_.size());
-    for (const auto& [userId, key] : userIdToKey_) {
+    result.reserve(slotByUserId_.size());
+    for (const auto& [userId, slot] : slotByUserId_) {
         result.push_back(userId);
     }
     return result;
@@ -481,21 +606,17 @@ std::vector<std::uint32_t> NetworkServer::getConnectedClients() const {
 
 std::size_t NetworkServer::clientCount() const noexcept {
     std::lock_guard<std::mutex> lock(clientsMutex_);
-    return clients_.size();
+    return slotByKey_.size();
 }
 
 std::optional<network::Endpoint> NetworkServer::getClientEndpoint(
     std::uint32_t userId) const {
     std::lock_guard<std::mutex> lock(clientsMutex_);
-    auto keyIt = userIdToKey_.find(userId);
-    if (keyIt == userIdToKey_.end()) {
+    auto slotIt = slotByUserId_.find(userId);
+    if (slotIt == slotByUserId_.end()) {
         return std::nullopt;
     }
-    auto clientIt = clients_.find(keyIt->second);
-    if (clientIt == clients_.end()) {
-        return std::nullopt;
-    }
-    return clientIt->second->endpoint;
+    return slots_[slotIt->second]->endpoint;
 }
 
 bool NetworkServer::disconnectClient(std::uint32_t userId,
@@ -503,15 +624,11 @@ bool NetworkServer::disconnectClient(std::uint32_t userId,
     std::shared_ptr<ClientConnection> client;
     {
         std::lock_guard<std::mutex> lock(clientsMutex_);
-        auto keyIt = userIdToKey_.find(userId);
-        if (keyIt == userIdToKey_.end()) {
-            return false;
-        }
-        auto clientIt = clients_.find(keyIt->second);
-        if (clientIt == clients_.end()) {
+        auto slotIt = slotByUserId_.find(userId);
+        if (slotIt == slotByUserId_.end()) {
             return false;
         }
-        client = clientIt->second;
+        client = slots_[slotIt->second];
     }
 
     network::DisconnectPayload payload;
@@ -521,9 +638,7 @@ bool NetworkServer::disconnectClient(std::uint32_t userId,
     auto disconnectPacket = buildPacket(network::OpCode::DISCONNECT, serialized,
                                         network::kServerUserId, 0, 0, false);
 
-    socket_->asyncSendTo(
-        disconnectPacket, client->endpoint,
-        [](network::Result<std::size_t> result) { (void)result; });
+    sendRaw(std::move(disconnectPacket), client->endpoint);
 
     queueCallback([this, userId, reason]() {
         if (onClientDisconnectedCallback_) {
@@ -536,22 +651,135 @@ bool NetworkServer::disconnectClient(std::uint32_t userId,
 }
 
 void NetworkServer::dispatchCallbacks() {
-    std::queue<std::function<void()>> toDispatch;
+    std::array<std::function<void()>, kCallbackDispatchBatch> batch;
+
+    // Bounded by what is queued now so callbacks queueing callbacks cannot
+    // keep this loop alive forever
+    std::size_t remaining = callbackQueue_.size();
+    while (remaining > 0) {
+        std::size_t count = callbackQueue_.popAll(batch);
+        if (count == 0) {
+            break;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            batch[i]();
+            batch[i] = nullptr;
+        }
+        remaining -= std::min(remaining, count);
+    }
+}
 
-    {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        std::swap(toDispatch, callbackQueue_);
+void NetworkServer::queueCallback(std::function<void()> callback) {
+    if (!callbackQueue_.tryPush(std::move(callback))) {
+        LOG_WARNING("[NetworkServer] Callback queue full, dropping event");
+    }
+}
+
+bool NetworkServer::claimIoLoop() {
+    if (!running_ || frontend_) {
+        return false;
+    }
+    return !ioLoopRunning_.exchange(true, std::memory_order_acq_rel);
+}
+
+void NetworkServer::releaseIoLoop() noexcept {
+    ioLoopRunning_.store(false, std::memory_order_release);
+}
+
+void NetworkServer::runIoLoop() {
+    // The flag is set by claimIoLoop() before the thread exists, so the game
+    // thread never polls the io_context or drains outboundPackets_ meanwhile
+    if (!isIoLoopRunning()) {
+        LOG_ERROR_CAT(::rtype::LogCategory::Network,
+                      "[NetworkServer] runIoLoop() called without claimIoLoop()");
+        return;
     }
+    LOG_DEBUG_CAT(::rtype::LogCategory::Network,
+                  "[NetworkServer] I/O loop running");
 
-    while (!toDispatch.empty()) {
-        toDispatch.front()();
-        toDispatch.pop();
+    for (;;) {
+        try {
+            ioContext_.run();
+            break;
+        } catch (const std::exception& e) {
+            LOG_ERROR_CAT(::rtype::LogCategory::Network,
+                          "[NetworkServer] Exception in I/O loop: "
+                              << e.what());
+        }
     }
+
+    // Handlers still queued (pending receive, flush) run in poll() from now
+    ioContext_.restart();
+    ioLoopRunning_.store(false, std::memory_order_release);
+    LOG_DEBUG_CAT(::rtype::LogCategory::Network,
+                  "[NetworkServer] I/O loop stopped");
 }
 
-void NetworkServer::queueCallback(std::function<void()> callback) {
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    callbackQueue_.push(std::move(callback));
+void NetworkServer::stopIoLoop() {
+    ioContext_.get().stop();
+}
+
+void NetworkServer::dispatchDecodedPackets() {
+    std::array<DecodedPacket, kIoDispatchBatch> batch;
+
+    // Only what is queued now, so a flood cannot stall the tick
+    std::size_t remaining = inboundPackets_.size();
+    if (_metrics) {
+        _metrics->inboundQueueDepth.record(remaining);
+    }
+    while (remaining > 0) {
+        std::size_t count = inboundPackets_.popAll(batch);
+        if (count == 0) {
+            break;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            dispatchPacket(batch[i]);
+        }
+        remaining -= std::min(remaining, count);
+    }
+}
+
+void NetworkServer::sendRaw(network::Buffer packet,
+                            const network::Endpoint& dest) {
+    if (frontend_) {
+        frontend_->send(std::move(packet), dest);
+        return;
+    }
+
+    if (!isIoLoopRunning()) {
+        socket_->asyncSendTo(
+            packet, dest,
+            [](network::Result<std::size_t> result) { (void)result; });
+        return;
+    }
+
+    if (!outboundPackets_.tryEmplace(std::move(packet), dest)) {
+        if (_metrics) {
+            _metrics->packetsDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // One wake-up per burst: the flush clears the flag before draining, so
+    // a packet queued after that point posts again
+    if (!flushPosted_.exchange(true, std::memory_order_acq_rel)) {
+        asio::post(ioContext_.get(), [this]() {
+            flushPosted_.exchange(false, std::memory_order_acq_rel);
+            flushOutgoing();
+        });
+    }
+}
+
+void NetworkServer::flushOutgoing() {
+    std::array<OutgoingPacket, kIoDispatchBatch> batch;
+
+    while (std::size_t count = outboundPackets_.popAll(batch)) {
+        for (std::size_t i = 0; i < count; ++i) {
+            socket_->asyncSendTo(
+                batch[i].data, batch[i].destination,
+                [](network::Result<std::size_t> result) { (void)result; });
+        }
+    }
 }
 
 void NetworkServer::startReceive() {
@@ -576,7 +804,11 @@ void NetworkServer::handleReceive(network::Result<std::size_t> result) {
         std::size_t bytesReceived = result.value();
         receiveBuffer_->resize(bytesReceived);
 
-        processIncomingPacket(*receiveBuffer_, *receiveSender_);
+        if (isIoLoopRunning()) {
+            deliver(*receiveBuffer_, *receiveSender_);
+        } else {
+            processIncomingPacket(*receiveBuffer_, *receiveSender_);
+        }
     }
 
     if (running_ && socket_->isOpen()) {
@@ -584,11 +816,38 @@ void NetworkServer::handleReceive(network::Result<std::size_t> result) {
     }
 }
 
+void NetworkServer::deliver(const network::Buffer& data,
+                            const network::Endpoint& sender) {
+    if (!running_) {
+        return;
+    }
+    auto packet = decodePacket(data, sender);
+    if (!packet) {
+        return;
+    }
+    if (!inboundPackets_.tryPush(std::move(*packet))) {
+        if (_metrics) {
+            _metrics->packetsDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+    if (onPacketQueuedCallback_) {
+        onPacketQueuedCallback_();
+    }
+}
+
 void NetworkServer::processIncomingPacket(const network::Buffer& data,
                                           const network::Endpoint& sender) {
+    if (auto packet = decodePacket(data, sender)) {
+        dispatchPacket(*packet);
+    }
+}
+
+std::optional<NetworkServer::DecodedPacket> NetworkServer::decodePacket(
+    const network::Buffer& data, const network::Endpoint& sender) {
     auto sizeResult = network::Validator::validatePacketSize(data.size());
     if (!sizeResult) {
-        return;
+        return std::nullopt;
     }
 
     if (_metrics) {
@@ -597,11 +856,12 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
                                           std::memory_order_relaxed);
     }
 
-    network::Header header;
+    DecodedPacket packet;
+    network::Header& header = packet.header;
     std::memcpy(&header, data.data(), network::kHeaderSize);
 
     if (!header.hasValidMagic()) {
-        return;
+        return std::nullopt;
     }
 
     header.payloadSize =
@@ -611,12 +871,46 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
     header.ackId = network::ByteOrderSpec::fromNetwork(header.ackId);
 
     if (!header.hasValidOpCode()) {
-        return;
+        return std::nullopt;
     }
 
     recordPacketReceived(header.opcode, data.size());
 
-    std::string connKey = makeConnectionKey(sender);
+    auto opcode = static_cast<network::OpCode>(header.opcode);
+
+    if (header.payloadSize > 0 &&
+        data.size() >= network::kHeaderSize + header.payloadSize) {
+        network::Buffer rawPayload(data.begin() + network::kHeaderSize,
+                                   data.end());
+
+        if (header.flags & network::Flags::kDictCompressed) {
+            auto decompressResult =
+                compressor_.decompressWithDictionary(rawPayload, opcode);
+            if (!decompressResult) {
+                return std::nullopt;
+            }
+            packet.payload = std::move(decompressResult.value());
+        } else if (header.flags & network::Flags::kCompressed) {
+            auto decompressResult = compressor_.decompress(rawPayload);
+            if (!decompressResult) {
+                return std::nullopt;
+            }
+            packet.payload = std::move(decompressResult.value());
+        } else {
+            packet.payload = std::move(rawPayload);
+        }
+    }
+
+    packet.sender = sender;
+    packet.senderKey = network::EndpointKey::from(sender);
+    return packet;
+}
+
+void NetworkServer::dispatchPacket(const DecodedPacket& packet) {
+    const network::Header& header = packet.header;
+    const network::Buffer& payload = packet.payload;
+    const network::Endpoint& sender = packet.sender;
+    const network::EndpointKey& connKey = packet.senderKey;
 
     auto opcode = static_cast<network::OpCode>(header.opcode);
 
@@ -629,13 +923,18 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
     }
 
     if (header.flags & network::Flags::kIsAck) {
-        auto client = findClient(sender);
+        auto client = findClient(connKey);
         if (client) {
             LOG_DEBUG_CAT(::rtype::LogCategory::Network,
                           "[NetworkServer] Processing ACK from userId="
                               << header.userId << " ackId=" << header.ackId
                               << " (seqId=" << header.seqId << ")");
-            client->reliableChannel.recordAck(header.ackId);
+            auto rtt = client->reliableChannel.recordAck(header.ackId);
+            if (rtt && _metrics) {
+                _metrics->rtt.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(*rtt)
+                        .count()));
+            }
             client->lastActivity = std::chrono::steady_clock::now();
         }
     }
@@ -650,7 +949,7 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
     }
 
     if (network::isReliable(opcode)) {
-        if (auto client = findClient(sender)) {
+        if (auto client = findClient(connKey)) {
             client->reliableChannel.recordReceived(header.seqId);
             client->lastActivity = std::chrono::steady_clock::now();
 
@@ -660,23 +959,6 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
         }
     }
 
-    network::Buffer payload;
-    if (header.payloadSize > 0 &&
-        data.size() >= network::kHeaderSize + header.payloadSize) {
-        network::Buffer rawPayload(data.begin() + network::kHeaderSize,
-                                   data.end());
-
-        if (header.flags & network::Flags::kCompressed) {
-            auto decompressResult = compressor_.decompress(rawPayload);
-            if (!decompressResult) {
-                return;
-            }
-            payload = std::move(decompressResult.value());
-        } else {
-            payload = std::move(rawPayload);
-        }
-    }
-
     switch (opcode) {
         case network::OpCode::C_CONNECT:
             handleConnect(header, payload, sender);
@@ -722,6 +1004,14 @@ void NetworkServer::processIncomingPacket(const network::Buffer& data,
             handleAdminCommand(header, payload, sender);
             break;
 
+        case network::OpCode::C_SNAPSHOT_ACK:
+            handleSnapshotAck(header, payload, sender);
+            break;
+
+        case network::OpCode::C_COMPRESSION_OFFER:
+            handleCompressionOffer(header, payload, sender);
+            break;
+
         default:
             break;
     }
@@ -732,20 +1022,17 @@ void NetworkServer::handleConnect(const network::Header& header,
                                   const network::Endpoint& sender) {
     (void)payload;
 
-    std::string connKey = makeConnectionKey(sender);
-
-    auto it = clients_.find(connKey);
-    if (it != clients_.end()) {
-        it->second->reliableChannel.recordReceived(header.seqId);
-        it->second->lastActivity = std::chrono::steady_clock::now();
+    if (auto existing = findClient(sender)) {
+        existing->reliableChannel.recordReceived(header.seqId);
+        existing->lastActivity = std::chrono::steady_clock::now();
 
         network::AcceptPayload acceptPayload;
-        acceptPayload.newUserId = it->second->userId;
+        acceptPayload.newUserId = existing->userId;
 
         auto serialized =
             network::Serializer::serializeForNetwork(acceptPayload);
 
-        sendToClient(it->second, network::OpCode::S_ACCEPT, serialized);
+        sendToClient(existing, network::OpCode::S_ACCEPT, serialized);
         return;
     }
 
@@ -760,9 +1047,7 @@ void NetworkServer::handleConnect(const network::Header& header,
             auto packet =
                 buildPacket(network::OpCode::DISCONNECT, serialized,
                             network::kServerUserId, 0, header.seqId, false);
-            socket_->asyncSendTo(
-                packet, sender,
-                [](network::Result<std::size_t> result) { (void)result; });
+            sendRaw(std::move(packet), sender);
             return;
         }
     }
@@ -775,7 +1060,7 @@ void NetworkServer::handleConnect(const network::Header& header,
     client->reliableChannel.recordReceived(header.seqId);
     client->lastActivity = std::chrono::steady_clock::now();
 
-    securityContext_.registerConnection(connKey, newUserId);
+    securityContext_.registerConnection(client->key, newUserId);
 
     network::AcceptPayload acceptPayload;
     acceptPayload.newUserId = newUserId;
@@ -786,8 +1071,16 @@ void NetworkServer::handleConnect(const network::Header& header,
 
     {
         std::lock_guard<std::mutex> lock(clientsMutex_);
-        userIdToKey_[newUserId] = connKey;
-        clients_[connKey] = client;
+        if (!freeSlots_.empty()) {
+            client->slot = freeSlots_.back();
+            freeSlots_.pop_back();
+            slots_[client->slot] = client;
+        } else {
+            client->slot = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(client);
+        }
+        slotByKey_[client->key] = client->slot;
+        slotByUserId_[newUserId] = client->slot;
     }
 
     queueCallback([this, newUserId]() {
@@ -799,14 +1092,12 @@ void NetworkServer::handleConnect(const network::Header& header,
 
 void NetworkServer::handleDisconnect(const network::Header& header,
                                      const network::Endpoint& sender) {
-    std::string connKey = makeConnectionKey(sender);
-
-    auto it = clients_.find(connKey);
-    if (it == clients_.end()) {
+    auto client = findClient(sender);
+    if (!client) {
         return;
     }
 
-    std::uint32_t userId = it->second->userId;
+    std::uint32_t userId = client->userId;
 
     network::DisconnectPayload payload;
     payload.reason =
@@ -817,9 +1108,7 @@ void NetworkServer::handleDisconnect(const network::Header& header,
         buildPacket(network::OpCode::DISCONNECT, serialized,
                     network::kServerUserId, 0, header.seqId, false);
 
-    socket_->asyncSendTo(
-        ackPacket, sender,
-        [](network::Result<std::size_t> result) { (void)result; });
+    sendRaw(std::move(ackPacket), sender);
 
     removeClient(userId);
 
@@ -845,12 +1134,7 @@ void NetworkServer::handleInput(const network::Header& header,
     }
 
     try {
-        auto deserialized =
-            network::Serializer::deserializeFromNetwork<network::InputPayload>(
-                payload);
-
         std::uint32_t userId = header.userId;
-        std::uint16_t inputMask = deserialized.inputMask;
 
         auto client = findClientByUserId(userId);
         if (!client) {
@@ -863,6 +1147,35 @@ void NetworkServer::handleInput(const network::Header& header,
 
         client->lastActivity = std::chrono::steady_clock::now();
 
+        if (network::InputHistoryCodec::isHistoryPayload(payload.size())) {
+            // Frames are deduped by tick downstream, so late packets still
+            // fill holes left by lost ones
+            auto decoded = network::InputHistoryCodec::decode(payload);
+            if (!decoded) {
+                return;
+            }
+            queueCallback(
+                [this, userId, frames = std::move(decoded.value())]() {
+                    if (onClientInputFramesCallback_) {
+                        onClientInputFramesCallback_(userId, frames);
+                    }
+                });
+            return;
+        }
+
+        auto deserialized =
+            network::Serializer::deserializeFromNetwork<network::InputPayload>(
+                payload);
+        std::uint16_t inputMask = deserialized.inputMask;
+
+        // Inputs are states, not deltas: a late one must not undo a newer one
+        if (client->lastInputSeq &&
+            static_cast<std::int16_t>(header.seqId - *client->lastInputSeq) <=
+                0) {
+            return;
+        }
+        client->lastInputSeq = header.seqId;
+
         queueCallback([this, userId, inputMask]() {
             if (onClientInputCallback_) {
                 onClientInputCallback_(userId, inputMask);
@@ -873,6 +1186,68 @@ void NetworkServer::handleInput(const network::Header& header,
     }
 }
 
+void NetworkServer::handleSnapshotAck(const network::Header& header,
+                                      const network::Buffer& payload,
+                                      const network::Endpoint& sender) {
+    (void)header;
+
+    if (payload.size() < sizeof(network::SnapshotAckPayload)) {
+        return;
+    }
+
+    try {
+        auto deserialized = network::Serializer::deserializeFromNetwork<
+            network::SnapshotAckPayload>(payload);
+
+        auto client = findClient(sender);
+        if (!client) {
+            return;
+        }
+
+        client->lastActivity = std::chrono::steady_clock::now();
+
+        if (deserialized.serverTick > client->lastAckedSnapshotTick &&
+            client->snapshotHistory.find(deserialized.serverTick)) {
+            client->lastAckedSnapshotTick = deserialized.serverTick;
+        }
+    } catch (...) {
+        // Invalid payload, ignore
+    }
+}
+
+void NetworkServer::handleCompressionOffer(const network::Header& header,
+                                           const network::Buffer& payload,
+                                           const network::Endpoint& sender) {
+    (void)header;
+
+    if (payload.size() < sizeof(network::CompressionDictionaryPayload)) {
+        return;
+    }
+
+    try {
+        auto offer = network::Serializer::deserializeFromNetwork<
+            network::CompressionDictionaryPayload>(payload);
+
+        auto client = findClient(sender);
+        if (!client) {
+            return;
+        }
+
+        client->lastActivity = std::chrono::steady_clock::now();
+
+        network::CompressionDictionaryPayload select{};
+        if (config_.enableCompression && offer.dictionaryId != 0 &&
+            offer.dictionaryId == compressor_.dictionaryId()) {
+            select.dictionaryId = offer.dictionaryId;
+        }
+        sendToClient(client, network::OpCode::S_COMPRESSION_SELECT,
+                     network::Serializer::serializeForNetwork(select));
+        client->dictionaryCompression = select.dictionaryId != 0;
+    } catch (...) {
+        // Invalid payload, ignore
+    }
+}
+
 void NetworkServer::handleGetUsers(const network::Header& header,
                                    const network::Endpoint& sender) {
     (void)sender;
@@ -908,9 +1283,7 @@ void NetworkServer::handlePing(const network::Header& header,
         buildPacket(network::OpCode::PONG, serialized, network::kServerUserId,
                     client->nextSeqId++, header.seqId, false);
 
-    socket_->asyncSendTo(
-        pongPacket, sender,
-        [](network::Result<std::size_t> result) { (void)result; });
+    sendRaw(std::move(pongPacket), sender);
 }
 
 void NetworkServer::handleReady(const network::Header& header,
@@ -940,8 +1313,7 @@ void NetworkServer::handleReady(const network::Header& header,
              << " ready status: " << (isReady ? "READY" : "NOT READY"));
 
     if (onClientReadyCallback_) {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        callbackQueue_.push([this, userId = client->userId, isReady]() {
+        queueCallback([this, userId = client->userId, isReady]() {
             onClientReadyCallback_(userId, isReady);
         });
     }
@@ -1062,8 +1434,8 @@ void NetworkServer::handleBandwidthMode(const network::Header& header,
              << " bandwidth mode: " << (lowBandwidth ? "LOW" : "NORMAL"));
 
     std::uint8_t activeCount = 0;
-    for (const auto& [key, c] : clients_) {
-        if (c->lowBandwidthMode) {
+    for (const auto& c : slots_) {
+        if (c && c->lowBandwidthMode) {
             activeCount++;
         }
     }
@@ -1078,23 +1450,35 @@ void NetworkServer::handleBandwidthMode(const network::Header& header,
     broadcastToAll(network::OpCode::S_BANDWIDTH_MODE_CHANGED, serialized);
 
     if (onBandwidthModeChangedCallback_) {
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        callbackQueue_.push([this, userId = client->userId, lowBandwidth]() {
+        queueCallback([this, userId = client->userId, lowBandwidth]() {
             onBandwidthModeChangedCallback_(userId, lowBandwidth);
         });
     }
 }
 
 bool NetworkServer::isLowBandwidthMode(std::uint32_t userId) const {
-    auto keyIt = userIdToKey_.find(userId);
-    if (keyIt == userIdToKey_.end()) {
+    auto slotIt = slotByUserId_.find(userId);
+    if (slotIt == slotByUserId_.end()) {
         return false;
     }
-    auto clientIt = clients_.find(keyIt->second);
-    if (clientIt == clients_.end()) {
-        return false;
+    return slots_[slotIt->second]->lowBandwidthMode;
+}
+
+std::optional<std::uint16_t> NetworkServer::lastInputSeq(
+    std::uint32_t userId) const {
+    auto slotIt = slotByUserId_.find(userId);
+    if (slotIt == slotByUserId_.end()) {
+        return std::nullopt;
+    }
+    return slots_[slotIt->second]->lastInputSeq;
+}
+
+void NetworkServer::acknowledgeInput(std::uint32_t userId,
+                                     std::uint16_t inputSeq) {
+    auto client = findClientByUserId(userId);
+    if (client) {
+        client->lastInputSeq = inputSeq;
     }
-    return clientIt->second->lowBandwidthMode;
 }
 
 void NetworkServer::setClientBandwidthMode(std::uint32_t userId,
@@ -1109,48 +1493,42 @@ void NetworkServer::onBandwidthModeChanged(BandwidthModeCallback callback) {
     onBandwidthModeChangedCallback_ = std::move(callback);
 }
 
-std::string NetworkServer::makeConnectionKey(
-    const network::Endpoint& ep) const {
-    std::ostringstream oss;
-    oss << ep.address << ":" << ep.port;
-    return oss.str();
+std::shared_ptr<NetworkServer::ClientConnection> NetworkServer::findClient(
+    const network::EndpointKey& key) {
+    auto it = slotByKey_.find(key);
+    if (it != slotByKey_.end()) {
+        return slots_[it->second];
+    }
+    return nullptr;
 }
 
 std::shared_ptr<NetworkServer::ClientConnection> NetworkServer::findClient(
     const network::Endpoint& ep) {
-    std::string key = makeConnectionKey(ep);
-    auto it = clients_.find(key);
-    if (it != clients_.end()) {
-        return it->second;
-    }
-    return nullptr;
+    return findClient(network::EndpointKey::from(ep));
 }
 
 std::shared_ptr<NetworkServer::ClientConnection>
 NetworkServer::findClientByUserId(std::uint32_t userId) {
-    auto keyIt = userIdToKey_.find(userId);
-    if (keyIt == userIdToKey_.end()) {
+    auto slotIt = slotByUserId_.find(userId);
+    if (slotIt == slotByUserId_.end()) {
         return nullptr;
     }
-
-    auto clientIt = clients_.find(keyIt->second);
-    if (clientIt != clients_.end()) {
-        return clientIt->second;
-    }
-    return nullptr;
+    return slots_[slotIt->second];
 }
 
 void NetworkServer::removeClient(std::uint32_t userId) {
     std::lock_guard<std::mutex> lock(clientsMutex_);
 
-    auto keyIt = userIdToKey_.find(userId);
-    if (keyIt == userIdToKey_.end()) {
+    auto slotIt = slotByUserId_.find(userId);
+    if (slotIt == slotByUserId_.end()) {
         return;
     }
 
-    std::string key = keyIt->second;
-    userIdToKey_.erase(keyIt);
-    clients_.erase(key);
+    const std::uint32_t slot = slotIt->second;
+    slotByUserId_.erase(slotIt);
+    slotByKey_.erase(slots_[slot]->key);
+    slots_[slot].reset();
+    freeSlots_.push_back(slot);
 
     freeUserIds_.push_back(userId);
 }
@@ -1161,7 +1539,10 @@ void NetworkServer::checkTimeouts() {
 
     {
         std::lock_guard<std::mutex> lock(clientsMutex_);
-        for (auto& [key, client] : clients_) {
+        for (const auto& client : slots_) {
+            if (!client) {
+                continue;
+            }
             auto elapsed =
                 std::chrono::duration_cast<std::chrono::milliseconds>(
                     now - client->lastActivity);
@@ -1189,9 +1570,7 @@ void NetworkServer::checkTimeouts() {
             auto disconnectPacket =
                 buildPacket(network::OpCode::DISCONNECT, serialized,
                             network::kServerUserId, 0, 0, false);
-            socket_->asyncSendTo(
-                disconnectPacket, client->endpoint,
-                [](network::Result<std::size_t> result) { (void)result; });
+            sendRaw(std::move(disconnectPacket), client->endpoint);
         }
 
         queueCallback([this, userId]() {
@@ -1208,16 +1587,19 @@ network::Buffer NetworkServer::buildPacket(network::OpCode opcode,
                                            const network::Buffer& payload,
                                            std::uint32_t userId,
                                            std::uint16_t seqId,
-                                           std::uint16_t ackId, bool reliable) {
+                                           std::uint16_t ackId, bool reliable,
+                                           bool allowDictionary) {
     network::Buffer finalPayload = payload;
-    bool isCompressed = false;
+    std::uint8_t compressionFlag = 0;
 
-    if (config_.enableCompression &&
-        compressor_.shouldCompress(payload.size())) {
-        auto compressionResult = compressor_.compress(payload);
+    if (config_.enableCompression) {
+        auto compressionResult =
+            compressor_.compress(payload, opcode, allowDictionary);
         if (compressionResult.wasCompressed) {
             finalPayload = std::move(compressionResult.data);
-            isCompressed = true;
+            compressionFlag = compressionResult.usedDictionary
+                                  ? network::Flags::kDictCompressed
+                                  : network::Flags::kCompressed;
         }
     }
 
@@ -1236,9 +1618,7 @@ network::Buffer NetworkServer::buildPacket(network::OpCode opcode,
         header.flags |= network::Flags::kReliable;
     }
 
-    if (isCompressed) {
-        header.flags |= network::Flags::kCompressed;
-    }
+    header.flags |= compressionFlag;
 
     network::Buffer packet(network::kHeaderSize + finalPayload.size());
     std::memcpy(packet.data(), &header, network::kHeaderSize);
@@ -1262,7 +1642,7 @@ void NetworkServer::sendToClient(
     std::uint16_t ackId = client->reliableChannel.getLastReceivedSeqId();
 
     auto packet = buildPacket(opcode, payload, network::kServerUserId, seqId,
-                              ackId, reliable);
+                              ackId, reliable, client->dictionaryCompression);
 
     if (reliable) {
         (void)client->reliableChannel.trackOutgoing(seqId, packet);
@@ -1275,15 +1655,15 @@ void NetworkServer::sendToClient(
 
     recordPacketSent(static_cast<std::uint8_t>(opcode), packet.size());
 
-    socket_->asyncSendTo(
-        packet, client->endpoint,
-        [](network::Result<std::size_t> result) { (void)result; });
+    sendRaw(std::move(packet), client->endpoint);
 }
 
 void NetworkServer::broadcastToAll(network::OpCode opcode,
                                    const network::Buffer& payload) {
-    for (const auto& [key, client] : clients_) {
-        sendToClient(client, opcode, payload);
+    for (const auto& client : slots_) {
+        if (client) {
+            sendToClient(client, opcode, payload);
+        }
     }
 }
 
@@ -1298,43 +1678,56 @@ std::uint32_t NetworkServer::nextUserId() {
 
     std::uint32_t id = nextUserIdCounter_++;
 
-    if (nextUserIdCounter_ >= network::kMaxClientUserId) {
+    // A shared socket routes on the high bits, so stay inside our range
+    const std::uint32_t limit = config_.userIdBase != 0
+                                    ? SharedUdpFrontend::kUserIdsPerSlot
+                                    : network::kMaxClientUserId;
+    if (nextUserIdCounter_ >= limit) {
         nextUserIdCounter_ = network::kMinClientUserId;
     }
 
-    return id;
+    return config_.userIdBase + id;
 }
 
 void NetworkServer::recordPacketSent(std::uint8_t opcode, std::size_t bytes) {
-    if (!config_.enablePacketStats) return;
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    sentPackets_[opcode].count++;
-    sentPackets_[opcode].totalBytes += bytes;
+    sentPackets_[opcode].count.fetch_add(1, std::memory_order_relaxed);
+    sentPackets_[opcode].totalBytes.fetch_add(bytes,
+                                              std::memory_order_relaxed);
+    if (_metrics) {
+        _metrics->packetSizeSent.record(bytes);
+    }
 }
 
 void NetworkServer::recordPacketReceived(std::uint8_t opcode,
                                          std::size_t bytes) {
-    if (!config_.enablePacketStats) return;
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    receivedPackets_[opcode].count++;
-    receivedPackets_[opcode].totalBytes += bytes;
+    receivedPackets_[opcode].count.fetch_add(1, std::memory_order_relaxed);
+    receivedPackets_[opcode].totalBytes.fetch_add(bytes,
+                                                  std::memory_order_relaxed);
+    if (_metrics) {
+        _metrics->packetSizeReceived.record(bytes);
+    }
 }
 
 void NetworkServer::printPacketStatistics() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-
     LOG_INFO("=== PACKET STATISTICS ===");
 
     LOG_INFO("--- SENT PACKETS ---");
     std::uint64_t totalSentBytes = 0;
     std::uint64_t totalSentCount = 0;
-    for (const auto& [opcode, stats] : sentPackets_) {
-        totalSentBytes += stats.totalBytes;
-        totalSentCount += stats.count;
+    for (std::size_t opcode = 0; opcode < kOpCodeCount; ++opcode) {
+        const PacketStats& stats = sentPackets_[opcode];
+        const std::uint64_t count = stats.count.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        const std::uint64_t bytes =
+            stats.totalBytes.load(std::memory_order_relaxed);
+        totalSentBytes += bytes;
+        totalSentCount += count;
         LOG_INFO("  OpCode 0x"
-                 << std::hex << static_cast<int>(opcode) << std::dec << ": "
-                 << stats.count << " packets, " << stats.totalBytes
-                 << " bytes, avg " << stats.getAvgSize() << " bytes/pkt");
+                 << std::hex << opcode << std::dec << ": " << count
+                 << " packets, " << bytes << " bytes, avg "
+                 << stats.getAvgSize() << " bytes/pkt");
     }
     LOG_INFO("  TOTAL SENT: " << totalSentCount << " packets, "
                               << totalSentBytes << " bytes ("
@@ -1343,13 +1736,20 @@ void NetworkServer::printPacketStatistics() const {
     LOG_INFO("--- RECEIVED PACKETS ---");
     std::uint64_t totalRecvBytes = 0;
     std::uint64_t totalRecvCount = 0;
-    for (const auto& [opcode, stats] : receivedPackets_) {
-        totalRecvBytes += stats.totalBytes;
-        totalRecvCount += stats.count;
+    for (std::size_t opcode = 0; opcode < kOpCodeCount; ++opcode) {
+        const PacketStats& stats = receivedPackets_[opcode];
+        const std::uint64_t count = stats.count.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        const std::uint64_t bytes =
+            stats.totalBytes.load(std::memory_order_relaxed);
+        totalRecvBytes += bytes;
+        totalRecvCount += count;
         LOG_INFO("  OpCode 0x"
-                 << std::hex << static_cast<int>(opcode) << std::dec << ": "
-                 << stats.count << " packets, " << stats.totalBytes
-                 << " bytes, avg " << stats.getAvgSize() << " bytes/pkt");
+                 << std::hex << opcode << std::dec << ": " << count
+                 << " packets, " << bytes << " bytes, avg "
+                 << stats.getAvgSize() << " bytes/pkt");
     }
     LOG_INFO("  TOTAL RECEIVED: " << totalRecvCount << " packets, "
                                   << totalRecvBytes << " bytes ("
@@ -9,6 +9,7 @@
 #define SRC_SERVER_NETWORK_NETWORKSERVER_HPP_
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
@@ -16,7 +17,6 @@
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <queue>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -24,20 +24,27 @@
 
 #include <asio.hpp>
 
+#include "LockFreeQueue/MpscQueue.hpp"
+#include "LockFreeQueue/SpscQueue.hpp"
 #include "compression/Compressor.hpp"
 #include "connection/ConnectionEvents.hpp"
 #include "core/Types.hpp"
+#include "input/InputHistoryCodec.hpp"
 #include "protocol/Header.hpp"
 #include "protocol/Payloads.hpp"
+#include "core/EndpointKey.hpp"
 #include "protocol/SecurityContext.hpp"
 #include "reliability/ReliableChannel.hpp"
 #include "server/shared/BanManager.hpp"
+#include "snapshot/Snapshot.hpp"
+#include "snapshot/SnapshotRing.hpp"
 #include "transport/AsioUdpSocket.hpp"
 #include "transport/IoContext.hpp"
 
 namespace rtype::server {
 
 class ServerMetrics;
+class SharedUdpFrontend;
 
 /**
  * @brief Configuration for NetworkServer
@@ -48,10 +55,18 @@ struct NetworkServerConfig {
     network::Compressor::Config compressionConfig{};
     bool enableCompression = true;
 
+    /// Log per-opcode packet totals on stop (they are always counted)
     bool enablePacketStats = false;
 
+    /// Replicate entity state through delta-compressed S_SNAPSHOT packets
+    bool enableSnapshotReplication = false;
+
     std::string expectedLobbyCode{};
     std::string levelId{"level_1"};
+
+    /// Added to every assigned user id. Lobbies sharing one socket get
+    /// disjoint ranges so SharedUdpFrontend can route on the id alone.
+    std::uint32_t userIdBase = 0;
 };
 
 /**
@@ -95,7 +110,9 @@ struct NetworkServerConfig {
  * @endcode
  *
  * Thread-safety: Callbacks are queued and dispatched on the thread calling
- * poll(). The network I/O itself is handled via asio's polling model.
+ * poll(). By default poll() also drives the socket through asio's polling
+ * model; when a dedicated thread calls runIoLoop(), socket I/O, validation
+ * and decompression move there and poll() only consumes decoded packets.
  */
 class NetworkServer {
    public:
@@ -132,6 +149,39 @@ class NetworkServer {
      */
     bool start(std::uint16_t port = network::kDefaultPort);
 
+    /**
+     * @brief Start behind a socket shared with other lobbies
+     *
+     * The server opens no socket of its own: the frontend receives every
+     * datagram, hands this server the ones routed to @p slot via deliver(),
+     * and writes what this server sends. User ids are allocated from the
+     * slot's range. poll() then only dispatches delivered packets.
+     *
+     * @param frontend Running frontend, must outlive stop()
+     * @param slot Route slot reserved for this server on the frontend
+     * @return true if started, false if already running or slot is taken
+     */
+    bool startShared(SharedUdpFrontend& frontend, std::size_t slot);
+
+    /**
+     * @brief Hand over a datagram received by a SharedUdpFrontend
+     *
+     * Runs stateless validation and decompression on the caller (the
+     * frontend I/O thread) and queues the packet for the next poll().
+     * Only one thread may deliver to a given server.
+     */
+    void deliver(const network::Buffer& data, const network::Endpoint& sender);
+
+    /**
+     * @brief Register a callback run whenever deliver() queues a packet
+     *
+     * Runs on the receiving thread, so it must be thread-safe; used to wake
+     * a hibernating game loop. Set before start().
+     */
+    void onPacketQueued(std::function<void()> callback) {
+        onPacketQueuedCallback_ = std::move(callback);
+    }
+
     /**
      * @brief Configure expected lobby code for validation
      * @param code 6-char lobby code that clients must send via C_JOIN_LOBBY
@@ -176,7 +226,7 @@ class NetworkServer {
      */
     [[nodiscard]] std::size_t getClientCount() const {
         std::lock_guard lock(clientsMutex_);
-        return clients_.size();
+        return slotByKey_.size();
     }
 
     /**
@@ -235,6 +285,60 @@ class NetworkServer {
         const std::vector<
             std::tuple<std::uint32_t, float, float, float, float>>& entities);
 
+    /**
+     * @brief Send batched entity moves to a single client
+     *
+     * Used by per-client replication, where each client gets its own
+     * selection of entities (see InterestManager).
+     *
+     * @param userId Target client's user ID
+     * @param entities Vector of (entityId, x, y, vx, vy) tuples; at most
+     *        network::kMaxEntitiesPerBatch are sent
+     */
+    void moveEntitiesBatchToClient(
+        std::uint32_t userId,
+        const std::vector<
+            std::tuple<std::uint32_t, float, float, float, float>>& entities);
+
+    /**
+     * @brief Start a new simulation tick
+     *
+     * Every entity update sent afterwards is stamped with this tick, so
+     * clients can place samples on the server timeline (one tick per
+     * simulation step). ServerNetworkSystem calls it once per
+     * broadcastEntityUpdates().
+     *
+     * @return The new tick
+     */
+    std::uint32_t advanceServerTick() noexcept {
+        return serverTickCounter_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+
+    /// Tick stamped on entity updates sent now
+    [[nodiscard]] std::uint32_t serverTick() const noexcept {
+        return serverTickCounter_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Check if snapshot replication mode is enabled
+     * @return true if entity state should go through broadcastSnapshot()
+     */
+    [[nodiscard]] bool isSnapshotReplicationEnabled() const noexcept {
+        return config_.enableSnapshotReplication;
+    }
+
+    /**
+     * @brief Broadcast a delta-compressed world snapshot to all clients
+     *
+     * Each client receives the snapshot encoded against the last snapshot it
+     * acknowledged (C_SNAPSHOT_ACK), or a full snapshot if that baseline is
+     * no longer retained. Sent unreliably: a lost snapshot is simply
+     * superseded, since every delta is built on acknowledged state.
+     *
+     * @param entities Quantized entity states (any order)
+     */
+    void broadcastSnapshot(std::vector<network::EntitySnapshotState> entities);
+
     /**
      * @brief Destroy an entity on all clients
      *
@@ -370,13 +474,17 @@ class NetworkServer {
      * @brief Send position correction to a specific client
      *
      * Used for server-authoritative position reconciliation.
-     * Sent unreliably - represents current authoritative state.
+     * Sent unreliably - represents current authoritative state. Carries the
+     * sequence ID of the last input applied so the client can replay the
+     * inputs sent after it.
      *
      * @param userId Target client's user ID
      * @param x Corrected X position
      * @param y Corrected Y position
+     * @param moveSpeed Speed applied to the held input, 0 if unknown
      */
-    void correctPosition(std::uint32_t userId, float x, float y);
+    void correctPosition(std::uint32_t userId, float x, float y,
+                         float moveSpeed = 0.0F);
 
     /**
      * @brief Send a user list response to a specific client
@@ -411,6 +519,21 @@ class NetworkServer {
         std::function<void(std::uint32_t userId, std::uint16_t input)>
             callback);
 
+    /**
+     * @brief Register callback for redundant client input histories
+     *
+     * C_INPUT packets carrying an input history (see InputHistoryCodec) are
+     * forwarded here instead of onClientInput(). Every packet repeats frames
+     * already received: the receiver dedups them by tick and must report the
+     * last one it applied through acknowledgeInput().
+     *
+     * @param callback Function receiving (userId, frames newest first)
+     */
+    void onClientInputFrames(
+        std::function<void(std::uint32_t userId,
+                           const std::vector<network::InputFrame>& frames)>
+            callback);
+
     /**
      * @brief Register callback for get users request
      * @param callback Function receiving the requesting user ID
@@ -463,9 +586,56 @@ class NetworkServer {
      * - Dispatch queued callbacks to registered handlers
      *
      * Callbacks are executed on the calling thread.
+     *
+     * While runIoLoop() is active on another thread, poll() does not touch
+     * the socket: it only handles packets the I/O thread already decoded.
      */
     void poll();
 
+    /**
+     * @brief Hand socket I/O over to a dedicated thread
+     *
+     * Call on the game thread before spawning the thread that will call
+     * runIoLoop(). From this point poll() and sendRaw() no longer touch the
+     * io_context or the socket, so there is no window where both threads
+     * drive them.
+     *
+     * @return false if the server is not running, uses a shared frontend or
+     *         the loop is already claimed
+     */
+    [[nodiscard]] bool claimIoLoop();
+
+    /**
+     * @brief Undo claimIoLoop() when the I/O thread could not be started
+     */
+    void releaseIoLoop() noexcept;
+
+    /**
+     * @brief Run the socket event loop on the calling thread
+     *
+     * Blocks in asio's run() until stopIoLoop(). Meanwhile, datagrams are
+     * received, validated and decompressed on this thread and handed to
+     * poll() through a lock-free queue. Packets sent from the game thread
+     * are queued and written to the socket here as well.
+     *
+     * Requires a successful claimIoLoop(); returns immediately otherwise.
+     * Ownership goes back to poll() once this returns. Stop the loop before
+     * stop().
+     */
+    void runIoLoop();
+
+    /**
+     * @brief Make runIoLoop() return (callable from any thread)
+     */
+    void stopIoLoop();
+
+    /**
+     * @brief Check whether socket I/O is owned by the runIoLoop() thread
+     */
+    [[nodiscard]] bool isIoLoopRunning() const noexcept {
+        return ioLoopRunning_.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Get list of connected client user IDs
      * @return Vector of connected user IDs
@@ -504,6 +674,25 @@ class NetworkServer {
      */
     [[nodiscard]] bool isLowBandwidthMode(std::uint32_t userId) const;
 
+    /**
+     * @brief Sequence ID of the last input applied for a client
+     * @param userId Client's user ID
+     * @return nullopt if unknown client or no input received yet
+     */
+    [[nodiscard]] std::optional<std::uint16_t> lastInputSeq(
+        std::uint32_t userId) const;
+
+    /**
+     * @brief Record the last input frame applied for a client
+     *
+     * For clients sending input histories the ack carried by S_UPDATE_POS is
+     * the low 16 bits of the last client tick applied, not a header seqId.
+     *
+     * @param userId Client's user ID
+     * @param inputSeq Low 16 bits of the applied frame's tick
+     */
+    void acknowledgeInput(std::uint32_t userId, std::uint16_t inputSeq);
+
     /**
      * @brief Set bandwidth mode for a client
      * @param userId Client's user ID
@@ -535,21 +724,52 @@ class NetworkServer {
      */
     struct ClientConnection {
         network::Endpoint endpoint;
+        network::EndpointKey key;
+        /// Index in slots_, assigned at connect time
+        std::uint32_t slot{0};
         std::uint32_t userId;
         network::ReliableChannel reliableChannel;
         std::chrono::steady_clock::time_point lastActivity;
         std::uint16_t nextSeqId{0};
         bool joined{false};
         bool lowBandwidthMode{false};
+        network::SnapshotHistory snapshotHistory;
+        std::uint32_t lastAckedSnapshotTick{0};
+        /// Client offered our dictionary set (C_COMPRESSION_OFFER)
+        bool dictionaryCompression{false};
+        /// Last input applied, acked in S_UPDATE_POS: header seqId of a
+        /// single-mask C_INPUT, or tick of a history frame (acknowledgeInput)
+        std::optional<std::uint16_t> lastInputSeq;
 
         explicit ClientConnection(const network::Endpoint& ep, std::uint32_t id,
                                   const network::ReliableChannel::Config& cfg)
             : endpoint(ep),
+              key(network::EndpointKey::from(ep)),
               userId(id),
               reliableChannel(cfg),
               lastActivity(std::chrono::steady_clock::now()) {}
     };
 
+    /**
+     * @brief Datagram that passed stateless validation and decompression
+     *
+     * Everything needing client state (user id mapping, sequence window,
+     * acks, handlers) is left to dispatchPacket() on the game thread.
+     */
+    struct DecodedPacket {
+        network::Header header{};
+        network::Buffer payload;
+        network::Endpoint sender;
+        /// Parsed once on the receiving thread, used for every lookup
+        network::EndpointKey senderKey;
+    };
+
+    /// Packet to write to the socket from the I/O thread
+    struct OutgoingPacket {
+        network::Buffer data;
+        network::Endpoint destination;
+    };
+
     void dispatchCallbacks();
     void queueCallback(std::function<void()> callback);
 
@@ -557,6 +777,13 @@ class NetworkServer {
     void handleReceive(network::Result<std::size_t> result);
     void processIncomingPacket(const network::Buffer& data,
                                const network::Endpoint& sender);
+    [[nodiscard]] std::optional<DecodedPacket> decodePacket(
+        const network::Buffer& data, const network::Endpoint& sender);
+    void dispatchPacket(const DecodedPacket& packet);
+    void dispatchDecodedPackets();
+
+    void sendRaw(network::Buffer packet, const network::Endpoint& dest);
+    void flushOutgoing();
 
     void handleConnect(const network::Header& header,
                        const network::Buffer& payload,
@@ -587,9 +814,15 @@ class NetworkServer {
     void handleAdminCommand(const network::Header& header,
                             const network::Buffer& payload,
                             const network::Endpoint& sender);
+    void handleSnapshotAck(const network::Header& header,
+                           const network::Buffer& payload,
+                           const network::Endpoint& sender);
+    void handleCompressionOffer(const network::Header& header,
+                                const network::Buffer& payload,
+                                const network::Endpoint& sender);
 
-    [[nodiscard]] std::string makeConnectionKey(
-        const network::Endpoint& ep) const;
+    [[nodiscard]] std::shared_ptr<ClientConnection> findClient(
+        const network::EndpointKey& key);
     [[nodiscard]] std::shared_ptr<ClientConnection> findClient(
         const network::Endpoint& ep);
     [[nodiscard]] std::shared_ptr<ClientConnection> findClientByUserId(
@@ -612,16 +845,18 @@ class NetworkServer {
         return static_cast<std::int16_t>(rounded);
     }
 
-    [[nodiscard]] std::uint32_t nextServerTick() noexcept {
-        return serverTickCounter_.fetch_add(1, std::memory_order_acq_rel) + 1;
-    }
+    /// S_ENTITY_MOVE_BATCH payload of the first kMaxEntitiesPerBatch moves
+    [[nodiscard]] network::Buffer encodeMoveBatch(
+        const std::vector<
+            std::tuple<std::uint32_t, float, float, float, float>>& entities);
 
     [[nodiscard]] network::Buffer buildPacket(network::OpCode opcode,
                                               const network::Buffer& payload,
                                               std::uint32_t userId,
                                               std::uint16_t seqId,
                                               std::uint16_t ackId,
-                                              bool reliable);
+                                              bool reliable,
+                                              bool allowDictionary = false);
     void sendToClient(const std::shared_ptr<ClientConnection>& client,
                       network::OpCode opcode, const network::Buffer& payload);
     void broadcastToAll(network::OpCode opcode, const network::Buffer& payload);
@@ -630,35 +865,59 @@ class NetworkServer {
     Config config_;
     network::Compressor compressor_;
 
-    bool running_{false};
+    std::atomic<bool> running_{false};
 
     network::IoContext ioContext_;
 
     std::unique_ptr<network::IAsyncSocket> socket_;
 
-    network::SecurityContext securityContext_;
+    /// Set by startShared(): sends go through the frontend instead of socket_
+    SharedUdpFrontend* frontend_{nullptr};
+    std::size_t frontendSlot_{0};
 
-    std::unordered_map<std::string, std::shared_ptr<ClientConnection>> clients_;
+    network::SecurityContext securityContext_;
 
-    std::unordered_map<std::uint32_t, std::string> userIdToKey_;
+    /// Connections indexed by ClientConnection::slot (nullptr when free)
+    std::vector<std::shared_ptr<ClientConnection>> slots_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::unordered_map<network::EndpointKey, std::uint32_t> slotByKey_;
+    std::unordered_map<std::uint32_t, std::uint32_t> slotByUserId_;
 
     std::vector<std::uint32_t> freeUserIds_;
 
     std::uint32_t nextUserIdCounter_{1};
 
     std::atomic<std::uint32_t> serverTickCounter_{0};
+    std::uint32_t lastSnapshotTick_{0};  ///< Snapshots never share a tick
 
     std::shared_ptr<network::Buffer> receiveBuffer_;
     std::shared_ptr<network::Endpoint> receiveSender_;
     std::atomic<bool> receiveInProgress_{false};
 
+    static constexpr std::size_t kIoQueueCapacity = 8192;
+    static constexpr std::size_t kIoDispatchBatch = 64;
+
+    /// I/O thread -> game thread, filled while runIoLoop() is active or by
+    /// a SharedUdpFrontend
+    SpscQueue<DecodedPacket> inboundPackets_{kIoQueueCapacity};
+    /// Any sender -> I/O thread, drained by flushOutgoing()
+    MpscQueue<OutgoingPacket> outboundPackets_{kIoQueueCapacity};
+    std::atomic<bool> ioLoopRunning_{false};
+    std::atomic<bool> flushPosted_{false};
+
     mutable std::mutex callbackMutex_;
-    std::queue<std::function<void()>> callbackQueue_;
 
+    static constexpr std::size_t kCallbackQueueCapacity = 4096;
+    static constexpr std::size_t kCallbackDispatchBatch = 64;
+    MpscQueue<std::function<void()>> callbackQueue_{kCallbackQueueCapacity};
+
+    std::function<void()> onPacketQueuedCallback_;
     std::function<void(std::uint32_t)> onClientConnectedCallback_;
     std::function<void(std::uint32_t, network::DisconnectReason)>
         onClientDisconnectedCallback_;
     std::function<void(std::uint32_t, std::uint16_t)> onClientInputCallback_;
+    std::function<void(std::uint32_t, const std::vector<network::InputFrame>&)>
+        onClientInputFramesCallback_;
     std::function<void(std::uint32_t)> onGetUsersRequestCallback_;
     std::function<void(std::uint32_t, bool)> onClientReadyCallback_;
     std::function<void(std::uint32_t, const std::string&)>
@@ -676,19 +935,24 @@ class NetworkServer {
 
     std::shared_ptr<ServerMetrics> _metrics{nullptr};
 
+    /// Per-opcode totals, always recorded: two relaxed adds, no lock
     struct PacketStats {
-        std::uint64_t count{0};
-        std::uint64_t totalBytes{0};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> totalBytes{0};
 
         double getAvgSize() const {
-            return count > 0 ? static_cast<double>(totalBytes) / count : 0.0;
+            const std::uint64_t packets = count.load(std::memory_order_relaxed);
+            return packets > 0 ? static_cast<double>(totalBytes.load(
+                                     std::memory_order_relaxed)) /
+                                     packets
+                               : 0.0;
         }
     };
 
-    std::unordered_map<std::uint8_t, PacketStats>
-        sentPackets_;  // opcode -> stats
-    std::unordered_map<std::uint8_t, PacketStats> receivedPackets_;
-    mutable std::mutex statsMutex_;
+    static constexpr std::size_t kOpCodeCount = 256;
+
+    std::array<PacketStats, kOpCodeCount> sentPackets_{};  // By opcode
+    std::array<PacketStats, kOpCodeCount> receivedPackets_{};
 
    public:
     void setBanManager(std::shared_ptr<BanManager> bm) { banManager_ = bm; }
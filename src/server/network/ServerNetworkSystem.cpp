@@ -7,7 +7,6 @@
 
 #include "ServerNetworkSystem.hpp"
 
-#include <cmath>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -27,34 +26,14 @@ static constexpr float VIEWPORT_HEIGHT =
     rtype::games::rtype::server::GameConfig::SCREEN_HEIGHT;
 static constexpr float VIEWPORT_MARGIN = 100.0F;
 
-// ============================================================================
-// NORMAL BANDWIDTH MODE - Full update rates for good connections
-// ============================================================================
+// Snapshot cadence (ticks); the batch path budgets each client instead, see
+// InterestManager
 namespace NormalMode {
-static constexpr std::uint32_t PLAYER_UPDATE_INTERVAL = 1;
-static constexpr std::uint32_t ENEMY_UPDATE_INTERVAL = 4;
-static constexpr std::uint32_t PROJECTILE_UPDATE_INTERVAL = 2;
-static constexpr float PLAYER_POSITION_DELTA = 20.0F;
-static constexpr float PLAYER_VELOCITY_DELTA = 50.0F;
-static constexpr float ENEMY_POSITION_DELTA = 30.0F;
-static constexpr float ENEMY_VELOCITY_DELTA = 60.0F;
-static constexpr float PROJECTILE_POSITION_DELTA = 40.0F;
-static constexpr float PROJECTILE_VELOCITY_DELTA = 80.0F;
+static constexpr std::uint32_t SNAPSHOT_INTERVAL = 1;
 }  // namespace NormalMode
 
-// ============================================================================
-// LOW BANDWIDTH MODE - Reduced rates for constrained connections (~5 KB/s)
-// ============================================================================
 namespace LowBandwidthMode {
-static constexpr std::uint32_t PLAYER_UPDATE_INTERVAL = 6;
-static constexpr std::uint32_t ENEMY_UPDATE_INTERVAL = 180;
-static constexpr std::uint32_t PROJECTILE_UPDATE_INTERVAL = 360;
-static constexpr float PLAYER_POSITION_DELTA = 40.0F;
-static constexpr float PLAYER_VELOCITY_DELTA = 80.0F;
-static constexpr float ENEMY_POSITION_DELTA = 200.0F;
-static constexpr float ENEMY_VELOCITY_DELTA = 200.0F;
-static constexpr float PROJECTILE_POSITION_DELTA = 300.0F;
-static constexpr float PROJECTILE_VELOCITY_DELTA = 250.0F;
+static constexpr std::uint32_t SNAPSHOT_INTERVAL = 6;
 }  // namespace LowBandwidthMode
 
 static bool isEntityVisible(float x, float y) {
@@ -80,6 +59,14 @@ ServerNetworkSystem::ServerNetworkSystem(
                 handleClientInput(userId, input);
             });
 
+        server_->onClientInputFrames(
+            [this](std::uint32_t userId,
+                   const std::vector<network::InputFrame>& frames) {
+                if (inputFramesHandler_) {
+                    inputFramesHandler_(userId, frames);
+                }
+            });
+
         server_->onGetUsersRequest(
             [this](std::uint32_t userId) { handleGetUsersRequest(userId); });
 
@@ -189,21 +176,40 @@ void ServerNetworkSystem::unregisterNetworkedEntityById(
 
     ECS::Entity entity = it->second.entity;
 
-    if (!entity.isNull()) {
-        entityToNetworkId_.erase(entity.id);
+    // Pooled entities keep their handle across lives: only touch the
+    // mapping and the entity while they still belong to this network id.
+    auto mapped = entityToNetworkId_.find(entity.id);
+    if (!entity.isNull() && mapped != entityToNetworkId_.end() &&
+        mapped->second == networkId) {
+        entityToNetworkId_.erase(mapped);
     }
 
     networkedEntities_.erase(it);
+    interest_.removeEntity(networkId);
 
     if (server_) {
         server_->destroyEntity(networkId);
     }
 
-    if (registry_ && !entity.isNull() && registry_->isAlive(entity)) {
+    if (registry_ && !entity.isNull() && registry_->isAlive(entity) &&
+        ownsNetworkId(entity, networkId)) {
         registry_->killEntity(entity);
     }
 }
 
+bool ServerNetworkSystem::ownsNetworkId(ECS::Entity entity,
+                                        std::uint32_t networkId) const {
+    using rtype::games::rtype::shared::NetworkIdComponent;
+    if (registry_->hasComponent<ECS::Inactive>(entity)) {
+        return false;
+    }
+    if (!registry_->hasComponent<NetworkIdComponent>(entity)) {
+        return true;
+    }
+    return registry_->getComponent<NetworkIdComponent>(entity).networkId ==
+           networkId;
+}
+
 void ServerNetworkSystem::setPlayerEntity(std::uint32_t userId,
                                           ECS::Entity entity) {
     userIdToEntity_[userId] = entity;
@@ -222,6 +228,28 @@ void ServerNetworkSystem::setInputHandler(InputHandler handler) {
     inputHandler_ = std::move(handler);
 }
 
+void ServerNetworkSystem::setInputFramesHandler(InputFramesHandler handler) {
+    inputFramesHandler_ = std::move(handler);
+}
+
+void ServerNetworkSystem::acknowledgeInput(std::uint32_t userId,
+                                           std::uint16_t inputSeq) {
+    if (server_) {
+        server_->acknowledgeInput(userId, inputSeq);
+    }
+}
+
+void ServerNetworkSystem::setPlayerMoveSpeed(std::uint32_t userId,
+                                             float speed) {
+    playerMoveSpeeds_[userId] = speed;
+}
+
+float ServerNetworkSystem::playerMoveSpeed(std::uint32_t userId) const {
+    auto it = playerMoveSpeeds_.find(userId);
+    return it != playerMoveSpeeds_.end() ? it->second
+                                         : defaultPlayerMoveSpeed_;
+}
+
 void ServerNetworkSystem::onClientConnected(
     std::function<void(std::uint32_t userId)> callback) {
     onClientConnectedCallback_ = std::move(callback);
@@ -268,16 +296,29 @@ void ServerNetworkSystem::updateEntityPosition(std::uint32_t networkId, float x,
 void ServerNetworkSystem::correctPlayerPosition(std::uint32_t userId, float x,
                                                 float y) {
     if (server_) {
-        server_->correctPosition(userId, x, y);
+        server_->correctPosition(userId, x, y, playerMoveSpeed(userId));
     }
 }
 
 void ServerNetworkSystem::updateEntityHealth(std::uint32_t networkId,
                                              std::int32_t current,
                                              std::int32_t max) {
-    if (server_) {
-        server_->updateEntityHealth(networkId, current, max);
+    if (!server_) {
+        return;
+    }
+
+    if (server_->isSnapshotReplicationEnabled()) {
+        auto it = networkedEntities_.find(networkId);
+        if (it != networkedEntities_.end() &&
+            it->second.type != EntityType::Player) {
+            // Player lives stay on the reliable channel (HUD, game over)
+            it->second.health = current;
+            it->second.maxHealth = max;
+            return;
+        }
     }
+
+    server_->updateEntityHealth(networkId, current, max);
 }
 
 void ServerNetworkSystem::broadcastPowerUp(std::uint32_t playerNetworkId,
@@ -289,102 +330,133 @@ void ServerNetworkSystem::broadcastPowerUp(std::uint32_t playerNetworkId,
 }
 
 void ServerNetworkSystem::broadcastEntityUpdates() {
-    std::vector<std::tuple<std::uint32_t, float, float, float, float>>
-        dirtyEntities;
-
-    bool lowBandwidth = lowBandwidthModeActive_.load(std::memory_order_acquire);
-
-    std::uint32_t playerInterval, enemyInterval, projectileInterval;
-    float playerPosDelta, playerVelDelta;
-    float enemyPosDelta, enemyVelDelta;
-    float projectilePosDelta, projectileVelDelta;
-
-    if (lowBandwidth) {
-        playerInterval = LowBandwidthMode::PLAYER_UPDATE_INTERVAL;
-        enemyInterval = LowBandwidthMode::ENEMY_UPDATE_INTERVAL;
-        projectileInterval = LowBandwidthMode::PROJECTILE_UPDATE_INTERVAL;
-        playerPosDelta = LowBandwidthMode::PLAYER_POSITION_DELTA;
-        playerVelDelta = LowBandwidthMode::PLAYER_VELOCITY_DELTA;
-        enemyPosDelta = LowBandwidthMode::ENEMY_POSITION_DELTA;
-        enemyVelDelta = LowBandwidthMode::ENEMY_VELOCITY_DELTA;
-        projectilePosDelta = LowBandwidthMode::PROJECTILE_POSITION_DELTA;
-        projectileVelDelta = LowBandwidthMode::PROJECTILE_VELOCITY_DELTA;
-    } else {
-        playerInterval = NormalMode::PLAYER_UPDATE_INTERVAL;
-        enemyInterval = NormalMode::ENEMY_UPDATE_INTERVAL;
-        projectileInterval = NormalMode::PROJECTILE_UPDATE_INTERVAL;
-        playerPosDelta = NormalMode::PLAYER_POSITION_DELTA;
-        playerVelDelta = NormalMode::PLAYER_VELOCITY_DELTA;
-        enemyPosDelta = NormalMode::ENEMY_POSITION_DELTA;
-        enemyVelDelta = NormalMode::ENEMY_VELOCITY_DELTA;
-        projectilePosDelta = NormalMode::PROJECTILE_POSITION_DELTA;
-        projectileVelDelta = NormalMode::PROJECTILE_VELOCITY_DELTA;
+    if (server_) {
+        server_->advanceServerTick();
+        sendPlayerCorrections();
+    }
+    if (server_ && server_->isSnapshotReplicationEnabled()) {
+        broadcastSnapshot();
+        return;
     }
 
+    candidates_.clear();
     for (auto& [networkId, info] : networkedEntities_) {
-        info.ticksSinceLastSend++;
+        const bool changed = info.dirty;
+        info.dirty = false;
 
-        if (!info.dirty) {
+        if (!isEntityVisible(info.lastX, info.lastY)) {
             continue;
         }
+        candidates_.push_back({networkId, info.type, info.lastX, info.lastY,
+                               info.lastVx, info.lastVy, changed});
+    }
 
-        if (!isEntityVisible(info.lastX, info.lastY)) {
-            info.dirty = false;
+    if (candidates_.empty() || !server_) {
+        return;
+    }
+
+    for (std::uint32_t userId : server_->getConnectedClients()) {
+        const std::size_t budget =
+            server_->isLowBandwidthMode(userId)
+                ? InterestManager::kLowBandwidthByteBudget
+                : InterestManager::kDefaultByteBudget;
+        interest_.select(userId, shipPosition(userId), budget, candidates_,
+                         selected_);
+        if (selected_.empty()) {
             continue;
         }
 
-        float posDelta = std::abs(info.lastX - info.lastSentX) +
-                         std::abs(info.lastY - info.lastSentY);
-        float velDelta = std::abs(info.lastVx - info.lastSentVx) +
-                         std::abs(info.lastVy - info.lastSentVy);
-
-        std::uint32_t updateInterval = playerInterval;
-        float posThreshold = playerPosDelta;
-        float velThreshold = playerVelDelta;
-        if (info.type == EntityType::Bydos ||
-            info.type == EntityType::Obstacle ||
-            info.type == EntityType::Boss ||
-            info.type == EntityType::BossPart) {
-            updateInterval = enemyInterval;
-            posThreshold = enemyPosDelta;
-            velThreshold = enemyVelDelta;
-        } else if (info.type == EntityType::Missile) {
-            updateInterval = projectileInterval;
-            posThreshold = projectilePosDelta;
-            velThreshold = projectileVelDelta;
+        batch_.clear();
+        for (std::size_t index : selected_) {
+            const auto& candidate = candidates_[index];
+            batch_.emplace_back(candidate.networkId, candidate.x, candidate.y,
+                                candidate.vx, candidate.vy);
+            if (batch_.size() == network::kMaxEntitiesPerBatch) {
+                server_->moveEntitiesBatchToClient(userId, batch_);
+                batch_.clear();
+            }
         }
+        server_->moveEntitiesBatchToClient(userId, batch_);
+    }
+}
 
-        bool shouldSend = (info.ticksSinceLastSend >= updateInterval) ||
-                          (posDelta > posThreshold) ||
-                          (velDelta > velThreshold);
-
-        if (shouldSend) {
-            dirtyEntities.emplace_back(networkId, info.lastX, info.lastY,
-                                       info.lastVx, info.lastVy);
-            info.lastSentX = info.lastX;
-            info.lastSentY = info.lastY;
-            info.lastSentVx = info.lastVx;
-            info.lastSentVy = info.lastVy;
-            info.ticksSinceLastSend = 0;
+std::optional<std::pair<float, float>> ServerNetworkSystem::shipPosition(
+    std::uint32_t userId) const {
+    auto entityIt = userIdToEntity_.find(userId);
+    if (entityIt == userIdToEntity_.end()) {
+        return std::nullopt;
+    }
+    auto idIt = entityToNetworkId_.find(entityIt->second.id);
+    if (idIt == entityToNetworkId_.end()) {
+        return std::nullopt;
+    }
+    auto it = networkedEntities_.find(idIt->second);
+    if (it == networkedEntities_.end()) {
+        return std::nullopt;
+    }
+    return std::make_pair(it->second.lastX, it->second.lastY);
+}
+
+void ServerNetworkSystem::sendPlayerCorrections() {
+    for (const auto& [userId, _] : userIdToEntity_) {
+        auto ship = shipPosition(userId);
+        if (!ship) {
+            continue;
+        }
+        const auto ack = server_->lastInputSeq(userId);
+        const float speed = playerMoveSpeed(userId);
+
+        auto [it, inserted] = corrections_.try_emplace(userId);
+        auto& sent = it->second;
+        const bool changed = inserted || sent.x != ship->first ||
+                             sent.y != ship->second ||
+                             sent.ackInputSeq != ack || sent.moveSpeed != speed;
+        if (!changed && ++sent.ticksSinceSent < CORRECTION_REFRESH_TICKS) {
+            continue;
         }
 
-        info.dirty = false;
+        sent = {ship->first, ship->second, ack, speed, 0};
+        server_->correctPosition(userId, ship->first, ship->second, speed);
     }
+}
 
-    if (dirtyEntities.empty()) {
+void ServerNetworkSystem::broadcastSnapshot() {
+    bool lowBandwidth = lowBandwidthModeActive_.load(std::memory_order_acquire);
+    std::uint32_t interval = lowBandwidth ? LowBandwidthMode::SNAPSHOT_INTERVAL
+                                          : NormalMode::SNAPSHOT_INTERVAL;
+
+    if (++ticksSinceLastSnapshot_ < interval) {
         return;
     }
+    ticksSinceLastSnapshot_ = 0;
 
-    constexpr std::size_t maxPerBatch = network::kMaxEntitiesPerBatch;
+    std::vector<network::EntitySnapshotState> states;
+    states.reserve(networkedEntities_.size());
 
-    for (std::size_t offset = 0; offset < dirtyEntities.size();
-         offset += maxPerBatch) {
-        auto end = std::min(offset + maxPerBatch, dirtyEntities.size());
-        std::vector<std::tuple<std::uint32_t, float, float, float, float>>
-            batch(dirtyEntities.begin() + static_cast<std::ptrdiff_t>(offset),
-                  dirtyEntities.begin() + static_cast<std::ptrdiff_t>(end));
-        server_->moveEntitiesBatch(batch);
-    }
+    for (auto& [networkId, info] : networkedEntities_) {
+        info.dirty = false;
+
+        if (!isEntityVisible(info.lastX, info.lastY)) {
+            continue;
+        }
+
+        network::EntitySnapshotState state;
+        state.networkId = networkId;
+        state.type = static_cast<std::uint8_t>(info.type);
+        state.posX = network::quantizeSnapshotValue(info.lastX,
+                                                    network::kSnapshotPosScale);
+        state.posY = network::quantizeSnapshotValue(info.lastY,
+                                                    network::kSnapshotPosScale);
+        state.velX = network::quantizeSnapshotValue(info.lastVx,
+                                                    network::kSnapshotVelScale);
+        state.velY = network::quantizeSnapshotValue(info.lastVy,
+                                                    network::kSnapshotVelScale);
+        state.health = info.health;
+        state.maxHealth = info.maxHealth;
+        states.push_back(state);
+    }
+
+    server_->broadcastSnapshot(std::move(states));
 }
 
 void ServerNetworkSystem::broadcastEntitySpawn(std::uint32_t networkId,
@@ -444,6 +516,11 @@ void ServerNetworkSystem::broadcastEntitySpawn(std::uint32_t networkId,
                               std::to_string(networkId) + ": " +
                               std::to_string(health.current) + "/" +
                               std::to_string(health.max));
+            if (type != EntityType::Player) {
+                auto& tracked = networkedEntities_[networkId];
+                tracked.health = health.current;
+                tracked.maxHealth = health.max;
+            }
             server_->updateEntityHealth(networkId, health.current, health.max);
         } else {
             LOG_DEBUG_CAT(::rtype::LogCategory::Network,
@@ -484,10 +561,14 @@ void ServerNetworkSystem::resetState() {
     }
 
     networkedEntities_.clear();
+    interest_.clear();
+    corrections_.clear();
+    playerMoveSpeeds_.clear();
     entityToNetworkId_.clear();
     userIdToEntity_.clear();
     pendingDisconnections_.clear();
     nextNetworkIdCounter_ = 1;
+    ticksSinceLastSnapshot_ = 0;
 
     lowBandwidthClientCount_.store(0, std::memory_order_release);
     lowBandwidthModeActive_.store(false, std::memory_order_release);
@@ -546,6 +627,9 @@ void ServerNetworkSystem::handleClientConnected(std::uint32_t userId) {
         }
         pendingDisconnections_.erase(pendingIt);
     }
+    interest_.removeClient(userId);
+    corrections_.erase(userId);
+    playerMoveSpeeds_.erase(userId);
 
     for (const auto& [networkId, info] : networkedEntities_) {
         std::uint8_t subType = 0;
@@ -640,6 +724,9 @@ void ServerNetworkSystem::finalizeDisconnection(std::uint32_t userId) {
         }
         userIdToEntity_.erase(it);
     }
+    interest_.removeClient(userId);
+    corrections_.erase(userId);
+    playerMoveSpeeds_.erase(userId);
 
     LOG_INFO_CAT(
         ::rtype::LogCategory::Network,
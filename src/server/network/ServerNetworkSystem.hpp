@@ -9,15 +9,20 @@
 #define SRC_SERVER_NETWORK_SERVERNETWORKSYSTEM_HPP_
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <rtype/ecs.hpp>
 
+#include "InterestManager.hpp"
 #include "NetworkServer.hpp"
 #include "protocol/Payloads.hpp"
 
@@ -29,7 +34,7 @@ namespace rtype::server {
  *
  * This system handles:
  * - Broadcasting entity spawns to all clients
- * - Broadcasting entity movement updates
+ * - Broadcasting entity movement updates, prioritised per client
  * - Broadcasting entity destruction
  * - Tracking which entities are networked
  * - Processing client inputs and routing to game logic
@@ -77,6 +82,16 @@ class ServerNetworkSystem {
         std::function<void(std::uint32_t userId, std::uint16_t inputMask,
                            std::optional<ECS::Entity> entity)>;
 
+    /**
+     * @brief Callback type for redundant input histories
+     *
+     * Receives every decoded frame, newest first, including ones already
+     * received in earlier packets.
+     */
+    using InputFramesHandler =
+        std::function<void(std::uint32_t userId,
+                           const std::vector<network::InputFrame>& frames)>;
+
     /**
      * @brief Construct a new ServerNetworkSystem
      *
@@ -155,6 +170,41 @@ class ServerNetworkSystem {
      */
     void setInputHandler(InputHandler handler);
 
+    /**
+     * @brief Set the handler for redundant input histories
+     *
+     * @param handler Function buffering the frames (see InputJitterBuffer)
+     */
+    void setInputFramesHandler(InputFramesHandler handler);
+
+    /**
+     * @brief Report the last input frame applied for a player
+     *
+     * Sent back to the client in S_UPDATE_POS for reconciliation.
+     *
+     * @param userId The client's user ID
+     * @param inputSeq Low 16 bits of the applied frame's tick
+     */
+    void acknowledgeInput(std::uint32_t userId, std::uint16_t inputSeq);
+
+    /**
+     * @brief Report the speed a player's held input moves its ship at
+     *
+     * Sent in S_UPDATE_POS so the client predicts with the speed the server
+     * actually applies (configured speed and speed modifiers).
+     *
+     * @param userId The client's user ID
+     * @param speed Speed in px/s per axis
+     */
+    void setPlayerMoveSpeed(std::uint32_t userId, float speed);
+
+    /**
+     * @brief Speed reported for players that sent no input yet
+     */
+    void setDefaultPlayerMoveSpeed(float speed) noexcept {
+        defaultPlayerMoveSpeed_ = speed;
+    }
+
     /**
      * @brief Register callback for client connection
      *
@@ -207,10 +257,17 @@ class ServerNetworkSystem {
      */
     void correctPlayerPosition(std::uint32_t userId, float x, float y);
 
+    /// Speed sent to a player in S_UPDATE_POS (0 if unknown)
+    [[nodiscard]] float playerMoveSpeed(std::uint32_t userId) const;
+
     /**
      * @brief Broadcast all pending entity updates
      *
-     * Call this after updating entity positions in your game loop.
+     * Call this once per simulation tick, after updating entity positions:
+     * it advances the server tick stamped on updates. Each client gets its
+     * own S_ENTITY_MOVE_BATCH holding the visible entities with the highest
+     * replication priority for it, within its per-tick byte budget (see
+     * InterestManager).
      */
     void broadcastEntityUpdates();
 
@@ -296,6 +353,33 @@ class ServerNetworkSystem {
     void handleClientChat(std::uint32_t userId, const std::string& message);
     void handleGetUsersRequest(std::uint32_t userId);
 
+    /**
+     * @brief Whether an entity still is the one registered under networkId
+     *
+     * False once a pooled entity was parked or reused for another id.
+     */
+    [[nodiscard]] bool ownsNetworkId(ECS::Entity entity,
+                                     std::uint32_t networkId) const;
+
+    /**
+     * @brief Build the visible world state and send it as a snapshot
+     *
+     * Replaces the per-entity batch path when snapshot replication is on.
+     */
+    void broadcastSnapshot();
+
+    /// Last known position of a client's ship, for distance priority
+    [[nodiscard]] std::optional<std::pair<float, float>> shipPosition(
+        std::uint32_t userId) const;
+
+    /**
+     * @brief Send each player its ship state and last applied input
+     *
+     * Sent when the ship moved or a new input was applied, and refreshed
+     * every CORRECTION_REFRESH_TICKS since S_UPDATE_POS is unreliable.
+     */
+    void sendPlayerCorrections();
+
     struct NetworkedEntity {
         ECS::Entity entity;
         std::uint32_t networkId;
@@ -305,11 +389,8 @@ class ServerNetworkSystem {
         float lastVx{0};
         float lastVy{0};
         bool dirty{false};
-        float lastSentX{0};
-        float lastSentY{0};
-        float lastSentVx{0};
-        float lastSentVy{0};
-        std::uint32_t ticksSinceLastSend{0};
+        std::int32_t health{0};     ///< Replicated via snapshots only
+        std::int32_t maxHealth{0};  ///< Replicated via snapshots only
     };
 
     std::shared_ptr<ECS::Registry> registry_;
@@ -319,6 +400,7 @@ class ServerNetworkSystem {
     std::unordered_map<std::uint32_t, ECS::Entity> userIdToEntity_;
     std::uint32_t nextNetworkIdCounter_{1};
     InputHandler inputHandler_;
+    InputFramesHandler inputFramesHandler_;
     std::function<void(std::uint32_t)> onClientConnectedCallback_;
     std::function<void(std::uint32_t)> onClientDisconnectedCallback_;
 
@@ -332,6 +414,27 @@ class ServerNetworkSystem {
     std::unordered_map<std::uint32_t, PendingDisconnection>
         pendingDisconnections_;
 
+    std::uint32_t ticksSinceLastSnapshot_{0};
+
+    static constexpr std::uint32_t CORRECTION_REFRESH_TICKS = 30;
+
+    struct SentCorrection {
+        float x{0};
+        float y{0};
+        std::optional<std::uint16_t> ackInputSeq;
+        float moveSpeed{0};
+        std::uint32_t ticksSinceSent{0};
+    };
+    std::unordered_map<std::uint32_t, SentCorrection> corrections_;
+    std::unordered_map<std::uint32_t, float> playerMoveSpeeds_;
+    float defaultPlayerMoveSpeed_{0};
+
+    InterestManager interest_;
+    /// Per-tick scratch, kept to avoid reallocating every broadcast
+    std::vector<InterestManager::Candidate> candidates_;
+    std::vector<std::size_t> selected_;
+    std::vector<std::tuple<std::uint32_t, float, float, float, float>> batch_;
+
     std::atomic<bool> lowBandwidthModeActive_{false};
     std::atomic<std::uint32_t> lowBandwidthClientCount_{0};
 
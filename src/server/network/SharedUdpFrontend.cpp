@@ -0,0 +1,245 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** SharedUdpFrontend - Implementation
+*/
+
+#include "SharedUdpFrontend.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <string>
+#include <utility>
+
+#include "Logger/Macros.hpp"
+#include "NetworkServer.hpp"
+#include "protocol/ByteOrderSpec.hpp"
+#include "protocol/Header.hpp"
+#include "protocol/OpCode.hpp"
+#include "protocol/Payloads.hpp"
+
+namespace rtype::server {
+
+SharedUdpFrontend::SharedUdpFrontend()
+    : socket_(network::createAsyncSocket(ioContext_.get())),
+      receiveBuffer_(
+          std::make_shared<network::Buffer>(network::kMaxPacketSize)),
+      receiveSender_(std::make_shared<network::Endpoint>()) {}
+
+SharedUdpFrontend::~SharedUdpFrontend() { stop(); }
+
+bool SharedUdpFrontend::start(std::uint16_t port) {
+    if (running_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    auto bindResult = socket_->bind(port);
+    if (!bindResult) {
+        LOG_ERROR_CAT(::rtype::LogCategory::Network,
+                      "[SharedUdpFrontend] Failed to bind port " << port);
+        return false;
+    }
+
+    running_.store(true, std::memory_order_release);
+    startReceive();
+    ioContext_.runInBackground();
+
+    LOG_INFO_CAT(::rtype::LogCategory::Network,
+                 "[SharedUdpFrontend] Listening on port "
+                     << socket_->localPort());
+    return true;
+}
+
+void SharedUdpFrontend::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    // Join the I/O thread, then write what is still queued from here
+    ioContext_.stop();
+    ioContext_.restart();
+    flushOutgoing();
+    socket_->cancel();
+    ioContext_.poll();
+    socket_->close();
+
+    LOG_INFO_CAT(::rtype::LogCategory::Network,
+                 "[SharedUdpFrontend] Stopped (routed="
+                     << routedPackets() << " unrouted=" << unroutedPackets()
+                     << " droppedSends=" << droppedSends() << ")");
+}
+
+std::uint16_t SharedUdpFrontend::port() const noexcept {
+    if (!running_.load(std::memory_order_acquire)) {
+        return 0;
+    }
+    return socket_->localPort();
+}
+
+bool SharedUdpFrontend::registerRoute(std::size_t slot, NetworkServer* server,
+                                      const std::string& lobbyCode) {
+    if (slot >= kMaxRoutes || server == nullptr) {
+        return false;
+    }
+
+    std::lock_guard lock(codesMutex_);
+    NetworkServer* expected = nullptr;
+    if (!routes_[slot].compare_exchange_strong(expected, server,
+                                               std::memory_order_acq_rel)) {
+        return false;
+    }
+    if (!lobbyCode.empty()) {
+        slotByCode_[lobbyCode] = slot;
+    }
+    updateDefaultSlot();
+    return true;
+}
+
+void SharedUdpFrontend::unregisterRoute(std::size_t slot) {
+    if (slot >= kMaxRoutes) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(codesMutex_);
+        routes_[slot].store(nullptr, std::memory_order_release);
+        std::erase_if(slotByCode_, [slot](const auto& entry) {
+            return entry.second == slot;
+        });
+        updateDefaultSlot();
+    }
+
+    // A datagram routed just before the store may still be in deliver():
+    // a no-op posted behind it only runs once that handler has returned
+    auto& context = ioContext_.get();
+    if (!running_.load(std::memory_order_acquire) ||
+        context.get_executor().running_in_this_thread()) {
+        return;
+    }
+    std::promise<void> drained;
+    auto done = drained.get_future();
+    asio::post(context, [&drained]() { drained.set_value(); });
+    if (done.wait_for(std::chrono::seconds(1)) != std::future_status::ready) {
+        LOG_WARNING_CAT(::rtype::LogCategory::Network,
+                        "[SharedUdpFrontend] I/O thread did not drain for "
+                        "slot "
+                            << slot);
+    }
+}
+
+void SharedUdpFrontend::send(network::Buffer packet,
+                             const network::Endpoint& dest) {
+    if (!outgoing_.tryEmplace(std::move(packet), dest)) {
+        droppedSends_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // One wake-up per burst, as in NetworkServer::sendRaw()
+    if (!flushPosted_.exchange(true, std::memory_order_acq_rel)) {
+        asio::post(ioContext_.get(), [this]() {
+            flushPosted_.exchange(false, std::memory_order_acq_rel);
+            flushOutgoing();
+        });
+    }
+}
+
+void SharedUdpFrontend::startReceive() {
+    if (!socket_->isOpen()) {
+        return;
+    }
+    receiveBuffer_->resize(network::kMaxPacketSize);
+    socket_->asyncReceiveFrom(receiveBuffer_, receiveSender_,
+                              [this](network::Result<std::size_t> result) {
+                                  handleReceive(std::move(result));
+                              });
+}
+
+void SharedUdpFrontend::handleReceive(network::Result<std::size_t> result) {
+    if (result && running_.load(std::memory_order_acquire)) {
+        receiveBuffer_->resize(result.value());
+        if (NetworkServer* server = route(*receiveBuffer_)) {
+            server->deliver(*receiveBuffer_, *receiveSender_);
+            routedPackets_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            unroutedPackets_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (running_.load(std::memory_order_acquire) && socket_->isOpen()) {
+        startReceive();
+    }
+}
+
+NetworkServer* SharedUdpFrontend::route(const network::Buffer& data) {
+    if (data.size() < network::kHeaderSize) {
+        return nullptr;
+    }
+
+    network::Header header;
+    std::memcpy(&header, data.data(), network::kHeaderSize);
+    if (!header.hasValidMagic()) {
+        return nullptr;
+    }
+
+    const std::uint32_t userId =
+        network::ByteOrderSpec::fromNetwork(header.userId);
+    if (userId != network::kUnassignedUserId) {
+        auto slot = slotForUserId(userId);
+        return slot ? routes_[*slot].load(std::memory_order_acquire)
+                    : nullptr;
+    }
+
+    if (header.opcode !=
+        static_cast<std::uint8_t>(network::OpCode::C_CONNECT)) {
+        return nullptr;
+    }
+
+    const std::uint16_t payloadSize =
+        network::ByteOrderSpec::fromNetwork(header.payloadSize);
+    if (payloadSize == sizeof(network::ConnectTokenPayload) &&
+        data.size() >= network::kHeaderSize + payloadSize &&
+        (header.flags & (network::Flags::kCompressed |
+                         network::Flags::kDictCompressed)) == 0) {
+        const char* token =
+            reinterpret_cast<const char*>(data.data() + network::kHeaderSize);
+        std::string code(token, strnlen(token, payloadSize));
+
+        std::lock_guard lock(codesMutex_);
+        auto it = slotByCode_.find(code);
+        if (it == slotByCode_.end()) {
+            // Asked for a lobby we don't host: better no answer than the
+            // wrong lobby
+            return nullptr;
+        }
+        return routes_[it->second].load(std::memory_order_acquire);
+    }
+
+    const std::size_t slot = defaultSlot_.load(std::memory_order_acquire);
+    return slot < kMaxRoutes ? routes_[slot].load(std::memory_order_acquire)
+                             : nullptr;
+}
+
+void SharedUdpFrontend::updateDefaultSlot() {
+    std::size_t slot = 0;
+    while (slot < kMaxRoutes &&
+           routes_[slot].load(std::memory_order_relaxed) == nullptr) {
+        ++slot;
+    }
+    defaultSlot_.store(slot, std::memory_order_release);
+}
+
+void SharedUdpFrontend::flushOutgoing() {
+    std::array<OutgoingPacket, kFlushBatch> batch;
+
+    while (std::size_t count = outgoing_.popAll(batch)) {
+        for (std::size_t i = 0; i < count; ++i) {
+            socket_->asyncSendTo(
+                batch[i].data, batch[i].destination,
+                [](network::Result<std::size_t> result) { (void)result; });
+        }
+    }
+}
+
+}  // namespace rtype::server
@@ -0,0 +1,177 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** SharedUdpFrontend - One UDP socket demultiplexed across several lobbies
+*/
+
+#ifndef SRC_SERVER_NETWORK_SHAREDUDPFRONTEND_HPP_
+#define SRC_SERVER_NETWORK_SHAREDUDPFRONTEND_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "LockFreeQueue/MpscQueue.hpp"
+#include "core/Types.hpp"
+#include "transport/AsioUdpSocket.hpp"
+#include "transport/IoContext.hpp"
+
+namespace rtype::server {
+
+class NetworkServer;
+
+/**
+ * @brief Front-door UDP socket shared by every lobby of a LobbyManager
+ *
+ * Instead of one port (and one socket) per lobby, a single socket receives
+ * all game traffic on one I/O thread and hands each datagram to the lobby
+ * it belongs to through NetworkServer::deliver(). Routing needs only the
+ * RTGP header:
+ * - assigned clients carry a user id whose high 16 bits encode the route
+ *   slot (see userIdBase()), so steady-state traffic is one array load;
+ * - the C_CONNECT handshake (user id 0) carries the lobby code as an
+ *   optional ConnectTokenPayload, looked up in a code -> slot map;
+ * - a tokenless C_CONNECT goes to the lowest registered slot, so older
+ *   clients still reach a lobby.
+ *
+ * Sends from any lobby thread are queued on a lock-free MPSC ring and
+ * written by the I/O thread.
+ *
+ * Thread-safety: registerRoute/unregisterRoute/send from any thread.
+ */
+class SharedUdpFrontend {
+   public:
+    /// Number of lobbies that can share one frontend
+    static constexpr std::size_t kMaxRoutes = 256;
+
+    /// User ids available to each slot (low 16 bits, 0 excluded)
+    static constexpr std::uint32_t kUserIdsPerSlot = 0x10000;
+
+    /// First user id of a slot's range (slot 0 starts at 0x10000)
+    [[nodiscard]] static constexpr std::uint32_t userIdBase(
+        std::size_t slot) noexcept {
+        return static_cast<std::uint32_t>(slot + 1) * kUserIdsPerSlot;
+    }
+
+    /// Route slot encoded in an assigned user id, if any
+    [[nodiscard]] static constexpr std::optional<std::size_t> slotForUserId(
+        std::uint32_t userId) noexcept {
+        const std::uint32_t high = userId / kUserIdsPerSlot;
+        if (high == 0 || high > kMaxRoutes) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(high - 1);
+    }
+
+    SharedUdpFrontend();
+    ~SharedUdpFrontend();
+
+    SharedUdpFrontend(const SharedUdpFrontend&) = delete;
+    SharedUdpFrontend& operator=(const SharedUdpFrontend&) = delete;
+    SharedUdpFrontend(SharedUdpFrontend&&) = delete;
+    SharedUdpFrontend& operator=(SharedUdpFrontend&&) = delete;
+
+    /**
+     * @brief Bind the socket and start the I/O thread
+     * @param port UDP port (0 for ephemeral)
+     * @return true on success
+     */
+    bool start(std::uint16_t port);
+
+    /**
+     * @brief Stop the I/O thread and close the socket
+     *
+     * Lobbies should be unregistered first; packets still routed to a
+     * lobby after this point are dropped.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+    /// Bound port, 0 if not running
+    [[nodiscard]] std::uint16_t port() const noexcept;
+
+    /**
+     * @brief Route a slot (and its lobby code) to a server
+     * @return false if the slot is out of range or already taken
+     */
+    bool registerRoute(std::size_t slot, NetworkServer* server,
+                       const std::string& lobbyCode);
+
+    /**
+     * @brief Remove a route
+     *
+     * Returns once the I/O thread can no longer be inside deliver() for the
+     * removed server, so the caller may destroy it afterwards.
+     */
+    void unregisterRoute(std::size_t slot);
+
+    /**
+     * @brief Queue a packet to be written by the I/O thread
+     */
+    void send(network::Buffer packet, const network::Endpoint& dest);
+
+    /// Datagrams handed to a lobby
+    [[nodiscard]] std::uint64_t routedPackets() const noexcept {
+        return routedPackets_.load(std::memory_order_relaxed);
+    }
+
+    /// Datagrams dropped because no lobby matched
+    [[nodiscard]] std::uint64_t unroutedPackets() const noexcept {
+        return unroutedPackets_.load(std::memory_order_relaxed);
+    }
+
+    /// Outgoing packets dropped because the send queue was full
+    [[nodiscard]] std::uint64_t droppedSends() const noexcept {
+        return droppedSends_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    struct OutgoingPacket {
+        network::Buffer data;
+        network::Endpoint destination;
+    };
+
+    void startReceive();
+    void handleReceive(network::Result<std::size_t> result);
+    [[nodiscard]] NetworkServer* route(const network::Buffer& data);
+    void updateDefaultSlot();
+    void flushOutgoing();
+
+    network::IoContext ioContext_;
+    std::unique_ptr<network::IAsyncSocket> socket_;
+    std::atomic<bool> running_{false};
+
+    std::shared_ptr<network::Buffer> receiveBuffer_;
+    std::shared_ptr<network::Endpoint> receiveSender_;
+
+    /// Read lock-free by the I/O thread on every datagram
+    std::array<std::atomic<NetworkServer*>, kMaxRoutes> routes_{};
+
+    /// Only consulted for C_CONNECT, so a mutex is fine here
+    mutable std::mutex codesMutex_;
+    std::unordered_map<std::string, std::size_t> slotByCode_;
+    std::atomic<std::size_t> defaultSlot_{kMaxRoutes};
+
+    static constexpr std::size_t kOutgoingCapacity = 16384;
+    static constexpr std::size_t kFlushBatch = 64;
+    MpscQueue<OutgoingPacket> outgoing_{kOutgoingCapacity};
+    std::atomic<bool> flushPosted_{false};
+
+    std::atomic<std::uint64_t> routedPackets_{0};
+    std::atomic<std::uint64_t> unroutedPackets_{0};
+    std::atomic<std::uint64_t> droppedSends_{0};
+};
+
+}  // namespace rtype::server
+
+#endif  // SRC_SERVER_NETWORK_SHAREDUDPFRONTEND_HPP_
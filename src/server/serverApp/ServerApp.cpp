@@ -12,12 +12,14 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <vector>
 
 #include "games/rtype/server/GameEngine.hpp"
 #include "games/rtype/server/RTypeGameConfig.hpp"
 #include "games/rtype/shared/Components/EntityType.hpp"
 #include "games/rtype/shared/Components/HealthComponent.hpp"
 #include "games/rtype/shared/Components/Tags.hpp"
+#include "server/network/SharedUdpFrontend.hpp"
 #include "server/serverApp/game/entitySpawnerFactory/EntitySpawnerFactory.hpp"
 #include "shared/NetworkUtils.hpp"
 
@@ -44,11 +46,30 @@ ServerApp::ServerApp(uint16_t port, size_t maxPlayers, uint32_t tickRate,
 }
 
 void ServerApp::setLobbyCode(const std::string& code) {
+    _lobbyCode = code;
     if (_networkServer) {
         _networkServer->setExpectedLobbyCode(code);
     }
 }
 
+std::string ServerApp::metricsLobbyLabel() const {
+    return _lobbyCode.empty() ? "main" : _lobbyCode;
+}
+
+void ServerApp::recordSystemDuration(const std::string& name,
+                                     std::chrono::nanoseconds elapsed) {
+    auto it = _systemDurations.find(name);
+    if (it == _systemDurations.end()) {
+        auto histogram = std::make_shared<rtype::HdrHistogram>();
+        MetricsRegistry::instance().addHistogram(
+            "rtype_system_duration_seconds", "Time spent in one ECS system",
+            {{"lobby", metricsLobbyLabel()}, {"system", name}}, histogram,
+            {8, 27, 1e-9});
+        it = _systemDurations.emplace(name, std::move(histogram)).first;
+    }
+    it->second->record(static_cast<std::uint64_t>(elapsed.count()));
+}
+
 void ServerApp::broadcastMessage(const std::string& message) {
     if (_networkServer) {
         // userId 0 is reserved for system messages
@@ -99,6 +120,7 @@ bool ServerApp::run() {
     logStartupInfo();
 
     ServerLoop loop(_tickRate, _shutdownFlag);
+    configureLoop(loop);
     _serverLoop = &loop;
     loop.run([this]() { onFrame(); }, [this](float dt) { onUpdate(dt); },
              [this]() { onPostUpdate(); });
@@ -109,6 +131,60 @@ bool ServerApp::run() {
     return true;
 }
 
+bool ServerApp::startStepped() {
+    if (!initialize()) {
+        LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
+                      "[Server] Failed to initialize server");
+        return false;
+    }
+    logStartupInfo();
+
+    _steppedLoop = std::make_unique<ServerLoop>(_tickRate, _shutdownFlag);
+    configureLoop(*_steppedLoop);
+    _serverLoop = _steppedLoop.get();
+    _steppedLoop->begin();
+    return true;
+}
+
+std::optional<std::chrono::steady_clock::time_point> ServerApp::step() {
+    if (!_steppedLoop) {
+        return std::nullopt;
+    }
+    if (_shutdownFlag->load(std::memory_order_acquire)) {
+        _serverLoop = nullptr;
+        LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
+                     "[Server] Shutting down...");
+        shutdown();
+        return std::nullopt;
+    }
+    return _steppedLoop->step([this]() { onFrame(); },
+                              [this](float dt) { onUpdate(dt); },
+                              [this]() { onPostUpdate(); });
+}
+
+void ServerApp::configureLoop(ServerLoop& loop) {
+    DegradationPolicy policy;
+    if (_degradationPolicy) {
+        policy = *_degradationPolicy;
+    } else {
+        policy.tickBudget = loop.getLoopTiming().fixedDeltaNs;
+        policy.minTickRate = std::max(_tickRate / 2, 1U);
+        policy.maxSendDivisor = 2;
+    }
+    loop.setDegradationPolicy(policy);
+
+    if (_hibernationEnabled) {
+        // A countdown or a game needs every tick; waiting players only
+        // send ready/chat packets, and those wake the loop
+        loop.setIdleCheck([this]() {
+            return _stateManager->isWaiting() &&
+                   !_stateManager->isCountdownActive();
+        });
+    }
+    loop.setWakeHandler(_loopWakeHandler);
+    loop.setJitterMeasurement(_measureJitter);
+}
+
 void ServerApp::onFrame() {
     processIncomingData();
     processRawNetworkData();
@@ -146,8 +222,31 @@ void ServerApp::onUpdate(float deltaTime) {
                    totalPackets)
                 : 0.0;
 
-        snapshot.tickOverruns =
-            _serverLoop ? _serverLoop->getTickOverruns() : 0;
+        if (const ServerLoop* loop = _serverLoop.load()) {
+            // Loop histograms are in nanoseconds
+            auto us = [](const rtype::HdrHistogram& histogram,
+                         double quantile) {
+                return histogram.percentile(quantile) / 1000;
+            };
+            snapshot.tickOverruns = loop->getTickOverruns();
+            snapshot.tickP99Us =
+                us(loop->getPhaseHistogram(LoopPhase::Total), 0.99);
+            snapshot.updateP99Us =
+                us(loop->getPhaseHistogram(LoopPhase::Update), 0.99);
+            snapshot.broadcastP99Us =
+                us(loop->getPhaseHistogram(LoopPhase::PostUpdate), 0.99);
+            snapshot.simulationRate = loop->getSimulationRate();
+
+            if (_measureJitter) {
+                const auto& jitter = loop->getJitterHistogram();
+                _metrics->tickJitterP50Us.store(us(jitter, 0.5),
+                                                std::memory_order_relaxed);
+                _metrics->tickJitterP99Us.store(us(jitter, 0.99),
+                                                std::memory_order_relaxed);
+                _metrics->tickJitterMaxUs.store(jitter.max() / 1000,
+                                                std::memory_order_relaxed);
+            }
+        }
 
         _metrics->addSnapshot(snapshot);
 
@@ -173,6 +272,10 @@ void ServerApp::onUpdate(float deltaTime) {
         return;
     }
 
+    const auto tickStart = std::chrono::steady_clock::now();
+    if (_inputHandler) {
+        _inputHandler->consumeBufferedInputs();
+    }
     updatePlayerMovement(deltaTime);
 
     if (_gameEngine && _gameEngine->isRunning()) {
@@ -186,13 +289,17 @@ void ServerApp::onUpdate(float deltaTime) {
     }
 
     checkGameOverCondition();
+    _metrics->tickDuration.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - tickStart)
+            .count()));
 }
 
 void ServerApp::onPostUpdate() {
+    // syncEntityPositions() broadcasts too: exactly one broadcast per tick
     if (_eventProcessor) {
         _eventProcessor->syncEntityPositions();
-    }
-    if (_networkSystem) {
+    } else if (_networkSystem) {
         _networkSystem->broadcastEntityUpdates();
     }
 }
@@ -377,6 +484,12 @@ bool ServerApp::initialize() {
                       "[Server] Failed to initialize game engine");
         return false;
     }
+    registerServerMetrics(MetricsRegistry::instance(), _metrics,
+                          metricsLobbyLabel());
+    _gameEngine->setSystemTimer(
+        [this](const std::string& name, std::chrono::nanoseconds elapsed) {
+            recordSystemDuration(name, elapsed);
+        });
 
     if (!_initialLevel.empty()) {
         std::string levelPath = "config/game/levels/" + _initialLevel + ".toml";
@@ -399,8 +512,16 @@ bool ServerApp::initialize() {
     netConfig.reliabilityConfig.retransmitTimeout =
         std::chrono::milliseconds(1000);
     netConfig.reliabilityConfig.maxRetries = 15;
+    netConfig.enableSnapshotReplication = _snapshotReplication;
+    netConfig.compressionConfig.dictionaries = _compressionDictionaries;
+    netConfig.expectedLobbyCode = _lobbyCode;
     _networkServer = std::make_shared<NetworkServer>(netConfig);
     _networkServer->setMetrics(_metrics);
+    _networkServer->onPacketQueued([this]() {
+        if (ServerLoop* loop = _serverLoop.load()) {
+            loop->wake();
+        }
+    });
 
     _networkServer->setBanManager(_banManager);
     _networkSystem =
@@ -557,30 +678,47 @@ bool ServerApp::initialize() {
                                            std::optional<ECS::Entity> entity) {
         _inputHandler->handleInput(userId, inputMask, entity);
     });
+    _networkSystem->setInputFramesHandler(
+        [this](std::uint32_t userId,
+               const std::vector<rtype::network::InputFrame>& frames) {
+            _inputHandler->queueInputFrames(userId, frames);
+        });
 
     _stateManager->setStateChangeCallback(
         [this](GameState oldState, GameState newState) {
             handleStateChange(oldState, newState);
         });
 
-    if (!rtype::server::isUdpPortAvailable(static_cast<uint16_t>(_port))) {
+    if (_sharedFrontend) {
+        if (!_networkServer->startShared(*_sharedFrontend, _sharedSlot)) {
+            LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
+                          "[Server] Shared socket slot "
+                              << _sharedSlot << " unavailable");
+            return false;
+        }
+        _port = _networkServer->port();
+        LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
+                     "[Server] Network server attached to shared port "
+                         << _port << " (slot " << _sharedSlot << ")");
+    } else if (!rtype::server::isUdpPortAvailable(
+                   static_cast<uint16_t>(_port))) {
         LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
                       "[Server] Port "
                           << _port
                           << " unavailable; cannot start network server");
         return false;
-    }
-
-    if (!_networkServer->start(_port)) {
+    } else if (!_networkServer->start(_port)) {
         LOG_ERROR_CAT(
             ::rtype::LogCategory::GameEngine,
             "[Server] Failed to start network server on port " << _port);
         return false;
+    } else {
+        LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
+                     "[Server] Network server started on port " << _port);
     }
-    LOG_INFO_CAT(::rtype::LogCategory::GameEngine,
-                 "[Server] Network server started on port " << _port);
 
-    if (!startNetworkThread()) {
+    // The shared frontend already runs socket I/O on its own thread
+    if (!_sharedFrontend && !startNetworkThread()) {
         LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
                       "[Server] Failed to start network thread");
         return false;
@@ -676,6 +814,9 @@ void ServerApp::handleClientDisconnected(std::uint32_t userId) {
     LOG_DEBUG(
         "[Server] Connected players after disconnect: " << connectedCount);
 
+    if (_inputHandler) {
+        _inputHandler->removePlayer(userId);
+    }
     if (_entitySpawner) {
         _entitySpawner->destroyPlayerByUserId(userId);
     }
@@ -794,7 +935,7 @@ void ServerApp::processIncomingData() noexcept {
         _networkServer->poll();
     }
 
-    while (auto packetOpt = _incomingPackets.pop()) {
+    while (auto packetOpt = _incomingPackets.tryPop()) {
         auto& [endpoint, packet] = *packetOpt;
 
         auto clientId = _clientManager.findClientByEndpoint(endpoint);
@@ -815,18 +956,26 @@ void ServerApp::processIncomingData() noexcept {
 }
 
 void ServerApp::processRawNetworkData() noexcept {
-    while (auto rawDataOpt = _rawNetworkData.pop()) {
+    while (auto rawDataOpt = _rawNetworkData.tryPop()) {
         auto& [endpoint, rawData] = *rawDataOpt;
         auto packetOpt = _packetProcessor.processRawData(
-            endpoint.toString(), std::span<const std::uint8_t>(rawData));
+            rtype::network::EndpointKey::from(endpoint),
+            std::span<const std::uint8_t>(rawData));
 
-        if (packetOpt) {
-            _incomingPackets.push({endpoint, std::move(*packetOpt)});
+        if (packetOpt &&
+            !_incomingPackets.tryEmplace(endpoint, std::move(*packetOpt))) {
+            LOG_WARNING_CAT(::rtype::LogCategory::GameEngine,
+                            "[Server] Incoming packet queue full, dropping "
+                            "packet from "
+                                << endpoint);
         }
     }
 }
 
 bool ServerApp::startNetworkThread() {
+    // Claim the socket before the thread exists: the game thread must stop
+    // polling it now, not whenever the new thread gets scheduled
+    bool claimed = _networkServer && _networkServer->claimIoLoop();
     try {
         _networkThreadRunning.store(true, std::memory_order_release);
         _networkThread = std::thread(&ServerApp::networkThreadFunction, this);
@@ -837,6 +986,9 @@ bool ServerApp::startNetworkThread() {
         LOG_ERROR_CAT(::rtype::LogCategory::GameEngine,
                       "[Server] Failed to start network thread: " << e.what());
         _networkThreadRunning.store(false, std::memory_order_release);
+        if (claimed) {
+            _networkServer->releaseIoLoop();
+        }
         return false;
     }
 }
@@ -844,6 +996,9 @@ bool ServerApp::startNetworkThread() {
 void ServerApp::stopNetworkThread() noexcept {
     if (_networkThreadRunning.load(std::memory_order_acquire)) {
         _networkThreadRunning.store(false, std::memory_order_release);
+        if (_networkServer) {
+            _networkServer->stopIoLoop();
+        }
         if (_networkThread.joinable()) {
             _networkThread.join();
         }
@@ -856,8 +1011,10 @@ void ServerApp::networkThreadFunction() noexcept {
     LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
                   "[Server] Network thread running");
 
-    while (_networkThreadRunning.load(std::memory_order_acquire)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Owns the socket: receive, validation and decompression happen here
+    // and the game thread only consumes decoded packets in poll()
+    if (_networkServer && _networkServer->isIoLoopRunning()) {
+        _networkServer->runIoLoop();
     }
 
     LOG_DEBUG_CAT(::rtype::LogCategory::GameEngine,
@@ -9,11 +9,14 @@
 #define SRC_SERVER_SERVERAPP_SERVERAPP_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,11 +38,13 @@
 #include "server/shared/Client.hpp"
 #include "server/shared/IEntitySpawner.hpp"
 #include "server/shared/IGameConfig.hpp"
+#include "server/shared/MetricsRegistry.hpp"
 #include "server/shared/ServerMetrics.hpp"
 
 namespace rtype::server {
 
 class LobbyManager;
+class SharedUdpFrontend;
 
 using rtype::ClientId;
 using rtype::Endpoint;
@@ -89,6 +94,43 @@ class ServerApp {
      */
     [[nodiscard]] bool run();
 
+    /**
+     * @brief Initialize without entering the blocking loop
+     *
+     * For servers driven by a scheduler (see LobbyScheduler) that calls
+     * step() from a shared worker pool instead of giving each server its
+     * own thread.
+     *
+     * @return false if initialization failed
+     */
+    [[nodiscard]] bool startStepped();
+
+    /**
+     * @brief Run one frame of a server started with startStepped()
+     *
+     * Never sleeps. Once the shutdown flag is set the server is shut down
+     * and nullopt is returned.
+     *
+     * @return Time point at which the next frame is due
+     */
+    std::optional<std::chrono::steady_clock::time_point> step();
+
+    /**
+     * @brief Serve through a socket shared with other lobbies
+     *
+     * The server then binds no port of its own and runs no network thread:
+     * the frontend's I/O thread receives and sends for it. Must be set
+     * before run() or startStepped().
+     *
+     * @param frontend Running frontend, must outlive the server
+     * @param slot Route slot reserved for this server
+     */
+    void setSharedFrontend(SharedUdpFrontend* frontend,
+                           std::size_t slot) noexcept {
+        _sharedFrontend = frontend;
+        _sharedSlot = slot;
+    }
+
     /**
      * @brief Signal the server to stop
      */
@@ -100,6 +142,66 @@ class ServerApp {
      */
     void setLevel(const std::string& levelId) { _initialLevel = levelId; }
 
+    /**
+     * @brief Replicate entity state through delta snapshots (S_SNAPSHOT)
+     * instead of per-entity move batches. Must be set before run().
+     * @param enabled True to enable snapshot replication
+     */
+    void setSnapshotReplication(bool enabled) noexcept {
+        _snapshotReplication = enabled;
+    }
+
+    /**
+     * @brief Override how the loop degrades when ticks run over budget
+     *
+     * By default a tick may take one tick period; past that the loop first
+     * broadcasts every other frame, then halves the simulation rate once.
+     * Must be set before run() or startStepped().
+     */
+    void setDegradationPolicy(const DegradationPolicy& policy) noexcept {
+        _degradationPolicy = policy;
+    }
+
+    /**
+     * @brief Let the loop hibernate while waiting for players
+     *
+     * An idle lobby (no game, no countdown) then only runs a frame when a
+     * packet arrives or every ServerLoop::HIBERNATE_INTERVAL_MS. On by
+     * default; must be set before run() or startStepped().
+     */
+    void setHibernationEnabled(bool enabled) noexcept {
+        _hibernationEnabled = enabled;
+    }
+
+    /**
+     * @brief Measure tick start jitter into the server metrics
+     *
+     * Must be set before run() or startStepped().
+     */
+    void setJitterMeasurement(bool enabled) noexcept {
+        _measureJitter = enabled;
+    }
+
+    /**
+     * @brief Handler run when a packet wakes the hibernating loop
+     *
+     * For step() callers, so they can run the next frame early. Must be
+     * set before startStepped().
+     */
+    void setLoopWakeHandler(ServerLoop::WakeHandler handler) {
+        _loopWakeHandler = std::move(handler);
+    }
+
+    /**
+     * @brief LZ4 dictionaries offered to clients at connect time
+     * (C_COMPRESSION_OFFER). Must be set before run().
+     * @param dictionaries Loaded dictionary set, nullptr to disable
+     */
+    void setCompressionDictionaries(
+        std::shared_ptr<const network::DictionarySet> dictionaries) noexcept {
+        _compressionDictionaries = std::move(dictionaries);
+    }
+
     /**
      * @brief Change the current level (reloads if necessary)
      * @param levelId The level identifier
@@ -228,7 +330,8 @@ class ServerApp {
 
     void registerUserIdMapping(const Endpoint& endpoint,
                                std::uint32_t userId) noexcept {
-        _packetProcessor.registerConnection(endpoint.toString(), userId);
+        _packetProcessor.registerConnection(
+            rtype::network::EndpointKey::from(endpoint), userId);
     }
 
    private:
@@ -280,8 +383,12 @@ class ServerApp {
     std::unique_ptr<GameEventProcessor> _eventProcessor;
     std::unique_ptr<IEntitySpawner> _entitySpawner;
 
-    SafeQueue<std::pair<Endpoint, std::vector<uint8_t>>> _rawNetworkData;
-    SafeQueue<std::pair<Endpoint, rtype::network::Packet>> _incomingPackets;
+    // Network thread -> game thread handoffs (one producer, one consumer)
+    static constexpr std::size_t NETWORK_QUEUE_CAPACITY = 4096;
+    SpscQueue<std::pair<Endpoint, std::vector<uint8_t>>> _rawNetworkData{
+        NETWORK_QUEUE_CAPACITY};
+    SpscQueue<std::pair<Endpoint, rtype::network::Packet>> _incomingPackets{
+        NETWORK_QUEUE_CAPACITY};
     std::thread _networkThread;
     std::atomic<bool> _networkThreadRunning{false};
 
@@ -290,9 +397,35 @@ class ServerApp {
     std::shared_ptr<ServerNetworkSystem> _networkSystem;
     std::shared_ptr<ECS::Registry> _registry;
 
-    // Server loop (owned by run method, used for tick overrun tracking)
-    ServerLoop* _serverLoop{nullptr};
+    /**
+     * @brief Apply degradation, hibernation and wake settings to a loop
+     */
+    void configureLoop(ServerLoop& loop);
+
+    // Server loop (owned by run method, used for tick overrun tracking).
+    // Atomic because the network thread reads it to wake the loop.
+    std::atomic<ServerLoop*> _serverLoop{nullptr};
+    std::unique_ptr<ServerLoop> _steppedLoop;
+    std::optional<DegradationPolicy> _degradationPolicy;
+    bool _hibernationEnabled{true};
+    bool _measureJitter{false};
+    ServerLoop::WakeHandler _loopWakeHandler;
+
+    SharedUdpFrontend* _sharedFrontend{nullptr};
+    std::size_t _sharedSlot{0};
+    std::string _lobbyCode;
+
+    /// `lobby` label of this server's series in the MetricsRegistry
+    [[nodiscard]] std::string metricsLobbyLabel() const;
+
+    /**
+     * @brief Record one system's run time (game thread, from the engine)
+     */
+    void recordSystemDuration(const std::string& name,
+                              std::chrono::nanoseconds elapsed);
 
+    std::unordered_map<std::string, std::shared_ptr<rtype::HdrHistogram>>
+        _systemDurations;
     uint32_t _metricSnapshotCounter{0};
     static constexpr uint32_t METRICS_SNAPSHOT_INTERVAL = 60;  // in seconds
 
@@ -303,6 +436,8 @@ class ServerApp {
     bool _isVictory{false};
     static constexpr std::uint32_t ENEMY_DESTRUCTION_SCORE = 100;
     std::string _initialLevel;
+    bool _snapshotReplication{false};
+    std::shared_ptr<const network::DictionarySet> _compressionDictionaries;
 };
 
 }  // namespace rtype::server
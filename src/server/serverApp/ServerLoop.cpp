@@ -7,17 +7,28 @@
 
 #include "ServerLoop.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 #include <thread>
 
+#ifdef __linux__
+#include <sys/prctl.h>
+
+#include <cerrno>
+#include <ctime>
+#endif
+
 namespace rtype::server {
 
 ServerLoop::ServerLoop(uint32_t tickRate,
                        std::shared_ptr<std::atomic<bool>> shutdownFlag)
-    : _tickRate(tickRate), _shutdownFlag(std::move(shutdownFlag)) {
+    : _tickRate(tickRate),
+      _shutdownFlag(std::move(shutdownFlag)),
+      _simulationRate(tickRate) {
     if (tickRate == 0) {
         throw std::invalid_argument("tickRate cannot be zero");
     }
+    _timing = getLoopTiming();
 }
 
 LoopTiming ServerLoop::getLoopTiming() const noexcept {
@@ -27,7 +38,7 @@ LoopTiming ServerLoop::getLoopTiming() const noexcept {
     using std::chrono::nanoseconds;
 
     const auto fixedDeltaTime =
-        duration<double>(1.0 / static_cast<double>(_tickRate));
+        duration<double>(1.0 / static_cast<double>(getSimulationRate()));
 
     return {.fixedDeltaNs = duration_cast<nanoseconds>(fixedDeltaTime),
             .maxFrameTime =
@@ -54,17 +65,27 @@ std::chrono::nanoseconds ServerLoop::calculateFrameTime(
     return frameTime;
 }
 
-void ServerLoop::sleepUntilNextFrame(
-    std::chrono::steady_clock::time_point frameStartTime,
-    const LoopTiming& timing) noexcept {
+void ServerLoop::sleepUntil(std::chrono::steady_clock::time_point deadline) {
     using std::chrono::duration_cast;
     using std::chrono::microseconds;
     using std::chrono::nanoseconds;
     using std::chrono::steady_clock;
 
-    const auto elapsed = steady_clock::now() - frameStartTime;
-    const auto sleepTime = timing.fixedDeltaNs - elapsed;
-
+#ifdef __linux__
+    // libstdc++ and libc++ both implement steady_clock on CLOCK_MONOTONIC
+    const auto sinceEpoch =
+        duration_cast<nanoseconds>(deadline.time_since_epoch()).count();
+    if (sinceEpoch <= 0) {
+        return;
+    }
+    timespec target{};
+    target.tv_sec = static_cast<time_t>(sinceEpoch / 1'000'000'000);
+    target.tv_nsec = static_cast<long>(sinceEpoch % 1'000'000'000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) ==
+           EINTR) {
+    }
+#else
+    const auto sleepTime = deadline - steady_clock::now();
     if (sleepTime <= nanoseconds{0}) {
         return;
     }
@@ -76,50 +97,209 @@ void ServerLoop::sleepUntilNextFrame(
         std::this_thread::sleep_for(safeSleepTime);
     }
 
-    const auto targetTime = frameStartTime + timing.fixedDeltaNs;
-    while (steady_clock::now() < targetTime) {
+    while (steady_clock::now() < deadline) {
         std::this_thread::yield();
     }
+#endif
 }
 
-void ServerLoop::run(FrameCallback frameCallback, UpdateCallback updateCallback,
-                     PostUpdateCallback postUpdateCallback) {
-    const auto timing = getLoopTiming();
-    LoopState state;
-    state.previousTime = std::chrono::steady_clock::now();
-
-    const float deltaTime = getDeltaTime();
+void ServerLoop::setDegradationPolicy(
+    const DegradationPolicy& policy) noexcept {
+    _policy = policy;
+    _framesOverBudget = 0;
+    _framesUnderBudget = 0;
+    _sendDivisor.store(1, std::memory_order_relaxed);
+    setSimulationRate(_tickRate);
+}
 
-    while (!_shutdownFlag->load(std::memory_order_acquire)) {
-        const auto frameStartTime = std::chrono::steady_clock::now();
+void ServerLoop::setSimulationRate(uint32_t rate) noexcept {
+    _simulationRate.store(rate, std::memory_order_relaxed);
+    _timing = getLoopTiming();
+}
 
-        const auto frameTime = calculateFrameTime(state, timing);
-        state.accumulator += frameTime;
+void ServerLoop::applyDegradation(std::chrono::nanoseconds frameWork) noexcept {
+    if (_policy.tickBudget <= std::chrono::nanoseconds{0}) {
+        return;
+    }
 
-        if (frameCallback) {
-            frameCallback();
+    if (frameWork > _policy.tickBudget) {
+        _framesUnderBudget = 0;
+        if (++_framesOverBudget < _policy.degradeAfterFrames) {
+            return;
         }
+        _framesOverBudget = 0;
 
-        uint32_t updateCount = 0;
-        while (state.accumulator >= timing.fixedDeltaNs &&
-               updateCount < timing.maxUpdatesPerFrame) {
-            if (updateCallback) {
-                updateCallback(deltaTime);
-            }
-            state.accumulator -= timing.fixedDeltaNs;
-            ++updateCount;
+        // Cheapest first: the clients still get every tick, just batched
+        const uint32_t divisor = getSendDivisor();
+        const uint32_t rate = getSimulationRate();
+        if (divisor < _policy.maxSendDivisor) {
+            _sendDivisor.store(std::min(divisor * 2, _policy.maxSendDivisor),
+                               std::memory_order_relaxed);
+        } else if (rate > _policy.minTickRate && rate > 1) {
+            setSimulationRate(std::max({rate / 2, _policy.minTickRate, 1U}));
         }
+        return;
+    }
+
+    _framesOverBudget = 0;
+    if (frameWork * 2 > _policy.tickBudget) {
+        _framesUnderBudget = 0;
+        return;
+    }
+    if (++_framesUnderBudget < _policy.recoverAfterFrames) {
+        return;
+    }
+    _framesUnderBudget = 0;
+
+    const uint32_t rate = getSimulationRate();
+    if (rate < _tickRate) {
+        setSimulationRate(std::min(rate * 2, _tickRate));
+    } else if (const uint32_t divisor = getSendDivisor(); divisor > 1) {
+        _sendDivisor.store(divisor / 2, std::memory_order_relaxed);
+    }
+}
+
+void ServerLoop::recordPhase(LoopPhase phase,
+                             std::chrono::nanoseconds duration) noexcept {
+    _histograms[static_cast<std::size_t>(phase)].record(
+        static_cast<uint64_t>(std::max<int64_t>(0, duration.count())));
+}
+
+void ServerLoop::wake() {
+    _wakeRequested.store(true);
+    if (!_hibernating.load()) {
+        return;
+    }
+    {
+        std::lock_guard lock(_wakeMutex);
+    }
+    _wakeCondition.notify_all();
+    if (_wakeHandler) {
+        _wakeHandler();
+    }
+}
 
-        if (updateCount >= timing.maxUpdatesPerFrame &&
-            state.accumulator >= timing.fixedDeltaNs) {
-            state.accumulator = state.accumulator % timing.fixedDeltaNs;
+void ServerLoop::waitForWake(std::chrono::steady_clock::time_point due) {
+    std::unique_lock lock(_wakeMutex);
+    _wakeCondition.wait_until(lock, due, [this]() {
+        return _wakeRequested.load(std::memory_order_acquire);
+    });
+}
+
+void ServerLoop::begin() noexcept {
+    _state = LoopState{};
+    _state.previousTime = std::chrono::steady_clock::now();
+    _hibernating.store(false);
+    _wakeRequested.store(false);
+    _framesSinceSend = 0;
+    _nextDue = {};
+}
+
+std::chrono::steady_clock::time_point ServerLoop::step(
+    const FrameCallback& frameCallback, const UpdateCallback& updateCallback,
+    const PostUpdateCallback& postUpdateCallback) {
+    using std::chrono::steady_clock;
+
+    const auto frameStartTime = steady_clock::now();
+    _wakeRequested.store(false);
+
+    const bool resumed = _hibernating.exchange(false);
+    if (resumed) {
+        // Time spent asleep is not simulated: one tick, then normal pace
+        _state.previousTime = frameStartTime;
+        _state.accumulator = _timing.fixedDeltaNs;
+    } else if (_measureJitter && _nextDue.time_since_epoch().count() != 0) {
+        const auto late = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            frameStartTime - _nextDue);
+        _jitter.record(
+            static_cast<uint64_t>(std::max<int64_t>(0, late.count())));
+    }
+
+    const float deltaTime = getDeltaTime();
+    const auto frameTime = calculateFrameTime(_state, _timing);
+    _state.accumulator += frameTime;
+
+    if (frameCallback) {
+        frameCallback();
+    }
+    auto phaseStart = steady_clock::now();
+    recordPhase(LoopPhase::Frame, phaseStart - frameStartTime);
+
+    uint32_t updateCount = 0;
+    while (_state.accumulator >= _timing.fixedDeltaNs &&
+           updateCount < _timing.maxUpdatesPerFrame) {
+        if (updateCallback) {
+            updateCallback(deltaTime);
         }
+        _state.accumulator -= _timing.fixedDeltaNs;
+        ++updateCount;
+
+        const auto updateEnd = steady_clock::now();
+        recordPhase(LoopPhase::Update, updateEnd - phaseStart);
+        phaseStart = updateEnd;
+    }
+
+    if (updateCount >= _timing.maxUpdatesPerFrame &&
+        _state.accumulator >= _timing.fixedDeltaNs) {
+        _state.accumulator = _state.accumulator % _timing.fixedDeltaNs;
+    }
 
+    if (++_framesSinceSend >= getSendDivisor()) {
+        _framesSinceSend = 0;
         if (postUpdateCallback) {
             postUpdateCallback();
         }
+        const auto postEnd = steady_clock::now();
+        recordPhase(LoopPhase::PostUpdate, postEnd - phaseStart);
+        phaseStart = postEnd;
+    }
+
+    const auto frameWork = phaseStart - frameStartTime;
+    recordPhase(LoopPhase::Total, frameWork);
+    applyDegradation(frameWork);
+
+    if (_idleCheck && _idleCheck()) {
+        // Paired with wake(): a packet racing this store either sees the
+        // flag and wakes us, or set _wakeRequested before we read it
+        _hibernating.store(true);
+        if (!_wakeRequested.load()) {
+            return frameStartTime +
+                   std::chrono::milliseconds(HIBERNATE_INTERVAL_MS);
+        }
+        _hibernating.store(false);
+    }
+
+    // Advance on the schedule rather than from this wakeup, so wakeup
+    // delays do not add up; resync only when too far behind to catch up
+    const auto now = steady_clock::now();
+    if (resumed || _nextDue.time_since_epoch().count() == 0) {
+        _nextDue = frameStartTime + _timing.fixedDeltaNs;
+    } else {
+        _nextDue += _timing.fixedDeltaNs;
+        if (now - _nextDue > _timing.fixedDeltaNs * MAX_LATE_FRAMES) {
+            _nextDue = now + _timing.fixedDeltaNs;
+        }
+    }
+    return _nextDue;
+}
+
+void ServerLoop::run(FrameCallback frameCallback, UpdateCallback updateCallback,
+                     PostUpdateCallback postUpdateCallback) {
+    begin();
+
+#ifdef __linux__
+    // The default 50 us slack would be added to every deadline below
+    prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
 
-        sleepUntilNextFrame(frameStartTime, timing);
+    while (!_shutdownFlag->load(std::memory_order_acquire)) {
+        const auto due =
+            step(frameCallback, updateCallback, postUpdateCallback);
+        if (isHibernating()) {
+            waitForWake(due);
+        } else {
+            sleepUntil(due);
+        }
     }
 }
 
@@ -9,10 +9,16 @@
 #define SRC_SERVER_SERVERAPP_SERVERLOOP_HPP_
 
 #include <atomic>
+#include <array>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+
+#include "Metrics/HdrHistogram.hpp"
 
 namespace rtype::server {
 
@@ -33,6 +39,38 @@ struct LoopState {
     std::chrono::nanoseconds accumulator{0};
 };
 
+/**
+ * @brief What the loop gives up when ticks run over budget
+ *
+ * A frame whose work (network, updates, broadcast) takes longer than
+ * tickBudget is over budget. After degradeAfterFrames of them in a row the
+ * loop steps down one level: first it broadcasts only every other frame
+ * (send divisor doubled up to maxSendDivisor), then it halves the
+ * simulation rate down to minTickRate. After recoverAfterFrames frames
+ * under half the budget it steps back up one level the other way round.
+ */
+struct DegradationPolicy {
+    /// 0 disables degradation
+    std::chrono::nanoseconds tickBudget{0};
+    /// Lowest simulation rate, 0 or the tick rate to never lower it
+    uint32_t minTickRate{0};
+    /// Most frames per broadcast, 1 to always broadcast
+    uint32_t maxSendDivisor{1};
+    uint32_t degradeAfterFrames{30};
+    uint32_t recoverAfterFrames{120};
+};
+
+/**
+ * @brief Phases of a frame timed by the loop
+ */
+enum class LoopPhase : std::size_t {
+    Frame = 0,   ///< frameCallback (network receive)
+    Update,      ///< One updateCallback (simulation tick)
+    PostUpdate,  ///< postUpdateCallback (broadcast)
+    Total,       ///< Whole frame
+    Count
+};
+
 /**
  * @brief Manages the game loop timing for the server
  *
@@ -44,6 +82,11 @@ struct LoopState {
  * - Frame time clamping to prevent spiral of death
  * - Configurable tick rate
  * - Tick overrun detection
+ * - Per-phase tick-time histograms
+ * - Optional degradation when frames exceed a time budget
+ * - Optional hibernation while idle, woken by wake() instead of a timer
+ * - Absolute-deadline pacing (clock_nanosleep on Linux) and optional
+ *   tick start jitter measurement
  *
  * Usage:
  * @code
@@ -67,6 +110,9 @@ class ServerLoop {
 
     /**
      * @brief Percentage of calculated sleep time to actually sleep
+     *
+     * Only used by the portable sleep-then-yield pacing; on Linux the loop
+     * sleeps to the absolute deadline with clock_nanosleep instead.
      */
     static constexpr uint32_t SLEEP_TIME_SAFETY_PERCENT = 95;
 
@@ -75,6 +121,22 @@ class ServerLoop {
      */
     static constexpr uint32_t MIN_SLEEP_THRESHOLD_US = 100;
 
+    /**
+     * @brief Longest a hibernating loop waits without a wake()
+     *
+     * Keeps client timeouts, retransmits and shutdown going while idle.
+     */
+    static constexpr uint32_t HIBERNATE_INTERVAL_MS = 100;
+
+    /**
+     * @brief Frames the schedule may lag before deadlines are reset
+     *
+     * Deadlines advance by one period from the previous one; a loop more
+     * than this many frames behind restarts its schedule from now instead
+     * of returning a run of past deadlines.
+     */
+    static constexpr uint32_t MAX_LATE_FRAMES = 2;
+
     /**
      * @brief Callback type for frame updates
      *
@@ -98,6 +160,19 @@ class ServerLoop {
      */
     using PostUpdateCallback = std::function<void()>;
 
+    /**
+     * @brief Returns true when the loop may hibernate after this frame
+     */
+    using IdleCheck = std::function<bool()>;
+
+    /**
+     * @brief Called by wake() while hibernating, from the waking thread
+     *
+     * Lets a scheduler stepping the loop run it early (see
+     * LobbyScheduler::wake()).
+     */
+    using WakeHandler = std::function<void()>;
+
     /**
      * @brief Construct a ServerLoop
      *
@@ -127,20 +202,116 @@ class ServerLoop {
     void run(FrameCallback frameCallback, UpdateCallback updateCallback,
              PostUpdateCallback postUpdateCallback);
 
+    /**
+     * @brief Reset the loop clock before driving it with step()
+     */
+    void begin() noexcept;
+
+    /**
+     * @brief Run a single frame without sleeping
+     *
+     * Lets a scheduler drive many loops from a shared worker pool instead
+     * of parking one thread per loop in run(). Call begin() first.
+     *
+     * @return Time point at which the next frame is due, up to
+     *         HIBERNATE_INTERVAL_MS away while hibernating
+     */
+    std::chrono::steady_clock::time_point step(
+        const FrameCallback& frameCallback,
+        const UpdateCallback& updateCallback,
+        const PostUpdateCallback& postUpdateCallback);
+
+    /**
+     * @brief Set the degradation policy (before run() or between steps)
+     */
+    void setDegradationPolicy(const DegradationPolicy& policy) noexcept;
+
+    /**
+     * @brief Let the loop hibernate whenever @p idleCheck returns true
+     *
+     * Checked at the end of each frame. A hibernating loop runs its next
+     * frame on wake() or after HIBERNATE_INTERVAL_MS, with a single update
+     * and no catch-up for the time spent asleep. Set before run().
+     */
+    void setIdleCheck(IdleCheck idleCheck) {
+        _idleCheck = std::move(idleCheck);
+    }
+
+    /**
+     * @brief Set the handler run by wake() while hibernating
+     */
+    void setWakeHandler(WakeHandler handler) {
+        _wakeHandler = std::move(handler);
+    }
+
+    /**
+     * @brief End hibernation early, e.g. on an incoming packet
+     *
+     * Callable from any thread. Cheap while the loop is awake.
+     */
+    void wake();
+
+    /**
+     * @brief Record how late each frame starts after its due time
+     *
+     * Fills getJitterHistogram(). Frames after hibernation are skipped,
+     * they have no regular due time.
+     */
+    void setJitterMeasurement(bool enabled) noexcept {
+        _measureJitter = enabled;
+    }
+
+    /**
+     * @brief Histogram of frame start lateness in nanoseconds (see
+     *        setJitterMeasurement())
+     */
+    [[nodiscard]] const rtype::HdrHistogram& getJitterHistogram()
+        const noexcept {
+        return _jitter;
+    }
+
+    [[nodiscard]] bool isHibernating() const noexcept {
+        return _hibernating.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Get the tick rate
      *
-     * @return Tick rate in Hz
+     * @return Configured tick rate in Hz
      */
     [[nodiscard]] uint32_t getTickRate() const noexcept { return _tickRate; }
 
+    /**
+     * @brief Get the current simulation rate
+     *
+     * @return Tick rate in Hz, lower than getTickRate() while degraded
+     */
+    [[nodiscard]] uint32_t getSimulationRate() const noexcept {
+        return _simulationRate.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of frames per postUpdateCallback
+     */
+    [[nodiscard]] uint32_t getSendDivisor() const noexcept {
+        return _sendDivisor.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Get the fixed delta time
      *
-     * @return Delta time in seconds
+     * @return Delta time in seconds at the current simulation rate
      */
     [[nodiscard]] float getDeltaTime() const noexcept {
-        return 1.0F / static_cast<float>(_tickRate);
+        return 1.0F / static_cast<float>(getSimulationRate());
+    }
+
+    /**
+     * @brief Get the duration histogram of a frame phase, in nanoseconds
+     */
+    [[nodiscard]] const rtype::HdrHistogram& getPhaseHistogram(
+        LoopPhase phase) const noexcept {
+        return _histograms[static_cast<std::size_t>(phase)];
     }
 
     /**
@@ -167,15 +338,61 @@ class ServerLoop {
         LoopState& state, const LoopTiming& timing) noexcept;
 
     /**
-     * @brief Sleep to maintain target frame rate
+     * @brief Step the degradation level from one frame's work time
+     */
+    void applyDegradation(std::chrono::nanoseconds frameWork) noexcept;
+
+    void recordPhase(LoopPhase phase,
+                     std::chrono::nanoseconds duration) noexcept;
+
+    /**
+     * @brief Switch to @p rate Hz (timing and delta time)
      */
-    void sleepUntilNextFrame(
-        std::chrono::steady_clock::time_point frameStartTime,
-        const LoopTiming& timing) noexcept;
+    void setSimulationRate(uint32_t rate) noexcept;
+
+    /**
+     * @brief Block until @p due or a wake() while hibernating
+     */
+    void waitForWake(std::chrono::steady_clock::time_point due);
+
+    /**
+     * @brief Sleep until @p deadline
+     *
+     * Linux: one absolute CLOCK_MONOTONIC clock_nanosleep, so there is no
+     * drift from computing a relative sleep and no spinning core. Elsewhere:
+     * sleep SLEEP_TIME_SAFETY_PERCENT of the time left, then yield.
+     */
+    static void sleepUntil(std::chrono::steady_clock::time_point deadline);
 
     uint32_t _tickRate;
     std::shared_ptr<std::atomic<bool>> _shutdownFlag;
+    LoopTiming _timing;
+    LoopState _state;
     std::atomic<uint64_t> _tickOverruns{0};
+
+    std::array<rtype::HdrHistogram,
+               static_cast<std::size_t>(LoopPhase::Count)>
+        _histograms;
+
+    DegradationPolicy _policy;
+    std::atomic<uint32_t> _simulationRate;
+    std::atomic<uint32_t> _sendDivisor{1};
+    uint32_t _framesOverBudget{0};
+    uint32_t _framesUnderBudget{0};
+    uint32_t _framesSinceSend{0};
+
+    bool _measureJitter{false};
+    rtype::HdrHistogram _jitter;
+    /// Due time returned by the last step(): the pacing schedule, also used
+    /// for jitter measurement
+    std::chrono::steady_clock::time_point _nextDue;
+
+    IdleCheck _idleCheck;
+    WakeHandler _wakeHandler;
+    std::atomic<bool> _hibernating{false};
+    std::atomic<bool> _wakeRequested{false};
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
 };
 
 }  // namespace rtype::server
@@ -14,7 +14,8 @@ PacketProcessor::PacketProcessor(std::shared_ptr<ServerMetrics> metrics,
     : _metrics(std::move(metrics)), _verbose(verbose) {}
 
 std::optional<rtype::network::Packet> PacketProcessor::processRawData(
-    const std::string& endpointKey, std::span<const std::uint8_t> rawData) {
+    const rtype::network::EndpointKey& endpointKey,
+    std::span<const std::uint8_t> rawData) {
     try {
         auto validationResult =
             rtype::network::Serializer::validateAndExtractPacket(rawData,
@@ -59,8 +60,8 @@ std::optional<rtype::network::Packet> PacketProcessor::processRawData(
         rtype::network::Packet packet(
             static_cast<rtype::network::PacketType>(header.opcode));
         if (header.payloadSize > 0) {
-            std::vector<uint8_t> payloadData(payload.begin(), payload.end());
-            packet.setData(payloadData);
+            packet.setData(
+                std::vector<uint8_t>(payload.begin(), payload.end()));
         }
 
         if (_verbose) {
@@ -90,15 +91,16 @@ std::optional<rtype::network::Packet> PacketProcessor::processRawData(
     }
 }
 
-void PacketProcessor::registerConnection(const std::string& endpointKey,
-                                         std::uint32_t userId) {
+void PacketProcessor::registerConnection(
+    const rtype::network::EndpointKey& endpointKey, std::uint32_t userId) {
     _securityContext.registerConnection(endpointKey, userId);
     LOG_DEBUG_CAT(::rtype::LogCategory::Network,
                   "[PacketProcessor] Registered UserID "
                       << userId << " for endpoint " << endpointKey);
 }
 
-void PacketProcessor::unregisterConnection(const std::string& endpointKey) {
+void PacketProcessor::unregisterConnection(
+    const rtype::network::EndpointKey& endpointKey) {
     _securityContext.removeConnection(endpointKey);
     LOG_DEBUG_CAT(::rtype::LogCategory::Network,
                   "[PacketProcessor] Unregistered endpoint " << endpointKey);
@@ -48,26 +48,27 @@ class PacketProcessor {
 
     /**
      * @brief Process raw data and extract a valid packet
-     * @param endpointKey Unique endpoint identifier string
+     * @param endpointKey Sender key (EndpointKey::from(endpoint))
      * @param rawData Raw packet bytes
      * @return Validated packet if successful, nullopt if validation failed
      */
     [[nodiscard]] std::optional<rtype::network::Packet> processRawData(
-        const std::string& endpointKey, std::span<const std::uint8_t> rawData);
+        const rtype::network::EndpointKey& endpointKey,
+        std::span<const std::uint8_t> rawData);
 
     /**
      * @brief Register a connection for UserID validation
      * @param endpointKey Unique endpoint identifier
      * @param userId Assigned user ID
      */
-    void registerConnection(const std::string& endpointKey,
+    void registerConnection(const rtype::network::EndpointKey& endpointKey,
                             std::uint32_t userId);
 
     /**
      * @brief Unregister a connection
      * @param endpointKey Unique endpoint identifier
      */
-    void unregisterConnection(const std::string& endpointKey);
+    void unregisterConnection(const rtype::network::EndpointKey& endpointKey);
 
     /**
      * @brief Get security context for external use
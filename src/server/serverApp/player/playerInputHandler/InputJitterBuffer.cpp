@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputJitterBuffer - Implementation
+*/
+
+#include "InputJitterBuffer.hpp"
+
+#include <algorithm>
+
+#include "protocol/Payloads.hpp"
+
+namespace rtype::server {
+
+namespace {
+
+/// Everything but movement: direction comes from the frame that is played
+constexpr std::uint16_t kCarriedBits =
+    rtype::network::InputMask::kShoot | rtype::network::InputMask::kForcePod |
+    rtype::network::InputMask::kChargeLevelMask |
+    rtype::network::InputMask::kWeaponSwitch;
+
+}  // namespace
+
+bool InputJitterBuffer::push(const network::InputFrame& frame) {
+    if (frame.tick == 0) {
+        return false;
+    }
+    if (cursor_ && frame.tick <= *cursor_) {
+        ++duplicates_;
+        return false;
+    }
+
+    auto it = std::lower_bound(frames_.begin(), frames_.end(), frame.tick,
+                               [](const network::InputFrame& stored,
+                                  std::uint32_t tick) {
+                                   return stored.tick < tick;
+                               });
+    if (it != frames_.end() && it->tick == frame.tick) {
+        ++duplicates_;
+        return false;
+    }
+    frames_.insert(it, frame);
+
+    if (frames_.size() > kCapacity) {
+        const auto& oldest = frames_.front();
+        carried_ |= oldest.inputMask & kCarriedBits;
+        if (cursor_) {
+            skipped_ += oldest.tick - *cursor_;
+            cursor_ = oldest.tick;
+        }
+        frames_.pop_front();
+    }
+    return true;
+}
+
+std::optional<network::InputFrame> InputJitterBuffer::pop() {
+    if (frames_.empty()) {
+        return std::nullopt;
+    }
+    const std::uint32_t newest = frames_.back().tick;
+
+    if (!cursor_) {
+        if (newest - frames_.front().tick < config_.delayTicks) {
+            return std::nullopt;
+        }
+        cursor_ = frames_.front().tick - 1;
+    }
+
+    if (newest - *cursor_ > config_.maxLagTicks) {
+        const std::uint32_t target = newest - config_.delayTicks - 1;
+        skipped_ += target - *cursor_;
+        cursor_ = target;
+        dropPlayed();
+        if (frames_.empty()) {
+            return std::nullopt;
+        }
+    }
+
+    network::InputFrame frame = frames_.front();
+    if (frame.tick != *cursor_ + 1) {
+        if (newest - *cursor_ <= config_.delayTicks) {
+            // The missing tick may still come in the next packet
+            return std::nullopt;
+        }
+        skipped_ += frame.tick - *cursor_ - 1;
+    }
+    frames_.pop_front();
+    cursor_ = frame.tick;
+    frame.inputMask |= carried_;
+    carried_ = 0;
+    return frame;
+}
+
+void InputJitterBuffer::dropPlayed() {
+    while (!frames_.empty() && frames_.front().tick <= *cursor_) {
+        carried_ |= frames_.front().inputMask & kCarriedBits;
+        frames_.pop_front();
+    }
+}
+
+void InputJitterBuffer::reset() noexcept {
+    frames_.clear();
+    cursor_.reset();
+    carried_ = 0;
+    duplicates_ = 0;
+    skipped_ = 0;
+}
+
+}  // namespace rtype::server
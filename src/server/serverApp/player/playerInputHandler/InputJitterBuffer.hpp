@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputJitterBuffer - Per-player playout buffer for input frames
+*/
+
+#ifndef SRC_SERVER_SERVERAPP_PLAYER_PLAYERINPUTHANDLER_INPUTJITTERBUFFER_HPP_
+#define SRC_SERVER_SERVERAPP_PLAYER_PLAYERINPUTHANDLER_INPUTJITTERBUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+#include "input/InputHistoryCodec.hpp"
+
+namespace rtype::server {
+
+/**
+ * @brief Plays a player's input frames back at one per simulation tick
+ *
+ * Clients send one frame per tick and repeat the last few in every C_INPUT,
+ * so a lost packet is covered by the next one. Frames are stored by client
+ * tick: copies of a stored or already played tick are dropped.
+ *
+ * Playback starts delayTicks behind the newest frame, which leaves time for
+ * a repeated frame to fill the hole of a lost packet. pop() returns the next
+ * tick in order; a missing tick is waited for while the buffer holds no more
+ * than delayTicks beyond it, then skipped. A player that falls more than
+ * maxLagTicks behind (burst after a stall, faster client clock, input
+ * resumed after idling) jumps back to delayTicks. Action bits of skipped
+ * frames are carried to the next played one so a short press is not lost.
+ *
+ * When pop() returns nothing the player keeps its last input: velocity stays
+ * on the entity and edge-triggered actions need no repeat.
+ */
+class InputJitterBuffer {
+   public:
+    /// Frames kept ahead of playback (about half a second at 60 Hz)
+    static constexpr std::size_t kCapacity = 32;
+
+    struct Config {
+        std::uint32_t delayTicks = 2;   ///< Frames held back at start
+        std::uint32_t maxLagTicks = 8;  ///< Lag that triggers a catch-up,
+                                        ///< must exceed delayTicks
+    };
+
+    InputJitterBuffer() = default;
+    explicit InputJitterBuffer(const Config& config) : config_(config) {}
+
+    /**
+     * @brief Store a received frame
+     * @return false if that tick is already stored or was played (redundant
+     *         copy or late packet), or is 0 (clients count from 1)
+     */
+    bool push(const network::InputFrame& frame);
+
+    /**
+     * @brief Frame to apply on this simulation tick
+     * @return nullopt if none is due yet (keep the last input)
+     */
+    [[nodiscard]] std::optional<network::InputFrame> pop();
+
+    /// Tick of the last frame played, nullopt before playback starts
+    [[nodiscard]] std::optional<std::uint32_t> lastTick() const noexcept {
+        return cursor_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return frames_.size(); }
+
+    /// Frames dropped as redundant copies or late arrivals
+    [[nodiscard]] std::uint64_t duplicates() const noexcept {
+        return duplicates_;
+    }
+
+    /// Client ticks skipped without being played (lost or client idle)
+    [[nodiscard]] std::uint64_t skipped() const noexcept { return skipped_; }
+
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+    void reset() noexcept;
+
+   private:
+    /// Drop stored frames at or before the playback cursor
+    void dropPlayed();
+
+    Config config_;
+    std::deque<network::InputFrame> frames_;  ///< Sorted by tick
+    std::optional<std::uint32_t> cursor_;
+    std::uint16_t carried_{0};
+    std::uint64_t duplicates_{0};
+    std::uint64_t skipped_{0};
+};
+
+}  // namespace rtype::server
+
+#endif  // SRC_SERVER_SERVERAPP_PLAYER_PLAYERINPUTHANDLER_INPUTJITTERBUFFER_HPP_
@@ -11,6 +11,7 @@
 #include <rtype/network.hpp>
 
 #include "games/rtype/shared/Components/CooldownComponent.hpp"
+#include "games/rtype/shared/Components/PowerUpComponent.hpp"
 #include "games/rtype/shared/Components/ProjectileComponent.hpp"
 #include "games/rtype/shared/Components/TransformComponent.hpp"
 #include "games/rtype/shared/Components/VelocityComponent.hpp"
@@ -21,6 +22,7 @@ namespace rtype::server {
 
 using Transform = rtype::games::rtype::shared::TransformComponent;
 using Velocity = rtype::games::rtype::shared::VelocityComponent;
+using ActivePowerUp = rtype::games::rtype::shared::ActivePowerUpComponent;
 using ShootCooldown = rtype::games::rtype::shared::ShootCooldownComponent;
 using WeaponComp = rtype::games::rtype::shared::WeaponComponent;
 using ProjectileType = rtype::games::rtype::shared::ProjectileType;
@@ -38,6 +40,16 @@ PlayerInputHandler::PlayerInputHandler(
     if (_gameConfig && _gameConfig->isInitialized()) {
         _playerSpeed = _gameConfig->getGameplaySettings().playerSpeed;
     }
+    if (_networkSystem) {
+        _networkSystem->setDefaultPlayerMoveSpeed(_playerSpeed);
+    }
+}
+
+void PlayerInputHandler::setPlayerSpeed(float speed) {
+    _playerSpeed = speed;
+    if (_networkSystem) {
+        _networkSystem->setDefaultPlayerMoveSpeed(_playerSpeed);
+    }
 }
 
 void PlayerInputHandler::handleInput(std::uint32_t userId,
@@ -71,7 +83,7 @@ void PlayerInputHandler::handleInput(std::uint32_t userId,
         return;
     }
 
-    processMovement(playerEntity, inputMask);
+    processMovement(userId, playerEntity, inputMask);
 
     bool hasLaserWeapon = false;
     if (_registry->hasComponent<WeaponComp>(playerEntity)) {
@@ -109,7 +121,14 @@ void PlayerInputHandler::handleInput(std::uint32_t userId,
         }
     }
 
-    if (inputMask & rtype::network::InputMask::kForcePod) {
+    // Held keys repeat on every tick once inputs are played per tick: launch
+    // on the press only
+    bool forcePodPressed =
+        (inputMask & rtype::network::InputMask::kForcePod) != 0;
+    bool wasForcePodPressed = _forcePodStates[userId];
+    _forcePodStates[userId] = forcePodPressed;
+
+    if (forcePodPressed && !wasForcePodPressed) {
         processForcePodLaunch(userId);
     }
 
@@ -123,22 +142,84 @@ void PlayerInputHandler::handleInput(std::uint32_t userId,
     }
 }
 
-void PlayerInputHandler::processMovement(ECS::Entity entity,
+void PlayerInputHandler::queueInputFrames(
+    std::uint32_t userId, const std::vector<network::InputFrame>& frames) {
+    if (frames.empty()) {
+        return;
+    }
+
+    if (_stateManager && !_stateManager->isPlaying()) {
+        _inputBuffers.erase(userId);
+        std::optional<ECS::Entity> entity;
+        if (_networkSystem) {
+            entity = _networkSystem->getPlayerEntity(userId);
+        }
+        handleInput(userId, frames.front().inputMask, entity);
+        return;
+    }
+
+    auto& buffer =
+        _inputBuffers.try_emplace(userId, _jitterConfig).first->second;
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+        buffer.push(*it);
+    }
+}
+
+void PlayerInputHandler::consumeBufferedInputs() {
+    for (auto& [userId, buffer] : _inputBuffers) {
+        auto frame = buffer.pop();
+        if (!frame) {
+            continue;
+        }
+
+        std::optional<ECS::Entity> entity;
+        if (_networkSystem) {
+            entity = _networkSystem->getPlayerEntity(userId);
+            _networkSystem->acknowledgeInput(
+                userId, static_cast<std::uint16_t>(frame->tick));
+        }
+        handleInput(userId, frame->inputMask, entity);
+    }
+}
+
+void PlayerInputHandler::removePlayer(std::uint32_t userId) {
+    _inputBuffers.erase(userId);
+    _weaponSwitchStates.erase(userId);
+    _forcePodStates.erase(userId);
+}
+
+const InputJitterBuffer* PlayerInputHandler::getJitterBuffer(
+    std::uint32_t userId) const {
+    auto it = _inputBuffers.find(userId);
+    return it != _inputBuffers.end() ? &it->second : nullptr;
+}
+
+void PlayerInputHandler::processMovement(std::uint32_t userId,
+                                         ECS::Entity entity,
                                          std::uint16_t inputMask) {
+    float speed = _playerSpeed;
+    if (_registry->hasComponent<ActivePowerUp>(entity)) {
+        speed *= _registry->getComponent<ActivePowerUp>(entity).speedMultiplier;
+    }
+    // The owner predicts its ship with this speed (S_UPDATE_POS)
+    if (_networkSystem) {
+        _networkSystem->setPlayerMoveSpeed(userId, speed);
+    }
+
     float vx = 0.0F;
     float vy = 0.0F;
 
     if (inputMask & rtype::network::InputMask::kUp) {
-        vy -= _playerSpeed;
+        vy -= speed;
     }
     if (inputMask & rtype::network::InputMask::kDown) {
-        vy += _playerSpeed;
+        vy += speed;
     }
     if (inputMask & rtype::network::InputMask::kLeft) {
-        vx -= _playerSpeed;
+        vx -= speed;
     }
     if (inputMask & rtype::network::InputMask::kRight) {
-        vx += _playerSpeed;
+        vx += speed;
     }
 
     if (!_registry->hasComponent<Velocity>(entity)) {
@@ -13,12 +13,14 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include <rtype/ecs.hpp>
 #include <rtype/engine.hpp>
 
 #include "GameStateManager.hpp"
 #include "IGameConfig.hpp"
+#include "InputJitterBuffer.hpp"
 
 namespace rtype::server {
 
@@ -99,6 +101,49 @@ class PlayerInputHandler {
     void handleInput(std::uint32_t userId, std::uint16_t inputMask,
                      std::optional<ECS::Entity> entity);
 
+    /**
+     * @brief Buffer a redundant input history from a player
+     *
+     * Frames go to the player's InputJitterBuffer and are applied by
+     * consumeBufferedInputs(). Outside of a running game there is no tick to
+     * play them on: the newest one is handled right away (any input marks
+     * the player ready) and the buffer is dropped.
+     *
+     * @param userId The player's user ID
+     * @param frames Received frames, newest first
+     */
+    void queueInputFrames(std::uint32_t userId,
+                          const std::vector<network::InputFrame>& frames);
+
+    /**
+     * @brief Apply at most one buffered frame per player
+     *
+     * Called once per simulation tick, before movement. The applied tick is
+     * acknowledged to the client for reconciliation; a starved player keeps
+     * its last input.
+     */
+    void consumeBufferedInputs();
+
+    /**
+     * @brief Forget a player's buffered frames and edge states
+     */
+    void removePlayer(std::uint32_t userId);
+
+    /**
+     * @brief Set the playout delay of the input jitter buffers
+     *
+     * Applies to buffers created afterwards.
+     */
+    void setJitterBufferConfig(const InputJitterBuffer::Config& config) {
+        _jitterConfig = config;
+    }
+
+    /**
+     * @brief Input jitter buffer of a player, nullptr if none
+     */
+    [[nodiscard]] const InputJitterBuffer* getJitterBuffer(
+        std::uint32_t userId) const;
+
     /**
      * @brief Set callback for shooting
      */
@@ -130,13 +175,17 @@ class PlayerInputHandler {
     /**
      * @brief Set player speed override
      */
-    void setPlayerSpeed(float speed) { _playerSpeed = speed; }
+    void setPlayerSpeed(float speed);
 
    private:
     /**
      * @brief Process movement input
+     *
+     * Moves at the configured speed times the active speed modifier and
+     * reports that speed to the network system for client prediction.
      */
-    void processMovement(ECS::Entity entity, std::uint16_t inputMask);
+    void processMovement(std::uint32_t userId, ECS::Entity entity,
+                         std::uint16_t inputMask);
 
     /**
      * @brief Process shoot input
@@ -171,6 +220,9 @@ class PlayerInputHandler {
     float _playerSpeed{DEFAULT_PLAYER_SPEED};
     bool _verbose;
     std::unordered_map<std::uint32_t, bool> _weaponSwitchStates;
+    std::unordered_map<std::uint32_t, bool> _forcePodStates;
+    InputJitterBuffer::Config _jitterConfig;
+    std::unordered_map<std::uint32_t, InputJitterBuffer> _inputBuffers;
 };
 
 }  // namespace rtype::server
@@ -10,6 +10,7 @@
 #include <rtype/common.hpp>
 
 #include "games/rtype/shared/Components/BoundingBoxComponent.hpp"
+#include "games/rtype/shared/Components/CollisionLayerComponent.hpp"
 #include "games/rtype/shared/Components/CooldownComponent.hpp"
 #include "games/rtype/shared/Components/HealthComponent.hpp"
 #include "games/rtype/shared/Components/NetworkIdComponent.hpp"
@@ -27,6 +28,7 @@ using Velocity = rtype::games::rtype::shared::VelocityComponent;
 using ShootCooldown = rtype::games::rtype::shared::ShootCooldownComponent;
 using Weapon = rtype::games::rtype::shared::WeaponComponent;
 using BoundingBox = rtype::games::rtype::shared::BoundingBoxComponent;
+using CollisionLayer = rtype::games::rtype::shared::CollisionLayerComponent;
 using PlayerTag = rtype::games::rtype::shared::PlayerTag;
 using NetworkIdComponent = rtype::games::rtype::shared::NetworkIdComponent;
 using Health = rtype::games::rtype::shared::HealthComponent;
@@ -80,6 +82,10 @@ PlayerSpawnResult PlayerSpawner::spawnPlayer(std::uint32_t userId,
 
     _registry->emplaceComponent<BoundingBox>(
         playerEntity, playerConfig.hitboxWidth, playerConfig.hitboxHeight);
+    _registry->emplaceComponent<CollisionLayer>(
+        playerEntity,
+        CollisionLayer::of(rtype::games::rtype::shared::CollisionLayer::Player,
+                           playerConfig.collisionMask));
 
     _registry->emplaceComponent<PlayerTag>(playerEntity);
     _registry->emplaceComponent<Health>(playerEntity, playerConfig.health,
@@ -8,6 +8,7 @@
 
 #include "AdminServer.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -21,6 +22,7 @@
 #include "server/lobby/Lobby.hpp"
 #include "server/lobby/LobbyManager.hpp"
 #include "server/serverApp/ServerApp.hpp"
+#include "server/shared/MetricsRegistry.hpp"
 using json = nlohmann::json;
 
 namespace rtype::server {
@@ -617,6 +619,18 @@ void AdminServer::registerMetricsRoutes(void* serverPtr) {
         res.status = 200;
     });
 
+    // Prometheus scrape target: every lobby's series, `lobby`-labeled
+    server->Get("/metrics", [this](const Request& req, Response& res) {
+        if (!authenticateRequest(_config, req, _adminUser, _adminPass)) {
+            res.set_content("Unauthorized\n", "text/plain");
+            res.status = 401;
+            return;
+        }
+        res.set_content(MetricsRegistry::instance().renderPrometheus(),
+                        "text/plain; version=0.0.4");
+        res.status = 200;
+    });
+
     server->Post("/api/metrics/reset", [this](const Request& req,
                                               Response& res) {
         if (!authenticateRequest(_config, req, _adminUser, _adminPass)) {
@@ -698,6 +712,7 @@ std::string AdminServer::buildMetricsJson() const {
     std::uint64_t totalTickOverruns = 0;
     std::uint64_t totalConnections = 0;
     std::uint64_t totalConnectionsRejected = 0;
+    std::uint64_t worstTickJitterP99Us = 0;
 
     if (_lobbyManager) {
         auto lobbies = _lobbyManager->getAllLobbies();
@@ -728,6 +743,9 @@ std::string AdminServer::buildMetricsJson() const {
                 totalConnectionsRejected +=
                     lobbyMetrics.connectionsRejected.load(
                         std::memory_order_relaxed);
+                worstTickJitterP99Us = std::max(
+                    worstTickJitterP99Us, lobbyMetrics.tickJitterP99Us.load(
+                                              std::memory_order_relaxed));
             }
         }
     }
@@ -758,6 +776,7 @@ std::string AdminServer::buildMetricsJson() const {
         << R"("bytesReceived":)" << totalBytesReceived << ","
         << R"("bytesSent":)" << totalBytesSent << ","
         << R"("tickOverruns":)" << totalTickOverruns << ","
+        << R"("tickJitterP99Us":)" << worstTickJitterP99Us << ","
         << R"("connectionsRejected":)" << totalConnectionsRejected << ","
         << R"("totalConnections":)" << totalConnections << ",";
 
@@ -776,7 +795,11 @@ std::string AdminServer::buildMetricsJson() const {
             << R"("bytesReceived":)" << snap.bytesReceived << ","
             << R"("bytesSent":)" << snap.bytesSent << ","
             << R"("packetLossPercent":)" << snap.packetLossPercent << ","
-            << R"("tickOverruns":)" << snap.tickOverruns << "}";
+            << R"("tickOverruns":)" << snap.tickOverruns << ","
+            << R"("tickP99Us":)" << snap.tickP99Us << ","
+            << R"("updateP99Us":)" << snap.updateP99Us << ","
+            << R"("broadcastP99Us":)" << snap.broadcastP99Us << ","
+            << R"("simulationRate":)" << snap.simulationRate << "}";
     }
     oss << R"(])";
     oss << R"(})";
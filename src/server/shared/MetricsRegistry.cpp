@@ -0,0 +1,209 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** MetricsRegistry - Implementation
+*/
+
+#include "MetricsRegistry.hpp"
+
+#include <algorithm>
+#include <format>
+
+#include "ServerMetrics.hpp"
+
+namespace rtype::server {
+
+namespace {
+
+std::string escapeLabelValue(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/// `{a="1",b="2"` without the closing brace, so `le` can be appended
+std::string openLabels(const MetricsRegistry::Labels& labels) {
+    std::string out = "{";
+    for (const auto& [key, value] : labels) {
+        if (out.size() > 1) {
+            out += ',';
+        }
+        out += key + "=\"" + escapeLabelValue(value) + '"';
+    }
+    return out;
+}
+
+std::string closedLabels(const MetricsRegistry::Labels& labels) {
+    return labels.empty() ? std::string{} : openLabels(labels) + '}';
+}
+
+void renderHistogram(std::string& out, const std::string& name,
+                     const MetricsRegistry::Labels& labels,
+                     const HdrHistogram& histogram,
+                     const MetricsRegistry::Buckets& buckets) {
+    const std::string prefix = openLabels(labels);
+    const char* separator = labels.empty() ? "" : ",";
+    for (unsigned p = buckets.firstPow2; p <= buckets.lastPow2; ++p) {
+        const std::uint64_t bound = std::uint64_t{1} << p;
+        const double le = static_cast<double>(bound) * buckets.scale;
+        out += std::format("{}_bucket{}{}le=\"{}\"}} {}\n", name, prefix,
+                           separator, le, histogram.countAtOrBelow(bound));
+    }
+    const std::uint64_t count = histogram.count();
+    out += std::format("{}_bucket{}{}le=\"+Inf\"}} {}\n", name, prefix,
+                       separator, count);
+    out += std::format("{}_sum{} {}\n", name, closedLabels(labels),
+                       static_cast<double>(histogram.sum()) * buckets.scale);
+    out += std::format("{}_count{} {}\n", name, closedLabels(labels), count);
+}
+
+}  // namespace
+
+bool MetricsRegistry::isExpired(const Series& series) {
+    return series.counter.expired() && series.histogram.expired();
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+bool MetricsRegistry::addCounter(
+    const std::string& name, const std::string& help, Labels labels,
+    std::shared_ptr<const ShardedCounter> counter) {
+    return addSeries(name, help, false,
+                     Series{std::move(labels), counter, {}, {}});
+}
+
+bool MetricsRegistry::addHistogram(
+    const std::string& name, const std::string& help, Labels labels,
+    std::shared_ptr<const HdrHistogram> histogram, Buckets buckets) {
+    return addSeries(name, help, true,
+                     Series{std::move(labels), {}, histogram, buckets});
+}
+
+bool MetricsRegistry::addSeries(const std::string& name,
+                                const std::string& help, bool isHistogram,
+                                Series series) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto [it, inserted] = _families.try_emplace(name);
+    Family& family = it->second;
+    if (inserted) {
+        family.help = help;
+        family.isHistogram = isHistogram;
+    } else if (family.isHistogram != isHistogram) {
+        return false;
+    }
+    // Lobbies come and go without a scrape in between
+    std::erase_if(family.series, isExpired);
+    family.series.push_back(std::move(series));
+    return true;
+}
+
+std::string MetricsRegistry::renderPrometheus() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::string out;
+    for (auto it = _families.begin(); it != _families.end();) {
+        const std::string& name = it->first;
+        Family& family = it->second;
+        std::erase_if(family.series, isExpired);
+        if (family.series.empty()) {
+            it = _families.erase(it);
+            continue;
+        }
+
+        out += std::format("# HELP {} {}\n# TYPE {} {}\n", name, family.help,
+                           name, family.isHistogram ? "histogram" : "counter");
+        for (const Series& series : family.series) {
+            if (family.isHistogram) {
+                if (auto histogram = series.histogram.lock()) {
+                    renderHistogram(out, name, series.labels, *histogram,
+                                    series.buckets);
+                }
+            } else if (auto counter = series.counter.lock()) {
+                out += std::format("{}{} {}\n", name,
+                                   closedLabels(series.labels),
+                                   counter->load());
+            }
+        }
+        ++it;
+    }
+    return out;
+}
+
+std::size_t MetricsRegistry::seriesCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::size_t live = 0;
+    for (const auto& [name, family] : _families) {
+        live += family.series.size() -
+                static_cast<std::size_t>(
+                    std::ranges::count_if(family.series, isExpired));
+    }
+    return live;
+}
+
+void registerServerMetrics(MetricsRegistry& registry,
+                           const std::shared_ptr<ServerMetrics>& metrics,
+                           const std::string& lobby) {
+    // Aliasing pointers: each series keeps the whole ServerMetrics alive
+    // while it is being rendered, and expires with it
+    auto counter = [&](const std::string& name, const std::string& help,
+                       const ShardedCounter& member) {
+        registry.addCounter(
+            name, help, {{"lobby", lobby}},
+            std::shared_ptr<const ShardedCounter>(metrics, &member));
+    };
+    auto histogram = [&](const std::string& name, const std::string& help,
+                         MetricsRegistry::Labels labels,
+                         const HdrHistogram& member,
+                         MetricsRegistry::Buckets buckets) {
+        labels.insert(labels.begin(), {"lobby", lobby});
+        registry.addHistogram(
+            name, help, std::move(labels),
+            std::shared_ptr<const HdrHistogram>(metrics, &member), buckets);
+    };
+
+    counter("rtype_packets_received_total", "Valid packets received",
+            metrics->packetsReceived);
+    counter("rtype_packets_sent_total", "Packets sent", metrics->packetsSent);
+    counter("rtype_packets_dropped_total",
+            "Datagrams dropped before reaching the game",
+            metrics->packetsDropped);
+    counter("rtype_bytes_received_total", "Bytes of valid packets received",
+            metrics->bytesReceived);
+    counter("rtype_bytes_sent_total", "Bytes sent", metrics->bytesSent);
+    counter("rtype_connections_total", "Accepted connections",
+            metrics->totalConnections);
+    counter("rtype_connections_rejected_total", "Rejected connections",
+            metrics->connectionsRejected);
+
+    histogram("rtype_tick_duration_seconds", "Simulation time of one tick",
+              {}, metrics->tickDuration, {10, 30, 1e-9});
+    histogram("rtype_packet_size_bytes", "Datagram payload size",
+              {{"direction", "in"}}, metrics->packetSizeReceived, {3, 11, 1});
+    histogram("rtype_packet_size_bytes", "Datagram payload size",
+              {{"direction", "out"}}, metrics->packetSizeSent, {3, 11, 1});
+    histogram("rtype_rtt_seconds", "Reliable packet round-trip time", {},
+              metrics->rtt, {17, 31, 1e-9});
+    histogram("rtype_inbound_queue_depth",
+              "Packets waiting for the game thread at each poll", {},
+              metrics->inboundQueueDepth, {0, 13, 1});
+}
+
+}  // namespace rtype::server
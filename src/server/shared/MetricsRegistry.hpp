@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** MetricsRegistry - Labeled metric series exported in Prometheus format
+*/
+
+#ifndef SRC_SERVER_SHARED_METRICSREGISTRY_HPP_
+#define SRC_SERVER_SHARED_METRICSREGISTRY_HPP_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Metrics/HdrHistogram.hpp"
+#include "Metrics/ShardedCounter.hpp"
+
+namespace rtype::server {
+
+struct ServerMetrics;
+
+/**
+ * @brief Process-wide index of metric series for the /metrics endpoint
+ *
+ * The registry does not own the metrics: whoever updates a counter or
+ * histogram keeps it (usually inside its ServerMetrics) and registers a
+ * shared_ptr to it with its labels. The registry only keeps weak
+ * references, so a lobby's series disappear from the export when the
+ * lobby is destroyed, without an explicit unregister.
+ *
+ * Updating a metric never touches the registry; only registration and
+ * rendering take its mutex.
+ *
+ * Thread-safety: all methods from any thread.
+ */
+class MetricsRegistry {
+   public:
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief Histogram buckets exported to Prometheus
+     *
+     * One `le` bound per power of two from 2^firstPow2 to 2^lastPow2 raw
+     * units, multiplied by scale (1e-9 exports nanoseconds as seconds).
+     * Powers of two are HdrHistogram bucket boundaries, so counts are exact.
+     */
+    struct Buckets {
+        unsigned firstPow2{0};
+        unsigned lastPow2{20};
+        double scale{1.0};
+    };
+
+    /// Registry used by the server and its /metrics endpoint
+    static MetricsRegistry& instance();
+
+    /**
+     * @brief Register a counter series
+     * @return false if @p name is already a histogram
+     */
+    bool addCounter(const std::string& name, const std::string& help,
+                    Labels labels,
+                    std::shared_ptr<const ShardedCounter> counter);
+
+    /**
+     * @brief Register a histogram series
+     * @return false if @p name is already a counter
+     */
+    bool addHistogram(const std::string& name, const std::string& help,
+                      Labels labels,
+                      std::shared_ptr<const HdrHistogram> histogram,
+                      Buckets buckets);
+
+    /**
+     * @brief Render every live series in the Prometheus text format (0.0.4)
+     *
+     * Series whose owner is gone are dropped on the way.
+     */
+    [[nodiscard]] std::string renderPrometheus();
+
+    /// Live series, for tests and diagnostics
+    [[nodiscard]] std::size_t seriesCount() const;
+
+   private:
+    struct Series {
+        Labels labels;
+        std::weak_ptr<const ShardedCounter> counter;
+        std::weak_ptr<const HdrHistogram> histogram;
+        Buckets buckets;
+    };
+
+    struct Family {
+        std::string help;
+        bool isHistogram{false};
+        std::vector<Series> series;
+    };
+
+    static bool isExpired(const Series& series);
+
+    bool addSeries(const std::string& name, const std::string& help,
+                   bool isHistogram, Series series);
+
+    mutable std::mutex _mutex;
+    std::map<std::string, Family> _families;  ///< Sorted for stable output
+};
+
+/**
+ * @brief Register a lobby's ServerMetrics counters and histograms
+ *
+ * Every series gets a `lobby` label; they live as long as @p metrics.
+ *
+ * @param registry Registry to add the series to
+ * @param metrics Metrics of one ServerApp
+ * @param lobby Lobby code, or a name for a standalone server
+ */
+void registerServerMetrics(MetricsRegistry& registry,
+                           const std::shared_ptr<ServerMetrics>& metrics,
+                           const std::string& lobby);
+
+}  // namespace rtype::server
+
+#endif  // SRC_SERVER_SHARED_METRICSREGISTRY_HPP_
@@ -14,6 +14,9 @@
 #include <deque>
 #include <shared_mutex>
 
+#include "Metrics/HdrHistogram.hpp"
+#include "Metrics/ShardedCounter.hpp"
+
 namespace rtype::server {
 
 /**
@@ -28,24 +31,44 @@ struct MetricsSnapshot {
     uint64_t bytesSent{0};
     double packetLossPercent{0.0};
     uint64_t tickOverruns{0};
+    uint64_t tickP99Us{0};       ///< Whole frame, see ServerLoop histograms
+    uint64_t updateP99Us{0};     ///< One simulation tick
+    uint64_t broadcastP99Us{0};  ///< State broadcast
+    uint32_t simulationRate{0};  ///< Hz, below the tick rate when degraded
 };
 
 /**
  * @brief Server metrics for monitoring
  *
  * Thread-safe metrics structure using atomics for lock-free access.
- * All counters can be safely read and updated from multiple threads.
+ * All counters can be safely read and updated from multiple threads; they
+ * are sharded per thread so the I/O and game threads never contend.
  * Maintains a circular buffer of historical snapshots (max 60 entries).
+ *
+ * registerServerMetrics() exports the counters and histograms through the
+ * MetricsRegistry (Prometheus /metrics on the admin server).
  */
 struct ServerMetrics {
-    std::atomic<uint64_t> packetsReceived{0};
-    std::atomic<uint64_t> packetsSent{0};
-    std::atomic<uint64_t> packetsDropped{0};
-    std::atomic<uint64_t> bytesReceived{0};
-    std::atomic<uint64_t> bytesSent{0};
-    std::atomic<uint64_t> tickOverruns{0};
-    std::atomic<uint64_t> connectionsRejected{0};
-    std::atomic<uint64_t> totalConnections{0};
+    rtype::ShardedCounter packetsReceived;
+    rtype::ShardedCounter packetsSent;
+    rtype::ShardedCounter packetsDropped;
+    rtype::ShardedCounter bytesReceived;
+    rtype::ShardedCounter bytesSent;
+    rtype::ShardedCounter tickOverruns;
+    rtype::ShardedCounter connectionsRejected;
+    rtype::ShardedCounter totalConnections;
+
+    rtype::HdrHistogram tickDuration;        ///< ns, simulation of one tick
+    rtype::HdrHistogram packetSizeReceived;  ///< bytes, valid datagrams
+    rtype::HdrHistogram packetSizeSent;      ///< bytes
+    rtype::HdrHistogram rtt;                 ///< ns, reliable packet to ack
+    rtype::HdrHistogram inboundQueueDepth;   ///< Packets waiting per poll()
+
+    /// Tick start lateness percentiles in microseconds, only filled while
+    /// the loop measures jitter (see ServerLoop::setJitterMeasurement())
+    std::atomic<uint64_t> tickJitterP50Us{0};
+    std::atomic<uint64_t> tickJitterP99Us{0};
+    std::atomic<uint64_t> tickJitterMaxUs{0};
     std::chrono::steady_clock::time_point serverStartTime{
         std::chrono::steady_clock::now()};
 
@@ -0,0 +1,200 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** ClientPrediction - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "client/network/ClientPrediction.hpp"
+#include "protocol/Payloads.hpp"
+
+using rtype::client::ClientPrediction;
+namespace InputMask = rtype::network::InputMask;
+
+TEST(ClientPredictionTest, VelocityMatchesServerRules) {
+    ClientPrediction prediction;
+    prediction.setSpeed(250.0F);
+
+    auto [vx, vy] = prediction.velocityFor(InputMask::kRight | InputMask::kUp);
+    EXPECT_FLOAT_EQ(vx, 250.0F);
+    EXPECT_FLOAT_EQ(vy, -250.0F);
+
+    // Opposite keys cancel out, other bits do not move the ship
+    auto [sx, sy] = prediction.velocityFor(
+        InputMask::kLeft | InputMask::kRight | InputMask::kShoot);
+    EXPECT_FLOAT_EQ(sx, 0.0F);
+    EXPECT_FLOAT_EQ(sy, 0.0F);
+}
+
+TEST(ClientPredictionTest, ReplaysUnackedInputs) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+
+    prediction.record(1, InputMask::kRight, 0.0);
+    prediction.record(2, InputMask::kDown, 1.0);
+
+    // Server applied nothing yet: both inputs are replayed
+    auto predicted = prediction.reconcile(0, 0.0F, 0.0F, 1.5, 0.0);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_FLOAT_EQ(predicted->first, 100.0F);
+    EXPECT_FLOAT_EQ(predicted->second, 50.0F);
+    EXPECT_TRUE(prediction.synced());
+}
+
+TEST(ClientPredictionTest, AckedInputIsReplayedFromOneRoundTripAgo) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+
+    prediction.record(1, InputMask::kRight, 0.0);
+    prediction.record(2, InputMask::kDown, 1.0);
+    prediction.record(3, 0, 2.0);
+
+    // Input 2 applied; the server position is the one of t = 1.6 - 0.2
+    auto predicted = prediction.reconcile(2, 0.0F, 40.0F, 1.6, 0.2);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_FLOAT_EQ(predicted->first, 0.0F);
+    EXPECT_FLOAT_EQ(predicted->second, 60.0F);
+    // Input 1 is superseded
+    EXPECT_EQ(prediction.pendingCount(), 2u);
+}
+
+TEST(ClientPredictionTest, ReplayStaysInsideAckedSegment) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+
+    prediction.record(1, InputMask::kRight, 0.0);
+    prediction.record(2, InputMask::kDown, 1.0);
+
+    // Round trip says t = 1.5, but input 2 was not applied: the server can
+    // at most be at the end of input 1, so all of input 2 is replayed
+    auto late = prediction.reconcile(1, 100.0F, 0.0F, 2.0, 0.5);
+    ASSERT_TRUE(late.has_value());
+    EXPECT_FLOAT_EQ(late->first, 100.0F);
+    EXPECT_FLOAT_EQ(late->second, 100.0F);
+
+    // Round trip longer than the input's age: replay it from its start
+    auto early = prediction.reconcile(2, 100.0F, 0.0F, 1.5, 2.0);
+    ASSERT_TRUE(early.has_value());
+    EXPECT_FLOAT_EQ(early->second, 50.0F);
+}
+
+TEST(ClientPredictionTest, TickSeqsReplayFromTheAckedTick) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+    prediction.setTickSeconds(0.1);
+
+    prediction.record(10, InputMask::kRight, 0.0);
+    prediction.record(20, InputMask::kDown, 1.0);
+
+    // Ticks 10..14 of input 10 applied: the server is 0.5 s into it, the
+    // round trip estimate is not used
+    auto predicted = prediction.reconcile(14, 50.0F, 0.0F, 2.0, 5.0);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_FLOAT_EQ(predicted->first, 100.0F);
+    EXPECT_FLOAT_EQ(predicted->second, 100.0F);
+}
+
+TEST(ClientPredictionTest, IgnoresReorderedCorrections) {
+    ClientPrediction prediction;
+    prediction.record(10, InputMask::kUp, 0.0);
+    prediction.record(11, 0, 0.5);
+
+    ASSERT_TRUE(prediction.reconcile(11, 0.0F, 0.0F, 1.0, 0.1).has_value());
+    EXPECT_FALSE(prediction.reconcile(10, 5.0F, 5.0F, 1.0, 0.1).has_value());
+    // Same ack again is a fresh position for the same input
+    EXPECT_TRUE(prediction.reconcile(11, 1.0F, 1.0F, 1.1, 0.1).has_value());
+}
+
+TEST(ClientPredictionTest, SequenceIdsWrapAround) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+
+    prediction.record(65535, InputMask::kRight, 0.0);
+    prediction.record(0, InputMask::kLeft, 1.0);
+
+    // Ack 0 is newer than 65535: only the left input is replayed
+    auto predicted = prediction.reconcile(0, 0.0F, 0.0F, 2.0, 1.0);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_FLOAT_EQ(predicted->first, -100.0F);
+    EXPECT_EQ(prediction.pendingCount(), 1u);
+
+    auto [vx, vy] = prediction.currentVelocity();
+    EXPECT_FLOAT_EQ(vx, -100.0F);
+    EXPECT_FLOAT_EQ(vy, 0.0F);
+}
+
+TEST(ClientPredictionTest, HistoryIsBounded) {
+    ClientPrediction prediction;
+    for (std::uint16_t seq = 1; seq <= ClientPrediction::kMaxPendingInputs + 10;
+         ++seq) {
+        prediction.record(seq, InputMask::kUp, seq * 0.01);
+    }
+    EXPECT_EQ(prediction.pendingCount(), ClientPrediction::kMaxPendingInputs);
+
+    prediction.clear();
+    EXPECT_EQ(prediction.pendingCount(), 0u);
+    EXPECT_FALSE(prediction.synced());
+}
+
+TEST(ClientPredictionTest, ServerSpeedKeepsPredictionOnAuthority) {
+    // Client configured with players.toml's 250, server moving at 260
+    constexpr float kServerSpeed = 260.0F;
+    constexpr double kTick = 1.0 / 60.0;
+    ClientPrediction prediction;
+    prediction.setSpeed(250.0F);
+    prediction.setTickSeconds(kTick);
+
+    // Spawn correction: stationary ship, the server reports its speed
+    prediction.setSpeed(kServerSpeed);
+    ASSERT_TRUE(prediction.reconcile(0, 0.0F, 0.0F, 0.0, 0.0).has_value());
+
+    prediction.record(1, InputMask::kRight | InputMask::kDown, 0.0);
+
+    // Server side: the held input applied once per tick
+    constexpr int kAckedTicks = 100;
+    constexpr int kTicks = 120;
+    float serverX = 0.0F;
+    float serverY = 0.0F;
+    auto step = [&]() {
+        serverX += kServerSpeed * static_cast<float>(kTick);
+        serverY += kServerSpeed * static_cast<float>(kTick);
+    };
+    for (int tick = 0; tick < kAckedTicks; ++tick) {
+        step();
+    }
+    const float ackedX = serverX;
+    const float ackedY = serverY;
+    for (int tick = kAckedTicks; tick < kTicks; ++tick) {
+        step();
+    }
+
+    // Correction for tick 100 arrives at tick 120: the replayed prediction
+    // lands where the server is after N ticks
+    prediction.setSpeed(kServerSpeed);
+    auto predicted =
+        prediction.reconcile(kAckedTicks, ackedX, ackedY, kTicks * kTick, 0.0);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_NEAR(predicted->first, serverX, 1e-2F);
+    EXPECT_NEAR(predicted->second, serverY, 1e-2F);
+
+    auto [vx, vy] = prediction.currentVelocity();
+    EXPECT_FLOAT_EQ(vx, kServerSpeed);
+    EXPECT_FLOAT_EQ(vy, kServerSpeed);
+}
+
+TEST(ClientPredictionTest, ReportedSpeedAppliesToPendingInputs) {
+    ClientPrediction prediction;
+    prediction.setSpeed(100.0F);
+
+    prediction.record(1, InputMask::kRight, 0.0);
+
+    // A speed modifier reported later also applies to the unacked replay
+    prediction.setSpeed(150.0F);
+    auto predicted = prediction.reconcile(0, 0.0F, 0.0F, 2.0, 0.0);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_FLOAT_EQ(predicted->first, 300.0F);
+}
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistory - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "client/network/InputHistory.hpp"
+#include "protocol/Payloads.hpp"
+
+using rtype::client::InputHistory;
+namespace InputMask = rtype::network::InputMask;
+
+namespace {
+
+constexpr double kTick = InputHistory::tickSeconds();
+
+}  // namespace
+
+TEST(InputHistoryTest, OneFramePerTick) {
+    InputHistory history;
+    history.setInput(InputMask::kUp);
+
+    EXPECT_TRUE(history.advance(1.0));
+    ASSERT_EQ(history.frames().size(), 1u);
+    EXPECT_EQ(history.frames()[0].tick, 1u);
+    EXPECT_EQ(history.frames()[0].inputMask, InputMask::kUp);
+
+    // Same tick: nothing new to send
+    EXPECT_FALSE(history.advance(1.0 + kTick / 2));
+
+    history.setInput(InputMask::kDown);
+    EXPECT_TRUE(history.advance(1.0 + kTick * 1.5));
+    ASSERT_EQ(history.frames().size(), 2u);
+    EXPECT_EQ(history.frames()[0].tick, 2u);
+    EXPECT_EQ(history.frames()[0].inputMask, InputMask::kDown);
+    EXPECT_EQ(history.frames()[1].tick, 1u);
+    EXPECT_EQ(history.nextTick(), 3u);
+}
+
+TEST(InputHistoryTest, FramesAreBoundedByRedundancy) {
+    InputHistory history;
+    history.setRedundancy(3);
+    history.setInput(InputMask::kLeft);
+
+    for (int i = 0; i < 10; ++i) {
+        history.advance(i * kTick);
+    }
+    ASSERT_EQ(history.frames().size(), 3u);
+    EXPECT_EQ(history.frames()[0].tick, 10u);
+    EXPECT_EQ(history.frames()[2].tick, 8u);
+
+    history.setRedundancy(100);
+    EXPECT_EQ(history.redundancy(), rtype::network::kMaxInputHistoryFrames);
+}
+
+TEST(InputHistoryTest, ShortPressIsNotLostBetweenTicks) {
+    InputHistory history;
+    history.advance(0.0);
+
+    history.setInput(InputMask::kShoot);
+    history.setInput(0);
+    ASSERT_TRUE(history.advance(kTick));
+    EXPECT_EQ(history.frames()[0].inputMask, InputMask::kShoot);
+
+    history.advance(2 * kTick);
+    EXPECT_EQ(history.frames()[0].inputMask, 0);
+}
+
+TEST(InputHistoryTest, StallSkipsTicksOutsideTheWindow) {
+    InputHistory history;
+    history.setInput(InputMask::kRight);
+    history.advance(0.0);
+
+    // One second without a frame: only the last window is emitted
+    ASSERT_TRUE(history.advance(1.0 + kTick / 2));
+    EXPECT_EQ(history.nextTick(), 62u);
+    const auto frames = history.frames();
+    ASSERT_EQ(frames.size(), InputHistory::kDefaultRedundancy);
+    EXPECT_EQ(frames[0].tick, 61u);
+    EXPECT_EQ(frames[5].tick, 56u);
+}
+
+TEST(InputHistoryTest, StopsSendingOnceIdleFramesAreCovered) {
+    InputHistory history;
+    history.setRedundancy(2);
+    history.setInput(InputMask::kUp);
+    EXPECT_TRUE(history.advance(0.0));
+
+    history.setInput(0);
+    EXPECT_TRUE(history.advance(kTick));
+    EXPECT_TRUE(history.advance(2 * kTick));
+    EXPECT_FALSE(history.advance(3 * kTick));
+    EXPECT_FALSE(history.advance(4 * kTick));
+
+    // Ticks kept counting while silent
+    history.setInput(InputMask::kUp);
+    EXPECT_TRUE(history.advance(5 * kTick));
+    EXPECT_EQ(history.frames()[0].tick, 6u);
+}
+
+TEST(InputHistoryTest, ResetRestartsTheClock) {
+    InputHistory history;
+    history.setInput(InputMask::kUp);
+    history.advance(0.0);
+    history.advance(kTick);
+
+    history.reset();
+    EXPECT_TRUE(history.frames().empty());
+    EXPECT_EQ(history.nextTick(), 1u);
+    EXPECT_TRUE(history.advance(100.0));
+    EXPECT_EQ(history.frames()[0].tick, 1u);
+    EXPECT_EQ(history.frames()[0].inputMask, 0);
+}
@@ -0,0 +1,197 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterpolationBuffer - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "client/network/InterpolationBuffer.hpp"
+
+using rtype::client::InterpolationBuffer;
+using rtype::client::InterpolationClock;
+using rtype::client::InterpolationSample;
+
+namespace {
+
+constexpr double kSecondsPerTick = 1.0 / 60.0;
+
+}  // namespace
+
+TEST(InterpolationBufferTest, EmptyHasNoState) {
+    InterpolationBuffer buffer;
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.sample(10.0, kSecondsPerTick, 6.0).has_value());
+}
+
+TEST(InterpolationBufferTest, RejectsOldAndDuplicateTicks) {
+    InterpolationBuffer buffer;
+    EXPECT_TRUE(buffer.push({10, 0, 0, 0, 0}));
+    EXPECT_FALSE(buffer.push({10, 5, 5, 0, 0}));
+    EXPECT_FALSE(buffer.push({9, 5, 5, 0, 0}));
+    EXPECT_TRUE(buffer.push({12, 5, 5, 0, 0}));
+    EXPECT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer.newest().tick, 12u);
+}
+
+TEST(InterpolationBufferTest, HermiteFollowsConstantVelocity) {
+    InterpolationBuffer buffer;
+    // 60 px/s over 6 ticks = 6 px
+    buffer.push({0, 0, 0, 60, 0});
+    buffer.push({6, 6, 0, 60, 0});
+
+    for (double tick : {1.0, 3.0, 4.5}) {
+        auto state = buffer.sample(tick, kSecondsPerTick, 6.0);
+        ASSERT_TRUE(state.has_value());
+        EXPECT_NEAR(state->x, tick, 1e-4);
+        EXPECT_NEAR(state->vx, 60.0, 1e-3);
+        EXPECT_FALSE(state->extrapolated);
+    }
+}
+
+TEST(InterpolationBufferTest, HermiteUsesVelocityTangents) {
+    InterpolationBuffer buffer;
+    // Same endpoints, opposite initial velocities: the curve bends
+    buffer.push({0, 0, 0, 0, 120});
+    buffer.push({4, 10, 0, 0, 0});
+
+    auto mid = buffer.sample(2.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(mid.has_value());
+    EXPECT_NEAR(mid->x, 5.0, 1e-4);
+    // h10(0.5) * span * vy = 0.125 * (4 / 60) * 120
+    EXPECT_NEAR(mid->y, 1.0, 1e-4);
+}
+
+TEST(InterpolationBufferTest, PicksSurroundingSamples) {
+    InterpolationBuffer buffer;
+    buffer.push({0, 0, 0, 0, 0});
+    buffer.push({2, 100, 0, 0, 0});
+    buffer.push({4, 100, 50, 0, 0});
+
+    auto state = buffer.sample(3.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(state.has_value());
+    EXPECT_NEAR(state->x, 100.0, 1e-4);
+    EXPECT_NEAR(state->y, 25.0, 1e-4);
+}
+
+TEST(InterpolationBufferTest, ClampsBeforeOldestSample) {
+    InterpolationBuffer buffer;
+    buffer.push({10, 3, 4, 60, 0});
+    buffer.push({12, 5, 4, 60, 0});
+
+    auto state = buffer.sample(2.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(state.has_value());
+    EXPECT_FLOAT_EQ(state->x, 3.0F);
+    EXPECT_FLOAT_EQ(state->y, 4.0F);
+}
+
+TEST(InterpolationBufferTest, ExtrapolationIsBounded) {
+    InterpolationBuffer buffer;
+    buffer.push({0, 0, 0, 60, 0});
+
+    auto ahead = buffer.sample(3.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(ahead.has_value());
+    EXPECT_TRUE(ahead->extrapolated);
+    EXPECT_NEAR(ahead->x, 3.0, 1e-4);
+    EXPECT_FLOAT_EQ(ahead->vx, 60.0F);
+
+    // Past the limit the entity holds where extrapolation stopped
+    auto held = buffer.sample(30.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(held.has_value());
+    EXPECT_TRUE(held->extrapolated);
+    EXPECT_NEAR(held->x, 6.0, 1e-4);
+    EXPECT_FLOAT_EQ(held->vx, 0.0F);
+}
+
+TEST(InterpolationBufferTest, RingDropsOldestWhenFull) {
+    InterpolationBuffer buffer;
+    const auto capacity =
+        static_cast<std::uint32_t>(InterpolationBuffer::kCapacity);
+    for (std::uint32_t tick = 1; tick <= capacity + 4; ++tick) {
+        EXPECT_TRUE(buffer.push({tick, static_cast<float>(tick), 0, 0, 0}));
+    }
+    EXPECT_EQ(buffer.size(), InterpolationBuffer::kCapacity);
+    EXPECT_EQ(buffer.newest().tick, capacity + 4);
+
+    // Oldest kept sample is tick 5
+    auto state = buffer.sample(0.0, kSecondsPerTick, 6.0);
+    ASSERT_TRUE(state.has_value());
+    EXPECT_FLOAT_EQ(state->x, 5.0F);
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(InterpolationClockTest, NoRenderTickBeforeFirstSample) {
+    InterpolationClock clock;
+    EXPECT_FALSE(clock.renderTick(1.0).has_value());
+    clock.onSample(100, 1.0, 0);
+    ASSERT_TRUE(clock.renderTick(1.0).has_value());
+    clock.reset();
+    EXPECT_FALSE(clock.renderTick(1.0).has_value());
+}
+
+TEST(InterpolationClockTest, RendersBehindNewestTick) {
+    InterpolationClock clock;
+    for (std::uint32_t i = 0; i < 60; ++i) {
+        clock.onSample(1000 + i, i / 60.0, i == 0 ? 0 : 1);
+    }
+    const double delay = clock.delayTicks();
+    EXPECT_DOUBLE_EQ(delay, clock.config().minDelayTicks);
+
+    auto tick = clock.renderTick(59.0 / 60.0);
+    ASSERT_TRUE(tick.has_value());
+    EXPECT_NEAR(*tick, 1059.0 - delay, 0.05);
+}
+
+TEST(InterpolationClockTest, DelayGrowsWithJitter) {
+    InterpolationClock steady;
+    InterpolationClock jittery;
+    for (std::uint32_t i = 0; i < 120; ++i) {
+        const double t = i / 60.0;
+        steady.onSample(i, t, 1);
+        // Every other packet arrives 5 ticks late
+        jittery.onSample(i, t + (i % 2 == 1 ? 5.0 / 60.0 : 0.0), 1);
+    }
+    EXPECT_GT(jittery.jitterTicks(), steady.jitterTicks());
+    EXPECT_GT(jittery.delayTicks(), steady.delayTicks());
+    EXPECT_LE(jittery.delayTicks(), jittery.config().maxDelayTicks);
+}
+
+TEST(InterpolationClockTest, DelayCoversSendInterval) {
+    InterpolationClock clock;
+    // An entity updated every 6 ticks (low bandwidth mode)
+    for (std::uint32_t i = 0; i < 100; ++i) {
+        clock.onSample(i * 6, i * 0.1, 6);
+    }
+    EXPECT_GT(clock.delayTicks(), 5.0);
+}
+
+TEST(InterpolationClockTest, DelayIsClamped) {
+    InterpolationClock::Config config;
+    config.minDelayTicks = 3.0;
+    config.maxDelayTicks = 8.0;
+    InterpolationClock clock(config);
+
+    clock.onSample(0, 0.0, 0);
+    EXPECT_DOUBLE_EQ(clock.delayTicks(), 3.0);
+
+    for (std::uint32_t i = 1; i < 100; ++i) {
+        // Sparse and late every other time
+        clock.onSample(i * 30, i * 0.5 + (i % 2 == 1 ? 0.2 : 0.0), 30);
+    }
+    EXPECT_DOUBLE_EQ(clock.delayTicks(), 8.0);
+}
+
+TEST(InterpolationClockTest, ResyncsAfterLargeJump) {
+    InterpolationClock clock;
+    clock.onSample(50000, 0.0, 0);
+    // Server restarted: ticks start over
+    clock.onSample(10, 1.0, 0);
+    auto tick = clock.renderTick(1.0);
+    ASSERT_TRUE(tick.has_value());
+    EXPECT_NEAR(*tick, 10.0 - clock.delayTicks(), 0.5);
+}
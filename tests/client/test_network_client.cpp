@@ -9,6 +9,7 @@
 
 #include <chrono>
 #include <cstring>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -792,16 +793,23 @@ TEST_F(NetworkClientTest, HandleUpdatePos_ValidPayload) {
     bool callbackCalled = false;
     float receivedX = 0.0f;
     float receivedY = 0.0f;
-
-    client.onPositionCorrection([&](float x, float y) {
-        callbackCalled = true;
-        receivedX = x;
-        receivedY = y;
-    });
+    std::uint16_t receivedAck = 0;
+    float receivedSpeed = 0.0f;
+
+    client.onPositionCorrection(
+        [&](float x, float y, std::uint16_t ackInputSeq, float moveSpeed) {
+            callbackCalled = true;
+            receivedX = x;
+            receivedY = y;
+            receivedAck = ackInputSeq;
+            receivedSpeed = moveSpeed;
+        });
 
     UpdatePosPayload posPayload{};
     posPayload.posX = 123.45f;
     posPayload.posY = 678.90f;
+    posPayload.ackInputSeq = 4242;
+    posPayload.moveSpeed = 260.0f;
 
     auto serialized = Serializer::serializeForNetwork(posPayload);
 
@@ -817,6 +825,8 @@ TEST_F(NetworkClientTest, HandleUpdatePos_ValidPayload) {
     EXPECT_TRUE(callbackCalled);
     EXPECT_FLOAT_EQ(receivedX, 123.45f);
     EXPECT_FLOAT_EQ(receivedY, 678.90f);
+    EXPECT_EQ(receivedAck, 4242);
+    EXPECT_FLOAT_EQ(receivedSpeed, 260.0f);
 }
 
 // =============================================================================
@@ -949,6 +959,78 @@ TEST_F(NetworkClientTest, QueueCallback_MultipleCallbacks) {
     EXPECT_EQ(counter, 3);
 }
 
+TEST_F(NetworkClientTest, Dispatch_DeliversEventsInArrivalOrder) {
+    NetworkClient client;
+    std::vector<std::string> order;
+
+    client.onEntityDestroy(
+        [&](std::uint32_t entityId) {
+            order.push_back("destroy " + std::to_string(entityId));
+        });
+    client.onPositionCorrection([&](float, float, std::uint16_t ack, float) {
+        order.push_back("correction " + std::to_string(ack));
+    });
+    client.test_queueCallback([&]() { order.push_back("call"); });
+
+    EntityDestroyPayload destroyPayload{};
+    destroyPayload.entityId = 7;
+    auto destroy = Serializer::serializeForNetwork(destroyPayload);
+    UpdatePosPayload posPayload{};
+    posPayload.ackInputSeq = 3;
+    auto correction = Serializer::serializeForNetwork(posPayload);
+
+    const Endpoint server{"127.0.0.1", 4242};
+    client.test_processIncomingPacket(
+        createPacket(createHeader(OpCode::S_UPDATE_POS,
+                                  static_cast<std::uint16_t>(correction.size())),
+                     correction),
+        server);
+    client.test_processIncomingPacket(
+        createPacket(createHeader(OpCode::S_ENTITY_DESTROY,
+                                  static_cast<std::uint16_t>(destroy.size())),
+                     destroy),
+        server);
+    EXPECT_TRUE(order.empty());
+
+    client.test_dispatchCallbacks();
+    EXPECT_EQ(order, (std::vector<std::string>{"call", "correction 3",
+                                                "destroy 7"}));
+}
+
+TEST_F(NetworkClientTest, Dispatch_EventsQueuedDuringDispatchWaitForNextOne) {
+    NetworkClient client;
+    int delivered = 0;
+
+    client.test_queueCallback([&]() {
+        ++delivered;
+        client.test_queueCallback([&]() { ++delivered; });
+    });
+
+    client.test_dispatchCallbacks();
+    EXPECT_EQ(delivered, 1);
+    client.test_dispatchCallbacks();
+    EXPECT_EQ(delivered, 2);
+}
+
+TEST_F(NetworkClientTest, ClearPendingCallbacks_DropsQueuedEvents) {
+    NetworkClient client;
+    bool called = false;
+    client.onGameStart([&](float) { called = true; });
+
+    GameStartPayload startPayload{};
+    startPayload.countdownDuration = 3.0f;
+    auto serialized = Serializer::serializeForNetwork(startPayload);
+    client.test_processIncomingPacket(
+        createPacket(createHeader(OpCode::S_GAME_START,
+                                  static_cast<std::uint16_t>(serialized.size())),
+                     serialized),
+        Endpoint{"127.0.0.1", 4242});
+
+    client.clearPendingCallbacks();
+    client.test_dispatchCallbacks();
+    EXPECT_FALSE(called);
+}
+
 // =============================================================================
 // startReceive Tests
 // =============================================================================
@@ -959,6 +1041,19 @@ TEST_F(NetworkClientTest, StartReceive_DoesNotCrash) {
     client.test_startReceive();
 }
 
+TEST_F(NetworkClientTest, ReconnectWhileNetworkThreadRuns) {
+    NetworkClient client;
+
+    // Each cycle swaps the socket while the network thread is blocked in
+    // run() with a receive pending on the old one
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(client.connect("127.0.0.1", 4242));
+        client.disconnect();
+        EXPECT_FALSE(client.isConnected());
+    }
+    ASSERT_TRUE(client.connect("127.0.0.1", 4242));
+}
+
 // =============================================================================
 // handlePong Tests
 // =============================================================================
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include "../../src/games/rtype/client/GameScene/RtypeEntityFactory.hpp"
 #include "../../src/games/rtype/client/GraphicsConstants.hpp"
+#include "../../src/games/rtype/client/Components/RotationComponent.hpp"
+#include "../../src/games/rtype/client/Systems/ClientDestroySystem.hpp"
+#include "../../src/games/rtype/shared/Components/Tags.hpp"
 #include "../../src/games/rtype/shared/Config/GameConfig/RTypeGameConfig.hpp"
 
 namespace rtype::games::rtype::client {
@@ -59,4 +63,69 @@ TEST(RtypeEntityFactoryTest, GetPlayerSpriteOffset_InvalidPlayerIdHigh) {
     auto offset = rtype::games::rtype::client::getPlayerSpriteOffset(5);
     EXPECT_EQ(offset.first, 0);
     EXPECT_EQ(offset.second, 0);  // defaults to row 0
-}
\ No newline at end of file
+}
+namespace {
+using rtype::games::rtype::client::RtypeEntityFactory;
+using rtype::network::EntityType;
+}  // namespace
+
+TEST(RtypeEntityFactoryTest, DespawnedMissileIsReusedForSameSubType) {
+    ECS::Registry registry;
+    auto first = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Missile, 0);
+    registry.emplaceComponent<rtype::games::rtype::shared::DestroyTag>(first);
+    registry.emplaceComponent<rtype::games::rtype::client::Rotation>(first,
+                                                                      180.0f);
+
+    ECS::EntityPool::despawn(registry, first);
+    EXPECT_TRUE(registry.hasComponent<ECS::Inactive>(first));
+
+    auto second = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Missile, 0);
+    EXPECT_EQ(second, first);
+    EXPECT_FALSE(registry.hasComponent<ECS::Inactive>(second));
+    EXPECT_FALSE(
+        registry.hasComponent<rtype::games::rtype::shared::DestroyTag>(second));
+    EXPECT_FALSE(
+        registry.hasComponent<rtype::games::rtype::client::Rotation>(second));
+}
+
+TEST(RtypeEntityFactoryTest, MissilePoolsAreKeyedBySubType) {
+    ECS::Registry registry;
+    auto basic = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Missile, 0);
+    ECS::EntityPool::despawn(registry, basic);
+
+    auto charged = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Missile, 0x41);
+    EXPECT_NE(charged, basic);
+    EXPECT_TRUE(registry.hasComponent<ECS::Inactive>(basic));
+}
+
+TEST(RtypeEntityFactoryTest, UnpooledTypesAreKilledOnDespawn) {
+    ECS::Registry registry;
+    auto enemy = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Bydos, 0);
+    EXPECT_FALSE(registry.hasComponent<ECS::Pooled>(enemy));
+
+    ECS::EntityPool::despawn(registry, enemy);
+    EXPECT_FALSE(registry.isAlive(enemy));
+}
+
+TEST(RtypeEntityFactoryTest, ClientDestroySystemParksPooledMissiles) {
+    ECS::Registry registry;
+    rtype::games::rtype::client::ClientDestroySystem destroySystem;
+    auto missile = RtypeEntityFactory::acquireNetworkEntity(
+        registry, EntityType::Missile, 0);
+    auto effect = registry.spawnEntity();
+    registry.emplaceComponent<rtype::games::rtype::shared::DestroyTag>(missile);
+    registry.emplaceComponent<rtype::games::rtype::shared::DestroyTag>(effect);
+
+    destroySystem.update(registry, 0.016f);
+
+    EXPECT_TRUE(registry.isAlive(missile));
+    EXPECT_TRUE(registry.hasComponent<ECS::Inactive>(missile));
+    EXPECT_FALSE(
+        registry.hasComponent<rtype::games::rtype::shared::DestroyTag>(missile));
+    EXPECT_FALSE(registry.isAlive(effect));
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** JobPool tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "common/src/JobPool/JobPool.hpp"
+
+using rtype::JobPool;
+
+TEST(JobPoolTest, ChunkCountRoundsUp) {
+    EXPECT_EQ(JobPool::chunkCount(0, 64), 0U);
+    EXPECT_EQ(JobPool::chunkCount(64, 64), 1U);
+    EXPECT_EQ(JobPool::chunkCount(65, 64), 2U);
+    EXPECT_EQ(JobPool::chunkCount(10, 0), 0U);
+}
+
+TEST(JobPoolTest, EveryIndexRunsExactlyOnce) {
+    JobPool pool(3);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), 37,
+                     [&hits](std::size_t, std::size_t begin, std::size_t end) {
+                         for (std::size_t i = begin; i < end; ++i) {
+                             hits[i].fetch_add(1);
+                         }
+                     });
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+TEST(JobPoolTest, ChunkBoundsDoNotDependOnWorkers) {
+    for (std::size_t workers : {0U, 1U, 4U}) {
+        JobPool pool(workers);
+        std::vector<std::size_t> begins(JobPool::chunkCount(100, 16));
+        std::vector<std::size_t> ends(begins.size());
+        pool.parallelFor(100, 16,
+                         [&](std::size_t chunk, std::size_t begin,
+                             std::size_t end) {
+                             begins[chunk] = begin;
+                             ends[chunk] = end;
+                         });
+        for (std::size_t c = 0; c < begins.size(); ++c) {
+            EXPECT_EQ(begins[c], c * 16);
+        }
+        EXPECT_EQ(ends.back(), 100U);
+    }
+}
+
+TEST(JobPoolTest, ReusableAcrossManyCalls) {
+    JobPool pool(2);
+    std::vector<long> partial(JobPool::chunkCount(500, 50));
+    for (int round = 0; round < 200; ++round) {
+        pool.parallelFor(500, 50,
+                         [&](std::size_t chunk, std::size_t begin,
+                             std::size_t end) {
+                             long sum = 0;
+                             for (std::size_t i = begin; i < end; ++i) {
+                                 sum += static_cast<long>(i);
+                             }
+                             partial[chunk] = sum;
+                         });
+        ASSERT_EQ(std::accumulate(partial.begin(), partial.end(), 0L),
+                  500L * 499L / 2);
+    }
+}
+
+TEST(JobPoolTest, RethrowsJobException) {
+    JobPool pool(2);
+    EXPECT_THROW(pool.parallelFor(100, 10,
+                                  [](std::size_t chunk, std::size_t,
+                                     std::size_t) {
+                                      if (chunk == 3) {
+                                          throw std::runtime_error("boom");
+                                      }
+                                  }),
+                 std::runtime_error);
+
+    std::atomic<int> runs{0};
+    pool.parallelFor(100, 10, [&runs](std::size_t, std::size_t,
+                                      std::size_t) { runs.fetch_add(1); });
+    EXPECT_EQ(runs.load(), 10);
+}
@@ -0,0 +1,172 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** Lock-free SPSC/MPSC queue tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/src/LockFreeQueue/MpscQueue.hpp"
+#include "common/src/LockFreeQueue/SpscQueue.hpp"
+
+using rtype::MpscQueue;
+using rtype::SpscQueue;
+
+TEST(SpscQueueTest, CapacityRoundsUpToPowerOfTwo) {
+    SpscQueue<int> queue(100);
+    EXPECT_EQ(queue.capacity(), 128u);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, PushPopInOrderAcrossWrap) {
+    SpscQueue<int> queue(4);
+    for (int round = 0; round < 10; ++round) {
+        EXPECT_TRUE(queue.tryPush(round * 2));
+        EXPECT_TRUE(queue.tryPush(round * 2 + 1));
+        EXPECT_EQ(queue.size(), 2u);
+        EXPECT_EQ(queue.tryPop(), round * 2);
+        EXPECT_EQ(queue.tryPop(), round * 2 + 1);
+    }
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(SpscQueueTest, FullQueueRejectsPush) {
+    SpscQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(99));
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_TRUE(queue.tryPush(4));
+}
+
+TEST(SpscQueueTest, PopAllDrainsInBatches) {
+    SpscQueue<std::string> queue(16);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(queue.tryEmplace(std::to_string(i)));
+    }
+    std::array<std::string, 4> batch;
+    EXPECT_EQ(queue.popAll(batch), 4u);
+    EXPECT_EQ(batch[0], "0");
+    EXPECT_EQ(batch[3], "3");
+    EXPECT_EQ(queue.popAll(batch), 4u);
+    EXPECT_EQ(queue.popAll(batch), 2u);
+    EXPECT_EQ(batch[1], "9");
+    EXPECT_EQ(queue.popAll(batch), 0u);
+}
+
+TEST(SpscQueueTest, DestructorReleasesRemainingElements) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        SpscQueue<std::shared_ptr<int>> queue(8);
+        EXPECT_TRUE(queue.tryPush(tracker));
+        EXPECT_TRUE(queue.tryPush(tracker));
+        EXPECT_EQ(tracker.use_count(), 3);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SpscQueueTest, ConcurrentProducerConsumerKeepsOrder) {
+    constexpr int kItems = 200000;
+    SpscQueue<int> queue(1024);
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < kItems; ++i) {
+            while (!queue.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    std::array<int, 64> batch{};
+    while (expected < kItems) {
+        std::size_t n = queue.popAll(batch);
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(batch[i], expected);
+            ++expected;
+        }
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, PushPopAndFull) {
+    MpscQueue<int> queue(4);
+    EXPECT_EQ(queue.capacity(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(4));
+    EXPECT_EQ(queue.size(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(queue.tryPop(), i);
+    }
+    EXPECT_FALSE(queue.tryPop().has_value());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, PopAllWithFunctions) {
+    MpscQueue<std::function<void()>> queue(8);
+    int calls = 0;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.tryPush([&calls]() { ++calls; }));
+    }
+    std::array<std::function<void()>, 8> batch;
+    std::size_t n = queue.popAll(batch);
+    ASSERT_EQ(n, 5u);
+    for (std::size_t i = 0; i < n; ++i) {
+        batch[i]();
+    }
+    EXPECT_EQ(calls, 5);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, ConcurrentProducersKeepPerProducerOrder) {
+    constexpr int kProducers = 4;
+    constexpr int kItemsPerProducer = 50000;
+    MpscQueue<std::pair<int, int>> queue(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < kItemsPerProducer; ++i) {
+                while (!queue.tryEmplace(p, i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<int, kProducers> next{};
+    int received = 0;
+    std::array<std::pair<int, int>, 32> batch{};
+    while (received < kProducers * kItemsPerProducer) {
+        std::size_t n = queue.popAll(batch);
+        for (std::size_t i = 0; i < n; ++i) {
+            auto [producer, value] = batch[i];
+            ASSERT_EQ(value, next[static_cast<std::size_t>(producer)]);
+            ++next[static_cast<std::size_t>(producer)];
+        }
+        received += static_cast<int>(n);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** Sharded counter and HDR histogram tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "common/src/Metrics/HdrHistogram.hpp"
+#include "common/src/Metrics/ShardedCounter.hpp"
+
+using rtype::HdrHistogram;
+using rtype::ShardedCounter;
+
+TEST(ShardedCounterTest, SumsIncrementsFromManyThreads) {
+    ShardedCounter counter;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&counter]() {
+            for (int i = 0; i < 10000; ++i) {
+                counter.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.load(), 80000U);
+}
+
+TEST(ShardedCounterTest, StoreResetsEveryShard) {
+    ShardedCounter counter;
+    std::thread other([&counter]() { counter.fetch_add(5); });
+    other.join();
+    counter.fetch_add(3);
+
+    counter.store(7);
+    EXPECT_EQ(counter.load(), 7U);
+    EXPECT_EQ(static_cast<std::uint64_t>(counter), 7U);
+}
+
+TEST(HdrHistogramTest, BucketsAreContiguous) {
+    for (std::size_t i = 0; i + 1 < HdrHistogram::kBucketCount; ++i) {
+        ASSERT_EQ(HdrHistogram::bucketUpperBound(i),
+                  HdrHistogram::bucketLowerBound(i + 1));
+        ASSERT_EQ(HdrHistogram::bucketIndex(HdrHistogram::bucketLowerBound(i)),
+                  i);
+    }
+    constexpr auto kMax = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(HdrHistogram::bucketIndex(kMax), HdrHistogram::kBucketCount - 1);
+}
+
+TEST(HdrHistogramTest, RelativeErrorIsBounded) {
+    for (std::uint64_t value : {17ULL, 1000ULL, 123456ULL, 987654321ULL}) {
+        const auto index = HdrHistogram::bucketIndex(value);
+        const auto width = HdrHistogram::bucketUpperBound(index) -
+                           HdrHistogram::bucketLowerBound(index);
+        EXPECT_LE(width * 8, value) << value;
+    }
+}
+
+TEST(HdrHistogramTest, PercentilesTrackTheDistribution) {
+    HdrHistogram histogram;
+    for (std::uint64_t v = 1; v <= 1000; ++v) {
+        histogram.record(v * 1000);
+    }
+
+    EXPECT_EQ(histogram.count(), 1000U);
+    EXPECT_EQ(histogram.max(), 1'000'000U);
+    EXPECT_EQ(histogram.mean(), 500'500U);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.5)), 500'000.0,
+                500'000.0 * 0.125);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.99)), 990'000.0,
+                990'000.0 * 0.125);
+    EXPECT_EQ(histogram.percentile(1.0), 1'000'000U);
+}
+
+TEST(HdrHistogramTest, CountBelowPowerOfTwoIsExact) {
+    HdrHistogram histogram;
+    histogram.record(3);
+    histogram.record(1023);
+    histogram.record(1024);
+    histogram.record(5000, 2);
+
+    EXPECT_EQ(histogram.countBelow(4), 1U);
+    EXPECT_EQ(histogram.countBelow(1024), 2U);
+    EXPECT_EQ(histogram.countBelow(2048), 3U);
+    EXPECT_EQ(histogram.countBelow(8192), 5U);
+    EXPECT_EQ(histogram.sum(), 3U + 1023U + 1024U + 10000U);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.percentile(0.99), 0U);
+}
+
+TEST(HdrHistogramTest, CountAtOrBelowIncludesTheBound) {
+    HdrHistogram histogram;
+    histogram.record(4);
+    histogram.record(7);
+    histogram.record(8);
+    histogram.record(1024);
+
+    EXPECT_EQ(histogram.countBelow(4), 0U);
+    EXPECT_EQ(histogram.countAtOrBelow(4), 1U);
+    EXPECT_EQ(histogram.countBelow(8), 2U);
+    EXPECT_EQ(histogram.countAtOrBelow(8), 3U);
+    EXPECT_EQ(histogram.countAtOrBelow(1023), 3U);
+    EXPECT_EQ(histogram.countAtOrBelow(1024), 4U);
+}
@@ -0,0 +1,153 @@
+/*
+** EPITECH PROJECT, 2026
+** R-Type
+** File description:
+** EntityPool and Inactive filtering tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+
+#include "../../../lib/ecs/src/core/EntityPool.hpp"
+#include "../../../lib/ecs/src/core/Registry/Registry.hpp"
+
+using namespace ECS;
+
+namespace {
+struct Position {
+    float x = 0.0F;
+    float y = 0.0F;
+};
+struct Frozen {};
+
+EntityPool::PrefabFunc bulletPrefab() {
+    return [](Registry& r, Entity e) { r.emplaceComponent<Position>(e); };
+}
+
+int countPositions(Registry& registry) {
+    int count = 0;
+    registry.view<Position>().each(
+        [&count](Entity, const Position&) { ++count; });
+    return count;
+}
+}  // namespace
+
+class EntityPoolTest : public ::testing::Test {
+   protected:
+    Registry registry;
+    EntityPool pool{bulletPrefab()};
+};
+
+TEST_F(EntityPoolTest, PrewarmedEntitiesAreHiddenFromViews) {
+    pool.prewarm(registry, 8);
+
+    EXPECT_EQ(pool.available(), 8U);
+    EXPECT_EQ(pool.created(), 8U);
+    EXPECT_EQ(countPositions(registry), 0);
+    EXPECT_EQ(registry.countComponents<Position>(), 8U);
+
+    int parked = 0;
+    registry.view<Inactive, Position>().each(
+        [&parked](Entity, const Inactive&, const Position&) { ++parked; });
+    EXPECT_EQ(parked, 8);
+}
+
+TEST_F(EntityPoolTest, AcquireReusesParkedEntity) {
+    pool.prewarm(registry, 1);
+    Entity first = pool.acquire(registry);
+    registry.emplaceComponent<Position>(first, 10.0F, 20.0F);
+    EXPECT_EQ(countPositions(registry), 1);
+
+    pool.release(registry, first);
+    EXPECT_EQ(countPositions(registry), 0);
+    EXPECT_TRUE(registry.isAlive(first));
+
+    Entity second = pool.acquire(registry);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(pool.created(), 1U);
+    // Components survive parking; the caller overwrites them
+    EXPECT_FLOAT_EQ(registry.getComponent<Position>(second).x, 10.0F);
+}
+
+TEST_F(EntityPoolTest, AcquireCreatesWhenEmpty) {
+    Entity e = pool.acquire(registry);
+    EXPECT_TRUE(registry.hasComponent<Position>(e));
+    EXPECT_TRUE(registry.hasComponent<Pooled>(e));
+    EXPECT_FALSE(registry.hasComponent<Inactive>(e));
+    EXPECT_EQ(pool.created(), 1U);
+}
+
+TEST_F(EntityPoolTest, ReleaseTwiceParksOnce) {
+    Entity e = pool.acquire(registry);
+    pool.release(registry, e);
+    pool.release(registry, e);
+    EXPECT_EQ(pool.available(), 1U);
+}
+
+TEST_F(EntityPoolTest, AcquireSkipsEntitiesKilledWhileParked) {
+    pool.prewarm(registry, 2);
+    registry.clear();
+
+    Entity e = pool.acquire(registry);
+    EXPECT_TRUE(registry.isAlive(e));
+    EXPECT_EQ(pool.available(), 0U);
+    EXPECT_EQ(pool.created(), 3U);
+}
+
+TEST_F(EntityPoolTest, DespawnParksPooledAndKillsOthers) {
+    Entity pooled = pool.acquire(registry);
+    Entity plain = registry.spawnEntity();
+
+    EntityPool::despawn(registry, pooled);
+    EntityPool::despawn(registry, plain);
+
+    EXPECT_TRUE(registry.isAlive(pooled));
+    EXPECT_TRUE(registry.hasComponent<Inactive>(pooled));
+    EXPECT_EQ(pool.available(), 1U);
+    EXPECT_FALSE(registry.isAlive(plain));
+}
+
+TEST_F(EntityPoolTest, DespawnKillsOnceThePoolIsGone) {
+    Entity e;
+    {
+        EntityPool shortLived(bulletPrefab());
+        e = shortLived.acquire(registry);
+    }
+    EntityPool::despawn(registry, e);
+    EXPECT_FALSE(registry.isAlive(e));
+}
+
+TEST_F(EntityPoolTest, ClearKillsParkedEntities) {
+    pool.prewarm(registry, 3);
+    Entity active = pool.acquire(registry);
+    pool.clear(registry);
+
+    EXPECT_EQ(pool.available(), 0U);
+    EXPECT_EQ(registry.countComponents<Position>(), 1U);
+    EXPECT_TRUE(registry.isAlive(active));
+}
+
+TEST_F(EntityPoolTest, ExcludeViewGroupAndParallelViewSkipParked) {
+    pool.prewarm(registry, 4);
+    Entity active = pool.acquire(registry);
+    Entity frozen = pool.acquire(registry);
+    registry.emplaceComponent<Frozen>(frozen);
+
+    int excluded = 0;
+    registry.view<Position>().exclude<Frozen>().each(
+        [&](Entity e, const Position&) {
+            EXPECT_EQ(e, active);
+            ++excluded;
+        });
+    EXPECT_EQ(excluded, 1);
+
+    auto group = registry.createGroup<Position>();
+    EXPECT_EQ(group.size(), 2U);
+
+    std::atomic<int> parallel{0};
+    registry.parallelView<Position>().each(
+        [&parallel](Entity, Position&) { parallel.fetch_add(1); });
+    EXPECT_EQ(parallel.load(), 2);
+}
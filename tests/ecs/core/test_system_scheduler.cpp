@@ -101,3 +101,26 @@ TEST(SystemSchedulerTest, ClearRemovesSystemsAndOrder) {
     auto order = scheduler.getExecutionOrder();
     EXPECT_TRUE(order.empty());
 }
+
+TEST(SystemSchedulerTest, SystemTimerReportsEverySystemInOrder) {
+    Registry registry;
+    SystemScheduler scheduler(std::ref(registry));
+
+    scheduler.addSystem("A", [](Registry&) {});
+    scheduler.addSystem("B", [](Registry&) {}, {"A"});
+
+    std::vector<std::string> timed;
+    scheduler.setSystemTimer(
+        [&timed](const std::string& name, std::chrono::nanoseconds elapsed) {
+            EXPECT_GE(elapsed.count(), 0);
+            timed.push_back(name);
+        });
+    scheduler.run();
+    ASSERT_EQ(timed.size(), 2u);
+    EXPECT_EQ(timed[0], "A");
+    EXPECT_EQ(timed[1], "B");
+
+    scheduler.setSystemTimer({});
+    scheduler.run();
+    EXPECT_EQ(timed.size(), 2u);
+}
@@ -416,3 +416,52 @@ TEST_F(ProjectileSpawnerSystemTest, EnemyCustomOffsetApplied) {
         EXPECT_FLOAT_EQ(transform.y, 125.0F);  // 100 + 25
     });
 }
+
+// =============================================================================
+// Pooling Tests
+// =============================================================================
+
+TEST_F(ProjectileSpawnerSystemTest, PrewarmedProjectilesAreReused) {
+    auto system = createSystem();
+    ECS::Registry registry;
+    system.prewarm(registry, 4);
+
+    auto all = registry.view<shared::ProjectileTag>();
+    int visible = 0;
+    all.each([&visible](ECS::Entity /*e*/, shared::ProjectileTag&) {
+        visible++;
+    });
+    EXPECT_EQ(visible, 0);
+
+    system.spawnPlayerProjectile(registry, 1, 0.0F, 0.0F);
+    system.spawnPlayerProjectile(registry, 2, 0.0F, 0.0F);
+
+    EXPECT_EQ(registry.countComponents<shared::ProjectileTag>(), 4U);
+    EXPECT_EQ(registry.countComponents<ECS::Inactive>(), 2U);
+}
+
+TEST_F(ProjectileSpawnerSystemTest, RecycledProjectileDropsStaleOwnerTag) {
+    auto system = createSystem();
+    ECS::Registry registry;
+
+    system.spawnPlayerProjectile(registry, 1, 0.0F, 0.0F);
+    ECS::Entity shot;
+    auto playerShots = registry.view<shared::PlayerProjectileTag>();
+    playerShots.each([&shot](ECS::Entity e, shared::PlayerProjectileTag&) {
+        shot = e;
+    });
+    ECS::EntityPool::despawn(registry, shot);
+    ASSERT_TRUE(registry.hasComponent<ECS::Inactive>(shot));
+
+    auto enemy = registry.spawnEntity();
+    uint32_t networkId = system.spawnEnemyProjectile(
+        registry, enemy, 99, 500.0F, 300.0F, 100.0F, 300.0F);
+
+    EXPECT_FALSE(registry.hasComponent<ECS::Inactive>(shot));
+    EXPECT_FALSE(registry.hasComponent<shared::PlayerProjectileTag>(shot));
+    EXPECT_TRUE(registry.hasComponent<shared::EnemyProjectileTag>(shot));
+    EXPECT_EQ(registry.getComponent<shared::NetworkIdComponent>(shot).networkId,
+              networkId);
+    EXPECT_EQ(registry.getComponent<shared::ProjectileComponent>(shot).owner,
+              shared::ProjectileOwner::Enemy);
+}
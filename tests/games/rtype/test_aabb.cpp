@@ -267,3 +267,68 @@ TEST_F(AABBTest, SeparationIsSymmetric) {
     EXPECT_EQ(resultAB, resultBA);
     EXPECT_FALSE(resultAB);
 }
+
+// =============================================================================
+// Segment and Swept Tests
+// =============================================================================
+
+TEST(SegmentTest, CrossingSegmentHitsRect) {
+    const Rect rect(10.0F, 10.0F, 4.0F, 20.0F);
+    EXPECT_TRUE(segmentIntersects(rect, 0.0F, 15.0F, 50.0F, 15.0F));
+    EXPECT_TRUE(segmentIntersects(rect, 50.0F, 15.0F, 0.0F, 15.0F));
+    EXPECT_FALSE(segmentIntersects(rect, 0.0F, 40.0F, 50.0F, 40.0F));
+}
+
+TEST(SegmentTest, SegmentStoppingShortMisses) {
+    const Rect rect(10.0F, 10.0F, 4.0F, 20.0F);
+    EXPECT_FALSE(segmentIntersects(rect, 0.0F, 15.0F, 9.0F, 15.0F));
+    EXPECT_TRUE(segmentIntersects(rect, 0.0F, 15.0F, 10.0F, 15.0F));
+}
+
+TEST(SegmentTest, DiagonalAndDegenerateSegments) {
+    const Rect rect(0.0F, 0.0F, 10.0F, 10.0F);
+    EXPECT_TRUE(segmentIntersects(rect, -5.0F, -5.0F, 15.0F, 15.0F));
+    EXPECT_FALSE(segmentIntersects(rect, -5.0F, 8.0F, 8.0F, 21.0F));
+    EXPECT_TRUE(segmentIntersects(rect, 5.0F, 5.0F, 5.0F, 5.0F));
+    EXPECT_FALSE(segmentIntersects(rect, 5.0F, 11.0F, 5.0F, 11.0F));
+}
+
+TEST_F(AABBTest, SweptCatchesTunnelling) {
+    // 10x10 shot moving 200 px through a 10 px wide enemy in one tick
+    TransformComponent from{0.0F, 0.0F};
+    TransformComponent to{200.0F, 0.0F};
+    transformB.x = 100.0F;
+    transformB.y = 3.0F;
+
+    EXPECT_FALSE(overlaps(to, boxA, transformB, boxB));
+    EXPECT_TRUE(sweptOverlaps(from, to, boxA, transformB, transformB, boxB));
+}
+
+TEST_F(AABBTest, SweptMissesOffPath) {
+    TransformComponent from{0.0F, 0.0F};
+    TransformComponent to{200.0F, 0.0F};
+    transformB.x = 100.0F;
+    transformB.y = 30.0F;
+
+    EXPECT_FALSE(sweptOverlaps(from, to, boxA, transformB, transformB, boxB));
+}
+
+TEST_F(AABBTest, SweptUsesRelativeMotion) {
+    // Both move right at the same speed, 50 px apart: never touch
+    TransformComponent aFrom{0.0F, 0.0F};
+    TransformComponent aTo{200.0F, 0.0F};
+    TransformComponent bFrom{50.0F, 0.0F};
+    TransformComponent bTo{250.0F, 0.0F};
+    EXPECT_FALSE(sweptOverlaps(aFrom, aTo, boxA, bFrom, bTo, boxB));
+
+    // Head-on: they cross somewhere in the middle
+    bFrom.x = 200.0F;
+    bTo.x = 0.0F;
+    EXPECT_TRUE(sweptOverlaps(aFrom, aTo, boxA, bFrom, bTo, boxB));
+}
+
+TEST(RectTest, MergedCoversBoth) {
+    const Rect merged =
+        Rect(0.0F, 10.0F, 5.0F, 5.0F).merged(Rect(20.0F, 0.0F, 5.0F, 5.0F));
+    EXPECT_EQ(merged, Rect(0.0F, 0.0F, 25.0F, 15.0F));
+}
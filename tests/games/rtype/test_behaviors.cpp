@@ -8,6 +8,9 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 #include "../../../src/games/rtype/shared/Systems/AISystem/Behaviors/Behaviors.hpp"
 
@@ -664,3 +667,65 @@ TEST_F(DiveBombBehaviorTest, ApplyWhenAboveTargetYSetsNegativeYVelocity) {
     behavior.apply(ai, transform, velocity, 0.016F);
     EXPECT_LT(velocity.vy, 0.0F);
 }
+
+// =============================================================================
+// Batch Tests
+// =============================================================================
+
+namespace {
+
+/// Behavior that only implements apply(), like a game-specific add-on
+class CountingBehavior final : public IAIBehavior {
+   public:
+    void apply(AIComponent& ai, const TransformComponent& /*transform*/,
+               VelocityComponent& velocity, float deltaTime) override {
+        ai.stateTimer += deltaTime;
+        velocity.vx = static_cast<float>(++calls);
+    }
+
+    [[nodiscard]] AIBehavior getType() const noexcept override {
+        return AIBehavior::Patrol;
+    }
+
+    [[nodiscard]] const std::string getName() const noexcept override {
+        return "CountingBehavior";
+    }
+
+    int calls = 0;
+};
+
+}  // namespace
+
+TEST(AIBatchTest, DefaultApplyBatchCallsApplyInOrder) {
+    CountingBehavior behavior;
+    std::vector<AIComponent> ai(3);
+    std::vector<TransformComponent> transforms(3);
+    std::vector<VelocityComponent> velocities(3);
+
+    behavior.applyBatch({ai, transforms, velocities}, 0.5F);
+
+    EXPECT_EQ(behavior.calls, 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_FLOAT_EQ(ai[i].stateTimer, 0.5F);
+        EXPECT_FLOAT_EQ(velocities[i].vx, static_cast<float>(i + 1));
+    }
+}
+
+TEST(AIBatchTest, SubspanSelectsTheSameEntities) {
+    std::vector<AIComponent> ai(10);
+    std::vector<TransformComponent> transforms(10);
+    std::vector<VelocityComponent> velocities(10);
+    for (std::size_t i = 0; i < 10; ++i) {
+        ai[i].speed = static_cast<float>(i);
+    }
+
+    const AIBatch batch{ai, transforms, velocities};
+    MoveLeftBehavior().applyBatch(batch.subspan(4, 3), 0.016F);
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        const bool inside = i >= 4 && i < 7;
+        EXPECT_FLOAT_EQ(velocities[i].vx,
+                        inside ? -static_cast<float>(i) : 0.0F)
+            << i;
+    }
+}
@@ -4,7 +4,7 @@
 ** File description:
 ** test_boss_components - Unit tests for boss-related components
 ** Covers: BossComponent, WeakPointComponent, BossPatternComponent,
-**         WeaponComponent, DamageOnContactComponent
+**         WeaponComponent, DamageOnContactComponent, PositionTrailComponent
 */
 
 #include <gtest/gtest.h>
@@ -12,6 +12,7 @@
 #include "games/rtype/shared/Components/BossComponent.hpp"
 #include "games/rtype/shared/Components/BossPatternComponent.hpp"
 #include "games/rtype/shared/Components/DamageOnContactComponent.hpp"
+#include "games/rtype/shared/Components/PositionTrailComponent.hpp"
 #include "games/rtype/shared/Components/WeakPointComponent.hpp"
 #include "games/rtype/shared/Components/WeaponComponent.hpp"
 
@@ -291,6 +292,85 @@ TEST_F(BossComponentTest, GetSegmentPositionEmptyHistoryFallback) {
     EXPECT_FLOAT_EQ(pos.second, 300.0F);
 }
 
+TEST_F(BossComponentTest, SegmentsAreSpacedAlongPath) {
+    // 10 px steps: segment 1 sits SEGMENT_SPACING behind the head
+    for (int i = 0; i <= 40; ++i) {
+        boss.recordPosition(static_cast<float>(i * 10), 50.0F);
+    }
+    auto pos = boss.getSegmentPosition(1);
+    EXPECT_FLOAT_EQ(pos.first, 400.0F - BossComponent::SEGMENT_SPACING);
+    EXPECT_FLOAT_EQ(pos.second, 50.0F);
+}
+
+// =============================================================================
+// PositionTrailComponent Tests
+// =============================================================================
+
+TEST(PositionTrailComponentTest, OverwritesOldestWhenFull) {
+    PositionTrailComponent trail(3);
+    for (int i = 0; i < 5; ++i) {
+        trail.record(static_cast<float>(i), 0.0F);
+    }
+    ASSERT_EQ(trail.size(), 3U);
+    EXPECT_EQ(trail.capacity(), 3U);
+    EXPECT_FLOAT_EQ(trail.front().first, 4.0F);
+    EXPECT_FLOAT_EQ(trail[1].first, 3.0F);
+    EXPECT_FLOAT_EQ(trail.back().first, 2.0F);
+    EXPECT_FLOAT_EQ(trail.length(), 2.0F);
+}
+
+TEST(PositionTrailComponentTest, IgnoresPositionsCloserThanMinDistance) {
+    PositionTrailComponent trail;
+    EXPECT_TRUE(trail.record(0.0F, 0.0F, 5.0F));
+    EXPECT_FALSE(trail.record(3.0F, 0.0F, 5.0F));
+    EXPECT_TRUE(trail.record(0.0F, 6.0F, 5.0F));
+    EXPECT_EQ(trail.size(), 2U);
+}
+
+TEST(PositionTrailComponentTest, SampleBehindInterpolatesAlongPath) {
+    PositionTrailComponent trail;
+    trail.record(0.0F, 0.0F);
+    trail.record(10.0F, 0.0F);
+    trail.record(10.0F, 10.0F);
+
+    auto head = trail.sampleBehind(0.0F);
+    ASSERT_TRUE(head.has_value());
+    EXPECT_FLOAT_EQ(head->second, 10.0F);
+
+    auto corner = trail.sampleBehind(10.0F);
+    ASSERT_TRUE(corner.has_value());
+    EXPECT_FLOAT_EQ(corner->first, 10.0F);
+    EXPECT_FLOAT_EQ(corner->second, 0.0F);
+
+    auto mid = trail.sampleBehind(15.0F);
+    ASSERT_TRUE(mid.has_value());
+    EXPECT_FLOAT_EQ(mid->first, 5.0F);
+    EXPECT_FLOAT_EQ(mid->second, 0.0F);
+
+    EXPECT_FALSE(trail.sampleBehind(20.5F).has_value());
+}
+
+TEST(PositionTrailComponentTest, SampleBehindAfterWrapAround) {
+    PositionTrailComponent trail(4);
+    for (int i = 0; i < 10; ++i) {
+        trail.record(0.0F, static_cast<float>(i * 2));
+    }
+    auto pos = trail.sampleBehind(5.0F);
+    ASSERT_TRUE(pos.has_value());
+    EXPECT_FLOAT_EQ(pos->second, 13.0F);
+    EXPECT_FALSE(trail.sampleBehind(7.0F).has_value());
+}
+
+TEST(PositionTrailComponentTest, ClearEmptiesTrail) {
+    PositionTrailComponent trail;
+    trail.record(1.0F, 2.0F);
+    trail.clear();
+    EXPECT_TRUE(trail.empty());
+    EXPECT_FALSE(trail.sampleBehind(0.0F).has_value());
+    trail.record(3.0F, 4.0F);
+    EXPECT_FLOAT_EQ(trail.front().first, 3.0F);
+}
+
 // =============================================================================
 // BossType and BossAttackPattern String Conversion Tests
 // =============================================================================
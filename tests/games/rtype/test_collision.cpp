@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "ECS.hpp"
 #include "games/rtype/server/Systems/Collision/CollisionSystem.hpp"
 #include "games/rtype/shared/Components.hpp"
@@ -28,6 +31,74 @@ struct CollisionFixture : public ::testing::Test {
     server::CollisionSystem system;
 };
 
+/// Boss-fight-like crowd: volleys of player shots on a row of enemies
+void spawnCrowd(ECS::Registry& registry) {
+    for (int e = 0; e < 30; ++e) {
+        const float x = 100.0F + static_cast<float>(e % 10) * 150.0F;
+        const float y = 100.0F + static_cast<float>(e / 10) * 300.0F;
+        auto enemy = registry.spawnEntity();
+        registry.emplaceComponent<shared::TransformComponent>(enemy, x, y,
+                                                              0.0F);
+        registry.emplaceComponent<shared::BoundingBoxComponent>(enemy, 60.0F,
+                                                                60.0F);
+        registry.emplaceComponent<shared::EnemyTag>(enemy);
+        registry.emplaceComponent<shared::HealthComponent>(enemy, 150, 150);
+        registry.emplaceComponent<shared::NetworkIdComponent>(
+            enemy, static_cast<uint32_t>(e + 1));
+        for (int p = 0; p < 20; ++p) {
+            auto shot = registry.spawnEntity();
+            registry.emplaceComponent<shared::TransformComponent>(
+                shot, x - 20.0F + static_cast<float>(p * 2),
+                y - 20.0F + static_cast<float>((p * 7) % 40), 0.0F);
+            registry.emplaceComponent<shared::BoundingBoxComponent>(
+                shot, 12.0F, 6.0F);
+            registry.emplaceComponent<shared::ProjectileTag>(shot);
+            registry.emplaceComponent<shared::ProjectileComponent>(
+                shot, 5 + p % 7, 0U, shared::ProjectileOwner::Player,
+                shared::ProjectileType::BasicBullet);
+            if (p % 4 == 0) {
+                registry.getComponent<shared::ProjectileComponent>(shot)
+                    .piercing = true;
+            }
+        }
+    }
+}
+
+/// Health and destroy flag of every entity, in spawn order
+std::vector<int32_t> outcome(ECS::Registry& registry) {
+    std::vector<int32_t> result;
+    registry.view<shared::TransformComponent>().each(
+        [&](ECS::Entity entity, const shared::TransformComponent&) {
+            result.push_back(
+                registry.hasComponent<shared::HealthComponent>(entity)
+                    ? registry.getComponent<shared::HealthComponent>(entity)
+                          .current
+                    : -1);
+            result.push_back(
+                registry.hasComponent<shared::DestroyTag>(entity) ? 1 : 0);
+        });
+    return result;
+}
+
+std::vector<int32_t> runCrowd(shared::BroadphaseBackend backend,
+                              std::size_t workers) {
+    ECS::Registry registry;
+    spawnCrowd(registry);
+    std::vector<int32_t> events;
+    server::CollisionSystem system(
+        [&events](const rtype::engine::GameEvent& event) {
+            events.push_back(static_cast<int32_t>(event.entityNetworkId));
+            events.push_back(event.healthCurrent);
+        },
+        1920.0F, 1080.0F, backend, workers);
+    for (int frame = 0; frame < 3; ++frame) {
+        system.update(registry, 1.0F / 60.0F);
+    }
+    auto result = outcome(registry);
+    result.insert(result.end(), events.begin(), events.end());
+    return result;
+}
+
 }  // namespace
 
 TEST_F(CollisionFixture, OverlapMarksDestroyOnEnemyAndProjectile) {
@@ -384,3 +455,117 @@ TEST_F(CollisionFixture, EnemyWithHealthTakesDamage) {
     EXPECT_TRUE(registry->hasComponent<shared::DestroyTag>(projectile));
 }
 
+
+TEST_F(CollisionFixture, LayeredEntitiesDispatchWithoutTags) {
+    auto projectile = registry->spawnEntity();
+    registry->emplaceComponent<shared::TransformComponent>(projectile, 100.0F,
+                                                            100.0F, 0.0F);
+    registry->emplaceComponent<shared::BoundingBoxComponent>(projectile, 10.0F,
+                                                              10.0F);
+    registry->emplaceComponent<shared::ProjectileComponent>(
+        projectile, 10, 0U, shared::ProjectileOwner::Player,
+        shared::ProjectileType::BasicBullet);
+    registry->emplaceComponent<shared::CollisionLayerComponent>(
+        projectile, shared::CollisionLayerComponent::of(
+                        shared::CollisionLayer::PlayerProjectile));
+
+    auto enemy = registry->spawnEntity();
+    registry->emplaceComponent<shared::TransformComponent>(enemy, 105.0F, 100.0F,
+                                                           0.0F);
+    registry->emplaceComponent<shared::BoundingBoxComponent>(enemy, 10.0F,
+                                                              10.0F);
+    registry->emplaceComponent<shared::CollisionLayerComponent>(
+        enemy,
+        shared::CollisionLayerComponent::of(shared::CollisionLayer::Enemy));
+
+    system.update(*registry, 0.0F);
+
+    EXPECT_TRUE(registry->hasComponent<shared::DestroyTag>(projectile));
+    EXPECT_TRUE(registry->hasComponent<shared::DestroyTag>(enemy));
+}
+
+TEST_F(CollisionFixture, MaskedOutPairIsIgnored) {
+    auto enemy = registry->spawnEntity();
+    registry->emplaceComponent<shared::TransformComponent>(enemy, 100.0F,
+                                                           100.0F, 0.0F);
+    registry->emplaceComponent<shared::BoundingBoxComponent>(enemy, 10.0F,
+                                                              10.0F);
+    registry->emplaceComponent<shared::EnemyTag>(enemy);
+    registry->emplaceComponent<shared::DamageOnContactComponent>(enemy);
+    // As if loaded with collides_with = ["player_projectile"]
+    registry->emplaceComponent<shared::CollisionLayerComponent>(
+        enemy, shared::CollisionLayerComponent::of(
+                   shared::CollisionLayer::Enemy,
+                   shared::CollisionLayer::PlayerProjectile));
+
+    auto player = registry->spawnEntity();
+    registry->emplaceComponent<shared::TransformComponent>(player, 105.0F,
+                                                           100.0F, 0.0F);
+    registry->emplaceComponent<shared::BoundingBoxComponent>(player, 10.0F,
+                                                              10.0F);
+    registry->emplaceComponent<shared::PlayerTag>(player);
+    registry->emplaceComponent<shared::HealthComponent>(player, 100, 100);
+    registry->emplaceComponent<shared::CollisionLayerComponent>(
+        player,
+        shared::CollisionLayerComponent::of(shared::CollisionLayer::Player));
+
+    system.update(*registry, 0.0F);
+
+    EXPECT_EQ(registry->getComponent<shared::HealthComponent>(player).current,
+              100);
+    EXPECT_FALSE(registry->hasComponent<shared::DestroyTag>(enemy));
+}
+
+TEST(CollisionNarrowphaseTest, ParallelMatchesSerial) {
+    const auto serial = runCrowd(shared::BroadphaseBackend::LooseQuadTree, 0);
+    for (std::size_t workers : {1U, 3U, 7U}) {
+        EXPECT_EQ(runCrowd(shared::BroadphaseBackend::LooseQuadTree, workers),
+                  serial)
+            << workers << " workers";
+    }
+}
+
+TEST(CollisionNarrowphaseTest, OutcomeIndependentOfBroadphase) {
+    EXPECT_EQ(runCrowd(shared::BroadphaseBackend::SweepAndPrune, 3),
+              runCrowd(shared::BroadphaseBackend::LooseQuadTree, 0));
+}
+
+TEST_F(CollisionFixture, SweptProjectileDoesNotTunnel) {
+    // Thin weak point the shot jumps over in a single tick
+    auto target = registry->spawnEntity();
+    registry->emplaceComponent<shared::TransformComponent>(target, 300.0F,
+                                                           200.0F, 0.0F);
+    registry->emplaceComponent<shared::BoundingBoxComponent>(target, 4.0F,
+                                                              40.0F);
+    registry->emplaceComponent<shared::EnemyTag>(target);
+    registry->emplaceComponent<shared::HealthComponent>(target, 100, 100);
+
+    auto makeShot = [this](bool swept) {
+        auto shot = registry->spawnEntity();
+        registry->emplaceComponent<shared::TransformComponent>(shot, 200.0F,
+                                                                200.0F, 0.0F);
+        registry->emplaceComponent<shared::BoundingBoxComponent>(shot, 8.0F,
+                                                                  8.0F);
+        registry->emplaceComponent<shared::ProjectileTag>(shot);
+        registry->emplaceComponent<shared::ProjectileComponent>(
+            shot, 10, 0U, shared::ProjectileOwner::Player,
+            shared::ProjectileType::BasicBullet);
+        if (swept) {
+            registry->emplaceComponent<shared::SweptColliderComponent>(shot);
+        }
+        return shot;
+    };
+    auto plain = makeShot(false);
+    auto fast = makeShot(true);
+
+    system.update(*registry, 0.0F);  // Records where the fast shot starts
+    for (auto shot : {plain, fast}) {
+        registry->getComponent<shared::TransformComponent>(shot).x = 400.0F;
+    }
+    system.update(*registry, 0.0F);
+
+    EXPECT_FALSE(registry->hasComponent<shared::DestroyTag>(plain));
+    EXPECT_TRUE(registry->hasComponent<shared::DestroyTag>(fast));
+    EXPECT_EQ(registry->getComponent<shared::HealthComponent>(target).current,
+              90);
+}
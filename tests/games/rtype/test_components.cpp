@@ -689,3 +689,44 @@ TEST(ProjectileTagsTest, EnemyProjectileTagExists) {
     (void)tag;
     SUCCEED();
 }
+
+// =============================================================================
+// CollisionLayerComponent Tests
+// =============================================================================
+
+TEST(CollisionLayerComponentTest, DefaultCollidesWithEverything) {
+    CollisionLayerComponent unlabelled;
+    const auto laser = CollisionLayerComponent::of(CollisionLayer::LaserBeam);
+    EXPECT_TRUE(unlabelled.canCollideWith(laser));
+    EXPECT_TRUE(laser.canCollideWith(unlabelled));
+}
+
+TEST(CollisionLayerComponentTest, DefaultMasksAreSymmetric) {
+    for (uint16_t a = 1; a <= CollisionLayer::LaserBeam; a <<= 1) {
+        for (uint16_t b = 1; b <= CollisionLayer::LaserBeam; b <<= 1) {
+            const auto layerA = CollisionLayerComponent::of(a);
+            const auto layerB = CollisionLayerComponent::of(b);
+            EXPECT_EQ(layerA.canCollideWith(layerB),
+                      layerB.canCollideWith(layerA))
+                << a << " vs " << b;
+        }
+    }
+}
+
+TEST(CollisionLayerComponentTest, RejectsPairsThatNeverInteract) {
+    const auto enemy = CollisionLayerComponent::of(CollisionLayer::Enemy);
+    const auto pickup = CollisionLayerComponent::of(CollisionLayer::Pickup);
+    const auto shot =
+        CollisionLayerComponent::of(CollisionLayer::PlayerProjectile);
+    EXPECT_FALSE(enemy.canCollideWith(enemy));
+    EXPECT_FALSE(pickup.canCollideWith(shot));
+    EXPECT_TRUE(enemy.canCollideWith(shot));
+}
+
+TEST(CollisionLayerComponentTest, ConfigMaskOverridesDefault) {
+    const auto enemy = CollisionLayerComponent::of(
+        CollisionLayer::Enemy, CollisionLayer::Player | CollisionLayer::Enemy);
+    EXPECT_TRUE(enemy.canCollideWith(enemy));
+    EXPECT_FALSE(enemy.canCollideWith(
+        CollisionLayerComponent::of(CollisionLayer::PlayerProjectile)));
+}
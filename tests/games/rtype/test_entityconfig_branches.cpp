@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <fstream>
 
+#include "../../../src/games/rtype/shared/Components/CollisionLayerComponent.hpp"
 #include "../../../src/games/rtype/shared/Config/EntityConfig/EntityConfig.hpp"
 
 using namespace rtype::games::rtype::shared;
@@ -69,6 +70,27 @@ TEST(EntityConfigBranches, LoadProjectilesPiercingAndDefaults) {
     EXPECT_EQ(p.maxHits, 3);
 }
 
+TEST(EntityConfigBranches, LoadProjectilesCollisionMask) {
+    EntityConfigRegistry& reg = EntityConfigRegistry::getInstance();
+    reg.clear();
+
+    const std::string toml = R"(projectile = [
+  { id = "masked", damage = 5, speed = 100.0, collides_with = ["enemy", "obstacle", "bogus"] },
+  { id = "plain", damage = 5, speed = 100.0 }
+])";
+
+    auto file = makeTempFile("projectiles_mask.toml", toml);
+    EXPECT_TRUE(reg.loadProjectiles(file.string()));
+
+    auto masked = reg.getProjectile("masked");
+    ASSERT_TRUE(masked.has_value());
+    EXPECT_EQ(masked->get().collisionMask,
+              CollisionLayer::Enemy | CollisionLayer::Obstacle);
+    auto plain = reg.getProjectile("plain");
+    ASSERT_TRUE(plain.has_value());
+    EXPECT_FALSE(plain->get().collisionMask.has_value());
+}
+
 TEST(EntityConfigBranches, LoadPowerUpsEffectAndColorFallback) {
     EntityConfigRegistry& reg = EntityConfigRegistry::getInstance();
     reg.clear();
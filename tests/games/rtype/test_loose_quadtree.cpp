@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** test_loose_quadtree - Unit tests for the persistent LooseQuadTree
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../../../src/games/rtype/shared/Systems/Collision/LooseQuadTree.hpp"
+
+using namespace rtype::games::rtype::shared::collision;
+
+namespace {
+
+using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+std::set<Pair> pairsOf(const LooseQuadTree<std::uint32_t>& tree) {
+    std::set<Pair> pairs;
+    tree.forEachPair([&pairs](std::uint32_t a, std::uint32_t b) {
+        EXPECT_TRUE(pairs.insert({std::min(a, b), std::max(a, b)}).second)
+            << "Pair reported twice";
+    });
+    return pairs;
+}
+
+std::set<Pair> bruteForcePairs(const std::vector<Rect>& rects) {
+    std::set<Pair> pairs;
+    for (std::uint32_t a = 0; a < rects.size(); ++a) {
+        for (std::uint32_t b = a + 1; b < rects.size(); ++b) {
+            if (rects[a].intersects(rects[b])) {
+                pairs.insert({a, b});
+            }
+        }
+    }
+    return pairs;
+}
+
+}  // namespace
+
+TEST(LooseQuadTreeTest, StartsWithRootOnly) {
+    LooseQuadTree<std::uint32_t> tree(Rect{0, 0, 1920, 1080});
+    EXPECT_EQ(tree.size(), 0U);
+    EXPECT_EQ(tree.getNodeCount(), 1U);
+}
+
+TEST(LooseQuadTreeTest, RejectsObjectsOutsideTheWorld) {
+    LooseQuadTree<std::uint32_t> tree(Rect{0, 0, 1920, 1080});
+    EXPECT_TRUE(tree.update(0, Rect{100, 100, 32, 32}, 0));
+    EXPECT_FALSE(tree.update(0, Rect{1910, 100, 32, 32}, 0));
+    EXPECT_FALSE(tree.contains(0));
+    EXPECT_EQ(tree.size(), 0U);
+}
+
+TEST(LooseQuadTreeTest, MoveUpdatesQueries) {
+    LooseQuadTree<std::uint32_t> tree(Rect{0, 0, 1920, 1080});
+    tree.update(7, Rect{100, 100, 32, 32}, 70);
+    tree.update(7, Rect{900, 600, 32, 32}, 70);
+
+    std::vector<QuadTreeObject<std::uint32_t>> found;
+    tree.query(Rect{80, 80, 64, 64}, found);
+    EXPECT_TRUE(found.empty());
+    tree.query(Rect{880, 580, 64, 64}, found);
+    ASSERT_EQ(found.size(), 1U);
+    EXPECT_EQ(found[0].data, 70U);
+    EXPECT_EQ(tree.size(), 1U);
+}
+
+TEST(LooseQuadTreeTest, SplitsWhenCrowdedAndMergesWhenEmptied) {
+    LooseQuadTree<std::uint32_t> tree(Rect{0, 0, 1920, 1080}, 4, 5);
+    for (std::uint32_t i = 0; i < 40; ++i) {
+        tree.update(i, Rect{static_cast<float>(i * 40), 100, 16, 16}, i);
+    }
+    EXPECT_GT(tree.getNodeCount(), 1U);
+
+    for (std::uint32_t i = 0; i < 40; ++i) {
+        tree.remove(i);
+    }
+    EXPECT_EQ(tree.size(), 0U);
+    EXPECT_EQ(tree.getNodeCount(), 1U);
+}
+
+TEST(LooseQuadTreeTest, RemoveIfDropsMatchingObjects) {
+    LooseQuadTree<std::uint32_t> tree(Rect{0, 0, 1920, 1080});
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        tree.update(i, Rect{static_cast<float>(i * 100), 100, 16, 16}, i);
+    }
+    tree.removeIf([](std::uint32_t key, std::uint32_t) { return key % 2; });
+    EXPECT_EQ(tree.size(), 5U);
+    EXPECT_TRUE(tree.contains(4));
+    EXPECT_FALSE(tree.contains(5));
+}
+
+TEST(LooseQuadTreeTest, PairsMatchBruteForceWhileObjectsMove) {
+    const Rect world{0, 0, 1920, 1080};
+    LooseQuadTree<std::uint32_t> tree(world, 6, 6);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> size(4.0F, 120.0F);
+    std::uniform_real_distribution<float> step(-40.0F, 40.0F);
+    std::uniform_real_distribution<float> unit(0.0F, 1.0F);
+
+    std::vector<Rect> rects(300);
+    for (auto& rect : rects) {
+        rect.w = size(rng);
+        rect.h = size(rng);
+        rect.x = unit(rng) * (world.w - rect.w);
+        rect.y = unit(rng) * (world.h - rect.h);
+    }
+
+    for (int frame = 0; frame < 20; ++frame) {
+        for (std::uint32_t i = 0; i < rects.size(); ++i) {
+            Rect& rect = rects[i];
+            rect.x = std::clamp(rect.x + step(rng), 0.0F, world.w - rect.w);
+            rect.y = std::clamp(rect.y + step(rng), 0.0F, world.h - rect.h);
+            ASSERT_TRUE(tree.update(i, rect, i));
+        }
+        ASSERT_EQ(tree.size(), rects.size());
+        EXPECT_EQ(pairsOf(tree), bruteForcePairs(rects)) << "frame " << frame;
+    }
+}
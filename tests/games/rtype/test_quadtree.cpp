@@ -509,3 +509,75 @@ TEST_F(QuadTreeSystemTest, RebuildEachFrame) {
     EXPECT_EQ(nearNew.size(), 1);
 }
 
+
+TEST_F(QuadTreeSystemTest, DestroyedAndStrippedEntitiesLeaveTree) {
+    auto killed = createCollidableEntity(100.0F, 100.0F);
+    auto stripped = createCollidableEntity(110.0F, 110.0F);
+    auto kept = createCollidableEntity(120.0F, 120.0F);
+
+    system->update(*registry, 0.016F);
+    EXPECT_EQ(system->getEntityCount(), 3);
+    EXPECT_EQ(system->queryCollisionPairs(*registry).size(), 3);
+
+    registry->killEntity(killed);
+    registry->removeComponent<BoundingBoxComponent>(stripped);
+    system->update(*registry, 0.016F);
+
+    EXPECT_EQ(system->getEntityCount(), 1);
+    EXPECT_TRUE(system->queryCollisionPairs(*registry).empty());
+    auto nearby = system->queryNearby(Rect{0, 0, 300, 300});
+    ASSERT_EQ(nearby.size(), 1);
+    EXPECT_EQ(nearby[0].id, kept.id);
+}
+
+TEST_F(QuadTreeSystemTest, SweepAndPruneBackendMatchesQuadTree) {
+    QuadTreeSystem sweep(Rect{0, 0, 1920, 1080}, 10, 5,
+                         BroadphaseBackend::SweepAndPrune);
+    EXPECT_EQ(sweep.getBackend(), BroadphaseBackend::SweepAndPrune);
+
+    auto killed = createCollidableEntity(100.0F, 100.0F);
+    createCollidableEntity(110.0F, 110.0F);
+    createCollidableEntity(120.0F, 120.0F);
+    createCollidableEntity(900.0F, 500.0F);
+    createCollidableEntity(1950.0F, 500.0F);  // Outside the world
+
+    system->update(*registry, 0.016F);
+    sweep.update(*registry, 0.016F);
+    EXPECT_EQ(sweep.getEntityCount(), system->getEntityCount());
+    EXPECT_EQ(sweep.getNodeCount(), 0);
+
+    std::vector<CollisionPair> pairs;
+    sweep.queryCollisionPairs(pairs);
+    EXPECT_EQ(pairs.size(), system->queryCollisionPairs(*registry).size());
+    EXPECT_EQ(pairs.size(), 3);
+
+    registry->killEntity(killed);
+    sweep.update(*registry, 0.016F);
+    sweep.queryCollisionPairs(pairs);
+    EXPECT_EQ(pairs.size(), 1);
+    EXPECT_EQ(sweep.queryNearby(Rect{850, 450, 100, 100}).size(), 1);
+}
+
+TEST_F(QuadTreeSystemTest, CollisionLayersFilterPairs) {
+    auto enemyA = createCollidableEntity(100.0F, 100.0F);
+    auto enemyB = createCollidableEntity(110.0F, 110.0F);
+    auto shot = createCollidableEntity(120.0F, 120.0F);
+    registry->emplaceComponent<CollisionLayerComponent>(
+        enemyA, CollisionLayerComponent::of(CollisionLayer::Enemy));
+    registry->emplaceComponent<CollisionLayerComponent>(
+        enemyB, CollisionLayerComponent::of(CollisionLayer::Enemy));
+    registry->emplaceComponent<CollisionLayerComponent>(
+        shot, CollisionLayerComponent::of(CollisionLayer::PlayerProjectile));
+    createCollidableEntity(105.0F, 105.0F);  // Unlabelled: meets everyone
+
+    system->update(*registry, 0.016F);
+    std::vector<CollisionPair> pairs;
+    system->queryCollisionPairs(pairs);
+
+    // 6 overlapping pairs, minus enemy-enemy
+    EXPECT_EQ(pairs.size(), 5);
+    for (const auto& pair : pairs) {
+        EXPECT_FALSE(pair.categoryA == CollisionLayer::Enemy &&
+                     pair.categoryB == CollisionLayer::Enemy);
+    }
+}
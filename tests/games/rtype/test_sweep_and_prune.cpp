@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** test_sweep_and_prune - Unit tests for the SweepAndPrune broadphase
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../../../src/games/rtype/shared/Systems/Collision/SweepAndPrune.hpp"
+
+using namespace rtype::games::rtype::shared::collision;
+
+namespace {
+
+using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+std::set<Pair> pairsOf(const SweepAndPrune<std::uint32_t>& sap) {
+    std::set<Pair> pairs;
+    sap.forEachPair([&pairs](std::uint32_t a, std::uint32_t b) {
+        EXPECT_TRUE(pairs.insert({std::min(a, b), std::max(a, b)}).second)
+            << "Pair reported twice";
+    });
+    return pairs;
+}
+
+std::set<Pair> bruteForcePairs(const std::vector<Rect>& rects,
+                               const std::vector<bool>& alive) {
+    std::set<Pair> pairs;
+    for (std::uint32_t a = 0; a < rects.size(); ++a) {
+        for (std::uint32_t b = a + 1; b < rects.size(); ++b) {
+            if (alive[a] && alive[b] && rects[a].intersects(rects[b])) {
+                pairs.insert({a, b});
+            }
+        }
+    }
+    return pairs;
+}
+
+}  // namespace
+
+TEST(SweepAndPruneTest, StartsEmpty) {
+    SweepAndPrune<std::uint32_t> sap;
+    EXPECT_EQ(sap.size(), 0U);
+    EXPECT_TRUE(pairsOf(sap).empty());
+}
+
+TEST(SweepAndPruneTest, TouchingEdgesArePaired) {
+    SweepAndPrune<std::uint32_t> sap;
+    sap.update(0, Rect{0, 0, 10, 10}, 0);
+    sap.update(1, Rect{10, 0, 10, 10}, 1);
+    sap.update(2, Rect{10, 50, 10, 10}, 2);
+    sap.sort();
+    EXPECT_EQ(pairsOf(sap), (std::set<Pair>{{0, 1}}));
+}
+
+TEST(SweepAndPruneTest, PairsAreFoundBeforeSort) {
+    SweepAndPrune<std::uint32_t> sap;
+    sap.update(3, Rect{300, 0, 20, 20}, 3);
+    sap.update(1, Rect{100, 0, 20, 20}, 1);
+    sap.update(2, Rect{310, 10, 20, 20}, 2);
+    EXPECT_EQ(pairsOf(sap), (std::set<Pair>{{2, 3}}));
+    sap.sort();
+    EXPECT_EQ(pairsOf(sap), (std::set<Pair>{{2, 3}}));
+}
+
+TEST(SweepAndPruneTest, RemoveAndQuery) {
+    SweepAndPrune<std::uint32_t> sap;
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        sap.update(i, Rect{static_cast<float>(i * 100), 100, 16, 16}, i);
+    }
+    sap.removeIf([](std::uint32_t key, std::uint32_t) { return key % 2; });
+    EXPECT_TRUE(sap.remove(4));
+    EXPECT_FALSE(sap.remove(4));
+    sap.sort();
+    EXPECT_EQ(sap.size(), 4U);
+    EXPECT_FALSE(sap.contains(5));
+
+    std::vector<QuadTreeObject<std::uint32_t>> found;
+    sap.query(Rect{150, 0, 500, 200}, found);
+    ASSERT_EQ(found.size(), 2U);
+    EXPECT_EQ(found[0].data, 2U);
+    EXPECT_EQ(found[1].data, 6U);
+}
+
+TEST(SweepAndPruneTest, PairsMatchBruteForceWhileObjectsMove) {
+    const Rect world{0, 0, 1920, 1080};
+    SweepAndPrune<std::uint32_t> sap;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> size(4.0F, 120.0F);
+    std::uniform_real_distribution<float> step(-40.0F, 40.0F);
+    std::uniform_real_distribution<float> unit(0.0F, 1.0F);
+
+    std::vector<Rect> rects(300);
+    std::vector<bool> alive(rects.size(), true);
+    for (auto& rect : rects) {
+        rect.w = size(rng);
+        rect.h = size(rng);
+        rect.x = unit(rng) * (world.w - rect.w);
+        rect.y = unit(rng) * (world.h - rect.h);
+    }
+
+    for (int frame = 0; frame < 20; ++frame) {
+        for (std::uint32_t i = 0; i < rects.size(); ++i) {
+            Rect& rect = rects[i];
+            rect.x = std::clamp(rect.x + step(rng), 0.0F, world.w - rect.w);
+            rect.y = std::clamp(rect.y + step(rng), 0.0F, world.h - rect.h);
+            alive[i] = unit(rng) > 0.1F;
+            if (alive[i]) {
+                sap.update(i, rect, i);
+            } else {
+                sap.remove(i);
+            }
+        }
+        sap.sort();
+        const auto live = std::count(alive.begin(), alive.end(), true);
+        ASSERT_EQ(sap.size(), static_cast<std::size_t>(live));
+        EXPECT_EQ(pairsOf(sap), bruteForcePairs(rects, alive))
+            << "frame " << frame;
+    }
+}
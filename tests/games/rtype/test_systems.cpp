@@ -16,6 +16,7 @@
 #include "../../../src/games/rtype/shared/Systems/AISystem/AISystem.hpp"
 #include "../../../src/games/rtype/shared/Systems/AISystem/Behaviors/BehaviorRegistry.hpp"
 #include "../../../src/games/rtype/shared/Systems/Movements/MovementSystem.hpp"
+#include "../../../src/games/rtype/shared/Systems/Targeting/TargetIndexSystem.hpp"
 #include "../../../src/games/rtype/server/Systems/Cleanup/CleanupSystem.hpp"
 #include "../../../src/games/rtype/server/Systems/Destroy/DestroySystem.hpp"
 #include "../../../src/games/rtype/server/Systems/Spawner/SpawnerSystem.hpp"
@@ -497,6 +498,157 @@ TEST_F(AISystemTest, UpdateChaseTargetsWithMultiplePlayers) {
     registry.killEntity(enemy);
 }
 
+TEST_F(AISystemTest, BatchedWaveMatchesPerEntityApply) {
+    // A large mixed wave, split across workers, against apply() per entity
+    constexpr int kCount = 1200;
+    std::vector<ECS::Entity> entities;
+    std::vector<AIComponent> expectedAi;
+    std::vector<VelocityComponent> expectedVelocity;
+    for (int i = 0; i < kCount; ++i) {
+        AIComponent ai;
+        ai.behavior = static_cast<AIBehavior>(i % kAIBehaviorCount);
+        ai.speed = 50.0F + static_cast<float>(i % 13) * 10.0F;
+        ai.stateTimer = static_cast<float>(i % 7) * 0.15F;
+        ai.targetX = 100.0F;
+        ai.targetY = static_cast<float>(i % 5) * 200.0F;
+        const TransformComponent transform{static_cast<float>(i % 1900),
+                                           static_cast<float>(i % 1000),
+                                           0.0F};
+        VelocityComponent velocity{1.0F, 1.0F};
+
+        auto e = registry.spawnEntity();
+        registry.emplaceComponent<AIComponent>(e, ai);
+        registry.emplaceComponent<TransformComponent>(e, transform);
+        registry.emplaceComponent<VelocityComponent>(e, velocity);
+        entities.push_back(e);
+
+        BehaviorRegistry::instance().getBehavior(ai.behavior)->apply(
+            ai, transform, velocity, 0.5F);
+        expectedAi.push_back(ai);
+        expectedVelocity.push_back(velocity);
+    }
+
+    AISystem batched(3);
+    batched.update(registry, 0.5F);
+
+    for (int i = 0; i < kCount; ++i) {
+        const auto& ai = registry.getComponent<AIComponent>(entities[i]);
+        const auto& velocity =
+            registry.getComponent<VelocityComponent>(entities[i]);
+        EXPECT_FLOAT_EQ(ai.stateTimer, expectedAi[i].stateTimer) << i;
+        EXPECT_FLOAT_EQ(ai.targetY, expectedAi[i].targetY) << i;
+        EXPECT_FLOAT_EQ(velocity.vx, expectedVelocity[i].vx) << i;
+        EXPECT_FLOAT_EQ(velocity.vy, expectedVelocity[i].vy) << i;
+    }
+
+    for (auto e : entities) {
+        registry.killEntity(e);
+    }
+}
+
+// =============================================================================
+// TargetIndexSystem Tests
+// =============================================================================
+
+class TargetIndexSystemTest : public ::testing::Test {
+   protected:
+    ECS::Entity spawnPlayer(float x, float y, uint32_t networkId) {
+        auto e = registry.spawnEntity();
+        registry.emplaceComponent<PlayerTag>(e);
+        registry.emplaceComponent<TransformComponent>(e, x, y, 0.0F);
+        if (networkId != INVALID_NETWORK_ID) {
+            registry.emplaceComponent<NetworkIdComponent>(e, networkId);
+        }
+        return e;
+    }
+
+    ECS::Registry registry;
+    TargetIndexSystem indexSystem;
+};
+
+TEST_F(TargetIndexSystemTest, PublishesPlayersSortedByNetworkId) {
+    spawnPlayer(100.0F, 100.0F, 7);
+    spawnPlayer(200.0F, 100.0F, 3);
+    spawnPlayer(300.0F, 100.0F, INVALID_NETWORK_ID);
+
+    indexSystem.update(registry, 0.016F);
+
+    ASSERT_TRUE(registry.hasSingleton<PlayerTargetIndex>());
+    const auto& index = registry.getSingleton<PlayerTargetIndex>();
+    ASSERT_EQ(index.size(), 3U);
+    EXPECT_EQ(index.players()[0].networkId, 3U);
+    EXPECT_EQ(index.players()[1].networkId, 7U);
+    ASSERT_NE(index.findByNetworkId(7), nullptr);
+    EXPECT_FLOAT_EQ(index.findByNetworkId(7)->x, 100.0F);
+    EXPECT_EQ(index.findByNetworkId(5), nullptr);
+    EXPECT_EQ(index.findByNetworkId(INVALID_NETWORK_ID), nullptr);
+}
+
+TEST_F(TargetIndexSystemTest, NearestAndRadiusQueries) {
+    spawnPlayer(0.0F, 0.0F, 1);
+    spawnPlayer(100.0F, 0.0F, 2);
+    spawnPlayer(500.0F, 500.0F, 3);
+    indexSystem.update(registry, 0.016F);
+    const auto& index = registry.getSingleton<PlayerTargetIndex>();
+
+    ASSERT_NE(index.nearest(80.0F, 10.0F), nullptr);
+    EXPECT_EQ(index.nearest(80.0F, 10.0F)->networkId, 2U);
+
+    std::vector<const PlayerTarget*> found;
+    index.inRadius(50.0F, 0.0F, 60.0F, found);
+    ASSERT_EQ(found.size(), 2U);
+    EXPECT_EQ(found[0]->networkId, 1U);
+    EXPECT_EQ(found[1]->networkId, 2U);
+
+    PlayerTargetIndex empty;
+    EXPECT_EQ(empty.nearest(0.0F, 0.0F), nullptr);
+}
+
+TEST_F(TargetIndexSystemTest, FirstInLineReturnsClosestInCorridor) {
+    spawnPlayer(100.0F, 0.0F, 1);
+    spawnPlayer(300.0F, 5.0F, 2);
+    spawnPlayer(-50.0F, 0.0F, 3);
+    spawnPlayer(200.0F, 80.0F, 4);
+    indexSystem.update(registry, 0.016F);
+    const auto& index = registry.getSingleton<PlayerTargetIndex>();
+
+    // Shooting left from x=400: player 2 is first, player 3 is behind 1
+    const auto* hit = index.firstInLine(400.0F, 0.0F, -2.0F, 0.0F, 10.0F,
+                                        1000.0F);
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->networkId, 2U);
+    EXPECT_EQ(index.firstInLine(400.0F, 0.0F, -1.0F, 0.0F, 10.0F, 50.0F),
+              nullptr);
+    EXPECT_EQ(index.firstInLine(0.0F, 0.0F, 0.0F, 0.0F, 10.0F, 1000.0F),
+              nullptr);
+}
+
+TEST_F(TargetIndexSystemTest, AISystemChasesPublishedPositions) {
+    BehaviorRegistry::instance().clear();
+    registerDefaultBehaviors();
+    auto player = spawnPlayer(100.0F, 200.0F, 1);
+    indexSystem.update(registry, 0.016F);
+    // Moves after the index was built are not seen until the next rebuild
+    registry.getComponent<TransformComponent>(player).x = 900.0F;
+
+    auto enemy = registry.spawnEntity();
+    AIComponent ai;
+    ai.behavior = AIBehavior::Chase;
+    registry.emplaceComponent<EnemyTag>(enemy);
+    registry.emplaceComponent<AIComponent>(enemy, ai);
+    registry.emplaceComponent<TransformComponent>(enemy, 500.0F, 200.0F, 0.0F);
+    registry.emplaceComponent<VelocityComponent>(enemy, 0.0F, 0.0F);
+
+    AISystem aiSystem;
+    aiSystem.update(registry, 0.016F);
+    EXPECT_FLOAT_EQ(registry.getComponent<AIComponent>(enemy).targetX, 100.0F);
+
+    indexSystem.update(registry, 0.016F);
+    aiSystem.update(registry, 0.016F);
+    EXPECT_FLOAT_EQ(registry.getComponent<AIComponent>(enemy).targetX, 900.0F);
+    BehaviorRegistry::instance().clear();
+}
+
 // =============================================================================
 // CleanupSystem Tests
 // =============================================================================
@@ -929,6 +1081,31 @@ TEST_F(DestroySystemTest, EntityWithDestroyTagIsDestroyed) {
     EXPECT_FALSE(registry.isAlive(entity));
 }
 
+TEST_F(DestroySystemTest, PooledEntityIsParkedInsteadOfKilled) {
+    DestroySystem destroySystem(
+        [this](const rtype::engine::GameEvent& event) {
+            emittedEvents.push_back(event);
+        },
+        [this]() { enemyCountDecremented = true; });
+
+    ECS::EntityPool pool([](ECS::Registry&, ECS::Entity) {});
+    auto pooled = pool.acquire(registry);
+    registry.emplaceComponent<DestroyTag>(pooled);
+    registry.emplaceComponent<NetworkIdComponent>(pooled, 7u);
+
+    destroySystem.update(registry, 0.016F);
+
+    ASSERT_EQ(emittedEvents.size(), 1U);
+    EXPECT_EQ(emittedEvents[0].entityNetworkId, 7u);
+    EXPECT_TRUE(registry.isAlive(pooled));
+    EXPECT_TRUE(registry.hasComponent<ECS::Inactive>(pooled));
+    EXPECT_FALSE(registry.hasComponent<DestroyTag>(pooled));
+    EXPECT_EQ(pool.available(), 1U);
+
+    pool.clear(registry);
+    registry.killEntity(entity);
+}
+
 TEST_F(DestroySystemTest, EntityWithoutDestroyTagNotDestroyed) {
     DestroySystem destroySystem(
         [this](const rtype::engine::GameEvent& event) {
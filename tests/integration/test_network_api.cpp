@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "../../src/client/network/NetworkClient.hpp"
 #include "../../src/server/network/NetworkServer.hpp"
@@ -253,6 +254,49 @@ TEST_F(NetworkApiTest, ClientSendInput) {
     EXPECT_GT(inputUserId, 0u);
 }
 
+TEST_F(NetworkApiTest, ClientSendInputHistory) {
+    std::atomic<bool> clientConnected{false};
+    std::atomic<bool> framesReceived{false};
+    std::atomic<bool> legacyReceived{false};
+    std::vector<network::InputFrame> received;
+
+    server_->onClientInput([&](std::uint32_t userId, std::uint8_t input) {
+        (void)userId; (void)input;
+        legacyReceived = true;
+    });
+    server_->onClientInputFrames(
+        [&](std::uint32_t userId,
+            const std::vector<network::InputFrame>& frames) {
+            (void)userId;
+            received = frames;
+            framesReceived = true;
+        });
+    client_->onConnected([&](std::uint32_t userId) {
+        (void)userId;
+        clientConnected = true;
+    });
+
+    EXPECT_TRUE(server_->start(TEST_PORT));
+    EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
+    ASSERT_TRUE(waitFor(clientConnected, 1s));
+
+    const std::vector<network::InputFrame> frames = {
+        {42, network::InputMask::kUp | network::InputMask::kShoot},
+        {41, network::InputMask::kUp},
+        {39, 0},
+    };
+    EXPECT_TRUE(client_->sendInputHistory(frames));
+    ASSERT_TRUE(waitFor(framesReceived, 1s));
+
+    ASSERT_EQ(received.size(), frames.size());
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ(received[i].tick, frames[i].tick);
+        EXPECT_EQ(received[i].inputMask, frames[i].inputMask);
+    }
+    EXPECT_FALSE(legacyReceived.load());
+    EXPECT_FALSE(client_->sendInputHistory({}));
+}
+
 TEST_F(NetworkApiTest, ClientSendInputWhileDisconnected) {
     EXPECT_FALSE(client_->sendInput(network::InputMask::kUp));
 }
@@ -427,11 +471,14 @@ TEST_F(NetworkApiTest, ServerPositionCorrection) {
         clientConnected = true;
     });
 
-    client_->onPositionCorrection([&](float x, float y) {
-        correctedX = x;
-        correctedY = y;
-        correctionReceived = true;
-    });
+    client_->onPositionCorrection(
+        [&](float x, float y, std::uint16_t ackInputSeq, float moveSpeed) {
+            (void)ackInputSeq;
+            (void)moveSpeed;
+            correctedX = x;
+            correctedY = y;
+            correctionReceived = true;
+        });
 
     EXPECT_TRUE(server_->start(TEST_PORT));
     EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
@@ -455,6 +502,48 @@ TEST_F(NetworkApiTest, ServerPositionCorrection) {
     EXPECT_FLOAT_EQ(correctedY, 250.0f);
 }
 
+TEST_F(NetworkApiTest, PositionCorrectionAcksLastInput) {
+    std::atomic<bool> clientConnected{false};
+    std::atomic<bool> inputReceived{false};
+    std::atomic<bool> correctionReceived{false};
+    std::uint16_t ackedInput = 0;
+    float reportedSpeed = 0;
+    std::uint32_t clientUserId = 0;
+
+    client_->onConnected([&](std::uint32_t userId) {
+        clientUserId = userId;
+        clientConnected = true;
+    });
+    server_->onClientInput([&](std::uint32_t userId, std::uint16_t input) {
+        (void)userId;
+        (void)input;
+        inputReceived = true;
+    });
+    client_->onPositionCorrection(
+        [&](float x, float y, std::uint16_t ackInputSeq, float moveSpeed) {
+            (void)x;
+            (void)y;
+            ackedInput = ackInputSeq;
+            reportedSpeed = moveSpeed;
+            correctionReceived = true;
+        });
+
+    EXPECT_TRUE(server_->start(TEST_PORT));
+    EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
+    ASSERT_TRUE(waitFor(clientConnected, 1s));
+    EXPECT_FALSE(server_->lastInputSeq(clientUserId).has_value());
+
+    ASSERT_TRUE(client_->sendInput(network::InputMask::kRight));
+    const std::uint16_t inputSeq = client_->lastInputSeqId();
+    ASSERT_TRUE(waitFor(inputReceived, 1s));
+    ASSERT_EQ(server_->lastInputSeq(clientUserId), inputSeq);
+
+    server_->correctPosition(clientUserId, 10.0f, 20.0f, 260.0f);
+    ASSERT_TRUE(waitFor(correctionReceived, 1s));
+    EXPECT_EQ(ackedInput, inputSeq);
+    EXPECT_FLOAT_EQ(reportedSpeed, 260.0f);
+}
+
 // ============================================================================
 // Multiple Clients Test
 // ============================================================================
@@ -655,6 +744,49 @@ TEST_F(NetworkApiTest, MoveEntityToClient) {
     EXPECT_FLOAT_EQ(receivedMove.y, 60.0f);
 }
 
+TEST_F(NetworkApiTest, MoveEntitiesBatchToClient) {
+    std::atomic<bool> clientConnected{false};
+    std::atomic<bool> batchReceived{false};
+    client::EntityMoveBatchEvent receivedBatch{};
+
+    client_->onConnected([&](std::uint32_t userId) {
+        (void)userId;
+        clientConnected = true;
+    });
+
+    client_->onEntityMoveBatch([&](client::EntityMoveBatchEvent event) {
+        receivedBatch = event;
+        batchReceived = true;
+    });
+
+    EXPECT_TRUE(server_->start(TEST_PORT));
+    EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
+
+    for (int i = 0; i < 100 && !clientConnected; ++i) {
+        pollBoth(10ms);
+    }
+    ASSERT_TRUE(clientConnected.load());
+
+    auto clients = server_->getConnectedClients();
+    ASSERT_EQ(clients.size(), 1u);
+
+    server_->moveEntitiesBatchToClient(
+        clients[0], {{11, 10.0f, 20.0f, 0.0f, 0.0f},
+                     {12, 30.0f, 40.0f, 1.0f, -1.0f}});
+    EXPECT_NO_THROW(server_->moveEntitiesBatchToClient(
+        99999, {{13, 0.0f, 0.0f, 0.0f, 0.0f}}));
+
+    for (int i = 0; i < 100 && !batchReceived; ++i) {
+        pollBoth(10ms);
+    }
+
+    ASSERT_TRUE(batchReceived.load());
+    ASSERT_EQ(receivedBatch.entities.size(), 2u);
+    EXPECT_EQ(receivedBatch.entities[0].entityId, 11u);
+    EXPECT_EQ(receivedBatch.entities[1].entityId, 12u);
+    EXPECT_FLOAT_EQ(receivedBatch.entities[1].x, 30.0f);
+}
+
 TEST_F(NetworkApiTest, DestroyEntityToClient) {
     std::atomic<bool> clientConnected{false};
     std::atomic<bool> destroyReceived{false};
@@ -815,3 +947,94 @@ TEST_F(NetworkApiTest, ClientConnectWhileConnected) {
     EXPECT_FALSE(secondConnect);
 }
 
+
+// ============================================================================
+// Dedicated I/O Thread Tests
+// ============================================================================
+
+TEST_F(NetworkApiTest, ServerIoLoopOnDedicatedThread) {
+    std::atomic<bool> clientConnected{false};
+    std::atomic<bool> spawnReceived{false};
+    std::atomic<bool> inputReceived{false};
+
+    client_->onConnected([&](std::uint32_t) { clientConnected = true; });
+    client_->onEntitySpawn([&](client::EntitySpawnEvent event) {
+        spawnReceived = event.entityId == 7u;
+    });
+    const std::uint8_t testInput =
+        network::InputMask::kUp | network::InputMask::kShoot;
+    server_->onClientInput([&](std::uint32_t, std::uint16_t input) {
+        inputReceived = input == testInput;
+    });
+
+    ASSERT_TRUE(server_->start(TEST_PORT));
+    ASSERT_TRUE(server_->claimIoLoop());
+    std::thread ioThread([this]() { server_->runIoLoop(); });
+    EXPECT_TRUE(server_->isIoLoopRunning());
+
+    EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
+    ASSERT_TRUE(waitFor(clientConnected, 1000ms));
+
+    server_->spawnEntity(7, network::EntityType::Player, 0, 10.0f, 20.0f);
+    EXPECT_TRUE(waitFor(spawnReceived, 1000ms));
+
+    EXPECT_TRUE(client_->sendInput(testInput));
+    EXPECT_TRUE(waitFor(inputReceived, 1000ms));
+
+    server_->stopIoLoop();
+    ioThread.join();
+    EXPECT_FALSE(server_->isIoLoopRunning());
+
+    // Back on the polling model after the loop returns
+    server_->spawnEntity(8, network::EntityType::Player, 0, 10.0f, 20.0f);
+    pollBoth(50ms);
+    EXPECT_EQ(server_->clientCount(), 1u);
+}
+
+TEST_F(NetworkApiTest, ServerIoLoopClaimedBeforeThreadStarts) {
+    std::atomic<bool> clientConnected{false};
+    std::atomic<int> spawnsReceived{0};
+    client_->onConnected([&](std::uint32_t) { clientConnected = true; });
+    client_->onEntitySpawn(
+        [&](client::EntitySpawnEvent) { spawnsReceived.fetch_add(1); });
+
+    ASSERT_TRUE(server_->start(TEST_PORT));
+    EXPECT_TRUE(client_->connect("127.0.0.1", TEST_PORT));
+    ASSERT_TRUE(waitFor(clientConnected, 1000ms));
+
+    ASSERT_TRUE(server_->claimIoLoop());
+    EXPECT_FALSE(server_->claimIoLoop());
+    EXPECT_TRUE(server_->isIoLoopRunning());
+
+    // poll() and sends right after the thread is spawned must go through the
+    // queues, never through the io_context the new thread is about to run
+    std::thread ioThread([this]() { server_->runIoLoop(); });
+    for (std::uint32_t id = 1; id <= 20; ++id) {
+        server_->poll();
+        server_->spawnEntity(id, network::EntityType::Player, 0, 1.0f, 2.0f);
+    }
+
+    for (int i = 0; i < 100 && spawnsReceived.load() < 20; ++i) {
+        client_->poll();
+        server_->poll();
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(spawnsReceived.load(), 20);
+
+    server_->stopIoLoop();
+    ioThread.join();
+    EXPECT_FALSE(server_->isIoLoopRunning());
+}
+
+TEST_F(NetworkApiTest, ServerIoLoopRequiresClaim) {
+    ASSERT_TRUE(server_->start(TEST_PORT));
+
+    // Without claimIoLoop() the loop refuses to run and poll() keeps the socket
+    server_->runIoLoop();
+    EXPECT_FALSE(server_->isIoLoopRunning());
+
+    ASSERT_TRUE(server_->claimIoLoop());
+    server_->releaseIoLoop();
+    EXPECT_FALSE(server_->isIoLoopRunning());
+    EXPECT_NO_THROW(server_->poll());
+}
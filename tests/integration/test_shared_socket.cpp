@@ -0,0 +1,194 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** test_shared_socket - Several NetworkServers behind one SharedUdpFrontend
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../../src/client/network/NetworkClient.hpp"
+#include "../../src/server/network/NetworkServer.hpp"
+#include "../../src/server/network/SharedUdpFrontend.hpp"
+#include "protocol/Payloads.hpp"
+
+using namespace rtype;
+using namespace std::chrono_literals;
+
+class SharedSocketTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        frontend_ = std::make_unique<server::SharedUdpFrontend>();
+        ASSERT_TRUE(frontend_->start(0));
+
+        for (std::size_t slot = 0; slot < 2; ++slot) {
+            servers_[slot] = std::make_unique<server::NetworkServer>();
+            servers_[slot]->setExpectedLobbyCode(kCodes[slot]);
+            ASSERT_TRUE(servers_[slot]->startShared(*frontend_, slot));
+        }
+    }
+
+    void TearDown() override {
+        for (auto& client : clients_) {
+            if (client) {
+                client->disconnect();
+            }
+        }
+        pumpAll(30ms);
+        for (auto& server : servers_) {
+            if (server) {
+                server->stop();
+            }
+        }
+        frontend_->stop();
+    }
+
+    void pumpAll(std::chrono::milliseconds duration) {
+        auto deadline = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < deadline) {
+            for (auto& server : servers_) {
+                if (server) {
+                    server->poll();
+                }
+            }
+            for (auto& client : clients_) {
+                if (client) {
+                    client->poll();
+                }
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    bool waitFor(std::atomic<bool>& flag, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!flag.load(std::memory_order_acquire) &&
+               std::chrono::steady_clock::now() < deadline) {
+            pumpAll(5ms);
+        }
+        return flag.load(std::memory_order_acquire);
+    }
+
+    static constexpr const char* kCodes[2] = {"AAAAAA", "BBBBBB"};
+
+    std::unique_ptr<server::SharedUdpFrontend> frontend_;
+    std::unique_ptr<server::NetworkServer> servers_[2];
+    std::unique_ptr<client::NetworkClient> clients_[2];
+};
+
+TEST_F(SharedSocketTest, ServersReportFrontendPort) {
+    EXPECT_NE(frontend_->port(), 0);
+    EXPECT_EQ(servers_[0]->port(), frontend_->port());
+    EXPECT_EQ(servers_[1]->port(), frontend_->port());
+}
+
+TEST_F(SharedSocketTest, SlotAlreadyTaken) {
+    server::NetworkServer extra;
+    EXPECT_FALSE(extra.startShared(*frontend_, 0));
+    EXPECT_FALSE(extra.isRunning());
+}
+
+TEST_F(SharedSocketTest, UserIdRangesEncodeSlot) {
+    using server::SharedUdpFrontend;
+    EXPECT_EQ(SharedUdpFrontend::userIdBase(0), 0x10000u);
+    EXPECT_EQ(SharedUdpFrontend::slotForUserId(0x10001), 0u);
+    EXPECT_EQ(SharedUdpFrontend::slotForUserId(0x2FFFF), 1u);
+    EXPECT_FALSE(SharedUdpFrontend::slotForUserId(42).has_value());
+    EXPECT_FALSE(
+        SharedUdpFrontend::slotForUserId(network::kServerUserId).has_value());
+}
+
+TEST_F(SharedSocketTest, TokenRoutesEachClientToItsLobby) {
+    std::atomic<bool> connected[2]{false, false};
+    std::atomic<bool> joined[2]{false, false};
+    std::atomic<bool> input[2]{false, false};
+    std::atomic<std::uint32_t> userIds[2]{0, 0};
+    std::atomic<int> wrongServerInputs{0};
+
+    for (std::size_t slot = 0; slot < 2; ++slot) {
+        clients_[slot] = std::make_unique<client::NetworkClient>();
+        clients_[slot]->onConnected([&, slot](std::uint32_t userId) {
+            userIds[slot] = userId;
+            connected[slot] = true;
+        });
+        clients_[slot]->onJoinLobbyResponse(
+            [&, slot](bool accepted, std::uint8_t, const std::string&) {
+                joined[slot] = accepted;
+            });
+        servers_[slot]->onClientInput(
+            [&, slot](std::uint32_t userId, std::uint16_t) {
+                if (userId == userIds[slot].load()) {
+                    input[slot] = true;
+                } else {
+                    ++wrongServerInputs;
+                }
+            });
+    }
+
+    // Connect in the opposite order to show routing ignores arrival order
+    for (std::size_t slot = 2; slot-- > 0;) {
+        ASSERT_TRUE(clients_[slot]->connect("127.0.0.1", frontend_->port(),
+                                            kCodes[slot]));
+        ASSERT_TRUE(waitFor(connected[slot], 1000ms));
+    }
+
+    EXPECT_EQ(server::SharedUdpFrontend::slotForUserId(userIds[0]), 0u);
+    EXPECT_EQ(server::SharedUdpFrontend::slotForUserId(userIds[1]), 1u);
+    EXPECT_EQ(servers_[0]->clientCount(), 1u);
+    EXPECT_EQ(servers_[1]->clientCount(), 1u);
+
+    for (std::size_t slot = 0; slot < 2; ++slot) {
+        ASSERT_TRUE(clients_[slot]->sendJoinLobby(kCodes[slot]));
+        ASSERT_TRUE(waitFor(joined[slot], 1000ms));
+        ASSERT_TRUE(clients_[slot]->sendInput(network::InputMask::kUp));
+        EXPECT_TRUE(waitFor(input[slot], 1000ms));
+    }
+    EXPECT_EQ(wrongServerInputs.load(), 0);
+    EXPECT_GT(frontend_->routedPackets(), 0u);
+}
+
+TEST_F(SharedSocketTest, TokenlessClientReachesFirstLobby) {
+    std::atomic<bool> connected{false};
+    std::atomic<std::uint32_t> userId{0};
+
+    clients_[0] = std::make_unique<client::NetworkClient>();
+    clients_[0]->onConnected([&](std::uint32_t id) {
+        userId = id;
+        connected = true;
+    });
+
+    ASSERT_TRUE(clients_[0]->connect("127.0.0.1", frontend_->port()));
+    ASSERT_TRUE(waitFor(connected, 1000ms));
+
+    EXPECT_EQ(server::SharedUdpFrontend::slotForUserId(userId), 0u);
+    EXPECT_EQ(servers_[0]->clientCount(), 1u);
+    EXPECT_EQ(servers_[1]->clientCount(), 0u);
+}
+
+TEST_F(SharedSocketTest, UnknownTokenGetsNoAnswer) {
+    std::atomic<bool> connected{false};
+
+    clients_[0] = std::make_unique<client::NetworkClient>();
+    clients_[0]->onConnected([&](std::uint32_t) { connected = true; });
+
+    ASSERT_TRUE(
+        clients_[0]->connect("127.0.0.1", frontend_->port(), "ZZZZZZ"));
+    EXPECT_FALSE(waitFor(connected, 200ms));
+    EXPECT_GT(frontend_->unroutedPackets(), 0u);
+    EXPECT_EQ(servers_[0]->clientCount(), 0u);
+    EXPECT_EQ(servers_[1]->clientCount(), 0u);
+}
+
+TEST_F(SharedSocketTest, UnregisteredSlotIsFreedForReuse) {
+    servers_[1]->stop();
+
+    server::NetworkServer replacement;
+    EXPECT_TRUE(replacement.startShared(*frontend_, 1));
+    replacement.stop();
+}
@@ -0,0 +1,228 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** BitStream tests - bit writer/reader and payload bit layouts
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "bitstream/BitLayout.hpp"
+#include "bitstream/BitStream.hpp"
+#include "protocol/PayloadLayouts.hpp"
+
+using namespace rtype::network;
+
+TEST(BitStreamTest, RawBitsRoundTripAcrossByteBoundaries) {
+    BitWriter writer;
+    writer.writeBits(0x5, 3);
+    writer.writeBits(0xABCDEF12, 32);
+    writer.writeBits(0x1, 1);
+    writer.writeBits(0x3FF, 10);
+    writer.writeBits64(0x123456789ABCDEFULL, 60);
+    EXPECT_EQ(writer.bitCount(), 106u);
+    EXPECT_EQ(writer.byteCount(), 14u);
+
+    auto bytes = std::move(writer).finish();
+    ASSERT_EQ(bytes.size(), 14u);
+
+    BitReader reader(bytes);
+    EXPECT_EQ(reader.readBits(3), 0x5u);
+    EXPECT_EQ(reader.readBits(32), 0xABCDEF12u);
+    EXPECT_TRUE(reader.readBool());
+    EXPECT_EQ(reader.readBits(10), 0x3FFu);
+    EXPECT_EQ(reader.readBits64(60), 0x123456789ABCDEFULL);
+    EXPECT_FALSE(reader.overflowed());
+    EXPECT_EQ(reader.remainingBits(), 6u);
+}
+
+TEST(BitStreamTest, WriterMasksExtraBits) {
+    BitWriter writer;
+    writer.writeBits(0xFF, 4);
+    writer.writeBits(0x0, 4);
+    auto bytes = std::move(writer).finish();
+    ASSERT_EQ(bytes.size(), 1u);
+    EXPECT_EQ(bytes[0], 0xF0);
+}
+
+TEST(BitStreamTest, RangedUsesMinimalBitsAndClamps) {
+    EXPECT_EQ(rangedBits(0, 1), 1u);
+    EXPECT_EQ(rangedBits(-8, 7), 4u);
+    EXPECT_EQ(rangedBits(0, 100), 7u);
+    EXPECT_EQ(rangedBits(std::numeric_limits<std::int64_t>::min(),
+                         std::numeric_limits<std::int64_t>::max()),
+              64u);
+
+    BitWriter writer;
+    writer.writeRanged(-3, -8, 7);
+    writer.writeRanged(250, 0, 100);
+    writer.writeRanged<std::int64_t>(std::numeric_limits<std::int64_t>::min(),
+                                     std::numeric_limits<std::int64_t>::min(),
+                                     std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(writer.bitCount(), 4u + 7u + 64u);
+
+    auto bytes = std::move(writer).finish();
+    BitReader reader(bytes);
+    EXPECT_EQ(reader.readRanged(-8, 7), -3);
+    EXPECT_EQ(reader.readRanged(0, 100), 100);
+    EXPECT_EQ(reader.readRanged<std::int64_t>(
+                  std::numeric_limits<std::int64_t>::min(),
+                  std::numeric_limits<std::int64_t>::max()),
+              std::numeric_limits<std::int64_t>::min());
+}
+
+TEST(BitStreamTest, QuantizedFloatStaysWithinPrecision) {
+    constexpr float kMin = -100.0f;
+    constexpr float kMax = 2000.0f;
+    constexpr float kPrecision = 0.125f;
+    EXPECT_EQ(quantizedBits(kMin, kMax, kPrecision), 15u);
+
+    const std::vector<float> values = {-100.0f, -37.3f, 0.0f, 512.06f,
+                                       1999.99f};
+    BitWriter writer;
+    for (float v : values) {
+        writer.writeQuantized(v, kMin, kMax, kPrecision);
+    }
+    writer.writeQuantized(5000.0f, kMin, kMax, kPrecision);
+    writer.writeQuantized(std::nanf(""), kMin, kMax, kPrecision);
+
+    auto bytes = std::move(writer).finish();
+    BitReader reader(bytes);
+    for (float v : values) {
+        EXPECT_NEAR(reader.readQuantized(kMin, kMax, kPrecision), v,
+                    kPrecision / 2.0f);
+    }
+    EXPECT_FLOAT_EQ(reader.readQuantized(kMin, kMax, kPrecision), kMax);
+    EXPECT_FLOAT_EQ(reader.readQuantized(kMin, kMax, kPrecision), kMin);
+    EXPECT_FALSE(reader.overflowed());
+}
+
+TEST(BitStreamTest, VarintSizesAndRoundTrip) {
+    EXPECT_EQ(VarUint::encodedBits(0), 6u);
+    EXPECT_EQ(VarUint::encodedBits(15), 6u);
+    EXPECT_EQ(VarUint::encodedBits(16), 10u);
+    EXPECT_EQ(VarUint::encodedBits(255), 10u);
+    EXPECT_EQ(VarUint::encodedBits(256), 18u);
+    EXPECT_EQ(VarUint::encodedBits(0xFFFFFFFFu), 34u);
+
+    const std::vector<std::int32_t> signedValues = {
+        0, -1, 1, 63, -64, 30000, std::numeric_limits<std::int32_t>::min(),
+        std::numeric_limits<std::int32_t>::max()};
+
+    BitWriter writer;
+    writer.writeVarUint(7);
+    writer.writeVarUint(0xFFFFFFFFu);
+    for (auto v : signedValues) {
+        writer.writeVarInt(v);
+    }
+
+    auto bytes = std::move(writer).finish();
+    BitReader reader(bytes);
+    EXPECT_EQ(reader.readVarUint(), 7u);
+    EXPECT_EQ(reader.readVarUint(), 0xFFFFFFFFu);
+    for (auto v : signedValues) {
+        EXPECT_EQ(reader.readVarInt(), v);
+    }
+    EXPECT_FALSE(reader.overflowed());
+}
+
+TEST(BitStreamTest, AlignAndRawBytes) {
+    BitWriter writer;
+    writer.writeBits(1, 1);
+    const std::vector<std::uint8_t> raw = {0xDE, 0xAD};
+    writer.writeBytes(raw);
+    EXPECT_EQ(writer.bitCount(), 24u);
+
+    auto bytes = std::move(writer).finish();
+    ASSERT_EQ(bytes.size(), 3u);
+    BitReader reader(bytes);
+    EXPECT_TRUE(reader.readBool());
+    reader.alignToByte();
+    EXPECT_EQ(reader.readBits(16), 0xDEADu);
+}
+
+TEST(BitStreamTest, ReaderOverflowIsSticky) {
+    const std::vector<std::uint8_t> bytes = {0xFF};
+    BitReader reader(bytes);
+    EXPECT_EQ(reader.readBits(6), 0x3Fu);
+    EXPECT_EQ(reader.readBits(4), 0u);
+    EXPECT_TRUE(reader.overflowed());
+    EXPECT_EQ(reader.readBits(1), 0u);
+    EXPECT_TRUE(reader.overflowed());
+}
+
+TEST(BitLayoutTest, MoveBatchEntryRoundTrip) {
+    EntityMoveBatchEntry entry{};
+    entry.entityId = 42;
+    entry.posX = -32768;
+    entry.posY = 1234;
+    entry.velX = -5;
+    entry.velY = 32767;
+
+    EXPECT_EQ(layoutBits(entry), 10u + 4u * 16u);
+    EXPECT_EQ(kLayoutMaxBits<EntityMoveBatchEntry>, 34u + 4u * 16u);
+
+    BitWriter writer;
+    writeLayout(writer, entry);
+    EXPECT_EQ(writer.bitCount(), layoutBits(entry));
+    EXPECT_LT(writer.byteCount(), sizeof(EntityMoveBatchEntry));
+
+    auto bytes = std::move(writer).finish();
+    BitReader reader(bytes);
+    auto decoded = readLayout<EntityMoveBatchEntry>(reader);
+    EXPECT_FALSE(reader.overflowed());
+    EXPECT_EQ(decoded.entityId, entry.entityId);
+    EXPECT_EQ(decoded.posX, entry.posX);
+    EXPECT_EQ(decoded.posY, entry.posY);
+    EXPECT_EQ(decoded.velX, entry.velX);
+    EXPECT_EQ(decoded.velY, entry.velY);
+}
+
+TEST(BitLayoutTest, PackedPayloadsShareOneStream) {
+    InputPayload input{};
+    input.inputMask = InputMask::kUp | InputMask::kShoot |
+                      InputMask::kWeaponSwitch;
+    EntityHealthPayload health{};
+    health.entityId = 7;
+    health.current = 2;
+    health.max = 3;
+    SnapshotAckPayload ack{};
+    ack.serverTick = 123456;
+
+    BitWriter writer;
+    writeLayout(writer, input);
+    writeLayout(writer, health);
+    writeLayout(writer, ack);
+    EXPECT_EQ(writer.bitCount(), 9u + 18u + 34u);
+
+    auto bytes = std::move(writer).finish();
+    BitReader reader(bytes);
+    EXPECT_EQ(readLayout<InputPayload>(reader).inputMask, input.inputMask);
+    auto decodedHealth = readLayout<EntityHealthPayload>(reader);
+    EXPECT_EQ(decodedHealth.entityId, 7u);
+    EXPECT_EQ(decodedHealth.current, 2);
+    EXPECT_EQ(decodedHealth.max, 3);
+    EXPECT_EQ(readLayout<SnapshotAckPayload>(reader).serverTick, 123456u);
+    EXPECT_FALSE(reader.overflowed());
+}
+
+TEST(BitLayoutTest, TruncatedLayoutReportsOverflow) {
+    EntityHealthPayload health{};
+    health.entityId = 0xFFFFFFFFu;
+    health.current = -1;
+    health.max = 100000;
+
+    BitWriter writer;
+    writeLayout(writer, health);
+    auto bytes = std::move(writer).finish();
+    bytes.resize(bytes.size() - 2);
+
+    BitReader reader(bytes);
+    (void)readLayout<EntityHealthPayload>(reader);
+    EXPECT_TRUE(reader.overflowed());
+}
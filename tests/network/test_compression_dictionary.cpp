@@ -0,0 +1,268 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** Compression dictionary tests - dictionary set, dictionary mode, trainer
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "compression/Compressor.hpp"
+#include "compression/DictionarySet.hpp"
+#include "compression/DictionaryTrainer.hpp"
+#include "connection/Connection.hpp"
+#include "core/Types.hpp"
+#include "protocol/ByteOrderSpec.hpp"
+#include "protocol/Header.hpp"
+#include "protocol/OpCode.hpp"
+#include "protocol/Payloads.hpp"
+
+using namespace rtype::network;
+
+namespace {
+
+/// Entity spawn-like payload: mostly constant fields, a few varying bytes
+Buffer makeSpawnPayload(std::uint32_t id) {
+    Buffer payload = {0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x43,
+                      0x48, 0x00, 0x00, 0x43, 0x96, 0x00, 0x00, 0x00, 0x64,
+                      0x00, 0x64, 0x00, 0x00, 0x00, 0x01};
+    payload[0] = static_cast<std::uint8_t>(id >> 24);
+    payload[1] = static_cast<std::uint8_t>(id >> 16);
+    payload[2] = static_cast<std::uint8_t>(id >> 8);
+    payload[3] = static_cast<std::uint8_t>(id);
+    payload[13] = static_cast<std::uint8_t>(id * 7);
+    return payload;
+}
+
+std::shared_ptr<const DictionarySet> makeTrainedSet() {
+    DictionaryTrainer::Config config;
+    config.dictionarySize = 1024;
+    config.minSamples = 8;
+    DictionaryTrainer trainer(config);
+    for (std::uint32_t id = 0; id < 64; ++id) {
+        trainer.addSample(static_cast<std::uint8_t>(OpCode::S_ENTITY_SPAWN),
+                          makeSpawnPayload(id));
+    }
+    return std::make_shared<const DictionarySet>(trainer.train());
+}
+
+template <typename T>
+Buffer makeServerPacket(OpCode opcode, std::uint16_t seqId, const T& payload) {
+    Header header;
+    header.magic = kMagicByte;
+    header.opcode = static_cast<std::uint8_t>(opcode);
+    header.payloadSize =
+        ByteOrderSpec::toNetwork(static_cast<std::uint16_t>(sizeof(T)));
+    header.userId = ByteOrderSpec::toNetwork(kServerUserId);
+    header.seqId = ByteOrderSpec::toNetwork(seqId);
+    header.ackId = 0;
+    header.flags = 0;
+    header.reserved = {0, 0, 0};
+
+    T networkPayload = ByteOrderSpec::toNetwork(payload);
+    Buffer packet(kHeaderSize + sizeof(T));
+    std::memcpy(packet.data(), &header, kHeaderSize);
+    std::memcpy(packet.data() + kHeaderSize, &networkPayload, sizeof(T));
+    return packet;
+}
+
+}  // namespace
+
+TEST(DictionarySetTest, EmptySetHasNoId) {
+    DictionarySet set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.id(), 0u);
+    EXPECT_EQ(set.find(OpCode::S_ENTITY_SPAWN), nullptr);
+}
+
+TEST(DictionarySetTest, FindFallsBackToDefaultDictionary) {
+    DictionarySet set;
+    set.add(static_cast<std::uint8_t>(OpCode::S_ENTITY_SPAWN), {1, 2, 3});
+    set.add(DictionarySet::kFallbackOpcode, {9, 9});
+
+    ASSERT_NE(set.find(OpCode::S_ENTITY_SPAWN), nullptr);
+    EXPECT_EQ(set.find(OpCode::S_ENTITY_SPAWN)->size(), 3u);
+    ASSERT_NE(set.find(OpCode::S_ENTITY_DESTROY), nullptr);
+    EXPECT_EQ(set.find(OpCode::S_ENTITY_DESTROY)->size(), 2u);
+    EXPECT_NE(set.id(), 0u);
+}
+
+TEST(DictionarySetTest, SerializeRoundTripKeepsId) {
+    DictionarySet set;
+    set.add(static_cast<std::uint8_t>(OpCode::S_ENTITY_MOVE), {4, 5, 6, 7});
+    set.add(DictionarySet::kFallbackOpcode, {1});
+
+    auto parsed = DictionarySet::deserialize(set.serialize());
+    ASSERT_TRUE(parsed.isOk());
+    EXPECT_EQ(parsed.value().id(), set.id());
+    EXPECT_EQ(parsed.value().size(), 2u);
+    EXPECT_EQ(*parsed.value().find(OpCode::S_ENTITY_MOVE),
+              (Buffer{4, 5, 6, 7}));
+}
+
+TEST(DictionarySetTest, RejectsCorruptData) {
+    DictionarySet set;
+    set.add(static_cast<std::uint8_t>(OpCode::S_ENTITY_MOVE), {4, 5, 6, 7});
+    Buffer data = set.serialize();
+
+    Buffer badMagic = data;
+    badMagic[0] = 'X';
+    EXPECT_TRUE(DictionarySet::deserialize(badMagic).isErr());
+
+    Buffer truncated(data.begin(), data.end() - 1);
+    EXPECT_TRUE(DictionarySet::deserialize(truncated).isErr());
+
+    Buffer trailing = data;
+    trailing.push_back(0);
+    EXPECT_TRUE(DictionarySet::deserialize(trailing).isErr());
+}
+
+TEST(DictionaryTrainerTest, TrainsDedicatedAndFallbackDictionaries) {
+    auto set = makeTrainedSet();
+    EXPECT_EQ(set->size(), 2u);
+
+    const Buffer* dict = set->find(OpCode::S_ENTITY_SPAWN);
+    ASSERT_NE(dict, nullptr);
+    EXPECT_FALSE(dict->empty());
+    EXPECT_LE(dict->size(), 1024u);
+}
+
+TEST(DictionaryCompressorTest, SmallPayloadRoundTrip) {
+    Compressor::Config config;
+    config.dictionaries = makeTrainedSet();
+    Compressor compressor(config);
+    EXPECT_EQ(compressor.dictionaryId(), config.dictionaries->id());
+
+    Buffer payload = makeSpawnPayload(1000);
+    ASSERT_LT(payload.size(), config.minSizeThreshold);
+
+    auto result = compressor.compress(payload, OpCode::S_ENTITY_SPAWN, true);
+    ASSERT_TRUE(result.wasCompressed);
+    EXPECT_TRUE(result.usedDictionary);
+    EXPECT_LT(result.data.size(), payload.size());
+
+    auto decompressed =
+        compressor.decompressWithDictionary(result.data, OpCode::S_ENTITY_SPAWN);
+    ASSERT_TRUE(decompressed.isOk());
+    EXPECT_EQ(decompressed.value(), payload);
+}
+
+TEST(DictionaryCompressorTest, DisallowedDictionaryUsesFrameMode) {
+    Compressor::Config config;
+    config.dictionaries = makeTrainedSet();
+    Compressor compressor(config);
+
+    Buffer payload = makeSpawnPayload(3);
+    auto result = compressor.compress(payload, OpCode::S_ENTITY_SPAWN, false);
+    EXPECT_FALSE(result.usedDictionary);
+    EXPECT_FALSE(result.wasCompressed);
+    EXPECT_EQ(result.data, payload);
+}
+
+TEST(DictionaryCompressorTest, NoDictionariesConfigured) {
+    Compressor compressor;
+    EXPECT_EQ(compressor.dictionaryId(), 0u);
+
+    Buffer payload(200, 0xAB);
+    auto result = compressor.compress(payload, OpCode::S_ENTITY_SPAWN, true);
+    EXPECT_TRUE(result.wasCompressed);
+    EXPECT_FALSE(result.usedDictionary);
+    EXPECT_TRUE(compressor.decompressWithDictionary(result.data,
+                                                    OpCode::S_ENTITY_SPAWN)
+                    .isErr());
+}
+
+TEST(DictionaryCompressorTest, CorruptBlockFails) {
+    Compressor::Config config;
+    config.dictionaries = makeTrainedSet();
+    Compressor compressor(config);
+
+    auto result = compressor.compress(makeSpawnPayload(42),
+                                      OpCode::S_ENTITY_SPAWN, true);
+    ASSERT_TRUE(result.usedDictionary);
+
+    Buffer wrongSize = result.data;
+    wrongSize[1] = static_cast<std::uint8_t>(wrongSize[1] + 5);
+    EXPECT_TRUE(
+        compressor.decompressWithDictionary(wrongSize, OpCode::S_ENTITY_SPAWN)
+            .isErr());
+
+    Buffer oversized = result.data;
+    oversized[0] = 0xFF;
+    EXPECT_TRUE(
+        compressor.decompressWithDictionary(oversized, OpCode::S_ENTITY_SPAWN)
+            .isErr());
+
+    Buffer truncated(result.data.begin(), result.data.begin() + 2);
+    EXPECT_TRUE(
+        compressor.decompressWithDictionary(truncated, OpCode::S_ENTITY_SPAWN)
+            .isErr());
+}
+
+TEST(DictionaryNegotiationTest, OfferAfterAcceptAndSelectEnablesDictionary) {
+    Connection::Config config;
+    config.compressionConfig.dictionaries = makeTrainedSet();
+    Connection conn(config);
+    Endpoint server{"127.0.0.1", 4242};
+    ASSERT_TRUE(conn.connect().isOk());
+    (void)conn.getOutgoingPackets();
+
+    AcceptPayload accept{};
+    accept.newUserId = 42;
+    ASSERT_TRUE(
+        conn.processPacket(makeServerPacket(OpCode::S_ACCEPT, 1, accept), server)
+            .isOk());
+
+    bool offered = false;
+    for (const auto& packet : conn.getOutgoingPackets()) {
+        if (packet.data[1] == static_cast<std::uint8_t>(
+                                  OpCode::C_COMPRESSION_OFFER)) {
+            offered = true;
+            EXPECT_TRUE(packet.isReliable);
+        }
+    }
+    EXPECT_TRUE(offered);
+    EXPECT_FALSE(conn.isDictionaryCompressionActive());
+
+    CompressionDictionaryPayload select{};
+    select.dictionaryId = conn.compressor().dictionaryId();
+    ASSERT_TRUE(conn.processPacket(makeServerPacket(
+                                       OpCode::S_COMPRESSION_SELECT, 2, select),
+                                   server)
+                    .isOk());
+    EXPECT_TRUE(conn.isDictionaryCompressionActive());
+
+    auto built = conn.buildPacket(OpCode::C_CHAT, makeSpawnPayload(9));
+    ASSERT_TRUE(built.isOk());
+    EXPECT_TRUE(built.value().data[kHeaderSize - 4] & Flags::kDictCompressed);
+
+    conn.reset();
+    EXPECT_FALSE(conn.isDictionaryCompressionActive());
+}
+
+TEST(DictionaryNegotiationTest, DeclinedSelectKeepsFrameMode) {
+    Connection::Config config;
+    config.compressionConfig.dictionaries = makeTrainedSet();
+    Connection conn(config);
+    Endpoint server{"127.0.0.1", 4242};
+    ASSERT_TRUE(conn.connect().isOk());
+
+    AcceptPayload accept{};
+    accept.newUserId = 7;
+    ASSERT_TRUE(
+        conn.processPacket(makeServerPacket(OpCode::S_ACCEPT, 1, accept), server)
+            .isOk());
+
+    CompressionDictionaryPayload select{};
+    select.dictionaryId = 0;
+    ASSERT_TRUE(conn.processPacket(makeServerPacket(
+                                       OpCode::S_COMPRESSION_SELECT, 2, select),
+                                   server)
+                    .isOk());
+    EXPECT_FALSE(conn.isDictionaryCompressionActive());
+}
@@ -101,6 +101,31 @@ TEST_F(ConnectionTest, Connect_PacketHasCorrectOpcode) {
     EXPECT_EQ(static_cast<OpCode>(header.opcode), OpCode::C_CONNECT);
 }
 
+TEST_F(ConnectionTest, Connect_WithTokenCarriesLobbyCode) {
+    Connection conn(config_);
+    conn.setConnectToken("ABC123");
+    ASSERT_TRUE(conn.connect().isOk());
+
+    auto packets = conn.getOutgoingPackets();
+    ASSERT_EQ(packets.size(), 1);
+    ASSERT_EQ(packets[0].data.size(),
+              kHeaderSize + sizeof(ConnectTokenPayload));
+
+    Header header;
+    std::memcpy(&header, packets[0].data.data(), kHeaderSize);
+    EXPECT_EQ(ByteOrderSpec::fromNetwork(header.payloadSize),
+              sizeof(ConnectTokenPayload));
+    EXPECT_EQ(std::memcmp(packets[0].data.data() + kHeaderSize, "ABC123", 6),
+              0);
+
+    // An empty code goes back to the empty handshake
+    Connection plain(config_);
+    plain.setConnectToken("ABC123");
+    plain.setConnectToken("");
+    ASSERT_TRUE(plain.connect().isOk());
+    EXPECT_EQ(plain.getOutgoingPackets()[0].data.size(), kHeaderSize);
+}
+
 // ============================================================================
 // DISCONNECT TESTS
 // ============================================================================
@@ -0,0 +1,142 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** EndpointKey and ReplayWindow unit tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <unordered_map>
+
+#include "core/EndpointKey.hpp"
+#include "protocol/SecurityContext.hpp"
+
+using namespace rtype::network;
+
+// =============================================================================
+// EndpointKey
+// =============================================================================
+
+TEST(EndpointKeyTest, SameEndpointSameKey) {
+    auto a = EndpointKey::from(Endpoint{"192.168.1.10", 4242});
+    auto b = EndpointKey::from(Endpoint{"192.168.1.10", 4242});
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash, b.hash);
+    EXPECT_EQ(a.family, EndpointKey::Family::IPv4);
+}
+
+TEST(EndpointKeyTest, PortAndAddressDistinguish) {
+    auto base = EndpointKey::from(Endpoint{"10.0.0.1", 5000});
+    EXPECT_NE(base, EndpointKey::from(Endpoint{"10.0.0.1", 5001}));
+    EXPECT_NE(base, EndpointKey::from(Endpoint{"10.0.0.2", 5000}));
+}
+
+TEST(EndpointKeyTest, TextFormMatchesEndpoint) {
+    // "address:port", as produced by Endpoint::toString()
+    EXPECT_EQ(EndpointKey("127.0.0.1:4242"),
+              EndpointKey::from(Endpoint{"127.0.0.1", 4242}));
+}
+
+TEST(EndpointKeyTest, V4MappedEqualsV4) {
+    EXPECT_EQ(EndpointKey::from(Endpoint{"::ffff:127.0.0.1", 80}),
+              EndpointKey::from(Endpoint{"127.0.0.1", 80}));
+}
+
+TEST(EndpointKeyTest, Ipv6) {
+    auto key = EndpointKey::from(Endpoint{"::1", 4242});
+    EXPECT_EQ(key.family, EndpointKey::Family::IPv6);
+    EXPECT_EQ(key.address[15], 1);
+    EXPECT_NE(key, EndpointKey::from(Endpoint{"::2", 4242}));
+}
+
+TEST(EndpointKeyTest, NonAddressTextIsStable) {
+    EndpointKey a("client1");
+    EndpointKey b("client1");
+    EndpointKey c("client2");
+    EXPECT_EQ(a.family, EndpointKey::Family::Text);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_NE(EndpointKey::from(Endpoint{"localhost", 1}),
+              EndpointKey::from(Endpoint{"localhost", 2}));
+}
+
+TEST(EndpointKeyTest, UsableAsHashKey) {
+    std::unordered_map<EndpointKey, int> map;
+    map[EndpointKey::from(Endpoint{"1.2.3.4", 1})] = 1;
+    map[EndpointKey::from(Endpoint{"1.2.3.4", 2})] = 2;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at(EndpointKey("1.2.3.4:2")), 2);
+}
+
+TEST(EndpointKeyTest, StreamsAddressAndPort) {
+    std::ostringstream v4;
+    v4 << EndpointKey::from(Endpoint{"192.168.0.7", 4242});
+    EXPECT_EQ(v4.str(), "192.168.0.7:4242");
+
+    std::ostringstream v6;
+    v6 << EndpointKey::from(Endpoint{"::1", 80});
+    EXPECT_EQ(v6.str(), "::1:80");
+}
+
+// =============================================================================
+// ReplayWindow
+// =============================================================================
+
+TEST(ReplayWindowTest, SetAndTest) {
+    ReplayWindow window;
+    EXPECT_TRUE(window.empty());
+    window.set(0);
+    window.set(63);
+    window.set(64);
+    window.set(1000);
+    EXPECT_TRUE(window.test(0));
+    EXPECT_TRUE(window.test(63));
+    EXPECT_TRUE(window.test(64));
+    EXPECT_TRUE(window.test(1000));
+    EXPECT_FALSE(window.test(1));
+    EXPECT_FALSE(window.test(ReplayWindow::kBits));
+    EXPECT_EQ(window.size(), 4u);
+}
+
+TEST(ReplayWindowTest, AdvanceShiftsAcrossWords) {
+    ReplayWindow window;
+    window.set(0);
+    window.set(60);
+    window.advance(10);
+    EXPECT_FALSE(window.test(0));
+    EXPECT_TRUE(window.test(10));
+    EXPECT_TRUE(window.test(70));
+    window.advance(128);
+    EXPECT_TRUE(window.test(138));
+    EXPECT_TRUE(window.test(198));
+    EXPECT_EQ(window.size(), 2u);
+}
+
+TEST(ReplayWindowTest, AdvancePastEndDropsBits) {
+    ReplayWindow window;
+    window.set(0);
+    window.set(ReplayWindow::kBits - 1);
+    window.advance(1);
+    EXPECT_TRUE(window.test(1));
+    EXPECT_EQ(window.size(), 1u);
+    window.advance(ReplayWindow::kBits);
+    EXPECT_TRUE(window.empty());
+}
+
+TEST(ReplayWindowTest, SecurityContextRejectsReplayInWindow) {
+    SecurityContext context;
+    const auto key = EndpointKey::from(Endpoint{"10.1.1.1", 9000});
+    for (uint16_t seq = 0; seq < 2000; seq += 2) {
+        ASSERT_TRUE(context.validateSequenceId(key, seq).isOk());
+    }
+    // Odd IDs inside the window were never seen
+    EXPECT_TRUE(context.validateSequenceId(key, 1995).isOk());
+    EXPECT_EQ(context.validateSequenceId(key, 1995).error(),
+              NetworkError::DuplicatePacket);
+    EXPECT_EQ(context.validateSequenceId(key, 1996).error(),
+              NetworkError::DuplicatePacket);
+    EXPECT_EQ(context.validateSequenceId(key, 500).error(),
+              NetworkError::InvalidSequence);
+}
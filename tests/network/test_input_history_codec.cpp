@@ -0,0 +1,119 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputHistoryCodec tests - redundant C_INPUT payloads
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "input/InputHistoryCodec.hpp"
+#include "protocol/Validator.hpp"
+
+using namespace rtype::network;
+
+namespace {
+
+/// count frames one tick apart ending at newest, newest first
+std::vector<InputFrame> makeHistory(std::uint32_t newest, std::size_t count,
+                                    std::uint16_t mask) {
+    std::vector<InputFrame> frames;
+    for (std::size_t i = 0; i < count; ++i) {
+        frames.push_back({newest - static_cast<std::uint32_t>(i), mask});
+    }
+    return frames;
+}
+
+}  // namespace
+
+TEST(InputHistoryCodecTest, RoundTripKeepsTicksAndMasks) {
+    std::vector<InputFrame> frames = {
+        {1000, InputMask::kUp | InputMask::kShoot},
+        {999, InputMask::kUp | InputMask::kShoot},
+        {998, InputMask::kUp},
+        {990, InputMask::kWeaponSwitch},
+        {3, InputMask::kNone},
+    };
+
+    auto payload = InputHistoryCodec::encode(frames);
+    auto decoded = InputHistoryCodec::decode(payload);
+    ASSERT_TRUE(decoded.isOk());
+    ASSERT_EQ(decoded.value().size(), frames.size());
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ(decoded.value()[i].tick, frames[i].tick);
+        EXPECT_EQ(decoded.value()[i].inputMask, frames[i].inputMask);
+    }
+}
+
+TEST(InputHistoryCodecTest, RepeatedFramesAreSmall) {
+    auto payload = InputHistoryCodec::encode(
+        makeHistory(123456, 8, InputMask::kRight | InputMask::kShoot));
+    // 9 bits + 7 x 7 bits after the 5-byte header
+    EXPECT_EQ(payload.size(), sizeof(InputHistoryHeader) + 8);
+    EXPECT_TRUE(InputHistoryCodec::isHistoryPayload(payload.size()));
+    EXPECT_FALSE(InputHistoryCodec::isHistoryPayload(sizeof(InputPayload)));
+}
+
+TEST(InputHistoryCodecTest, EncodeStopsAtLimitAndOutOfOrderFrames) {
+    auto payload = InputHistoryCodec::encode(
+        makeHistory(500, kMaxInputHistoryFrames + 4, InputMask::kDown));
+    auto decoded = InputHistoryCodec::decode(payload);
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().size(), kMaxInputHistoryFrames);
+
+    std::vector<InputFrame> unordered = {{10, 0}, {9, 0}, {9, 0}, {8, 0}};
+    decoded = InputHistoryCodec::decode(InputHistoryCodec::encode(unordered));
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().size(), 2u);
+
+    EXPECT_TRUE(InputHistoryCodec::encode({}).empty());
+}
+
+TEST(InputHistoryCodecTest, WorstCasePayloadPassesValidator) {
+    std::vector<InputFrame> frames;
+    std::uint32_t tick = 0xFFFFFFFFU;
+    for (std::size_t i = 0; i < kMaxInputHistoryFrames; ++i) {
+        frames.push_back(
+            {tick, static_cast<std::uint16_t>(i % 2 ? 0x1FF : 0)});
+        tick -= 0x0FFFFFFFU;
+    }
+    auto payload = InputHistoryCodec::encode(frames);
+    EXPECT_LE(payload.size(), kMaxInputHistoryPayloadSize);
+    EXPECT_TRUE(
+        Validator::validatePayloadSize(OpCode::C_INPUT, payload.size()).isOk());
+    EXPECT_TRUE(InputHistoryCodec::decode(payload).isOk());
+}
+
+TEST(InputHistoryCodecTest, RejectsMalformedPayloads) {
+    auto payload = InputHistoryCodec::encode(makeHistory(50, 4, 0));
+
+    auto tooSmall = InputHistoryCodec::decode(
+        std::span<const std::uint8_t>(payload.data(), 4));
+    EXPECT_EQ(tooSmall.error(), NetworkError::PacketTooSmall);
+
+    auto noFrames = payload;
+    noFrames[4] = 0;
+    EXPECT_EQ(InputHistoryCodec::decode(noFrames).error(),
+              NetworkError::MalformedPacket);
+
+    auto truncated = payload;
+    truncated[4] = static_cast<std::uint8_t>(kMaxInputHistoryFrames);
+    EXPECT_EQ(InputHistoryCodec::decode(truncated).error(),
+              NetworkError::MalformedPacket);
+
+    // Gaps reaching below tick 0
+    auto underflow = InputHistoryCodec::encode(makeHistory(2, 3, 0));
+    underflow[3] = 1;  // newestTick = 1
+    EXPECT_EQ(InputHistoryCodec::decode(underflow).error(),
+              NetworkError::MalformedPacket);
+}
+
+TEST(InputHistoryCodecTest, ValidatorStillRejectsOddInputSizes) {
+    EXPECT_TRUE(Validator::validatePayloadSize(OpCode::C_INPUT, 3).isErr());
+    EXPECT_TRUE(Validator::validatePayloadSize(
+                    OpCode::C_INPUT, kMaxInputHistoryPayloadSize + 1)
+                    .isErr());
+}
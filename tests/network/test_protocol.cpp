@@ -234,7 +234,7 @@ TEST_F(PayloadTest, PayloadSizesMatchRFC) {
     EXPECT_EQ(sizeof(EntityMovePayload), 16u);
     EXPECT_EQ(sizeof(EntityDestroyPayload), 4u);
     EXPECT_EQ(sizeof(InputPayload), 2u);
-    EXPECT_EQ(sizeof(UpdatePosPayload), 8u);
+    EXPECT_EQ(sizeof(UpdatePosPayload), 10u);
 }
 
 TEST_F(PayloadTest, AllPayloadsAreTriviallyCopiable) {
@@ -376,6 +376,10 @@ TEST_F(ValidatorTest, ValidatePayloadSize) {
     // Empty payloads
     EXPECT_TRUE(Validator::validatePayloadSize(OpCode::C_CONNECT, 0).isOk());
     EXPECT_TRUE(Validator::validatePayloadSize(OpCode::C_CONNECT, 1).isErr());
+    // Optional lobby-code token
+    EXPECT_TRUE(Validator::validatePayloadSize(
+                    OpCode::C_CONNECT, sizeof(ConnectTokenPayload))
+                    .isOk());
 
     // Variable size (R_GET_USERS) - need payload data for validation
     std::uint8_t payload0[1] = {0};  // count = 0, expected size = 1
@@ -608,12 +612,14 @@ TEST_F(ByteOrderSpecTest, UpdatePosPayloadRoundTrip) {
     UpdatePosPayload original{};
     original.posX = 123.456f;
     original.posY = -789.012f;
+    original.ackInputSeq = 0xBEEF;
 
     auto bytes = ByteOrderSpec::serializeToNetwork(original);
     auto restored = ByteOrderSpec::deserializeFromNetwork<UpdatePosPayload>(bytes);
 
     EXPECT_FLOAT_EQ(restored.posX, 123.456f);
     EXPECT_FLOAT_EQ(restored.posY, -789.012f);
+    EXPECT_EQ(restored.ackInputSeq, 0xBEEF);
 }
 
 TEST_F(ByteOrderSpecTest, SingleBytePayloadsUnchanged) {
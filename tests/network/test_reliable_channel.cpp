@@ -71,6 +71,28 @@ TEST_F(ReliableChannelTest, RecordAck_MultiplePackets) {
     EXPECT_EQ(channel_.getPendingCount(), 3);
 }
 
+TEST_F(ReliableChannelTest, RecordAck_ReturnsRttOnFirstAckOnly) {
+    channel_.trackOutgoing(8, testData_);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto rtt = channel_.recordAck(8);
+    ASSERT_TRUE(rtt.has_value());
+    EXPECT_GE(*rtt, std::chrono::milliseconds(2));
+    EXPECT_FALSE(channel_.recordAck(8).has_value());
+    EXPECT_FALSE(channel_.recordAck(9).has_value());
+}
+
+TEST_F(ReliableChannelTest, RecordAck_NoRttForRetransmittedPacket) {
+    ReliableChannel::Config config;
+    config.retransmitTimeout = std::chrono::milliseconds(0);
+    ReliableChannel channel{config};
+
+    channel.trackOutgoing(7, testData_);
+    ASSERT_EQ(channel.getPacketsToRetransmit().size(), 1);
+
+    EXPECT_FALSE(channel.recordAck(7).has_value());
+}
+
 // ============================================================================
 // Duplicate Detection Tests
 // ============================================================================
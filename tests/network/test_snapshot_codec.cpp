@@ -0,0 +1,225 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** SnapshotCodec tests - delta encoding, truncation and history ring
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "protocol/Header.hpp"
+#include "snapshot/Snapshot.hpp"
+#include "snapshot/SnapshotCodec.hpp"
+#include "snapshot/SnapshotRing.hpp"
+
+using namespace rtype::network;
+
+namespace {
+
+EntitySnapshotState makeEntity(std::uint32_t id, float x, float y,
+                               float vx = 0.0f, float vy = 0.0f,
+                               std::int32_t hp = 0, std::int32_t maxHp = 0) {
+    EntitySnapshotState e;
+    e.networkId = id;
+    e.type = 1;
+    e.posX = quantizeSnapshotValue(x, kSnapshotPosScale);
+    e.posY = quantizeSnapshotValue(y, kSnapshotPosScale);
+    e.velX = quantizeSnapshotValue(vx, kSnapshotVelScale);
+    e.velY = quantizeSnapshotValue(vy, kSnapshotVelScale);
+    e.health = hp;
+    e.maxHealth = maxHp;
+    return e;
+}
+
+WorldSnapshot makeWorld(std::uint32_t tick, std::size_t count,
+                        float offset = 0.0f) {
+    WorldSnapshot snap;
+    snap.tick = tick;
+    for (std::size_t i = 0; i < count; ++i) {
+        snap.entities.push_back(makeEntity(
+            static_cast<std::uint32_t>(i * 3 + 1),
+            100.0f + static_cast<float>(i) * 7.0f + offset,
+            200.0f + static_cast<float>(i) * 3.0f, -120.0f, 0.0f, 3, 3));
+    }
+    return snap;
+}
+
+}  // namespace
+
+TEST(SnapshotCodecTest, FullSnapshotRoundTrip) {
+    auto world = makeWorld(42, 20);
+
+    auto encoded = SnapshotCodec::encode(world, nullptr);
+    EXPECT_FALSE(encoded.truncated);
+    EXPECT_EQ(encoded.recordCount, 20u);
+
+    auto decoded = SnapshotCodec::decode(encoded.payload, nullptr);
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().tick, 42u);
+    EXPECT_EQ(decoded.value().entities, world.entities);
+}
+
+TEST(SnapshotCodecTest, HeaderCarriesTicks) {
+    auto base = makeWorld(10, 5);
+    auto next = makeWorld(11, 5, 2.0f);
+
+    auto encoded = SnapshotCodec::encode(next, &base);
+    auto header = SnapshotCodec::peekHeader(encoded.payload);
+    ASSERT_TRUE(header.isOk());
+    EXPECT_EQ(header.value().serverTick, 11u);
+    EXPECT_EQ(header.value().baselineTick, 10u);
+    EXPECT_EQ(header.value().recordCount, 5u);
+}
+
+TEST(SnapshotCodecTest, UnchangedEntitiesAreOmitted) {
+    auto base = makeWorld(1, 50);
+    auto next = base;
+    next.tick = 2;
+
+    auto encoded = SnapshotCodec::encode(next, &base);
+    EXPECT_EQ(encoded.recordCount, 0u);
+    EXPECT_EQ(encoded.payload.size(), sizeof(SnapshotHeader));
+
+    auto decoded = SnapshotCodec::decode(encoded.payload, &base);
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().entities, base.entities);
+}
+
+TEST(SnapshotCodecTest, DeltaRoundTripWithCreateUpdateRemove) {
+    auto base = makeWorld(100, 10);
+    auto next = base;
+    next.tick = 101;
+    next.entities[2].posX += 37;
+    next.entities[2].velY -= 5;
+    next.entities[5].health = 1;
+    next.entities.erase(next.entities.begin() + 7);
+    next.entities.push_back(makeEntity(500, 1900.0f, 40.0f, -300.0f, 0.0f));
+    next.sortEntities();
+
+    auto encoded = SnapshotCodec::encode(next, &base);
+    EXPECT_EQ(encoded.recordCount, 4u);
+
+    auto decoded = SnapshotCodec::decode(encoded.payload, &base);
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().tick, 101u);
+    EXPECT_EQ(decoded.value().entities, next.entities);
+}
+
+TEST(SnapshotCodecTest, DeltaIsSmallerThanBatchEncoding) {
+    constexpr std::size_t kCount = 100;
+    auto base = makeWorld(1, kCount);
+    auto next = makeWorld(2, kCount, 2.0f);
+
+    auto delta = SnapshotCodec::encode(next, &base);
+    ASSERT_FALSE(delta.truncated);
+
+    std::size_t batchBytes =
+        sizeof(EntityMoveBatchHeader) + kCount * sizeof(EntityMoveBatchEntry);
+    EXPECT_LT(delta.payload.size() * 2, batchBytes);
+}
+
+TEST(SnapshotCodecTest, ExtremeValuesRoundTrip) {
+    WorldSnapshot base;
+    base.tick = 5;
+    base.entities.push_back(makeEntity(1, 0.0f, 0.0f));
+    base.entities[0].posX = std::numeric_limits<std::int32_t>::min();
+    base.entities[0].health = std::numeric_limits<std::int32_t>::max();
+
+    WorldSnapshot next = base;
+    next.tick = 6;
+    next.entities[0].posX = std::numeric_limits<std::int32_t>::max();
+    next.entities[0].health = std::numeric_limits<std::int32_t>::min();
+    next.entities.push_back(makeEntity(0xFFFFFFFFu, -5.0f, 5.0f));
+
+    auto encoded = SnapshotCodec::encode(next, &base);
+    auto decoded = SnapshotCodec::decode(encoded.payload, &base);
+    ASSERT_TRUE(decoded.isOk());
+    EXPECT_EQ(decoded.value().entities, next.entities);
+}
+
+TEST(SnapshotCodecTest, TruncatesToBudgetAndStaysDecodable) {
+    auto base = makeWorld(1, 400);
+    auto next = makeWorld(2, 400, 50.0f);
+    constexpr std::size_t kBudget = 200;
+
+    auto encoded = SnapshotCodec::encode(next, &base, kBudget);
+    EXPECT_TRUE(encoded.truncated);
+    EXPECT_LE(encoded.payload.size(), kBudget);
+    EXPECT_GT(encoded.recordCount, 0u);
+
+    auto decoded = SnapshotCodec::decode(encoded.payload, &base);
+    ASSERT_TRUE(decoded.isOk());
+    const auto& entities = decoded.value().entities;
+    ASSERT_EQ(entities.size(), base.entities.size());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        const auto& expected =
+            i < encoded.recordCount ? next.entities[i] : base.entities[i];
+        EXPECT_EQ(entities[i], expected) << "entity index " << i;
+    }
+}
+
+TEST(SnapshotCodecTest, FullSnapshotFitsDefaultPayloadBudget) {
+    auto world = makeWorld(9, 1000);
+    auto encoded = SnapshotCodec::encode(world, nullptr);
+    EXPECT_TRUE(encoded.truncated);
+    EXPECT_LE(encoded.payload.size(), kMaxPayloadSize);
+}
+
+TEST(SnapshotCodecTest, RejectsMismatchedBaseline) {
+    auto base = makeWorld(10, 5);
+    auto next = makeWorld(11, 5, 1.0f);
+    auto encoded = SnapshotCodec::encode(next, &base);
+
+    auto wrong = makeWorld(9, 5);
+    auto decoded = SnapshotCodec::decode(encoded.payload, &wrong);
+    ASSERT_TRUE(decoded.isErr());
+    EXPECT_EQ(decoded.error(), NetworkError::InvalidSequence);
+
+    auto missing = SnapshotCodec::decode(encoded.payload, nullptr);
+    EXPECT_TRUE(missing.isErr());
+}
+
+TEST(SnapshotCodecTest, RejectsTruncatedPayload) {
+    auto world = makeWorld(3, 30);
+    auto encoded = SnapshotCodec::encode(world, nullptr);
+    encoded.payload.resize(encoded.payload.size() / 2);
+
+    auto decoded = SnapshotCodec::decode(encoded.payload, nullptr);
+    ASSERT_TRUE(decoded.isErr());
+    EXPECT_EQ(decoded.error(), NetworkError::MalformedPacket);
+
+    std::vector<std::uint8_t> tiny(4, 0);
+    EXPECT_TRUE(SnapshotCodec::decode(tiny, nullptr).isErr());
+}
+
+TEST(SnapshotCodecTest, QuantizeSaturates) {
+    EXPECT_EQ(quantizeSnapshotValue(1.0e12f, kSnapshotPosScale),
+              std::numeric_limits<std::int32_t>::max());
+    EXPECT_EQ(quantizeSnapshotValue(-1.0e12f, kSnapshotPosScale),
+              std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(quantizeSnapshotValue(1.5f, kSnapshotPosScale), 24);
+    EXPECT_FLOAT_EQ(dequantizeSnapshotValue(24, kSnapshotPosScale), 1.5f);
+}
+
+TEST(SnapshotRingTest, FindsOnlyRetainedTicks) {
+    SnapshotRing<4> ring;
+    for (std::uint32_t tick = 1; tick <= 6; ++tick) {
+        auto snap = std::make_shared<WorldSnapshot>();
+        snap->tick = tick;
+        ring.push(std::move(snap));
+    }
+
+    EXPECT_EQ(ring.find(1), nullptr);
+    EXPECT_EQ(ring.find(2), nullptr);
+    ASSERT_NE(ring.find(3), nullptr);
+    EXPECT_EQ(ring.find(3)->tick, 3u);
+    ASSERT_NE(ring.find(6), nullptr);
+
+    ring.clear();
+    EXPECT_EQ(ring.find(6), nullptr);
+}
@@ -278,3 +278,224 @@ TEST_F(ServerLoopTest, RapidStartStopCycles) {
     }
 }
 
+
+// ====================
+// Histogram Tests
+// ====================
+
+TEST_F(ServerLoopTest, StepRecordsEveryPhase) {
+    using rtype::server::LoopPhase;
+    ServerLoop loop(1000, _shutdownFlag);
+    loop.begin();
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+
+    int updates = 0;
+    loop.step([]() {}, [&](float) { updates++; }, []() {});
+
+    EXPECT_EQ(loop.getPhaseHistogram(LoopPhase::Frame).count(), 1U);
+    EXPECT_EQ(loop.getPhaseHistogram(LoopPhase::Update).count(),
+              static_cast<uint64_t>(updates));
+    EXPECT_EQ(loop.getPhaseHistogram(LoopPhase::PostUpdate).count(), 1U);
+    EXPECT_EQ(loop.getPhaseHistogram(LoopPhase::Total).count(), 1U);
+}
+
+// ====================
+// Degradation Tests
+// ====================
+
+TEST_F(ServerLoopTest, OverBudgetFramesDegradeThenRecover) {
+    ServerLoop loop(60, _shutdownFlag);
+    rtype::server::DegradationPolicy policy;
+    policy.tickBudget = std::chrono::microseconds(200);
+    policy.minTickRate = 30;
+    policy.maxSendDivisor = 2;
+    policy.degradeAfterFrames = 2;
+    policy.recoverAfterFrames = 2;
+    loop.setDegradationPolicy(policy);
+    loop.begin();
+
+    bool slow = true;
+    int broadcasts = 0;
+    auto frame = [&]() {
+        if (slow) {
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+    };
+    auto runFrames = [&](int count) {
+        for (int i = 0; i < count; ++i) {
+            loop.step(frame, [](float) {}, [&]() { broadcasts++; });
+        }
+    };
+
+    runFrames(2);
+    EXPECT_EQ(loop.getSendDivisor(), 2U);
+    EXPECT_EQ(loop.getSimulationRate(), 60U);
+
+    runFrames(2);
+    EXPECT_EQ(loop.getSimulationRate(), 30U);
+    EXPECT_NEAR(loop.getDeltaTime(), 1.0F / 30.0F, 0.0001F);
+
+    runFrames(4);
+    EXPECT_EQ(loop.getSimulationRate(), 30U) << "Never below minTickRate";
+
+    broadcasts = 0;
+    runFrames(4);
+    EXPECT_EQ(broadcasts, 2) << "One broadcast every other frame";
+
+    slow = false;
+    runFrames(2);
+    EXPECT_EQ(loop.getSimulationRate(), 60U);
+    EXPECT_EQ(loop.getSendDivisor(), 2U);
+    runFrames(2);
+    EXPECT_EQ(loop.getSendDivisor(), 1U);
+}
+
+TEST_F(ServerLoopTest, DegradationDisabledByDefault) {
+    ServerLoop loop(60, _shutdownFlag);
+    loop.begin();
+    for (int i = 0; i < 40; ++i) {
+        loop.step(
+            []() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); },
+            [](float) {}, []() {});
+    }
+    EXPECT_EQ(loop.getSendDivisor(), 1U);
+    EXPECT_EQ(loop.getSimulationRate(), 60U);
+}
+
+// ====================
+// Hibernation Tests
+// ====================
+
+TEST_F(ServerLoopTest, IdleLoopHibernatesUntilWoken) {
+    ServerLoop loop(60, _shutdownFlag);
+    std::atomic<int> wakeCalls{0};
+    loop.setIdleCheck([]() { return true; });
+    loop.setWakeHandler([&]() { wakeCalls++; });
+    loop.begin();
+
+    const auto due = loop.step([]() {}, [](float) {}, []() {});
+    EXPECT_TRUE(loop.isHibernating());
+    EXPECT_GE(due - std::chrono::steady_clock::now(),
+              std::chrono::milliseconds(ServerLoop::HIBERNATE_INTERVAL_MS / 2));
+
+    loop.wake();
+    EXPECT_EQ(wakeCalls.load(), 1);
+
+    // Time asleep is not caught up: exactly one tick
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    int updates = 0;
+    loop.setIdleCheck(nullptr);
+    loop.step([]() {}, [&](float) { updates++; }, []() {});
+    EXPECT_EQ(updates, 1);
+    EXPECT_FALSE(loop.isHibernating());
+}
+
+TEST_F(ServerLoopTest, WakeDuringFramePreventsHibernation) {
+    ServerLoop loop(60, _shutdownFlag);
+    std::atomic<int> wakeCalls{0};
+    loop.setIdleCheck([]() { return true; });
+    loop.setWakeHandler([&]() { wakeCalls++; });
+    loop.begin();
+
+    loop.step([&]() { loop.wake(); }, [](float) {}, []() {});
+    EXPECT_FALSE(loop.isHibernating());
+    EXPECT_EQ(wakeCalls.load(), 0) << "Awake loops skip the handler";
+}
+
+TEST_F(ServerLoopTest, RunReturnsFromHibernationOnWake) {
+    ServerLoop loop(60, _shutdownFlag);
+    std::atomic<int> frames{0};
+    loop.setIdleCheck([]() { return true; });
+
+    std::thread waker([&]() {
+        while (frames.load() < 1) {
+            std::this_thread::yield();
+        }
+        _shutdownFlag->store(true);
+        loop.wake();
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    loop.run([&]() { frames++; }, [](float) {}, []() {});
+    waker.join();
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start,
+              std::chrono::milliseconds(ServerLoop::HIBERNATE_INTERVAL_MS));
+}
+
+// ====================
+// Pacing Tests
+// ====================
+
+TEST_F(ServerLoopTest, JitterMeasurementRecordsFrameStarts) {
+    ServerLoop loop(200, _shutdownFlag);
+    loop.setJitterMeasurement(true);
+
+    int frames = 0;
+    loop.run(
+        [&]() {
+            if (++frames >= 20) {
+                _shutdownFlag->store(true);
+            }
+        },
+        [](float) {}, []() {});
+
+    const auto& jitter = loop.getJitterHistogram();
+    EXPECT_EQ(jitter.count(), 19U) << "Every frame but the first";
+    EXPECT_LT(jitter.percentile(0.5), 5'000'000U) << "Nanoseconds";
+}
+
+TEST_F(ServerLoopTest, JitterMeasurementOffByDefault) {
+    ServerLoop loop(200, _shutdownFlag);
+    loop.begin();
+    for (int i = 0; i < 5; ++i) {
+        loop.step([]() {}, [](float) {}, []() {});
+    }
+    EXPECT_EQ(loop.getJitterHistogram().count(), 0U);
+}
+
+TEST_F(ServerLoopTest, RunKeepsTheTickRate) {
+    ServerLoop loop(100, _shutdownFlag);
+    int frames = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    loop.run(
+        [&]() {
+            if (++frames >= 21) {
+                _shutdownFlag->store(true);
+            }
+        },
+        [](float) {}, []() {});
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // 20 paced intervals of 10 ms
+    EXPECT_GE(elapsed, std::chrono::milliseconds(195));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(400));
+}
+
+TEST_F(ServerLoopTest, DeadlinesStayOnScheduleWhenStepsRunLate) {
+    using namespace std::chrono_literals;
+    ServerLoop loop(100, _shutdownFlag);
+    const auto period = loop.getLoopTiming().fixedDeltaNs;
+    loop.begin();
+
+    const auto first = loop.step([]() {}, [](float) {}, []() {});
+
+    // Woken late and with a slow frame: the next deadline is still one
+    // period after the previous one, not after this wakeup
+    std::this_thread::sleep_until(first + 3ms);
+    auto due = loop.step([]() { std::this_thread::sleep_for(4ms); },
+                         [](float) {}, []() {});
+    EXPECT_EQ(due - first, period);
+
+    std::this_thread::sleep_until(due + 5ms);
+    due = loop.step([]() {}, [](float) {}, []() {});
+    EXPECT_EQ(due - first, period * 2);
+
+    // Too far behind to catch up: the schedule restarts from now
+    std::this_thread::sleep_until(due + period * (ServerLoop::MAX_LATE_FRAMES + 2));
+    const auto beforeStep = std::chrono::steady_clock::now();
+    due = loop.step([]() {}, [](float) {}, []() {});
+    EXPECT_GT(due, beforeStep);
+    EXPECT_LE(due - std::chrono::steady_clock::now(), period);
+}
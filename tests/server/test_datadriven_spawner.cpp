@@ -569,5 +569,60 @@ TEST_F(DataDrivenSpawnerTest, DecrementEnemyCountAtZero) {
     EXPECT_EQ(spawner.getEnemyCount(), 0);
 }
 
+// =============================================================================
+// Compiled Timeline Cache Tests
+// =============================================================================
+
+TEST_F(DataDrivenSpawnerTest, BossDetectedWhenLevelComesFromCache) {
+    const auto levelPath = _testDir / "levels" / "cached_boss.toml";
+    {
+        std::ofstream file(levelPath);
+        file << R"(
+[level]
+id = "cached_boss"
+name = "Cached Boss"
+background = "test.png"
+scroll_speed = 50.0
+boss = "zigzag"
+
+[[wave]]
+number = 1
+spawn_delay = 0.0
+
+[[wave.spawn]]
+enemy = "basic"
+delay = 0.0
+count = 1
+)";
+    }
+
+    auto& configRegistry = shared::EntityConfigRegistry::getInstance();
+    auto eventEmitter = [](const engine::GameEvent&) {};
+    DataDrivenSpawnerConfig config{};
+
+    DataDrivenSpawnerSystem firstRun(eventEmitter, config);
+    ASSERT_TRUE(firstRun.loadLevelFromFile(levelPath.string()));
+    auto zigzag = configRegistry.getEnemy("zigzag");
+    ASSERT_TRUE(zigzag.has_value());
+    EXPECT_TRUE(firstRun.isBossEnemy("zigzag", zigzag->get()));
+    ASSERT_TRUE(std::filesystem::exists(
+        std::filesystem::path(levelPath).replace_extension(".timeline")));
+
+    // A fresh process only has the enemy definitions; the level comes back
+    // from the compiled timeline without being registered again
+    configRegistry.clear();
+    configRegistry.loadEnemies((_testDir / "enemies.toml").string());
+
+    DataDrivenSpawnerSystem secondRun(eventEmitter, config);
+    ASSERT_TRUE(secondRun.loadLevelFromFile(levelPath.string()));
+    EXPECT_FALSE(configRegistry.getLevel("cached_boss").has_value());
+    zigzag = configRegistry.getEnemy("zigzag");
+    ASSERT_TRUE(zigzag.has_value());
+    EXPECT_TRUE(secondRun.isBossEnemy("zigzag", zigzag->get()));
+    auto basic = configRegistry.getEnemy("basic");
+    ASSERT_TRUE(basic.has_value());
+    EXPECT_FALSE(secondRun.isBossEnemy("basic", basic->get()));
+}
+
 }  // namespace
 }  // namespace rtype::games::rtype::server
@@ -0,0 +1,150 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InputJitterBuffer - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+
+#include "protocol/Payloads.hpp"
+#include "server/serverApp/player/playerInputHandler/InputJitterBuffer.hpp"
+
+using rtype::network::InputFrame;
+using rtype::server::InputJitterBuffer;
+namespace InputMask = rtype::network::InputMask;
+
+namespace {
+
+/// Mask a test client holds on a tick
+std::uint16_t maskAt(std::uint32_t tick) {
+    return static_cast<std::uint16_t>(tick % 16);
+}
+
+/// Push the last `redundancy` frames ending at tick, like one C_INPUT
+void receive(InputJitterBuffer& buffer, std::uint32_t tick,
+             std::uint32_t redundancy) {
+    for (std::uint32_t t = (tick > redundancy ? tick - redundancy + 1 : 1);
+         t <= tick; ++t) {
+        buffer.push({t, maskAt(t)});
+    }
+}
+
+}  // namespace
+
+TEST(InputJitterBufferTest, StartsAfterDelayAndPlaysInOrder) {
+    InputJitterBuffer buffer;  // 2 ticks of delay
+
+    buffer.push({1, InputMask::kUp});
+    EXPECT_FALSE(buffer.pop().has_value());
+    buffer.push({2, InputMask::kUp});
+    EXPECT_FALSE(buffer.pop().has_value());
+    buffer.push({3, InputMask::kDown});
+
+    auto frame = buffer.pop();
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->tick, 1u);
+    EXPECT_EQ(frame->inputMask, InputMask::kUp);
+    EXPECT_EQ(buffer.pop()->tick, 2u);
+    EXPECT_EQ(buffer.pop()->inputMask, InputMask::kDown);
+    EXPECT_FALSE(buffer.pop().has_value());
+    EXPECT_EQ(buffer.lastTick(), 3u);
+}
+
+TEST(InputJitterBufferTest, RedundantCopiesAreDropped) {
+    InputJitterBuffer buffer;
+    for (std::uint32_t tick = 1; tick <= 5; ++tick) {
+        receive(buffer, tick, 4);
+    }
+    EXPECT_EQ(buffer.size(), 5u);
+    EXPECT_EQ(buffer.duplicates(), 1u + 2u + 3u + 3u);
+
+    ASSERT_TRUE(buffer.pop().has_value());
+    EXPECT_FALSE(buffer.push({1, 0}));  // Already played
+    EXPECT_FALSE(buffer.push({0, 0}));
+}
+
+TEST(InputJitterBufferTest, LostPacketIsCoveredByTheNextOne) {
+    InputJitterBuffer buffer;
+    receive(buffer, 3, 4);
+    EXPECT_EQ(buffer.pop()->tick, 1u);
+
+    // Packet of tick 4 lost, tick 5 repeats it
+    EXPECT_EQ(buffer.pop()->tick, 2u);
+    receive(buffer, 5, 4);
+    EXPECT_EQ(buffer.pop()->tick, 3u);
+    EXPECT_EQ(buffer.pop()->tick, 4u);
+    EXPECT_EQ(buffer.pop()->tick, 5u);
+    EXPECT_EQ(buffer.skipped(), 0u);
+}
+
+TEST(InputJitterBufferTest, MissingTickIsSkippedPastTheDelay) {
+    InputJitterBuffer buffer;
+    receive(buffer, 3, 3);
+    EXPECT_EQ(buffer.pop()->tick, 1u);
+    EXPECT_EQ(buffer.pop()->tick, 2u);
+    EXPECT_EQ(buffer.pop()->tick, 3u);
+
+    // Tick 4 never arrives: wait while it could still be repeated
+    buffer.push({5, InputMask::kLeft});
+    EXPECT_FALSE(buffer.pop().has_value());
+    buffer.push({6, InputMask::kLeft});
+    auto frame = buffer.pop();
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->tick, 5u);
+    EXPECT_EQ(buffer.skipped(), 1u);
+}
+
+TEST(InputJitterBufferTest, CatchesUpAndKeepsSkippedPresses) {
+    InputJitterBuffer buffer;
+    receive(buffer, 3, 3);
+    EXPECT_EQ(buffer.pop()->tick, 1u);
+
+    // A burst far ahead of playback, with a force pod tap in it
+    for (std::uint32_t tick = 4; tick <= 20; ++tick) {
+        buffer.push({tick, tick == 6 ? InputMask::kForcePod : InputMask::kUp});
+    }
+    auto frame = buffer.pop();
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->tick, 18u);
+    EXPECT_EQ(frame->inputMask, InputMask::kUp | InputMask::kForcePod);
+    EXPECT_EQ(buffer.skipped(), 16u);
+    EXPECT_EQ(buffer.pop()->inputMask, InputMask::kUp);
+}
+
+TEST(InputJitterBufferTest, CapacityIsBounded) {
+    InputJitterBuffer buffer;
+    for (std::uint32_t tick = 1; tick <= 100; ++tick) {
+        buffer.push({tick, 0});
+    }
+    EXPECT_EQ(buffer.size(), InputJitterBuffer::kCapacity);
+    EXPECT_EQ(buffer.pop()->tick, 98u);
+}
+
+TEST(InputJitterBufferTest, EveryTickPlaysOnceAtFivePercentLoss) {
+    InputJitterBuffer buffer;
+    std::mt19937 rng(1234);
+    std::bernoulli_distribution lost(0.05);
+
+    std::uint32_t expected = 1;
+    std::uint32_t played = 0;
+    for (std::uint32_t tick = 1; tick <= 5000; ++tick) {
+        if (!lost(rng)) {
+            receive(buffer, tick, 6);
+        }
+        if (auto frame = buffer.pop()) {
+            EXPECT_EQ(frame->tick, expected);
+            EXPECT_EQ(frame->inputMask, maskAt(expected));
+            ++expected;
+            ++played;
+        }
+    }
+    EXPECT_EQ(buffer.skipped(), 0u);
+    EXPECT_GE(played, 5000u - 10u);
+    // Playback stays close to the newest tick
+    EXPECT_LE(5000u - *buffer.lastTick(), buffer.config().maxLagTicks);
+}
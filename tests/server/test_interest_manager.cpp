@@ -0,0 +1,171 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** InterestManager - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "server/network/InterestManager.hpp"
+
+using rtype::server::InterestManager;
+using EntityType = InterestManager::EntityType;
+
+namespace {
+
+InterestManager::Candidate makeCandidate(std::uint32_t id, EntityType type,
+                                         float x = 0.0F, float y = 0.0F) {
+    InterestManager::Candidate candidate;
+    candidate.networkId = id;
+    candidate.type = type;
+    candidate.x = x;
+    candidate.y = y;
+    candidate.changed = true;
+    return candidate;
+}
+
+std::vector<std::uint32_t> sentIds(
+    const std::vector<InterestManager::Candidate>& candidates,
+    const std::vector<std::size_t>& selected) {
+    std::vector<std::uint32_t> ids;
+    for (std::size_t index : selected) {
+        ids.push_back(candidates[index].networkId);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+}  // namespace
+
+TEST(InterestManagerTest, TypeWeightsOrdered) {
+    EXPECT_GT(InterestManager::typeWeight(EntityType::Player),
+              InterestManager::typeWeight(EntityType::Boss));
+    EXPECT_GT(InterestManager::typeWeight(EntityType::Boss),
+              InterestManager::typeWeight(EntityType::Bydos));
+    EXPECT_GT(InterestManager::typeWeight(EntityType::Bydos),
+              InterestManager::typeWeight(EntityType::Missile));
+}
+
+TEST(InterestManagerTest, BudgetAccountsForHeaders) {
+    EXPECT_EQ(InterestManager::entriesForBudget(0), 0u);
+    EXPECT_EQ(InterestManager::entriesForBudget(21), 0u);
+    EXPECT_EQ(InterestManager::entriesForBudget(33), 1u);
+    EXPECT_EQ(InterestManager::entriesForBudget(
+                  InterestManager::kDefaultByteBudget),
+              rtype::network::kMaxEntitiesPerBatch);
+    // A second datagram pays its own headers
+    EXPECT_EQ(InterestManager::entriesForBudget(1389 + 21 + 24),
+              rtype::network::kMaxEntitiesPerBatch + 2);
+}
+
+TEST(InterestManagerTest, PlayerSentEveryTickEnemyLess) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates = {
+        makeCandidate(1, EntityType::Player),
+        makeCandidate(2, EntityType::Bydos)};
+    std::vector<std::size_t> selected;
+
+    int playerSends = 0;
+    int enemySends = 0;
+    for (int tick = 0; tick < 8; ++tick) {
+        interest.select(7, std::make_pair(0.0F, 0.0F),
+                        InterestManager::kDefaultByteBudget, candidates,
+                        selected);
+        for (auto id : sentIds(candidates, selected)) {
+            (id == 1 ? playerSends : enemySends)++;
+        }
+    }
+    EXPECT_EQ(playerSends, 8);
+    EXPECT_EQ(enemySends, 2);
+}
+
+TEST(InterestManagerTest, UnchangedEntitiesStaySilent) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates = {
+        makeCandidate(1, EntityType::Player)};
+    std::vector<std::size_t> selected;
+
+    interest.select(7, std::nullopt, InterestManager::kDefaultByteBudget,
+                    candidates, selected);
+    EXPECT_EQ(selected.size(), 1u);
+
+    candidates[0].changed = false;
+    interest.select(7, std::nullopt, InterestManager::kDefaultByteBudget,
+                    candidates, selected);
+    EXPECT_TRUE(selected.empty());
+}
+
+TEST(InterestManagerTest, NearEntitiesWinOverFarOnes) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates = {
+        makeCandidate(1, EntityType::Bydos, 50.0F, 0.0F),
+        makeCandidate(2, EntityType::Bydos, 1800.0F, 0.0F)};
+    std::vector<std::size_t> selected;
+
+    interest.select(7, std::make_pair(0.0F, 0.0F),
+                    InterestManager::kDefaultByteBudget, candidates, selected);
+    EXPECT_GT(interest.priority(7, 1), interest.priority(7, 2));
+}
+
+TEST(InterestManagerTest, VelocityChangeMakesEntityDue) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates = {
+        makeCandidate(1, EntityType::Missile)};
+    candidates[0].vx = InterestManager::kVelocityChangeScale;
+    std::vector<std::size_t> selected;
+
+    interest.select(7, std::nullopt, InterestManager::kDefaultByteBudget,
+                    candidates, selected);
+    EXPECT_EQ(selected.size(), 1u);
+}
+
+TEST(InterestManagerTest, OverflowIsDelayedNotDropped) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates;
+    for (std::uint32_t id = 1; id <= 6; ++id) {
+        candidates.push_back(makeCandidate(id, EntityType::Player));
+    }
+    std::vector<std::size_t> selected;
+    std::vector<std::uint32_t> seen;
+
+    // Room for two entries per tick
+    const std::size_t budget = 21 + 2 * 12;
+    for (int tick = 0; tick < 3; ++tick) {
+        interest.select(7, std::nullopt, budget, candidates, selected);
+        EXPECT_EQ(selected.size(), 2u);
+        for (auto id : sentIds(candidates, selected)) {
+            seen.push_back(id);
+        }
+        for (auto& candidate : candidates) {
+            candidate.changed = false;
+        }
+    }
+    std::sort(seen.begin(), seen.end());
+    EXPECT_EQ(seen, (std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(InterestManagerTest, ClientsHaveIndependentState) {
+    InterestManager interest;
+    std::vector<InterestManager::Candidate> candidates = {
+        makeCandidate(1, EntityType::Bydos)};
+    std::vector<std::size_t> selected;
+
+    interest.select(1, std::nullopt, InterestManager::kDefaultByteBudget,
+                    candidates, selected);
+    EXPECT_EQ(interest.clientCount(), 1u);
+    EXPECT_FLOAT_EQ(interest.priority(1, 1), 0.25F);
+    EXPECT_FLOAT_EQ(interest.priority(2, 1), 0.0F);
+
+    interest.removeEntity(1);
+    EXPECT_FLOAT_EQ(interest.priority(1, 1), 0.0F);
+    interest.removeClient(1);
+    EXPECT_EQ(interest.clientCount(), 0u);
+}
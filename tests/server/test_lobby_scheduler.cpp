@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** LobbyScheduler - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "server/lobby/LobbyScheduler.hpp"
+
+using rtype::server::LobbyScheduler;
+using namespace std::chrono_literals;
+
+TEST(LobbySchedulerTest, ZeroWorkersUsesAtLeastOne) {
+    LobbyScheduler scheduler(0);
+    EXPECT_GE(scheduler.workerCount(), 1u);
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(LobbySchedulerTest, StepsUntilTaskFinishes) {
+    LobbyScheduler scheduler(2);
+    std::atomic<int> steps{0};
+
+    auto id = scheduler.add(
+        [&steps]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            if (steps.fetch_add(1) + 1 >= 5) {
+                return std::nullopt;
+            }
+            return LobbyScheduler::Clock::now() + 1ms;
+        });
+    scheduler.wait(id);
+
+    EXPECT_EQ(steps.load(), 5);
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(LobbySchedulerTest, HonoursDueTime) {
+    LobbyScheduler scheduler(1);
+    std::vector<LobbyScheduler::Clock::time_point> stamps;
+
+    auto id = scheduler.add(
+        [&stamps]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            stamps.push_back(LobbyScheduler::Clock::now());
+            if (stamps.size() == 2) {
+                return std::nullopt;
+            }
+            return stamps.back() + 20ms;
+        });
+    scheduler.wait(id);
+
+    ASSERT_EQ(stamps.size(), 2u);
+    EXPECT_GE(stamps[1] - stamps[0], 20ms);
+}
+
+TEST(LobbySchedulerTest, TaskNeverSteppedConcurrently) {
+    LobbyScheduler scheduler(4);
+    std::atomic<int> inside{0};
+    std::atomic<bool> overlap{false};
+    std::atomic<int> steps{0};
+
+    auto id = scheduler.add(
+        [&]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            if (inside.fetch_add(1) != 0) {
+                overlap = true;
+            }
+            std::this_thread::sleep_for(100us);
+            inside.fetch_sub(1);
+            if (steps.fetch_add(1) + 1 >= 50) {
+                return std::nullopt;
+            }
+            // Already due: every idle worker races for it
+            return LobbyScheduler::Clock::now();
+        });
+    scheduler.wait(id);
+
+    EXPECT_FALSE(overlap.load());
+    EXPECT_EQ(steps.load(), 50);
+}
+
+TEST(LobbySchedulerTest, MoreTasksThanWorkers) {
+    LobbyScheduler scheduler(2);
+    constexpr int kTasks = 8;
+    constexpr int kSteps = 10;
+    std::vector<std::atomic<int>> steps(kTasks);
+    std::vector<LobbyScheduler::TaskId> ids;
+
+    for (int i = 0; i < kTasks; ++i) {
+        ids.push_back(scheduler.add(
+            [&counter = steps[i]]()
+                -> std::optional<LobbyScheduler::Clock::time_point> {
+                if (counter.fetch_add(1) + 1 >= kSteps) {
+                    return std::nullopt;
+                }
+                return LobbyScheduler::Clock::now() + 1ms;
+            }));
+    }
+    for (auto id : ids) {
+        scheduler.wait(id);
+    }
+
+    for (const auto& counter : steps) {
+        EXPECT_EQ(counter.load(), kSteps);
+    }
+}
+
+TEST(LobbySchedulerTest, ThrowingTaskIsRemoved) {
+    LobbyScheduler scheduler(1);
+
+    auto id = scheduler.add(
+        []() -> std::optional<LobbyScheduler::Clock::time_point> {
+            throw std::runtime_error("boom");
+        });
+    scheduler.wait(id);
+
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(LobbySchedulerTest, StopDropsUnfinishedTasks) {
+    LobbyScheduler scheduler(2);
+    std::atomic<int> steps{0};
+
+    auto id = scheduler.add(
+        [&steps]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            steps.fetch_add(1);
+            return LobbyScheduler::Clock::now() + 1h;
+        });
+    while (steps.load() == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    scheduler.stop();
+    scheduler.wait(id);  // Returns right away once stopped
+
+    EXPECT_EQ(steps.load(), 1);
+    EXPECT_EQ(scheduler.taskCount(), 0u);
+}
+
+TEST(LobbySchedulerTest, WakeRunsFarTaskEarly) {
+    LobbyScheduler scheduler(1);
+    std::atomic<int> steps{0};
+
+    auto id = scheduler.add(
+        [&steps]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            if (steps.fetch_add(1) + 1 >= 2) {
+                return std::nullopt;
+            }
+            return LobbyScheduler::Clock::now() + 10s;
+        });
+    while (steps.load() < 1) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    const auto start = LobbyScheduler::Clock::now();
+    scheduler.wake(id);
+    scheduler.wait(id);
+
+    EXPECT_EQ(steps.load(), 2);
+    EXPECT_LT(LobbyScheduler::Clock::now() - start, 1s);
+}
+
+TEST(LobbySchedulerTest, WakeWhileSteppingReschedulesRightAway) {
+    LobbyScheduler scheduler(2);
+    std::atomic<int> steps{0};
+    std::atomic<LobbyScheduler::TaskId> self{0};
+
+    auto id = scheduler.add(
+        [&]() -> std::optional<LobbyScheduler::Clock::time_point> {
+            if (steps.fetch_add(1) + 1 >= 2) {
+                return std::nullopt;
+            }
+            while (self.load() == 0) {
+                std::this_thread::yield();
+            }
+            scheduler.wake(self.load());
+            return LobbyScheduler::Clock::now() + 10s;
+        });
+    self = id;
+
+    const auto start = LobbyScheduler::Clock::now();
+    scheduler.wait(id);
+
+    EXPECT_EQ(steps.load(), 2);
+    EXPECT_LT(LobbyScheduler::Clock::now() - start, 1s);
+}
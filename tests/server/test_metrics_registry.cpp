@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** MetricsRegistry - Unit Tests
+*/
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "server/shared/MetricsRegistry.hpp"
+#include "server/shared/ServerMetrics.hpp"
+
+using rtype::HdrHistogram;
+using rtype::ShardedCounter;
+using rtype::server::MetricsRegistry;
+using rtype::server::ServerMetrics;
+
+static bool contains(const std::string& text, const std::string& line) {
+    return text.find(line) != std::string::npos;
+}
+
+TEST(MetricsRegistryTest, RendersCounterWithHelpTypeAndLabels) {
+    MetricsRegistry registry;
+    auto counter = std::make_shared<ShardedCounter>();
+    counter->fetch_add(42);
+    ASSERT_TRUE(registry.addCounter("rtype_test_total", "A test counter",
+                                    {{"lobby", "AB\"C"}}, counter));
+
+    const std::string text = registry.renderPrometheus();
+    EXPECT_TRUE(contains(text, "# HELP rtype_test_total A test counter\n"));
+    EXPECT_TRUE(contains(text, "# TYPE rtype_test_total counter\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_total{lobby=\"AB\\\"C\"} 42\n"));
+}
+
+TEST(MetricsRegistryTest, RendersCumulativeHistogramBuckets) {
+    MetricsRegistry registry;
+    auto histogram = std::make_shared<HdrHistogram>();
+    histogram->record(3);
+    histogram->record(5);
+    histogram->record(100);
+    ASSERT_TRUE(registry.addHistogram("rtype_test", "A test histogram", {},
+                                      histogram, {2, 4, 1}));
+
+    const std::string text = registry.renderPrometheus();
+    EXPECT_TRUE(contains(text, "# TYPE rtype_test histogram\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_bucket{le=\"4\"} 1\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_bucket{le=\"8\"} 2\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_bucket{le=\"16\"} 2\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_bucket{le=\"+Inf\"} 3\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_sum 108\n"));
+    EXPECT_TRUE(contains(text, "rtype_test_count 3\n"));
+}
+
+TEST(MetricsRegistryTest, RejectsTypeMismatch) {
+    MetricsRegistry registry;
+    auto counter = std::make_shared<ShardedCounter>();
+    auto histogram = std::make_shared<HdrHistogram>();
+    ASSERT_TRUE(registry.addCounter("rtype_test", "help", {}, counter));
+    EXPECT_FALSE(
+        registry.addHistogram("rtype_test", "help", {}, histogram, {}));
+    EXPECT_EQ(registry.seriesCount(), 1u);
+}
+
+TEST(MetricsRegistryTest, SeriesExpireWithTheirOwner) {
+    MetricsRegistry registry;
+    auto metrics = std::make_shared<ServerMetrics>();
+    rtype::server::registerServerMetrics(registry, metrics, "LOBBY1");
+    metrics->packetsSent.fetch_add(7);
+    metrics->rtt.record(20'000'000);
+
+    const std::string text = registry.renderPrometheus();
+    EXPECT_TRUE(
+        contains(text, "rtype_packets_sent_total{lobby=\"LOBBY1\"} 7\n"));
+    EXPECT_TRUE(contains(text, "rtype_rtt_seconds_count{lobby=\"LOBBY1\"} 1"));
+    EXPECT_TRUE(contains(text, "rtype_packet_size_bytes_bucket{lobby="
+                               "\"LOBBY1\",direction=\"out\",le=\"8\"} 0\n"));
+    EXPECT_GT(registry.seriesCount(), 0u);
+
+    metrics.reset();
+    EXPECT_EQ(registry.seriesCount(), 0u);
+    EXPECT_TRUE(registry.renderPrometheus().empty());
+}
@@ -16,6 +16,7 @@
 #include "../../src/server/serverApp/game/gameStateManager/GameStateManager.hpp"
 #include "../../src/server/serverApp/player/playerInputHandler/PlayerInputHandler.hpp"
 #include "games/rtype/shared/Components/CooldownComponent.hpp"
+#include "games/rtype/shared/Components/PowerUpComponent.hpp"
 #include "games/rtype/shared/Components/TransformComponent.hpp"
 #include "games/rtype/shared/Components/VelocityComponent.hpp"
 
@@ -514,6 +515,29 @@ TEST_F(PlayerInputHandlerTest, SetPlayerSpeed) {
     EXPECT_FLOAT_EQ(vel.vy, -500.0f);
 }
 
+TEST_F(PlayerInputHandlerTest, SpeedModifierAppliedAndReported) {
+    PlayerInputHandler handler(registry_, networkSystem_, stateManager_);
+    handler.setPlayerSpeed(200.0f);
+    EXPECT_FLOAT_EQ(networkSystem_->playerMoveSpeed(1), 200.0f);
+
+    stateManager_->forceStart();
+
+    using Position = rtype::games::rtype::shared::TransformComponent;
+    using Velocity = rtype::games::rtype::shared::VelocityComponent;
+    using ActivePowerUp = rtype::games::rtype::shared::ActivePowerUpComponent;
+
+    ECS::Entity entity = registry_->spawnEntity();
+    registry_->emplaceComponent<Position>(entity, 100.0f, 100.0f);
+    registry_->emplaceComponent<Velocity>(entity, 0.0f, 0.0f);
+    registry_->emplaceComponent<ActivePowerUp>(entity).speedMultiplier = 1.5f;
+
+    handler.handleInput(1, rtype::network::InputMask::kRight, entity);
+
+    // The client predicts with the speed the server just applied
+    EXPECT_FLOAT_EQ(registry_->getComponent<Velocity>(entity).vx, 300.0f);
+    EXPECT_FLOAT_EQ(networkSystem_->playerMoveSpeed(1), 300.0f);
+}
+
 // ============================================================================
 // VERBOSE MODE TESTS
 // ============================================================================
@@ -555,3 +579,72 @@ TEST_F(PlayerInputHandlerTest, HandleInput_NullStateManager) {
         handler.handleInput(1, rtype::network::InputMask::kUp, entity);
     });
 }
+
+// ============================================================================
+// BUFFERED INPUT FRAMES TESTS
+// ============================================================================
+
+TEST_F(PlayerInputHandlerTest, InputFrames_OneFramePerTickAfterDelay) {
+    PlayerInputHandler handler(registry_, networkSystem_, stateManager_);
+    stateManager_->forceStart();
+
+    using Position = rtype::games::rtype::shared::TransformComponent;
+    using Velocity = rtype::games::rtype::shared::VelocityComponent;
+
+    ECS::Entity entity = registry_->spawnEntity();
+    registry_->emplaceComponent<Position>(entity, 100.0f, 100.0f);
+    registry_->emplaceComponent<Velocity>(entity, 0.0f, 0.0f);
+    networkSystem_->setPlayerEntity(7, entity);
+
+    // Newest first, as decoded; the oldest two repeat nothing new later
+    handler.queueInputFrames(7, {{3, rtype::network::InputMask::kRight},
+                                 {2, rtype::network::InputMask::kUp},
+                                 {1, rtype::network::InputMask::kUp}});
+    handler.queueInputFrames(7, {{3, rtype::network::InputMask::kRight},
+                                 {2, rtype::network::InputMask::kUp}});
+
+    auto& vel = registry_->getComponent<Velocity>(entity);
+    handler.consumeBufferedInputs();
+    EXPECT_LT(vel.vy, 0.0f);
+    handler.consumeBufferedInputs();
+    EXPECT_LT(vel.vy, 0.0f);
+    handler.consumeBufferedInputs();
+    EXPECT_FLOAT_EQ(vel.vy, 0.0f);
+    EXPECT_GT(vel.vx, 0.0f);
+
+    // Starved: the last input stays applied
+    handler.consumeBufferedInputs();
+    EXPECT_GT(vel.vx, 0.0f);
+
+    const auto* buffer = handler.getJitterBuffer(7);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->lastTick(), 3u);
+    EXPECT_EQ(buffer->duplicates(), 2u);
+
+    handler.removePlayer(7);
+    EXPECT_EQ(handler.getJitterBuffer(7), nullptr);
+}
+
+TEST_F(PlayerInputHandlerTest, InputFrames_AppliedAtOnceWhenNotPlaying) {
+    PlayerInputHandler handler(registry_, networkSystem_, stateManager_);
+
+    handler.queueInputFrames(3, {{5, rtype::network::InputMask::kShoot}});
+    EXPECT_TRUE(stateManager_->isPlayerReady(3));
+    EXPECT_EQ(handler.getJitterBuffer(3), nullptr);
+}
+
+TEST_F(PlayerInputHandlerTest, ForcePod_LaunchesOnPressOnly) {
+    PlayerInputHandler handler(registry_, networkSystem_, stateManager_);
+    stateManager_->forceStart();
+
+    int launches = 0;
+    handler.setForcePodLaunchCallback([&](std::uint32_t) { ++launches; });
+
+    ECS::Entity entity = registry_->spawnEntity();
+    for (int tick = 0; tick < 5; ++tick) {
+        handler.handleInput(1, rtype::network::InputMask::kForcePod, entity);
+    }
+    handler.handleInput(1, rtype::network::InputMask::kNone, entity);
+    handler.handleInput(1, rtype::network::InputMask::kForcePod, entity);
+    EXPECT_EQ(launches, 2);
+}
@@ -7,8 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 #include "games/rtype/server/Systems/WaveManager/WaveManager.hpp"
 #include "games/rtype/shared/Config/EntityConfig/EntityConfig.hpp"
@@ -925,5 +927,321 @@ TEST_F(WaveManagerTest, GettersWithoutLoadedLevel) {
     EXPECT_FALSE(manager.getBossId().has_value());
 }
 
+// =============================================================================
+// WaveTimeline Tests
+// =============================================================================
+
+shared::LevelConfig makeTimelineLevel() {
+    shared::LevelConfig level;
+    level.id = "timeline";
+    level.name = "Timeline Level";
+    level.backgroundPath = "bg.png";
+    level.levelMusic = "music.ogg";
+    level.scrollSpeed = 75.0F;
+    level.bossId = "boss_1";
+
+    shared::WaveConfig first;
+    first.waveNumber = 1;
+    first.spawnDelay = 1.0F;
+    first.spawns.push_back({"shooter", 700.0F, std::nullopt, 0.5F, 2});
+    first.spawns.push_back({"basic", std::nullopt, 200.0F, 0.0F, 3});
+    first.powerups.push_back({"health_small", 400.0F, 300.0F, 2.0F});
+
+    shared::WaveConfig second;
+    second.waveNumber = 2;
+    second.spawns.push_back({"basic", 800.0F, 100.0F, 0.0F, 1});
+    second.spawns.push_back({"shooter", 800.0F, 100.0F, 1.0F, 0});
+
+    level.waves = {first, second};
+    return level;
+}
+
+TEST(WaveTimelineTest, CompileExpandsAndSortsSpawns) {
+    auto timeline = WaveTimeline::compile(makeTimelineLevel());
+
+    ASSERT_EQ(timeline.waveCount(), 2);
+    ASSERT_EQ(timeline.enemyIds.size(), 2);
+    EXPECT_EQ(timeline.enemyIds[0], "shooter");
+    EXPECT_EQ(timeline.enemyIds[1], "basic");
+
+    auto wave1 = timeline.enemies(0);
+    ASSERT_EQ(wave1.size(), 5);
+    const float expectedTimes[] = {0.0F, 0.5F, 1.0F, 1.5F, 2.0F};
+    const uint32_t expectedIds[] = {1, 0, 1, 0, 1};
+    for (std::size_t i = 0; i < wave1.size(); ++i) {
+        EXPECT_FLOAT_EQ(wave1[i].time, expectedTimes[i]);
+        EXPECT_EQ(wave1[i].id, expectedIds[i]);
+    }
+    EXPECT_FALSE(wave1[0].fixedX().has_value());
+    EXPECT_FLOAT_EQ(*wave1[0].fixedY(), 200.0F);
+    EXPECT_FLOAT_EQ(*wave1[1].fixedX(), 700.0F);
+
+    // count = 0 entries produce no events
+    EXPECT_EQ(timeline.enemies(1).size(), 1);
+    EXPECT_EQ(timeline.powerUps(0).size(), 1);
+    EXPECT_TRUE(timeline.powerUps(1).empty());
+    EXPECT_TRUE(timeline.enemies(2).empty());
+}
+
+TEST(WaveTimelineTest, SerializeRoundTrip) {
+    auto timeline = WaveTimeline::compile(makeTimelineLevel());
+    const uint64_t hash = WaveTimeline::hashSource("level source");
+
+    auto restored = WaveTimeline::deserialize(timeline.serialize(hash), hash);
+
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->id, timeline.id);
+    EXPECT_EQ(restored->name, timeline.name);
+    EXPECT_EQ(restored->levelMusic, timeline.levelMusic);
+    EXPECT_FLOAT_EQ(restored->scrollSpeed, 75.0F);
+    EXPECT_EQ(restored->bossId, timeline.bossId);
+    EXPECT_FALSE(restored->nextLevel.has_value());
+    EXPECT_EQ(restored->enemyIds, timeline.enemyIds);
+    EXPECT_EQ(restored->powerUpIds, timeline.powerUpIds);
+    EXPECT_EQ(restored->enemyWaveStart, timeline.enemyWaveStart);
+    ASSERT_EQ(restored->enemyEvents.size(), timeline.enemyEvents.size());
+    for (std::size_t i = 0; i < timeline.enemyEvents.size(); ++i) {
+        EXPECT_FLOAT_EQ(restored->enemyEvents[i].time,
+                        timeline.enemyEvents[i].time);
+        EXPECT_EQ(restored->enemyEvents[i].id, timeline.enemyEvents[i].id);
+        EXPECT_EQ(restored->enemyEvents[i].flags,
+                  timeline.enemyEvents[i].flags);
+    }
+}
+
+TEST(WaveTimelineTest, DeserializeRejectsStaleOrCorruptData) {
+    auto timeline = WaveTimeline::compile(makeTimelineLevel());
+    const uint64_t hash = WaveTimeline::hashSource("level source");
+    auto image = timeline.serialize(hash);
+
+    EXPECT_FALSE(WaveTimeline::deserialize(
+                     image, WaveTimeline::hashSource("edited source"))
+                     .has_value());
+
+    auto truncated = image;
+    truncated.resize(image.size() / 2);
+    EXPECT_FALSE(WaveTimeline::deserialize(truncated, hash).has_value());
+
+    EXPECT_FALSE(WaveTimeline::deserialize({}, hash).has_value());
+}
+
+TEST_F(WaveManagerTest, UpdateAppendsDueSpawnsToBuffer) {
+    createTestLevel("buffered.toml", R"(
+[level]
+id = "buffered"
+name = "Buffered"
+background = "test.png"
+scroll_speed = 50.0
+
+[[wave]]
+number = 1
+spawn_delay = 0.5
+
+[[wave.spawn]]
+enemy = "basic"
+delay = 0.0
+count = 4
+)");
+
+    WaveManager manager;
+    ASSERT_TRUE(manager.loadLevel("buffered"));
+    manager.start();
+
+    std::vector<SpawnRequest> buffer(1);
+    manager.update(1.0F, 0, buffer);
+    // Spawns due at 0.0, 0.5 and 1.0 are all emitted, after existing entries
+    ASSERT_EQ(buffer.size(), 4);
+    EXPECT_EQ(buffer[1].enemyId, "basic");
+    ASSERT_NE(buffer[1].enemy, nullptr);
+    EXPECT_EQ(buffer[1].enemy->id, "basic");
+
+    buffer.clear();
+    manager.update(0.4F, 0, buffer);
+    EXPECT_TRUE(buffer.empty());
+    manager.update(0.1F, 0, buffer);
+    EXPECT_EQ(buffer.size(), 1);
+}
+
+TEST_F(WaveManagerTest, LoadLevelFromFileCachesCompiledTimeline) {
+    const auto levelPath = _testDir / "levels" / "cached.toml";
+    const auto cachePath = _testDir / "levels" / "cached.timeline";
+    {
+        std::ofstream file(levelPath);
+        file << R"(
+[level]
+id = "cached"
+name = "Cached Level"
+background = "test.png"
+scroll_speed = 50.0
+
+[[wave]]
+number = 1
+spawn_delay = 0.0
+
+[[wave.spawn]]
+enemy = "basic"
+x = 800.0
+y = 300.0
+delay = 0.0
+count = 2
+)";
+    }
+
+    WaveManager first;
+    ASSERT_TRUE(first.loadLevelFromFile(levelPath.string()));
+    ASSERT_TRUE(std::filesystem::exists(cachePath));
+
+    // A fresh registry proves the second load does not parse the TOML
+    auto& registry = shared::EntityConfigRegistry::getInstance();
+    registry.clear();
+    registry.loadEnemies((_testDir / "enemies.toml").string());
+
+    WaveManager second;
+    ASSERT_TRUE(second.loadLevelFromFile(levelPath.string()));
+    EXPECT_FALSE(registry.getLevel("cached").has_value());
+    EXPECT_EQ(second.getLevelName(), "Cached Level");
+    EXPECT_EQ(second.getTotalWaves(), 1);
+
+    second.start();
+    auto spawns = second.update(0.1F, 0);
+    ASSERT_EQ(spawns.size(), 2);
+    EXPECT_EQ(spawns[0].enemyId, "basic");
+    EXPECT_FLOAT_EQ(*spawns[0].x, 800.0F);
+
+    // Editing the TOML invalidates the cache
+    {
+        std::ofstream file(levelPath, std::ios::app);
+        file << "\n# edited\n";
+    }
+    WaveManager third;
+    ASSERT_TRUE(third.loadLevelFromFile(levelPath.string()));
+    EXPECT_TRUE(registry.getLevel("cached").has_value());
+}
+
+TEST_F(WaveManagerTest, UnwritableTimelineCacheStillLoads) {
+    const auto levelPath = _testDir / "levels" / "readonly.toml";
+    {
+        std::ofstream file(levelPath);
+        file << R"(
+[level]
+id = "readonly"
+name = "Read Only"
+background = "test.png"
+scroll_speed = 50.0
+
+[[wave]]
+number = 1
+spawn_delay = 0.0
+
+[[wave.spawn]]
+enemy = "basic"
+delay = 0.0
+count = 1
+)";
+    }
+    // A non-empty directory where the cache should go makes the rename fail
+    const auto cachePath = _testDir / "levels" / "readonly.timeline";
+    std::filesystem::create_directories(cachePath / "blocker");
+
+    WaveManager first;
+    ASSERT_TRUE(first.loadLevelFromFile(levelPath.string()));
+    WaveManager second;
+    ASSERT_TRUE(second.loadLevelFromFile(levelPath.string()));
+    EXPECT_EQ(second.getTotalWaves(), 1);
+
+    EXPECT_TRUE(std::filesystem::is_directory(cachePath));
+    for (const auto& entry :
+         std::filesystem::directory_iterator(_testDir / "levels")) {
+        EXPECT_EQ(entry.path().string().find(".tmp"), std::string::npos)
+            << entry.path();
+    }
+}
+
+TEST_F(WaveManagerTest, ConfigReloadRebindsCachedConfigs) {
+    createTestLevel("reload.toml", R"(
+[level]
+id = "reload"
+name = "Reload"
+background = "test.png"
+scroll_speed = 50.0
+
+[[wave]]
+number = 1
+spawn_delay = 1.0
+
+[[wave.spawn]]
+enemy = "basic"
+delay = 0.0
+count = 2
+
+[[wave.spawn]]
+enemy = "shooter"
+delay = 0.0
+count = 2
+)");
+
+    WaveManager manager;
+    ASSERT_TRUE(manager.loadLevel("reload"));
+    manager.start();
+    ASSERT_EQ(manager.update(0.1F, 0).size(), 2);
+
+    // Same reload sequence as RTypeGameConfig::reloadConfiguration(), with
+    // the shooter gone and the basic enemy retuned
+    auto& registry = shared::EntityConfigRegistry::getInstance();
+    registry.clear();
+    {
+        std::ofstream enemiesFile(_testDir / "enemies.toml");
+        enemiesFile << R"(
+[[enemy]]
+id = "basic"
+name = "Basic Enemy"
+sprite_sheet = "assets/sprites/enemies/basic.png"
+health = 75
+damage = 10
+score_value = 100
+behavior = "move_left"
+speed = 100.0
+hitbox_width = 32.0
+hitbox_height = 32.0
+can_shoot = false
+)";
+    }
+    registry.loadEnemies((_testDir / "enemies.toml").string());
+
+    auto spawns = manager.update(1.0F, 0);
+    ASSERT_EQ(spawns.size(), 1);
+    EXPECT_EQ(spawns[0].enemyId, "basic");
+    auto basic = registry.getEnemy("basic");
+    ASSERT_TRUE(basic.has_value());
+    EXPECT_EQ(spawns[0].enemy, &basic->get());
+    EXPECT_EQ(spawns[0].enemy->health, 75);
+}
+
+TEST_F(WaveManagerTest, LoadingALevelKeepsTheConfigGeneration) {
+    auto& registry = shared::EntityConfigRegistry::getInstance();
+    const std::uint64_t before = registry.generation();
+
+    createTestLevel("other_lobby.toml", R"(
+[level]
+id = "other_lobby"
+name = "Other Lobby"
+background = "test.png"
+scroll_speed = 50.0
+
+[[wave]]
+number = 1
+spawn_delay = 1.0
+
+[[wave.spawn]]
+enemy = "basic"
+delay = 0.0
+count = 1
+)");
+
+    EXPECT_EQ(registry.generation(), before);
+    registry.loadEnemies((_testDir / "enemies.toml").string());
+    EXPECT_GT(registry.generation(), before);
+}
+
 }  // namespace
 }  // namespace rtype::games::rtype::server
@@ -0,0 +1,174 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** queue_benchmark - SafeQueue vs lock-free SPSC/MPSC under contention
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "LockFreeQueue/MpscQueue.hpp"
+#include "LockFreeQueue/SpscQueue.hpp"
+#include "SafeQueue/SafeQueue.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kCapacity = 4096;
+constexpr std::size_t kBatch = 64;
+
+/// Payload roughly the size of a queued (endpoint, packet) handoff
+struct Item {
+    std::uint64_t producer = 0;
+    std::uint64_t sequence = 0;
+    std::array<std::uint8_t, 48> bytes{};
+};
+
+struct SafeQueueAdapter {
+    SafeQueue<Item> queue;
+
+    bool push(const Item& item) {
+        queue.push(item);
+        return true;
+    }
+
+    template <typename Sink>
+    std::size_t drain(Sink&& sink) {
+        std::size_t n = 0;
+        while (auto item = queue.pop()) {
+            sink(*item);
+            ++n;
+        }
+        return n;
+    }
+};
+
+template <typename Queue>
+struct LockFreeAdapter {
+    Queue queue{kCapacity};
+    std::array<Item, kBatch> batch{};
+
+    bool push(const Item& item) { return queue.tryPush(item); }
+
+    template <typename Sink>
+    std::size_t drain(Sink&& sink) {
+        std::size_t n = queue.popAll(batch);
+        for (std::size_t i = 0; i < n; ++i) {
+            sink(batch[i]);
+        }
+        return n;
+    }
+};
+
+/**
+ * @brief Push itemsPerProducer items from each producer, drain on the
+ *        calling thread, return consumer-side throughput in items/second
+ */
+template <typename Adapter>
+double run(std::size_t producers, std::size_t itemsPerProducer) {
+    Adapter adapter;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+
+    for (std::size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&adapter, &go, p, itemsPerProducer]() {
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            Item item{};
+            item.producer = p;
+            for (std::size_t i = 0; i < itemsPerProducer; ++i) {
+                item.sequence = i;
+                while (!adapter.push(item)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    const std::size_t total = producers * itemsPerProducer;
+    std::size_t received = 0;
+    std::uint64_t checksum = 0;
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    while (received < total) {
+        std::size_t n = adapter.drain(
+            [&checksum](const Item& item) { checksum += item.sequence; });
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        received += n;
+    }
+    auto elapsed = Clock::now() - start;
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    const std::uint64_t expected = static_cast<std::uint64_t>(producers) *
+                                   (itemsPerProducer * (itemsPerProducer - 1) /
+                                    2);
+    if (checksum != expected) {
+        std::cerr << "checksum mismatch\n";
+        std::exit(1);
+    }
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    return static_cast<double>(total) / seconds;
+}
+
+void printRow(std::string_view name, double itemsPerSecond) {
+    std::cout << "  " << std::left << std::setw(20) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(10)
+              << itemsPerSecond / 1e6 << " M items/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t items = 2'000'000;
+    std::size_t maxProducers = 4;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if ((arg == "-n" || arg == "--items") && i + 1 < argc) {
+            items = std::strtoull(argv[++i], nullptr, 10);
+        } else if ((arg == "-p" || arg == "--producers") && i + 1 < argc) {
+            maxProducers = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [-n items-per-producer] [-p max-producers]\n";
+            return 1;
+        }
+    }
+    if (items < 2 || maxProducers == 0) {
+        std::cerr << "Need at least 2 items and 1 producer\n";
+        return 1;
+    }
+
+    std::cout << "1 producer / 1 consumer, " << items << " items\n";
+    printRow("SafeQueue", run<SafeQueueAdapter>(1, items));
+    printRow("SpscQueue", run<LockFreeAdapter<rtype::SpscQueue<Item>>>(
+                              1, items));
+    printRow("MpscQueue", run<LockFreeAdapter<rtype::MpscQueue<Item>>>(
+                              1, items));
+
+    for (std::size_t producers = 2; producers <= maxProducers;
+         producers *= 2) {
+        std::cout << "\n"
+                  << producers << " producers / 1 consumer, " << items
+                  << " items each\n";
+        printRow("SafeQueue", run<SafeQueueAdapter>(producers, items));
+        printRow("MpscQueue", run<LockFreeAdapter<rtype::MpscQueue<Item>>>(
+                                  producers, items));
+    }
+    return 0;
+}
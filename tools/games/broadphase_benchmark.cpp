@@ -0,0 +1,205 @@
+/*
+** EPITECH PROJECT, 2026
+** Rtype
+** File description:
+** broadphase_benchmark - Per-tick QuadTree rebuild vs persistent
+** LooseQuadTree vs SweepAndPrune
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "games/rtype/shared/Systems/Collision/LooseQuadTree.hpp"
+#include "games/rtype/shared/Systems/Collision/QuadTree.hpp"
+#include "games/rtype/shared/Systems/Collision/SweepAndPrune.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using rtype::games::rtype::shared::collision::LooseQuadTree;
+using rtype::games::rtype::shared::collision::QuadTree;
+using rtype::games::rtype::shared::collision::QuadTreeObject;
+using rtype::games::rtype::shared::collision::Rect;
+using rtype::games::rtype::shared::collision::SweepAndPrune;
+
+constexpr Rect kWorld{0, 0, 1920, 1080};
+constexpr std::size_t kMaxObjects = 10;
+constexpr std::size_t kMaxDepth = 5;
+
+struct Collider {
+    Rect bounds;
+    float vx = 0;
+    float vy = 0;
+};
+
+/// Shmup-like field: most things scroll left, a fifth of them sit still
+std::vector<Collider> makeField(std::size_t count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> size(8.0F, 64.0F);
+    std::uniform_real_distribution<float> speed(-6.0F, -1.0F);
+    std::uniform_real_distribution<float> drift(-1.0F, 1.0F);
+    std::uniform_real_distribution<float> unit(0.0F, 1.0F);
+
+    std::vector<Collider> field(count);
+    for (auto& c : field) {
+        c.bounds.w = size(rng);
+        c.bounds.h = size(rng);
+        c.bounds.x = unit(rng) * (kWorld.w - c.bounds.w);
+        c.bounds.y = unit(rng) * (kWorld.h - c.bounds.h);
+        if (unit(rng) < 0.8F) {
+            c.vx = speed(rng);
+            c.vy = drift(rng);
+        }
+    }
+    return field;
+}
+
+void step(std::vector<Collider>& field) {
+    for (auto& c : field) {
+        c.bounds.x += c.vx;
+        c.bounds.y = std::clamp(c.bounds.y + c.vy, 0.0F,
+                                kWorld.h - c.bounds.h);
+        if (c.bounds.x < 0) {
+            c.bounds.x = kWorld.w - c.bounds.w;
+        }
+    }
+}
+
+/// What QuadTreeSystem did before: new tree, then query + dedupe per entity
+std::size_t rebuildFrame(const std::vector<Collider>& field) {
+    auto tree = std::make_unique<QuadTree<std::uint32_t>>(kWorld, kMaxObjects,
+                                                          kMaxDepth);
+    for (std::uint32_t i = 0; i < field.size(); ++i) {
+        tree->insert(QuadTreeObject<std::uint32_t>(field[i].bounds, i));
+    }
+
+    std::unordered_set<std::uint64_t> checked;
+    std::size_t pairs = 0;
+    for (std::uint32_t i = 0; i < field.size(); ++i) {
+        std::vector<QuadTreeObject<std::uint32_t>> nearby;
+        tree->query(field[i].bounds, nearby);
+        for (const auto& other : nearby) {
+            if (other.data == i) {
+                continue;
+            }
+            const std::uint64_t key =
+                (static_cast<std::uint64_t>(std::min(i, other.data)) << 32) |
+                std::max(i, other.data);
+            if (checked.insert(key).second) {
+                ++pairs;
+            }
+        }
+    }
+    return pairs;
+}
+
+std::size_t incrementalFrame(LooseQuadTree<std::uint32_t>& tree,
+                             const std::vector<Collider>& field) {
+    for (std::uint32_t i = 0; i < field.size(); ++i) {
+        tree.update(i, field[i].bounds, i);
+    }
+    std::size_t pairs = 0;
+    tree.forEachPair([&pairs](std::uint32_t, std::uint32_t) { ++pairs; });
+    return pairs;
+}
+
+std::size_t sweepFrame(SweepAndPrune<std::uint32_t>& sap,
+                       const std::vector<Collider>& field) {
+    for (std::uint32_t i = 0; i < field.size(); ++i) {
+        sap.update(i, field[i].bounds, i);
+    }
+    sap.sort();
+    std::size_t pairs = 0;
+    sap.forEachPair([&pairs](std::uint32_t, std::uint32_t) { ++pairs; });
+    return pairs;
+}
+
+struct Result {
+    double microsPerFrame = 0;
+    std::size_t pairs = 0;
+};
+
+template <typename Frame>
+Result measure(std::size_t count, std::size_t frames, Frame&& frame) {
+    std::mt19937 rng(1234);
+    auto field = makeField(count, rng);
+    Result result;
+    frame(field);  // Warm-up (and first insertion for the persistent tree)
+
+    auto start = Clock::now();
+    for (std::size_t f = 0; f < frames; ++f) {
+        step(field);
+        result.pairs += frame(field);
+    }
+    auto elapsed = Clock::now() - start;
+    result.microsPerFrame =
+        std::chrono::duration<double, std::micro>(elapsed).count() /
+        static_cast<double>(frames);
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t frames = 200;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if ((arg == "-f" || arg == "--frames") && i + 1 < argc) {
+            frames = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [-f frames]\n";
+            return 1;
+        }
+    }
+    if (frames == 0) {
+        std::cerr << "Need at least 1 frame\n";
+        return 1;
+    }
+
+    std::cout << "Broadphase, " << frames << " frames on a 1920x1080 field\n"
+              << std::setw(10) << "colliders" << std::setw(16)
+              << "rebuild us/f" << std::setw(16) << "loose us/f"
+              << std::setw(16) << "sweep us/f" << std::setw(10) << "speedup"
+              << "\n";
+
+    for (std::size_t count : {500, 2000, 10000}) {
+        const Result rebuild = measure(count, frames, rebuildFrame);
+
+        LooseQuadTree<std::uint32_t> tree(kWorld, kMaxObjects, kMaxDepth);
+        const Result loose =
+            measure(count, frames, [&tree](const std::vector<Collider>& f) {
+                return incrementalFrame(tree, f);
+            });
+
+        SweepAndPrune<std::uint32_t> sap;
+        const Result sweep =
+            measure(count, frames, [&sap](const std::vector<Collider>& f) {
+                return sweepFrame(sap, f);
+            });
+
+        if (rebuild.pairs != loose.pairs || rebuild.pairs != sweep.pairs) {
+            std::cerr << "pair count mismatch at " << count << ": "
+                      << rebuild.pairs << " vs " << loose.pairs << " vs "
+                      << sweep.pairs << "\n";
+            return 1;
+        }
+        const double best =
+            std::min(loose.microsPerFrame, sweep.microsPerFrame);
+        std::cout << std::setw(10) << count << std::fixed
+                  << std::setprecision(1) << std::setw(16)
+                  << rebuild.microsPerFrame << std::setw(16)
+                  << loose.microsPerFrame << std::setw(16)
+                  << sweep.microsPerFrame << std::setw(9)
+                  << std::setprecision(2) << rebuild.microsPerFrame / best
+                  << "x\n";
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** PcapReader - Implementation
+*/
+
+#include "PcapReader.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <utility>
+
+#include "compression/Compressor.hpp"
+#include "protocol/ByteOrderSpec.hpp"
+#include "protocol/Header.hpp"
+
+namespace rtype::tools {
+
+namespace {
+
+constexpr std::uint32_t kPcapMagicMicro = 0xA1B2C3D4;
+constexpr std::uint32_t kPcapMagicNano = 0xA1B23C4D;
+constexpr std::size_t kGlobalHeaderSize = 24;
+constexpr std::size_t kRecordHeaderSize = 16;
+
+constexpr std::uint32_t kLinkNull = 0;
+constexpr std::uint32_t kLinkEthernet = 1;
+constexpr std::uint32_t kLinkRaw = 101;
+constexpr std::uint32_t kLinkLinuxSll = 113;
+constexpr std::uint32_t kLinkIpv4 = 228;
+
+constexpr std::uint16_t kEtherTypeIpv4 = 0x0800;
+constexpr std::uint16_t kEtherTypeVlan = 0x8100;
+constexpr std::uint8_t kIpProtoUdp = 17;
+constexpr std::size_t kUdpHeaderSize = 8;
+
+[[nodiscard]] std::uint32_t readU32(const std::uint8_t* p, bool swap) {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    if (!swap) {
+        return v;
+    }
+    return (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) |
+           (v << 24);
+}
+
+[[nodiscard]] std::uint16_t readBe16(const std::uint8_t* p) {
+    return static_cast<std::uint16_t>((p[0] << 8) | p[1]);
+}
+
+/// Offset of the IPv4 header inside a link-layer frame, nullopt if not IPv4
+[[nodiscard]] std::optional<std::size_t> ipv4Offset(
+    std::span<const std::uint8_t> frame, std::uint32_t linkType) {
+    switch (linkType) {
+        case kLinkNull:
+            return frame.size() >= 4 ? std::optional<std::size_t>(4)
+                                     : std::nullopt;
+        case kLinkRaw:
+        case kLinkIpv4:
+            return 0;
+        case kLinkLinuxSll:
+            if (frame.size() < 16 || readBe16(&frame[14]) != kEtherTypeIpv4) {
+                return std::nullopt;
+            }
+            return 16;
+        case kLinkEthernet: {
+            std::size_t offset = 12;
+            while (offset + 2 <= frame.size() &&
+                   readBe16(&frame[offset]) == kEtherTypeVlan) {
+                offset += 4;
+            }
+            if (offset + 2 > frame.size() ||
+                readBe16(&frame[offset]) != kEtherTypeIpv4) {
+                return std::nullopt;
+            }
+            return offset + 2;
+        }
+        default:
+            return std::nullopt;
+    }
+}
+
+/// UDP payload of an IPv4 packet sent to or from port
+[[nodiscard]] std::optional<std::span<const std::uint8_t>> udpPayload(
+    std::span<const std::uint8_t> ip, std::uint16_t port) {
+    if (ip.size() < 20 || (ip[0] >> 4) != 4 || ip[9] != kIpProtoUdp) {
+        return std::nullopt;
+    }
+    std::size_t ihl = static_cast<std::size_t>(ip[0] & 0x0F) * 4;
+    std::uint16_t fragment = readBe16(&ip[6]);
+    if ((fragment & 0x3FFF) != 0 || ip.size() < ihl + kUdpHeaderSize) {
+        return std::nullopt;
+    }
+    auto udp = ip.subspan(ihl);
+    std::uint16_t srcPort = readBe16(&udp[0]);
+    std::uint16_t dstPort = readBe16(&udp[2]);
+    std::uint16_t length = readBe16(&udp[4]);
+    if (port != 0 && srcPort != port && dstPort != port) {
+        return std::nullopt;
+    }
+    if (length < kUdpHeaderSize || length > udp.size()) {
+        return std::nullopt;
+    }
+    return udp.subspan(kUdpHeaderSize, length - kUdpHeaderSize);
+}
+
+}  // namespace
+
+std::optional<std::vector<RtgpSample>> readRtgpCapture(
+    const std::string& path, std::uint16_t port) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    std::uint8_t global[kGlobalHeaderSize];
+    if (!file.read(reinterpret_cast<char*>(global), sizeof(global))) {
+        return std::nullopt;
+    }
+    std::uint32_t magic = readU32(global, false);
+    bool swap = false;
+    if (magic != kPcapMagicMicro && magic != kPcapMagicNano) {
+        magic = readU32(global, true);
+        if (magic != kPcapMagicMicro && magic != kPcapMagicNano) {
+            return std::nullopt;
+        }
+        swap = true;
+    }
+    std::uint32_t linkType = readU32(global + 20, swap) & 0x0FFFFFFF;
+
+    network::Compressor compressor;
+    std::vector<RtgpSample> samples;
+    std::uint8_t record[kRecordHeaderSize];
+    network::Buffer frame;
+    while (file.read(reinterpret_cast<char*>(record), sizeof(record))) {
+        std::uint32_t capturedLength = readU32(record + 8, swap);
+        if (capturedLength > 0x40000) {
+            return std::nullopt;
+        }
+        frame.resize(capturedLength);
+        if (!file.read(reinterpret_cast<char*>(frame.data()),
+                       static_cast<std::streamsize>(capturedLength))) {
+            break;
+        }
+
+        auto offset = ipv4Offset(frame, linkType);
+        if (!offset || *offset > frame.size()) {
+            continue;
+        }
+        auto datagram = udpPayload(
+            std::span<const std::uint8_t>(frame).subspan(*offset), port);
+        if (!datagram || datagram->size() < network::kHeaderSize) {
+            continue;
+        }
+
+        network::Header header;
+        std::memcpy(&header, datagram->data(), network::kHeaderSize);
+        std::uint16_t payloadSize =
+            network::ByteOrderSpec::fromNetwork(header.payloadSize);
+        if (header.magic != network::kMagicByte || payloadSize == 0 ||
+            network::kHeaderSize + payloadSize > datagram->size() ||
+            (header.flags & network::Flags::kDictCompressed)) {
+            continue;
+        }
+
+        auto payload = datagram->subspan(network::kHeaderSize, payloadSize);
+        network::Buffer bytes(payload.begin(), payload.end());
+        if (header.flags & network::Flags::kCompressed) {
+            auto decompressed = compressor.decompress(bytes);
+            if (!decompressed) {
+                continue;
+            }
+            bytes = std::move(decompressed.value());
+        }
+        samples.push_back({header.opcode, std::move(bytes)});
+    }
+    return samples;
+}
+
+}  // namespace rtype::tools
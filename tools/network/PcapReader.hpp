@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** PcapReader - Extracts RTGP payloads from pcap captures
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/Types.hpp"
+
+namespace rtype::tools {
+
+/**
+ * @brief Uncompressed RTGP payload found in a capture
+ */
+struct RtgpSample {
+    std::uint8_t opcode;
+    network::Buffer payload;
+};
+
+/**
+ * @brief Read every RTGP payload sent to or from a UDP port
+ *
+ * Supports classic pcap files (micro or nanosecond, either byte order) with
+ * link types NULL/loopback (0), Ethernet (1, with 802.1Q tags), raw IP
+ * (101, 228) and Linux cooked capture (113). Only IPv4 is decoded;
+ * fragments are skipped. Frame-compressed payloads are decompressed,
+ * dictionary-compressed ones are skipped since the dictionary is what is
+ * being trained.
+ *
+ * @param path Path to the .pcap file
+ * @param port UDP port of the server, 0 to accept any port
+ * @return Samples in capture order, nullopt if the file is unreadable
+ */
+[[nodiscard]] std::optional<std::vector<RtgpSample>> readRtgpCapture(
+    const std::string& path, std::uint16_t port);
+
+}  // namespace rtype::tools
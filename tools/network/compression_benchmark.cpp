@@ -0,0 +1,253 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** compression_benchmark - Frame vs dictionary LZ4 on RTGP payloads
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PcapReader.hpp"
+#include "compression/Compressor.hpp"
+#include "compression/DictionarySet.hpp"
+#include "compression/DictionaryTrainer.hpp"
+#include "protocol/OpCode.hpp"
+#include "protocol/Payloads.hpp"
+
+namespace {
+
+using rtype::network::Buffer;
+using rtype::network::OpCode;
+using rtype::tools::RtgpSample;
+using Clock = std::chrono::steady_clock;
+
+constexpr int kRepetitions = 20;
+
+void appendBe(Buffer& out, std::uint32_t value, int bytes) {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+/// Gameplay-like traffic when no capture is given
+std::vector<RtgpSample> syntheticSamples(std::size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> coord(0, 1920 * 16);
+    std::uniform_int_distribution<int> velocity(-64, 64);
+    std::uniform_int_distribution<int> entities(1, 40);
+    std::uint32_t nextId = 100;
+
+    std::vector<RtgpSample> samples;
+    samples.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        RtgpSample sample{};
+        switch (i % 4) {
+            case 0: {
+                sample.opcode = static_cast<std::uint8_t>(OpCode::S_ENTITY_SPAWN);
+                appendBe(sample.payload, nextId++, 4);
+                appendBe(sample.payload, 2, 1);
+                appendBe(sample.payload, 1, 1);
+                appendBe(sample.payload, 0x44F00000, 4);
+                appendBe(sample.payload, static_cast<std::uint32_t>(coord(rng)),
+                         4);
+                break;
+            }
+            case 1: {
+                sample.opcode = static_cast<std::uint8_t>(OpCode::S_ENTITY_HEALTH);
+                appendBe(sample.payload, nextId - 3, 4);
+                appendBe(sample.payload, 1, 4);
+                appendBe(sample.payload, 3, 4);
+                break;
+            }
+            default: {
+                sample.opcode =
+                    static_cast<std::uint8_t>(OpCode::S_ENTITY_MOVE_BATCH);
+                int n = entities(rng);
+                appendBe(sample.payload, static_cast<std::uint32_t>(n), 1);
+                appendBe(sample.payload, static_cast<std::uint32_t>(i), 4);
+                for (int e = 0; e < n; ++e) {
+                    appendBe(sample.payload, 100 + static_cast<std::uint32_t>(e),
+                             4);
+                    appendBe(sample.payload,
+                             static_cast<std::uint32_t>(coord(rng)), 2);
+                    appendBe(sample.payload,
+                             static_cast<std::uint32_t>(coord(rng)), 2);
+                    appendBe(sample.payload,
+                             static_cast<std::uint32_t>(velocity(rng)), 2);
+                    appendBe(sample.payload, 0, 2);
+                }
+                break;
+            }
+        }
+        samples.push_back(std::move(sample));
+    }
+    return samples;
+}
+
+struct Measurement {
+    std::size_t inputBytes = 0;
+    std::size_t outputBytes = 0;
+    std::size_t compressedPackets = 0;
+    double compressNs = 0.0;
+    double decompressNs = 0.0;
+};
+
+Measurement measure(const rtype::network::Compressor& compressor,
+                    const std::vector<RtgpSample>& samples,
+                    bool useDictionary) {
+    Measurement m;
+    std::vector<rtype::network::CompressionResult> results(samples.size());
+
+    auto start = Clock::now();
+    for (int rep = 0; rep < kRepetitions; ++rep) {
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            auto opcode = static_cast<OpCode>(samples[i].opcode);
+            results[i] =
+                compressor.compress(samples[i].payload, opcode, useDictionary);
+        }
+    }
+    auto compressTime = Clock::now() - start;
+
+    start = Clock::now();
+    std::size_t checksum = 0;
+    for (int rep = 0; rep < kRepetitions; ++rep) {
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            const auto& result = results[i];
+            if (!result.wasCompressed) {
+                continue;
+            }
+            auto opcode = static_cast<OpCode>(samples[i].opcode);
+            auto decoded = result.usedDictionary
+                               ? compressor.decompressWithDictionary(
+                                     result.data, opcode)
+                               : compressor.decompress(result.data);
+            checksum += decoded ? decoded.value().size() : 0;
+        }
+    }
+    auto decompressTime = Clock::now() - start;
+
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        m.inputBytes += samples[i].payload.size();
+        m.outputBytes += results[i].data.size();
+        m.compressedPackets += results[i].wasCompressed ? 1 : 0;
+    }
+    double packets = static_cast<double>(samples.size() * kRepetitions);
+    m.compressNs =
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(compressTime)
+                .count()) /
+        packets;
+    m.decompressNs =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                decompressTime)
+                                .count()) /
+        packets;
+    if (checksum == 0 && m.compressedPackets > 0) {
+        std::cerr << "warning: decompression produced no data\n";
+    }
+    return m;
+}
+
+void printRow(std::string_view name, const Measurement& m,
+              std::size_t packets) {
+    double ratio = m.inputBytes == 0 ? 1.0
+                                     : static_cast<double>(m.outputBytes) /
+                                           static_cast<double>(m.inputBytes);
+    std::cout << "  " << std::left << std::setw(12) << name << std::right
+              << std::fixed << std::setprecision(3) << std::setw(8) << ratio
+              << std::setw(10) << m.compressedPackets << "/" << std::left
+              << std::setw(8) << packets << std::right << std::setprecision(1)
+              << std::setw(12) << m.compressNs << std::setw(14)
+              << m.decompressNs << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string dictPath;
+    std::vector<std::string> captures;
+    unsigned long port = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if ((arg == "-d" || arg == "--dict") && i + 1 < argc) {
+            dictPath = argv[++i];
+        } else if ((arg == "-p" || arg == "--port") && i + 1 < argc) {
+            port = std::strtoul(argv[++i], nullptr, 10);
+        } else if (!arg.empty() && arg[0] != '-') {
+            captures.emplace_back(arg);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [-d dict] [-p port] [capture.pcap...]\n"
+                         "Without a capture, synthetic gameplay payloads "
+                         "are used.\nWithout a dictionary, one is trained on "
+                         "the first half of the samples.\n";
+            return 1;
+        }
+    }
+
+    std::vector<RtgpSample> samples;
+    for (const auto& path : captures) {
+        auto loaded = rtype::tools::readRtgpCapture(
+            path, static_cast<std::uint16_t>(port));
+        if (!loaded) {
+            std::cerr << "Cannot read capture " << path << "\n";
+            return 1;
+        }
+        samples.insert(samples.end(), loaded->begin(), loaded->end());
+    }
+    if (captures.empty()) {
+        samples = syntheticSamples(20000);
+    }
+    if (samples.empty()) {
+        std::cerr << "No RTGP payloads found\n";
+        return 1;
+    }
+
+    std::shared_ptr<const rtype::network::DictionarySet> dictionaries;
+    std::vector<RtgpSample> evaluation = samples;
+    if (!dictPath.empty()) {
+        auto loaded = rtype::network::DictionarySet::loadFromFile(dictPath);
+        if (!loaded) {
+            std::cerr << "Cannot load dictionary set " << dictPath << "\n";
+            return 1;
+        }
+        dictionaries = std::make_shared<const rtype::network::DictionarySet>(
+            std::move(loaded.value()));
+    } else {
+        // Train and evaluate on disjoint halves
+        rtype::network::DictionaryTrainer trainer;
+        std::size_t half = samples.size() / 2;
+        for (std::size_t i = 0; i < half; ++i) {
+            trainer.addSample(samples[i].opcode, samples[i].payload);
+        }
+        dictionaries = std::make_shared<const rtype::network::DictionarySet>(
+            trainer.train());
+        evaluation.assign(samples.begin() + static_cast<std::ptrdiff_t>(half),
+                          samples.end());
+    }
+
+    rtype::network::Compressor frame;
+    rtype::network::Compressor::Config config;
+    config.dictionaries = dictionaries;
+    rtype::network::Compressor dictionary(config);
+
+    std::cout << evaluation.size() << " payloads, " << dictionaries->size()
+              << " dictionaries (id 0x" << std::hex << dictionaries->id()
+              << std::dec << ")\n\n"
+              << "  mode           ratio  compressed     ns/pkt comp  ns/pkt "
+                 "decomp\n";
+    printRow("frame", measure(frame, evaluation, false), evaluation.size());
+    printRow("dictionary", measure(dictionary, evaluation, true),
+             evaluation.size());
+    return 0;
+}
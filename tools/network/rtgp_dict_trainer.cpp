@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** Rtype
+** File description:
+** rtgp_dict_trainer - Trains LZ4 dictionaries from RTGP captures
+*/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PcapReader.hpp"
+#include "compression/DictionaryTrainer.hpp"
+#include "protocol/OpCode.hpp"
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr
+        << "Usage: " << program
+        << " [options] -o <output.dict> <capture.pcap>...\n"
+           "  -o, --output <path>      Dictionary set to write\n"
+           "  -p, --port <port>        Server UDP port (default: any)\n"
+           "  -s, --size <bytes>       Size of each dictionary (default: "
+           "4096)\n"
+           "  -m, --min-samples <n>    Samples needed for a per-opcode "
+           "dictionary (default: 32)\n"
+           "\n"
+           "Record traffic with e.g. `tcpdump -i lo -w game.pcap udp port "
+           "4242`,\nthen load the result with `r-type_server "
+           "--compression-dict` and copy it\nto config/client/rtgp.dict.\n";
+}
+
+[[nodiscard]] bool parseNumber(std::string_view text, unsigned long& out) {
+    char* end = nullptr;
+    std::string copy(text);
+    out = std::strtoul(copy.c_str(), &end, 10);
+    return end != nullptr && *end == '\0' && !copy.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string output;
+    std::vector<std::string> captures;
+    unsigned long port = 0;
+    rtype::network::DictionaryTrainer::Config config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        unsigned long number = 0;
+        if ((arg == "-o" || arg == "--output") && hasValue) {
+            output = argv[++i];
+        } else if ((arg == "-p" || arg == "--port") && hasValue &&
+                   parseNumber(argv[++i], number) && number <= 0xFFFF) {
+            port = number;
+        } else if ((arg == "-s" || arg == "--size") && hasValue &&
+                   parseNumber(argv[++i], number) && number > 0) {
+            config.dictionarySize = number;
+        } else if ((arg == "-m" || arg == "--min-samples") && hasValue &&
+                   parseNumber(argv[++i], number)) {
+            config.minSamples = number;
+        } else if (!arg.empty() && arg[0] != '-') {
+            captures.emplace_back(arg);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (output.empty() || captures.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    rtype::network::DictionaryTrainer trainer(config);
+    for (const auto& path : captures) {
+        auto samples = rtype::tools::readRtgpCapture(
+            path, static_cast<std::uint16_t>(port));
+        if (!samples) {
+            std::cerr << "Cannot read capture " << path << "\n";
+            return 1;
+        }
+        for (const auto& sample : *samples) {
+            trainer.addSample(sample.opcode, sample.payload);
+        }
+        std::cout << path << ": " << samples->size() << " RTGP payloads\n";
+    }
+    if (trainer.sampleCount() == 0) {
+        std::cerr << "No RTGP payloads found\n";
+        return 1;
+    }
+
+    auto set = trainer.train();
+    std::cout << "\n  opcode                     samples  dictionary\n";
+    for (unsigned raw = 1; raw < 256; ++raw) {
+        auto opcode = static_cast<std::uint8_t>(raw);
+        std::size_t count = trainer.sampleCount(opcode);
+        if (count == 0) {
+            continue;
+        }
+        auto op = static_cast<rtype::network::OpCode>(opcode);
+        const auto* dict = set.find(op);
+        std::cout << "  " << std::left << std::setw(26)
+                  << rtype::network::toString(op) << std::right
+                  << std::setw(8) << count << std::setw(12)
+                  << (count >= config.minSamples && dict ? dict->size() : 0)
+                  << (count >= config.minSamples ? "" : "  (fallback)")
+                  << "\n";
+    }
+
+    auto saved = set.saveToFile(output);
+    if (saved.isErr()) {
+        std::cerr << "Cannot write " << output << "\n";
+        return 1;
+    }
+    std::cout << "\nWrote " << set.size() << " dictionaries to " << output
+              << " (id 0x" << std::hex << set.id() << std::dec << ")\n";
+    return 0;
+}